@@ -173,7 +173,45 @@ standard names. */
 /* USER CODE BEGIN Defines */
 /* Section where parameter definitions can be added (for instance, to override default ones in FreeRTOS.h) */
 #define traceTASK_SWITCHED_OUT() xTaskCallApplicationTaskHook( pxCurrentTCB, (void*)1 )
-#define traceTASK_SWITCHED_IN() xTaskCallApplicationTaskHook( pxCurrentTCB, (void*)0 )
+
+/* Run time statistics of the system monitor (sys_mon.h), clocked by the DWT
+   cycle counter plus the cycles it missed in Sleep (idle_sleep_cycles, which
+   idle_sleep.h cannot provide here). Each task gets a slot of
+   sys_mon_switches in its task number (vTaskSetTaskNumber), 0 for the tasks
+   without one. */
+#define SYS_MON_SLOTS                            32
+#if defined(__ICCARM__) || defined(__CC_ARM) || defined(__ARMCC_VERSION) || defined(__GNUC__)
+extern volatile uint32_t sys_mon_switches[SYS_MON_SLOTS];
+extern volatile uint32_t idle_sleep_slept_cycles;
+void sys_mon_timer_init(void);
+#endif
+#define configGENERATE_RUN_TIME_STATS            1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() sys_mon_timer_init()
+#define portGET_RUN_TIME_COUNTER_VALUE()         ( ( *( volatile uint32_t * ) 0xE0001004UL ) + idle_sleep_slept_cycles )
+#define traceTASK_SWITCHED_IN() do { \
+    sys_mon_switches[ pxCurrentTCB->uxTaskNumber & ( SYS_MON_SLOTS - 1 ) ]++; \
+    xTaskCallApplicationTaskHook( pxCurrentTCB, (void*)0 ); \
+  } while( 0 )
+
+/* Tickless idle with the SysTick of the port (idle_sleep.h): the sleeps end
+   before the predicted audio DMA and LTDC line interrupts, and the TIM6 HAL
+   tick is stopped and corrected around them. */
+#define configUSE_TICKLESS_IDLE                  1
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP    2
+#if defined(__ICCARM__) || defined(__CC_ARM) || defined(__ARMCC_VERSION) || defined(__GNUC__)
+void idle_sleep_pre_suppress(uint32_t *ticks);
+void idle_sleep_pre(uint32_t *ticks);
+void idle_sleep_post(uint32_t ticks);
+#endif
+#define configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( x ) idle_sleep_pre_suppress( &( x ) )
+#define configPRE_SLEEP_PROCESSING( x )          idle_sleep_pre( &( x ) )
+#define configPOST_SLEEP_PROCESSING( x )         idle_sleep_post( x )
+
+/* Heap: tlsf_heap.c replaces heap_4 (USE_FreeRTOS_HEAP_4 above). heap_4.c is
+   still generated into the project, the linker redirects pvPortMalloc,
+   vPortFree and the heap statistics to tlsf_heap.c (-Wl,--wrap) and ucHeap,
+   the internal arena, is defined there. */
+#define configAPPLICATION_ALLOCATED_HEAP         1
 /* USER CODE END Defines */
 
 #endif /* __FREERTOS_CONFIG_H */
@@ -1,3 +1,27 @@
+/*
+ * audio_drv.h
+ *
+ * SAI output of the sine generator or the MP3 stream.
+ *
+ * Scheduling (priorities set in main.c and the .ioc):
+ * - audioTaskHandle, osPriorityRealtime: refills the DMA buffers. The SAI
+ *   DMA interrupts only restart the transfer (normal DMA mode), stamp the
+ *   time and set a thread flag; the decode runs in audio_drv_process, above
+ *   the other application tasks
+ * - i2c_bus (High), media_pf and sys_mon (AboveNormal): short work that the
+ *   audio task may wait for
+ * - TouchGFXTask, osPriorityNormal: rendering, uses the rest of the CPU
+ * - defaultTask, osPriorityBelowNormal: housekeeping, the periodic statistics
+ *   reports over printf
+ *
+ * Deadline monitoring: a refill has to be done before the DMA reaches the
+ * buffer again, one half of the circular buffer or one chunk (normal mode)
+ * after the interrupt that asked for it. audio_drv_stats counts the refills
+ * that took longer (misses), the transfers that found no decoded chunk
+ * (underruns, normal mode) and the requests made while the previous one of
+ * the same buffer was still pending (overruns), so a priority inversion
+ * shows up in a counter before it is heard.
+ */
 #ifndef __AUDIO_DRV_H
 #define __AUDIO_DRV_H
 
@@ -6,7 +30,29 @@
 #include "task.h"
 #include "semphr.h"
 
+/* Period of the deadline statistics printed by the housekeeping task, 0 to disable */
+#ifndef AUDIO_DRV_REPORT_MS
+#define AUDIO_DRV_REPORT_MS         0
+#endif
 
+/* Thread flags of the audio task set by the SAI DMA interrupts */
+#define AUDIO_DRV_FLAG_HALF         (0x0100U)
+#define AUDIO_DRV_FLAG_FULL         (0x0200U)
+
+typedef struct
+{
+	uint32_t refills;
+	uint32_t misses;                /* Refills done after their deadline */
+	uint32_t underruns;             /* Normal DMA: no decoded chunk at the transfer end */
+	uint32_t overruns;              /* Requests while the same buffer was still pending */
+	uint32_t deadline_cycles;       /* Half buffer or chunk duration */
+	uint32_t latency_max_cycles;    /* Interrupt to audio task wakeup */
+	uint32_t refill_max_cycles;     /* Interrupt to refill done */
+	uint32_t start_tick;            /* HAL tick at the last reset */
+} audio_drv_stats_t;
+
+/* Statistics since the last audio_drv_stats_reset, readable from the debugger */
+extern volatile audio_drv_stats_t audio_drv_stats;
 
 typedef enum
 {
@@ -55,7 +101,19 @@ typedef struct
 } audio_drv_t;
 
 
+/* The calling task becomes the refill task: call audio_drv_process from it */
 int audio_drv_init(audio_drv_t *self);
 int audio_drv_start_dma(audio_drv_t* self);
 void audio_drv_update_frequency(audio_drv_t* self, float frequency);
+
+/**
+ * @brief Wait for a DMA interrupt and refill the buffer it released
+ * @param self Driver started with audio_drv_start_dma
+ * @param timeout Longest wait in kernel ticks, osWaitForever to block
+ * @return 0 after a refill, -1 on timeout
+ */
+int audio_drv_process(audio_drv_t *self, uint32_t timeout);
+
+void audio_drv_stats_reset(void);
+void audio_drv_stats_print(void);
 #endif /* __AUDIO_DRV_H */
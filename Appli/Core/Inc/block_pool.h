@@ -0,0 +1,180 @@
+/*
+ * block_pool.h
+ *
+ * Fixed-block memory pools: N blocks of S bytes reserved at link time in a
+ * chosen memory region, handed out and returned in constant time.
+ *
+ * A pool is defined once with BLOCK_POOL_DEFINE(name, size, count, region,
+ * dma), in a C or C++ file:
+ * - region is DTCM (zero wait state, CPU only), AXI (internal SRAM) or PSRAM
+ *   (external RAM), each mapped to its own linker section
+ * - dma set to 1 checks at compile time that the region is reachable by the
+ *   DMA masters and that the blocks are whole cache lines, so a cache clean
+ *   or invalidate of a block never touches its neighbours
+ *
+ * block_pool_alloc and block_pool_free are lock-free (tagged free list
+ * updated with LDREX/STREX), callable from tasks and interrupts alike. Blocks
+ * are not cleared. A bitmap of the blocks handed out rejects double frees.
+ * Each pool counts its blocks in use, high water mark, allocations and
+ * failures; pools register themselves on their first allocation for
+ * block_pool_print.
+ *
+ * C++ code uses the typed wrapper BlockPool<T, name##_BLOCK_SIZE>.
+ */
+#ifndef __BLOCK_POOL_H
+#define __BLOCK_POOL_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Return codes */
+#define BLOCK_POOL_OK               0
+#define BLOCK_POOL_INVALID_PARAM   -1
+#define BLOCK_POOL_NOT_ALLOCATED   -2
+
+#define BLOCK_POOL_CACHE_LINE       32U
+
+/* Pools listed by block_pool_print */
+#ifndef BLOCK_POOL_MAX
+#define BLOCK_POOL_MAX              8
+#endif
+
+/* Period of the statistics printed by the housekeeping task, 0 to disable */
+#ifndef BLOCK_POOL_REPORT_MS
+#define BLOCK_POOL_REPORT_MS        0
+#endif
+
+/* Linker sections of the regions */
+#define BLOCK_POOL_SECTION_DTCM     "PoolDtcmSection"
+#define BLOCK_POOL_SECTION_AXI      ".bss.block_pool"
+#define BLOCK_POOL_SECTION_PSRAM    "PoolPsramSection"
+
+/* Regions the DMA masters (HPDMA, GPDMA, DMA2D, JPEG) can reach */
+#define BLOCK_POOL_DMA_DTCM         0
+#define BLOCK_POOL_DMA_AXI          1
+#define BLOCK_POOL_DMA_PSRAM        1
+
+#define BLOCK_POOL_NONE             0xFFFFU
+
+/* Distance between two blocks: the size rounded up to 8 bytes */
+#define BLOCK_POOL_STRIDE(size)     ((((size) < 4U ? 4U : (size)) + 7U) & ~7U)
+
+#ifdef __cplusplus
+#define BLOCK_POOL_STATIC_ASSERT(cond, msg) static_assert(cond, msg)
+#else
+#define BLOCK_POOL_STATIC_ASSERT(cond, msg) _Static_assert(cond, msg)
+#endif
+
+typedef struct
+{
+	const char *name;
+	uint8_t *base;
+	uint32_t block_size;            /* Stride between blocks */
+	uint32_t count;
+	volatile uint32_t *allocated;   /* Bit n set while block n is handed out */
+	volatile uint32_t head;         /* Free list: tag << 16 | first block */
+	volatile uint32_t fresh;        /* Blocks never handed out start here */
+	volatile uint32_t used;
+	volatile uint32_t used_max;
+	volatile uint32_t allocs;
+	volatile uint32_t failures;
+	volatile uint32_t registered;
+} block_pool_t;
+
+/**
+ * @brief Reserve a pool of count blocks of size bytes in a region
+ * @param name Pool variable (block_pool_t), also name##_BLOCK_SIZE
+ * @param region DTCM, AXI or PSRAM
+ * @param dma 1 if the blocks are DMA buffers
+ */
+#define BLOCK_POOL_DEFINE(name, size, count, region, dma) \
+	BLOCK_POOL_STATIC_ASSERT((count) > 0 && (count) < BLOCK_POOL_NONE, \
+			#name ": block count out of range"); \
+	BLOCK_POOL_STATIC_ASSERT(!(dma) || BLOCK_POOL_DMA_##region, \
+			#name ": region not reachable by DMA"); \
+	BLOCK_POOL_STATIC_ASSERT(!(dma) || ((size) % BLOCK_POOL_CACHE_LINE) == 0U, \
+			#name ": DMA blocks must be whole cache lines"); \
+	static uint8_t name##_storage[(count) * BLOCK_POOL_STRIDE(size)] \
+		__attribute__((section(BLOCK_POOL_SECTION_##region), aligned(BLOCK_POOL_CACHE_LINE))); \
+	static volatile uint32_t name##_allocated[((count) + 31U) / 32U]; \
+	block_pool_t name = { #name, name##_storage, BLOCK_POOL_STRIDE(size), (count), \
+			name##_allocated, BLOCK_POOL_NONE, 0, 0, 0, 0, 0, 0 }
+
+/**
+ * @brief Declare a pool defined in another file
+ */
+#define BLOCK_POOL_DECLARE(name, size) \
+	enum { name##_BLOCK_SIZE = BLOCK_POOL_STRIDE(size) }; \
+	extern block_pool_t name
+
+/**
+ * @brief Take a block
+ * @return Block aligned to 8 bytes (cache line for DMA pools), NULL when
+ *         the pool is exhausted
+ */
+void *block_pool_alloc(block_pool_t *pool);
+
+/**
+ * @brief Return a block, NULL is ignored
+ * @return BLOCK_POOL_OK, BLOCK_POOL_INVALID_PARAM for a pointer that is not
+ *         a block of the pool, BLOCK_POOL_NOT_ALLOCATED for a block already
+ *         free (double free, the pool is left unchanged)
+ */
+int block_pool_free(block_pool_t *pool, void *block);
+
+/**
+ * @brief Clear the counters, the high water marks restart from the current use
+ */
+void block_pool_reset(void);
+
+/**
+ * @brief Print the statistics of the registered pools over printf
+ */
+void block_pool_print(void);
+
+#ifdef __cplusplus
+}
+
+#include <new>
+
+/**
+ * Typed view of a pool: objects of T constructed in its blocks.
+ * BlockSize is the name##_BLOCK_SIZE of the pool, it checks at compile time
+ * that T fits a block.
+ */
+template <typename T, uint32_t BlockSize>
+class BlockPool
+{
+public:
+    explicit BlockPool(block_pool_t& p)
+        : pool(p)
+    {
+        static_assert(sizeof(T) <= BlockSize, "type larger than the pool blocks");
+        static_assert(alignof(T) <= 8, "type alignment larger than the pool blocks");
+    }
+
+    /* Default initialized object, 0 when the pool is exhausted */
+    T* alloc()
+    {
+        void* const p = block_pool_alloc(&pool);
+        return p ? new (p) T : 0;
+    }
+
+    void free(T* object)
+    {
+        if (object)
+        {
+            object->~T();
+            block_pool_free(&pool, object);
+        }
+    }
+
+private:
+    block_pool_t& pool;
+};
+#endif /* __cplusplus */
+
+#endif /* __BLOCK_POOL_H */
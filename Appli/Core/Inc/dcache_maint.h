@@ -0,0 +1,123 @@
+/*
+ * dcache_maint.h
+ *
+ * Range based D-cache maintenance for the GPU2D/DMA2D hand-offs.
+ *
+ * The generated TouchGFX HAL cleans and invalidates the whole D-cache every
+ * time the CPU hands the framebuffer to GPU2D/DMA2D and back. The cache is
+ * then refilled by whoever runs next, in practice the MP3 decoder of the
+ * audio task, woken by the SAI DMA interrupts.
+ *
+ * With this layout the framebuffers (GFXMMU virtual buffers at 0x25000000,
+ * physical buffers at 0x90000000) and the animation storage are all mapped
+ * non-cacheable by the MPU, so the CPU writes reach the memory directly and
+ * there is nothing to maintain for them. The HAL marks every area the CPU has
+ * drawn into (dcache_maint_mark), only the cacheable part of it is kept, and
+ * the hand-off cleans/invalidates that range alone. When the pending range is
+ * larger than the cache, one full operation is cheaper than the by-address
+ * loop and is used instead.
+ *
+ * The same module keeps the numbers needed to compare both strategies:
+ * maintenance cycles, frame time and the duration of the MP3 decode calls
+ * made by the audio task (their spread is the decode jitter).
+ */
+#ifndef __DCACHE_MAINT_H
+#define __DCACHE_MAINT_H
+
+#include "main.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Set to 1 to get the generated behavior back (full clean/invalidate) */
+#ifndef DCACHE_MAINT_FULL
+#define DCACHE_MAINT_FULL           0
+#endif
+
+/* Period of the statistics printed by the housekeeping task, 0 to disable */
+#ifndef DCACHE_MAINT_REPORT_MS
+#define DCACHE_MAINT_REPORT_MS      0
+#endif
+
+#define DCACHE_MAINT_LINE_SIZE      (32U)
+#define DCACHE_MAINT_CACHE_SIZE     (32U * 1024U)   /* Cortex-M7 D-cache of the H7S7 */
+
+typedef struct
+{
+	uint32_t clean_calls;           /* FlushCache hand-offs */
+	uint32_t invalidate_calls;      /* InvalidateCache hand-offs */
+	uint32_t range_ops;             /* Served with a by-address operation */
+	uint32_t full_ops;              /* Served with a full cache operation */
+	uint32_t skipped_bytes;         /* Marked bytes in non-cacheable memory */
+	uint32_t cached_targets;        /* Cacheable render targets, forces full ops */
+	uint64_t maint_cycles;          /* Cycles spent in cache maintenance */
+	uint32_t maint_cycles_max;      /* Longest single hand-off */
+	uint32_t frames;
+	uint64_t frame_cycles;          /* Sum of the frame times */
+	uint32_t frame_cycles_max;
+	uint32_t decode_calls;
+	uint64_t decode_cycles;         /* Sum of the decode call durations */
+	uint32_t decode_cycles_min;
+	uint32_t decode_cycles_max;
+} dcache_maint_stats_t;
+
+/* Statistics since the last dcache_maint_reset, readable from the debugger */
+extern volatile dcache_maint_stats_t dcache_maint_stats;
+
+/**
+ * @brief Tell whether an area is mapped cacheable by the MPU configuration
+ *        of MPU_Config (main.c)
+ * @return 1 if any byte of the area is cacheable
+ */
+int dcache_maint_is_cacheable(const void *addr, uint32_t size);
+
+/**
+ * @brief Declare a buffer the hardware masters render into. If one of them
+ *        is cacheable the by-address shortcut is not safe (stale lines of
+ *        an area the CPU only read) and every hand-off is a full operation.
+ */
+void dcache_maint_target(const void *addr, uint32_t size);
+
+/**
+ * @brief Add an area written by the CPU to the range of the next hand-off
+ */
+void dcache_maint_mark(const void *addr, uint32_t size);
+
+/**
+ * @brief Clean the pending range before a hardware master reads it
+ */
+void dcache_maint_clean(void);
+
+/**
+ * @brief Clean and invalidate the pending range after a hardware master
+ *        wrote it
+ */
+void dcache_maint_invalidate(void);
+
+/**
+ * @brief Record the duration of one frame, in cycles
+ */
+void dcache_maint_frame(uint32_t cycles);
+
+/**
+ * @brief Record the duration of one decode call, in cycles
+ */
+void dcache_maint_decode(uint32_t cycles);
+
+/**
+ * @brief Clear the statistics
+ */
+void dcache_maint_reset(void);
+
+/**
+ * @brief Print the statistics over printf
+ */
+void dcache_maint_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DCACHE_MAINT_H */
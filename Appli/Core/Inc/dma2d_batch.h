@@ -0,0 +1,92 @@
+/*
+ * dma2d_batch.h
+ *
+ * Batching of the TouchGFX DMA2D blits and DMA2D activity statistics.
+ *
+ * Every blit queued by TouchGFX is one DMA2D transfer: register setup, the
+ * transfer, the transfer complete interrupt, and the next blit programmed from
+ * that interrupt. A screen made of many small fills and copies pays that fixed
+ * cost per blit. With DMA2D_BATCH_ENABLE set, the BatchingDMA queue merges a new
+ * blit into the last queued one when the DMA2D can do both in one transfer:
+ * same operation and formats, same colour/alpha, and areas that continue each
+ * other (next rows below, or next columns on the right, in both the source
+ * and the destination). The last queued blit is only modified while it is not
+ * the one being executed.
+ *
+ * The statistics count the blits per frame, the transfers actually started,
+ * the DMA2D busy time and the idle gaps between the end of a transfer and the
+ * start of the next one when work was already waiting (interrupt latency and
+ * register setup).
+ */
+#ifndef __DMA2D_BATCH_H
+#define __DMA2D_BATCH_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Set to 0 to queue every blit on its own */
+#ifndef DMA2D_BATCH_ENABLE
+#define DMA2D_BATCH_ENABLE          1
+#endif
+
+/* Period of the statistics printed by the housekeeping task, 0 to disable */
+#ifndef DMA2D_BATCH_REPORT_MS
+#define DMA2D_BATCH_REPORT_MS       0
+#endif
+
+typedef struct
+{
+	uint32_t frames;
+	uint32_t blits;                 /* Blits queued by TouchGFX */
+	uint32_t merged;                /* Blits merged into the previous one */
+	uint32_t transfers;             /* DMA2D transfers started, JPEG jobs included */
+	uint64_t busy_cycles;           /* Sum of the transfer durations */
+	uint64_t gap_cycles;            /* Sum of the idle gaps with work pending */
+	uint32_t gap_cycles_max;
+	uint32_t gaps;
+	uint32_t start_tick;            /* HAL tick at the last reset */
+} dma2d_batch_stats_t;
+
+/* Statistics since the last dma2d_batch_reset, readable from the debugger */
+extern volatile dma2d_batch_stats_t dma2d_batch_stats;
+
+/**
+ * @brief Count a blit queued by TouchGFX
+ * @param merged 1 when it was merged into the previous blit
+ */
+void dma2d_batch_queued(int merged);
+
+/**
+ * @brief Account the start of a DMA2D transfer
+ * @param chained 1 when started from the completion of the previous transfer
+ */
+void dma2d_batch_start(int chained);
+
+/**
+ * @brief Account the completion of a DMA2D transfer, from the DMA2D interrupt
+ */
+void dma2d_batch_done(void);
+
+/**
+ * @brief Count a frame, called at the end of each rendered frame
+ */
+void dma2d_batch_end_frame(void);
+
+/**
+ * @brief Clear the statistics
+ */
+void dma2d_batch_reset(void);
+
+/**
+ * @brief Print the statistics over printf
+ */
+void dma2d_batch_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DMA2D_BATCH_H */
@@ -0,0 +1,73 @@
+/*
+ * fb_dirty.h
+ *
+ * Dirty region meter of the double buffered framebuffer.
+ *
+ * The HAL reports every area drawn in a frame (flushFrameBuffer). The swap
+ * never copies: the LTDC only gets a new address, and TouchGFX brings the
+ * other buffer up to date itself by blitting the previous frame's drawn
+ * areas through the DMA2D queue. A second region copy from the HAL would
+ * add to that traffic instead of replacing it, so the HAL does not copy and
+ * the meter only sums the areas: the bytes that copy moves per frame, and
+ * the PSRAM bandwidth saved against copying the full frame (read and write).
+ */
+#ifndef __FB_DIRTY_H
+#define __FB_DIRTY_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Period of the statistics printed by the housekeeping task, 0 to disable */
+#ifndef FB_DIRTY_REPORT_MS
+#define FB_DIRTY_REPORT_MS          0
+#endif
+
+typedef struct
+{
+	uint32_t frames;                /* Frames with at least one dirty rect */
+	uint32_t rects;                 /* Rects reported by the HAL */
+	uint64_t dirty_bytes;           /* Sum of the rect sizes */
+	uint32_t dirty_bytes_max;       /* Largest single frame */
+	uint32_t start_tick;            /* HAL tick at the last reset */
+} fb_dirty_stats_t;
+
+/* Statistics since the last fb_dirty_reset, readable from the debugger */
+extern volatile fb_dirty_stats_t fb_dirty_stats;
+
+/**
+ * @brief Set the framebuffer geometry
+ * @param width Width in pixels
+ * @param height Height in pixels
+ * @param bytes_per_pixel Size of a pixel in the framebuffer
+ */
+void fb_dirty_init(uint16_t width, uint16_t height, uint8_t bytes_per_pixel);
+
+/**
+ * @brief Add an area drawn in the current frame
+ */
+void fb_dirty_add(int16_t x, int16_t y, int16_t width, int16_t height);
+
+/**
+ * @brief Close the current frame and account its bytes
+ * @return Dirty bytes of the frame
+ */
+uint32_t fb_dirty_end_frame(void);
+
+/**
+ * @brief Clear the statistics
+ */
+void fb_dirty_reset(void);
+
+/**
+ * @brief Print the statistics over printf
+ */
+void fb_dirty_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FB_DIRTY_H */
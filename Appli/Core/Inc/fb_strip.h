@@ -0,0 +1,106 @@
+/*
+ * fb_strip.h
+ *
+ * Single framebuffer, strip rendering mode of the TouchGFX HAL.
+ *
+ * The default mode renders whole frames into two PSRAM framebuffers and keeps
+ * a third full size buffer for the slide animations, all of it sharing the
+ * XSPI PSRAM bandwidth with the LTDC scanout. With FB_STRIP_ENABLE set, the
+ * HAL uses the TouchGFX partial framebuffer strategy instead: frames are
+ * rendered in horizontal strips of FB_STRIP_LINES lines into FB_STRIP_BLOCKS
+ * small blocks in internal SRAM, and every finished strip is copied by DMA2D
+ * into the single framebuffer scanned out by the LTDC. Slide animations are
+ * not available in that mode (no animation storage).
+ *
+ * The copy of a strip is held back while the LTDC is scanning the lines it
+ * covers, using the same LTDC line position the line event (VSYNC) interrupt
+ * is programmed with, so the panel never shows half of an old strip.
+ *
+ * The module counts what the strips write to the PSRAM; compare it with the
+ * fb_dirty report of the double buffered mode. A strip the DMA2D did not
+ * write is counted as dropped and drawn again in the next frame.
+ *
+ * The video widgets decode into the full framebuffer and are not drawn in
+ * this mode (ScheduledVideoController).
+ */
+#ifndef __FB_STRIP_H
+#define __FB_STRIP_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Set to 1 to render in strips into a single framebuffer */
+#ifndef FB_STRIP_ENABLE
+#define FB_STRIP_ENABLE             0
+#endif
+
+/* Period of the statistics printed by the housekeeping task, 0 to disable */
+#ifndef FB_STRIP_REPORT_MS
+#define FB_STRIP_REPORT_MS          0
+#endif
+
+#define FB_STRIP_LINES              (8U)    /* Lines of a strip block */
+#define FB_STRIP_BLOCKS             (2U)    /* Blocks in internal SRAM */
+#define FB_STRIP_TEAR_MARGIN        (16U)   /* Lines the copy must stay ahead of the scanout */
+
+/* Return codes */
+#define FB_STRIP_OK                 0
+#define FB_STRIP_ERROR             -1
+#define FB_STRIP_TIMEOUT           -2
+
+typedef struct
+{
+	uint32_t frames;
+	uint32_t strips;
+	uint64_t bytes;                 /* Written to the framebuffer */
+	uint32_t wait_cycles_max;       /* Longest wait for the scanout to move away */
+	uint32_t copy_cycles_max;       /* Longest DMA2D copy of a strip */
+	uint32_t timeouts;
+	uint32_t dropped;               /* Strips not written, drawn again next frame */
+	uint32_t start_tick;            /* HAL tick at the last reset */
+} fb_strip_stats_t;
+
+/* Statistics since the last fb_strip_reset, readable from the debugger */
+extern volatile fb_strip_stats_t fb_strip_stats;
+
+/**
+ * @brief Set the framebuffer the strips are copied to
+ * @param framebuffer Address of the framebuffer scanned out by the LTDC
+ * @param stride Bytes per framebuffer line
+ * @param bytes_per_pixel Size of a pixel, 4 (ARGB8888) is the only one supported
+ * @param height Lines of the display
+ */
+void fb_strip_init(void *framebuffer, uint32_t stride, uint8_t bytes_per_pixel, uint16_t height);
+
+/**
+ * @brief Copy one rendered strip into the framebuffer
+ * @param pixels Strip pixels, width * height packed
+ * @return FB_STRIP_OK when copied
+ * @note Blocking, returns when the DMA2D is done and the block can be reused.
+ *       The caller must own the DMA2D (TouchGFX DMA queue flushed).
+ */
+int fb_strip_copy(const void *pixels, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+/**
+ * @brief Count a frame, called at the end of each rendered frame
+ */
+void fb_strip_end_frame(void);
+
+/**
+ * @brief Clear the statistics
+ */
+void fb_strip_reset(void);
+
+/**
+ * @brief Print the statistics over printf
+ */
+void fb_strip_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FB_STRIP_H */
@@ -0,0 +1,136 @@
+/*
+ * frame_prof.h
+ *
+ * In-firmware frame profiler, the counterpart of the VSYNC_FREQ, RENDER_TIME,
+ * FRAME_RATE and MCU_ACTIVE pins of the readme without a logic analyser.
+ *
+ * Each TouchGFX frame gets one record of cycle stamps (idle_sleep_cycles,
+ * sleeps included): the VSYNC that released it, render start (beginFrame),
+ * application tick, first GPU2D command list submit and last completion, last
+ * flush, render end (endFrame), plus the DMA2D busy time of the frame
+ * (dma2d_batch.h) and the number of VSYNCs since the previous frame. A frame starts on every VSYNC, so more than
+ * one VSYNC between two frames means the previous one was not ready in time:
+ * each extra VSYNC counts as missed.
+ *
+ * The last FRAME_PROF_DEPTH records are kept in a ring buffer. The summary
+ * gives the rolling frame rate, the average, 99th percentile and maximum
+ * render time over that window, and the missed VSYNC count. The
+ * FrameProfilerOverlay widget shows the summary on screen.
+ *
+ * Stamps are 32 bit cycle counts and wrap after 7 s at 600 MHz, records are
+ * only compared with their neighbours.
+ */
+#ifndef __FRAME_PROF_H
+#define __FRAME_PROF_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Set to 0 to compile the hooks out */
+#ifndef FRAME_PROF_ENABLE
+#define FRAME_PROF_ENABLE           1
+#endif
+
+/* Frames kept in the ring buffer, power of two */
+#ifndef FRAME_PROF_DEPTH
+#define FRAME_PROF_DEPTH            128
+#endif
+
+/* Show the FrameProfilerOverlay on the screens */
+#ifndef FRAME_PROF_OVERLAY
+#define FRAME_PROF_OVERLAY          0
+#endif
+
+/* Refresh period of the overlay, in TouchGFX ticks (one per VSYNC) */
+#ifndef FRAME_PROF_OVERLAY_TICKS
+#define FRAME_PROF_OVERLAY_TICKS    30
+#endif
+
+/* Period of the summary printed by the housekeeping task, 0 to disable */
+#ifndef FRAME_PROF_REPORT_MS
+#define FRAME_PROF_REPORT_MS        0
+#endif
+
+typedef struct
+{
+	uint32_t vsync;                 /* VSYNC that released the frame */
+	uint32_t render_start;          /* beginFrame */
+	uint32_t tick;                  /* Application tick handler */
+	uint32_t gpu2d_submit;          /* First command list submitted, 0 if none */
+	uint32_t gpu2d_done;            /* Last command list completed */
+	uint32_t flush;                 /* Last flushFrameBuffer, 0 if nothing drawn */
+	uint32_t render_end;            /* endFrame */
+	uint32_t dma2d_busy;            /* DMA2D busy cycles during the frame */
+	uint16_t gpu2d_lists;           /* Command lists submitted */
+	uint16_t vsyncs;                /* VSYNCs since the previous frame */
+} frame_prof_record_t;
+
+typedef struct
+{
+	uint32_t frames;                /* Frames in the window */
+	uint32_t fps_x10;               /* Frame rate over the window, 0.1 fps */
+	uint32_t render_us_avg;         /* render_start to render_end */
+	uint32_t render_us_p99;
+	uint32_t render_us_max;
+	uint32_t vsync_us_avg;          /* VSYNC to render_end, latency of the frame */
+	uint32_t gpu2d_us_avg;          /* First submit to last completion */
+	uint32_t dma2d_us_avg;
+	uint32_t missed_window;         /* Missed VSYNCs in the window */
+	uint32_t missed_total;          /* Missed VSYNCs since the last reset */
+} frame_prof_summary_t;
+
+/* Hooks of the TouchGFX HAL, the VSYNC and GPU2D ones run in interrupts */
+#if FRAME_PROF_ENABLE
+void frame_prof_vsync(void);
+void frame_prof_begin(void);
+void frame_prof_tick(void);
+void frame_prof_gpu2d_submit(void);
+void frame_prof_gpu2d_done(void);
+void frame_prof_flush(void);
+void frame_prof_end(void);
+#else
+#define frame_prof_vsync()          ((void)0)
+#define frame_prof_begin()          ((void)0)
+#define frame_prof_tick()           ((void)0)
+#define frame_prof_gpu2d_submit()   ((void)0)
+#define frame_prof_gpu2d_done()     ((void)0)
+#define frame_prof_flush()          ((void)0)
+#define frame_prof_end()            ((void)0)
+#endif
+
+/**
+ * @brief Copy the most recent complete records, oldest first
+ * @param records Destination
+ * @param max Capacity of records
+ * @return Number of records copied
+ */
+uint32_t frame_prof_read(frame_prof_record_t *records, uint32_t max);
+
+/**
+ * @brief Compute the summary of the most recent records. They are copied
+ *        with the interrupts masked (frame_prof_read) and sorted in the copy.
+ * @param summary Result
+ * @param records Scratch of the caller, FRAME_PROF_DEPTH records for the
+ *        whole window
+ * @param max Capacity of records
+ */
+void frame_prof_summary(frame_prof_summary_t *summary, frame_prof_record_t *records, uint32_t max);
+
+/**
+ * @brief Clear the records and the missed VSYNC count
+ */
+void frame_prof_reset(void);
+
+/**
+ * @brief Print the summary over printf
+ */
+void frame_prof_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FRAME_PROF_H */
@@ -0,0 +1,95 @@
+/*
+ * gui_cache.h
+ *
+ * Retained rendering of the static GUI containers and frame CPU time.
+ *
+ * The GPU2D command lists are built and consumed inside the TouchGFX library
+ * (HALGPU2D, GPU2DVectorRenderer), they cannot be kept from one frame to the
+ * next. What is retained instead is the result: a RetainedContainer renders
+ * its children once into a dynamic bitmap and every later redraw of its area
+ * is a single bitmap blit. A child that changes invalidates its area of the
+ * cache, which is rendered again before the next frame is drawn.
+ *
+ * The statistics give the CPU time of the frames, measured between
+ * TouchGFXHAL::beginFrame and endFrame, the cache renders and the blits of the
+ * cached bitmaps; build with GUI_CACHE_ENABLE 1 and 0 to compare.
+ *
+ * The cache is off by default: no screen uses a RetainedContainer yet and the
+ * dynamic bitmap memory (GUI_CACHE_SIZE of PSRAM) would be reserved for
+ * nothing. Enable it together with the first container wrapped in one.
+ */
+#ifndef __GUI_CACHE_H
+#define __GUI_CACHE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Set to 1 to retain the RetainedContainer children as cached bitmaps */
+#ifndef GUI_CACHE_ENABLE
+#define GUI_CACHE_ENABLE            0
+#endif
+
+/* Dynamic bitmap memory in external RAM, one full screen ARGB8888 */
+#ifndef GUI_CACHE_SIZE
+#define GUI_CACHE_SIZE              (800U * 480U * 4U)
+#endif
+
+/* Maximum number of cached containers */
+#ifndef GUI_CACHE_BITMAPS
+#define GUI_CACHE_BITMAPS           8
+#endif
+
+/* Period of the statistics printed by the housekeeping task, 0 to disable */
+#ifndef GUI_CACHE_REPORT_MS
+#define GUI_CACHE_REPORT_MS         0
+#endif
+
+typedef struct
+{
+	uint32_t frames;
+	uint64_t frame_cycles;          /* Sum of the beginFrame to endFrame times */
+	uint32_t frame_cycles_max;
+	uint32_t renders;               /* Cache areas rendered again */
+	uint64_t render_cycles;
+	uint32_t replays;               /* Cached bitmaps drawn instead of the children */
+	uint32_t start_tick;            /* HAL tick at the last reset */
+} gui_cache_stats_t;
+
+/* Statistics since the last gui_cache_reset, readable from the debugger */
+extern volatile gui_cache_stats_t gui_cache_stats;
+
+/**
+ * @brief Record the CPU time of one frame
+ * @param cycles Cycles from beginFrame to endFrame
+ */
+void gui_cache_frame(uint32_t cycles);
+
+/**
+ * @brief Record the render of a cache area
+ * @param cycles Cycles spent rendering the children into the bitmap
+ */
+void gui_cache_render(uint32_t cycles);
+
+/**
+ * @brief Count a cached bitmap drawn in place of the children
+ */
+void gui_cache_replay(void);
+
+/**
+ * @brief Clear the statistics
+ */
+void gui_cache_reset(void);
+
+/**
+ * @brief Print the statistics over printf
+ */
+void gui_cache_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GUI_CACHE_H */
@@ -0,0 +1,181 @@
+/*
+ * i2c_bus.h
+ *
+ * Manager of the I2C1 bus shared by the GT911 touch controller and the
+ * WM8904 codec.
+ *
+ * Clients queue transfer descriptors, from a task or an interrupt. The bus
+ * task runs them one at a time, highest priority first and in submission
+ * order within a priority, with the interrupt driven HAL transfers, and
+ * calls the completion callback of the descriptor from its own context. A
+ * callback may queue the next transfer of a chain. A stuck transfer is
+ * aborted after I2C_BUS_TIMEOUT_MS by reinitializing the peripheral.
+ *
+ * A descriptor with several records is a batch of register writes: one
+ * I2C write per record, run back to back as one queue entry. Only a
+ * transfer of higher priority gets the bus in between two records, so the
+ * touch waits for one codec record at most. It saves the queueing and the
+ * task switches of each write, not bus time: the codec registers are not
+ * contiguous and each record carries its own register address. The codec
+ * uses it for its register sequences (volume ramp, mute), see
+ * i2c_bus_batch_*.
+ *
+ * Statistics are kept per client: transfers, errors, timeouts and the
+ * latency from submission to completion.
+ */
+#ifndef __I2C_BUS_H
+#define __I2C_BUS_H
+
+#include "main.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Return codes */
+#define I2C_BUS_OK                  0
+#define I2C_BUS_ERROR              -1
+#define I2C_BUS_TIMEOUT            -2
+#define I2C_BUS_INVALID_PARAM      -3
+#define I2C_BUS_NO_RESOURCES       -4
+#define I2C_BUS_BUSY               -5      /* Descriptor already queued */
+
+/* Longest single transfer */
+#ifndef I2C_BUS_TIMEOUT_MS
+#define I2C_BUS_TIMEOUT_MS          20
+#endif
+
+/* Records of a codec batch */
+#ifndef I2C_BUS_BATCH_MAX
+#define I2C_BUS_BATCH_MAX           16
+#endif
+
+/* Period of the statistics printed by the housekeeping task, 0 to disable */
+#ifndef I2C_BUS_REPORT_MS
+#define I2C_BUS_REPORT_MS           0
+#endif
+
+/* Thread flag used by the blocking calls on the calling task */
+#define I2C_BUS_FLAG_WAIT           (0x00010000U)
+
+typedef enum
+{
+	I2C_BUS_CLIENT_TOUCH = 0,
+	I2C_BUS_CLIENT_CODEC,
+	I2C_BUS_CLIENTS
+} i2c_bus_client_t;
+
+/* Priorities, higher first */
+#define I2C_BUS_PRIO_CODEC          1
+#define I2C_BUS_PRIO_TOUCH          2
+
+struct i2c_bus_xfer;
+typedef void (*i2c_bus_done_t)(struct i2c_bus_xfer *xfer, int status);
+
+typedef struct i2c_bus_xfer
+{
+	uint8_t client;                 /* i2c_bus_client_t */
+	uint8_t priority;
+	uint8_t read;                   /* 1 to read, 0 to write */
+	uint8_t reg_size;               /* I2C_MEMADD_SIZE_8BIT or I2C_MEMADD_SIZE_16BIT */
+	uint16_t addr;                  /* 8 bit device address */
+	uint16_t reg;
+	uint8_t *data;
+	uint16_t length;                /* Bytes, or bytes per record of a batch */
+	uint16_t records;               /* Batch writes: data holds records of reg_size
+	                                   register bytes (MSB first) + length bytes */
+	i2c_bus_done_t done;            /* Bus task context, NULL for none */
+	void *ctx;
+	/* Owned by the bus manager */
+	struct i2c_bus_xfer *next;
+	uint32_t queued;                /* DWT cycles at submission */
+	volatile int status;
+	volatile uint8_t busy;
+} i2c_bus_xfer_t;
+
+typedef struct
+{
+	uint32_t transfers;
+	uint32_t errors;
+	uint32_t timeouts;
+	uint64_t latency_cycles;        /* Submission to completion */
+	uint32_t latency_cycles_max;
+} i2c_bus_client_stats_t;
+
+typedef struct
+{
+	i2c_bus_client_stats_t client[I2C_BUS_CLIENTS];
+	uint32_t queue_max;             /* Deepest queue seen */
+	uint32_t start_tick;            /* HAL tick at the last reset */
+} i2c_bus_stats_t;
+
+typedef struct
+{
+	i2c_bus_xfer_t xfer;
+	uint16_t count;
+	uint8_t data[I2C_BUS_BATCH_MAX * 3];
+} i2c_bus_batch_t;
+
+/* Statistics since the last i2c_bus_reset, readable from the debugger */
+extern volatile i2c_bus_stats_t i2c_bus_stats;
+
+/**
+ * @brief Create the bus task, transfers queued before run once it starts
+ * @param hi2c Initialized bus
+ * @return I2C_BUS_OK or I2C_BUS_NO_RESOURCES
+ */
+int i2c_bus_init(I2C_HandleTypeDef *hi2c);
+
+/**
+ * @brief Queue a transfer, from a task or an interrupt
+ * @return I2C_BUS_OK, I2C_BUS_BUSY or I2C_BUS_INVALID_PARAM
+ */
+int i2c_bus_submit(i2c_bus_xfer_t *xfer);
+
+/**
+ * @brief Queue a transfer and wait for it, from a task other than the bus task
+ * @return Status of the transfer
+ */
+int i2c_bus_transfer(i2c_bus_xfer_t *xfer);
+
+/* WM8904_IO_t register access of the codec, blocking */
+int32_t i2c_bus_codec_write(uint16_t addr, uint16_t reg, uint8_t *data, uint16_t length);
+int32_t i2c_bus_codec_read(uint16_t addr, uint16_t reg, uint8_t *data, uint16_t length);
+/* WM8904_IO_t batch write: count records of [reg, value MSB, value LSB], one
+   I2C write each, blocking */
+int32_t i2c_bus_codec_batch(uint16_t addr, uint8_t *records, uint16_t count);
+
+/**
+ * @brief Start a batch of 16 bit codec register writes
+ */
+void i2c_bus_batch_init(i2c_bus_batch_t *batch, uint16_t addr);
+
+/**
+ * @brief Add a register write to the batch
+ * @return I2C_BUS_OK or I2C_BUS_NO_RESOURCES when the batch is full
+ */
+int i2c_bus_batch_write(i2c_bus_batch_t *batch, uint8_t reg, uint16_t value);
+
+/**
+ * @brief Queue the batch as one entry and wait for it, stops at the first
+ *        failed write
+ * @return Status of the batch
+ */
+int i2c_bus_batch_submit(i2c_bus_batch_t *batch);
+
+/**
+ * @brief Clear the statistics
+ */
+void i2c_bus_reset(void);
+
+/**
+ * @brief Print the statistics over printf
+ */
+void i2c_bus_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __I2C_BUS_H */
@@ -0,0 +1,128 @@
+/*
+ * idle_sleep.h
+ *
+ * Idle sleep of the FreeRTOS idle task, two states:
+ * - WFI with the tick running: idle_sleep_wfi, from the idle hook. Ends at
+ *   the next interrupt, the 1 ms tick at the latest.
+ * - Tickless (configUSE_TICKLESS_IDLE): the SysTick implementation of the
+ *   port stops the kernel tick until the next RTOS timer or task timeout;
+ *   the hooks below also stop the TIM6 HAL tick and add the HAL
+ *   milliseconds it missed on wakeup.
+ *
+ * The audio DMA and the LTDC line interrupts end most sleeps. Their next
+ * occurrence is predicted from the period seen between the last two
+ * (idle_sleep_event). A tickless sleep is not started when one of them is
+ * due within IDLE_SLEEP_MIN_TICKS ticks: the SysTick reprogramming and the
+ * tick correction would cost more than the sleep saves, and every early
+ * wakeup adds to the kernel tick drift. Longer sleeps are cut to end at the
+ * predicted interrupt. Both wake the CPU in Sleep mode only: the SAI and
+ * the LTDC keep running.
+ *
+ * The residency of each state is measured with the SysTick counter (core
+ * clock), which runs in Sleep. The DWT cycle counter stops with the core
+ * clock in Sleep unless DBGMCU DBG_SLEEP is set (IDLE_SLEEP_DEBUG_CLOCK, or
+ * a debugger): idle_sleep_cycles adds the cycles slept back, so that the run
+ * time statistics, frame_prof and the TouchGFX MCU load see the idle time.
+ * The line interrupts are recorded from LTDC_IRQHandler (stm32h7rsxx_it.c).
+ */
+#ifndef __IDLE_SLEEP_H
+#define __IDLE_SLEEP_H
+
+#include "main.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Shortest tickless sleep, in kernel ticks, before a predicted interrupt */
+#ifndef IDLE_SLEEP_MIN_TICKS
+#define IDLE_SLEEP_MIN_TICKS        2
+#endif
+
+/* Keep the core clock in Sleep (DBGMCU DBG_SLEEP), for cycle counter profiling */
+#ifndef IDLE_SLEEP_DEBUG_CLOCK
+#define IDLE_SLEEP_DEBUG_CLOCK      0
+#endif
+
+/* Period of the residency statistics printed by the housekeeping task, 0 to disable */
+#ifndef IDLE_SLEEP_REPORT_MS
+#define IDLE_SLEEP_REPORT_MS        0
+#endif
+
+/* Periodic interrupts that end the sleeps */
+typedef enum
+{
+	IDLE_SLEEP_SRC_AUDIO = 0,       /* SAI DMA half or complete */
+	IDLE_SLEEP_SRC_VSYNC,           /* LTDC line event, entering the active area */
+	IDLE_SLEEP_SRC_PORCH,           /* LTDC line event, leaving it */
+	IDLE_SLEEP_SOURCES
+} idle_sleep_source_t;
+
+typedef struct
+{
+	uint32_t wfi;                   /* Sleeps with the tick running */
+	uint32_t tickless;              /* Sleeps with the tick stopped */
+	uint32_t refused;               /* Tickless sleeps not started, an interrupt was due */
+	uint32_t shortened;             /* Tickless sleeps cut to a predicted interrupt */
+	uint64_t wfi_cycles;
+	uint64_t tickless_cycles;
+	uint32_t tickless_max_cycles;
+	uint32_t start_tick;            /* HAL tick at the last reset */
+} idle_sleep_stats_t;
+
+/* Statistics since the last idle_sleep_reset, readable from the debugger */
+extern volatile idle_sleep_stats_t idle_sleep_stats;
+
+/* Cycles slept while the cycle counter was stopped, see idle_sleep_cycles */
+extern volatile uint32_t idle_sleep_slept_cycles;
+
+/* Core cycles including the sleeps, from any context. Wraps like the cycle
+ * counter: only differences are meaningful. */
+static inline uint32_t idle_sleep_cycles(void)
+{
+	return DWT->CYCCNT + idle_sleep_slept_cycles;
+}
+
+/**
+ * @brief Record a periodic interrupt, from its handler
+ */
+void idle_sleep_event(idle_sleep_source_t source);
+
+/**
+ * @brief Sleep until the next interrupt, from the idle hook
+ */
+void idle_sleep_wfi(void);
+
+/**
+ * @brief configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING: cut the tickless
+ *        sleep to the predicted interrupts, 0 to stay in the WFI state
+ * @param ticks Expected idle time of the kernel, in ticks
+ */
+void idle_sleep_pre_suppress(uint32_t *ticks);
+
+/**
+ * @brief configPRE_SLEEP_PROCESSING: stop the HAL tick, interrupts masked
+ */
+void idle_sleep_pre(uint32_t *ticks);
+
+/**
+ * @brief configPOST_SLEEP_PROCESSING: add the HAL ticks missed and restart it
+ */
+void idle_sleep_post(uint32_t ticks);
+
+/**
+ * @brief Clear the statistics, also applies IDLE_SLEEP_DEBUG_CLOCK
+ */
+void idle_sleep_reset(void);
+
+/**
+ * @brief Print the residency over printf
+ */
+void idle_sleep_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IDLE_SLEEP_H */
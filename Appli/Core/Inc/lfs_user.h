@@ -21,5 +21,8 @@ void littlefs_dump_mp3_header(const char *path);
 void lfs_list_dir(const char *path);
 int lfs_get_file_size(const char *path, size_t *size);
 int lfs_read_file(const char *path, uint8_t *buffer, size_t buffer_size, size_t *bytes_read);
+int lfs_open_file_ro(lfs_file_t *file, const char *path, size_t *size);
+int lfs_read_file_at(lfs_file_t *file, uint32_t offset, uint8_t *buffer, size_t len);
+int lfs_close_file(lfs_file_t *file);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,180 @@
+/*
+ * media_prefetch.h
+ *
+ * Read-ahead engine for sequential media streams (MP3, MJPEG, ...).
+ *
+ * A client declares a stream (source, start offset, byte rate) and the
+ * prefetch task keeps the next N KB of it in a small internal SRAM block
+ * pool, so the consumer copies from SRAM instead of stalling on XSPI
+ * latency every time it enters a new region of the external flash.
+ *
+ * Two kinds of source are supported:
+ *  - MEDIA_PF_SRC_MAPPED : data reachable through the XSPI memory-mapped
+ *                          window (XIP assets, embedded arrays).
+ *                          Filled with DMA when a channel is attached,
+ *                          otherwise by a cache-line touch-ahead copy.
+ *  - MEDIA_PF_SRC_LFS    : a littlefs file (lfs_user mount). Filled by the
+ *                          prefetch task only; littlefs is not ISR safe.
+ */
+#ifndef __MEDIA_PREFETCH_H
+#define __MEDIA_PREFETCH_H
+
+#include "main.h"
+#include "lfs.h"
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Return codes */
+#define MEDIA_PF_OK                 0
+#define MEDIA_PF_ERROR             -1
+#define MEDIA_PF_INVALID_PARAM     -2
+#define MEDIA_PF_NO_RESOURCES      -3
+#define MEDIA_PF_NOT_READY         -4
+
+/* Configuration */
+#ifndef MEDIA_PF_BLOCK_SIZE
+#define MEDIA_PF_BLOCK_SIZE        (4096U)     /* Prefetch unit, multiple of the 32B cache line */
+#endif
+#ifndef MEDIA_PF_POOL_BLOCKS
+#define MEDIA_PF_POOL_BLOCKS       (16U)       /* 64KB internal SRAM pool shared by all streams */
+#endif
+#define MEDIA_PF_MAX_STREAMS       (4U)
+#define MEDIA_PF_MAX_SLOTS         (8U)        /* Max blocks one stream may hold */
+#define MEDIA_PF_LEAD_MS           (250U)      /* How much playback time to keep ahead */
+
+typedef enum
+{
+	MEDIA_PF_SRC_MAPPED,
+	MEDIA_PF_SRC_LFS
+} media_pf_src_e;
+
+typedef enum
+{
+	MEDIA_PF_SLOT_EMPTY,
+	MEDIA_PF_SLOT_FILLING,
+	MEDIA_PF_SLOT_READY
+} media_pf_slot_state_e;
+
+typedef struct
+{
+	uint8_t *buf;                       /* Pool block */
+	uint32_t offset;                    /* Stream offset of buf[0] */
+	uint32_t len;                       /* Valid bytes */
+	volatile uint8_t state;             /* media_pf_slot_state_e */
+} media_pf_slot_t;
+
+typedef struct
+{
+	uint32_t hits;                      /* Reads served completely from SRAM */
+	uint32_t misses;                    /* Reads that had to go to the source */
+	uint32_t bytes_read;                /* Bytes delivered to the consumer */
+	uint32_t bytes_prefetched;          /* Bytes brought in ahead of time */
+	uint64_t stall_cycles;              /* CPU cycles the consumer waited on the source */
+	uint32_t stall_max_cycles;          /* Worst single stall */
+	uint32_t underruns;                 /* Misses that could not be served (ISR + lfs) */
+} media_pf_stats_t;
+
+typedef struct
+{
+	const char *name;
+	uint8_t in_use;
+	uint8_t loop;                       /* Wrap the read-ahead at end of stream */
+	media_pf_src_e src;
+
+	const uint8_t *base;                /* MEDIA_PF_SRC_MAPPED */
+	lfs_file_t file;                    /* MEDIA_PF_SRC_LFS */
+
+	uint32_t length;
+	uint32_t rate_bps;                  /* Consumption rate in bytes per second */
+	uint32_t ahead_bytes;               /* Read-ahead distance derived from rate */
+
+	volatile uint32_t read_pos;         /* Last offset requested by the consumer */
+	uint32_t fill_pos;                  /* Next offset the prefetcher will fetch */
+
+	uint8_t nslots;
+	media_pf_slot_t slot[MEDIA_PF_MAX_SLOTS];
+
+	media_pf_stats_t stats;
+} media_prefetch_stream_t;
+
+/**
+ * @brief Initialize the prefetcher and start its task
+ * @param hdma Memory-to-memory DMA channel able to read the XSPI window,
+ *             or NULL to use the CPU touch-ahead copy
+ * @return MEDIA_PF_OK on success
+ */
+int media_prefetch_init(DMA_HandleTypeDef *hdma);
+
+/**
+ * @brief Declare a stream over the memory-mapped window
+ * @param stream Stream handle
+ * @param name Name used in statistics output
+ * @param base Mapped address of the stream data
+ * @param length Stream length in bytes
+ * @param offset First offset the consumer will read
+ * @param rate_bps Expected consumption rate in bytes per second
+ * @return MEDIA_PF_OK on success
+ */
+int media_prefetch_open_mapped(media_prefetch_stream_t *stream, const char *name,
+                               const uint8_t *base, uint32_t length,
+                               uint32_t offset, uint32_t rate_bps);
+
+/**
+ * @brief Declare a stream over a littlefs file (filesystem must be mounted)
+ * @param stream Stream handle
+ * @param path File path
+ * @param offset First offset the consumer will read
+ * @param rate_bps Expected consumption rate in bytes per second
+ * @return MEDIA_PF_OK on success
+ */
+int media_prefetch_open_lfs(media_prefetch_stream_t *stream, const char *path,
+                            uint32_t offset, uint32_t rate_bps);
+
+/**
+ * @brief Release the stream and give its blocks back to the pool
+ */
+void media_prefetch_close(media_prefetch_stream_t *stream);
+
+/**
+ * @brief Wrap the read-ahead back to offset 0 at end of stream
+ */
+void media_prefetch_set_loop(media_prefetch_stream_t *stream, uint8_t enable);
+
+/**
+ * @brief Copy stream data into dst. Safe from ISR for mapped streams and for
+ *        lfs streams as long as the data has been prefetched.
+ * @param stream Stream handle
+ * @param offset Stream offset
+ * @param dst Destination buffer
+ * @param len Bytes to read
+ * @return Bytes copied (may be short at end of stream or on ISR underrun),
+ *         negative error code on failure
+ */
+int media_prefetch_read(media_prefetch_stream_t *stream, uint32_t offset,
+                        uint8_t *dst, uint32_t len);
+
+/**
+ * @brief Touch-ahead for zero-copy consumers of a mapped stream: load one
+ *        word per cache line so the following reads hit the D-cache.
+ */
+void media_prefetch_touch(const media_prefetch_stream_t *stream, uint32_t offset, uint32_t len);
+
+/**
+ * @brief Copy statistics of a stream
+ */
+void media_prefetch_get_stats(const media_prefetch_stream_t *stream, media_pf_stats_t *stats);
+
+/**
+ * @brief Print hit rate and stall time of all open streams over printf
+ */
+void media_prefetch_print_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MEDIA_PREFETCH_H */
@@ -5,6 +5,7 @@
 #include <stdint.h>
 #include <stddef.h>
 #include "minimp3.h"
+#include "media_prefetch.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -20,6 +21,25 @@ extern "C" {
 /* Configuration */
 #define MP3_TARGET_SAMPLE_RATE     48000
 #define MP3_OUTPUT_CHANNELS        2
+#define MP3_INPUT_WINDOW_SIZE      4096    /* SRAM staging window when reading through the prefetcher */
+#define MP3_INPUT_WINDOW_REFILL    2048    /* Refill when less than this is left (> max frame size) */
+
+/* Period of the frame decode statistics printed by the housekeeping task, 0 to disable */
+#ifndef MP3_DECODER_REPORT_MS
+#define MP3_DECODER_REPORT_MS      0
+#endif
+
+/* Frame decode time, all decoders together */
+typedef struct {
+    uint32_t frames;                     /* Frames decoded */
+    uint64_t cycles;                     /* Sum of the mp3dec_decode_frame durations */
+    uint32_t cycles_min;
+    uint32_t cycles_max;
+    uint32_t start_tick;                 /* HAL tick at the last reset */
+} mp3_decoder_stats_t;
+
+/* Statistics since the last mp3_decoder_stats_reset, readable from the debugger */
+extern volatile mp3_decoder_stats_t mp3_decoder_stats;
 
 /* Streaming decoder handle */
 typedef struct {
@@ -29,6 +49,11 @@ typedef struct {
     size_t mp3_data_length;              /* Total MP3 data length */
     size_t mp3_data_position;            /* Current read position */
     
+    media_prefetch_stream_t *source;     /* Prefetched source, NULL when mp3_data is used */
+    size_t window_start;                 /* Stream offset of input_window[0] */
+    size_t window_length;                /* Valid bytes in input_window */
+    uint8_t input_window[MP3_INPUT_WINDOW_SIZE];
+    
     int16_t *output_buffer;              /* Output PCM buffer (ping-pong) */
     size_t output_buffer_size;           /* Size in samples */
     
@@ -66,6 +91,15 @@ int mp3_decoder_streaming_load(mp3_decoder_streaming_t *handle,
                                const uint8_t *mp3_data,
                                size_t mp3_length);
 
+/**
+ * @brief Load MP3 data from a prefetch stream instead of a memory pointer
+ * @param handle Decoder handle
+ * @param source Open prefetch stream (see media_prefetch.h)
+ * @return MP3_DEC_OK on success
+ */
+int mp3_decoder_streaming_load_stream(mp3_decoder_streaming_t *handle,
+                                      media_prefetch_stream_t *source);
+
 /**
  * @brief Start streaming - decode first chunk
  * @param handle Decoder handle
@@ -75,7 +109,7 @@ int16_t* mp3_decoder_streaming_start(mp3_decoder_streaming_t *handle);
 
 /**
  * @brief Get next chunk for DMA (decode next frames)
- * Call this from DMA half/complete callbacks
+ * Called by the audio task when a DMA half/complete interrupt requests a refill
  * @param handle Decoder handle
  * @param samples_decoded Number of samples decoded (can be NULL)
  * @return Pointer to next chunk (int16_t*) or NULL if end of file
@@ -97,6 +131,17 @@ int mp3_decoder_streaming_reset(mp3_decoder_streaming_t *handle);
  */
 void mp3_decoder_streaming_set_loop(mp3_decoder_streaming_t *handle, uint8_t enable);
 
+/**
+ * @brief Clear the frame decode statistics
+ */
+void mp3_decoder_stats_reset(void);
+
+/**
+ * @brief Print the frame decode statistics over printf: cycles per frame
+ *        average, min and max
+ */
+void mp3_decoder_stats_print(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -206,7 +206,7 @@
 #define USE_HAL_I2C_REGISTER_CALLBACKS        0U
 #define USE_HAL_I2S_REGISTER_CALLBACKS        0U
 #define USE_HAL_IRDA_REGISTER_CALLBACKS       0U
-#define USE_HAL_JPEG_REGISTER_CALLBACKS       0U
+#define USE_HAL_JPEG_REGISTER_CALLBACKS       1U
 #define USE_HAL_LPTIM_REGISTER_CALLBACKS      0U
 #define USE_HAL_MDF_REGISTER_CALLBACKS        0U
 #define USE_HAL_MMC_REGISTER_CALLBACKS        0U
@@ -64,6 +64,8 @@ void GPDMA1_Channel15_IRQHandler(void);
 void GPU2D_IRQHandler(void);
 void GPU2D_ER_IRQHandler(void);
 /* USER CODE BEGIN EFP */
+void I2C1_EV_IRQHandler(void);
+void I2C1_ER_IRQHandler(void);
 
 /* USER CODE END EFP */
 
@@ -0,0 +1,68 @@
+/*
+ * sw_jpeg.h
+ *
+ * Software baseline JPEG decoder, the fallback of the JPEG peripheral for
+ * MJPEG video frames.
+ *
+ * Supports sequential Huffman JPEG (SOF0/SOF1), 8 bit samples, grayscale or
+ * YCbCr with 4:4:4, 4:2:2 or 4:2:0 sampling, restart intervals, and frames
+ * without DHT (AVI MJPEG, the standard tables of the JPEG spec are used).
+ *
+ * The decoder converts each MCU to ARGB8888 as soon as it is decoded, row by
+ * row, straight into the destination; only the MCUs of the clip rectangle go
+ * through the IDCT and the colour conversion, and decoding stops after the
+ * last MCU row of the clip.
+ *
+ * The module only uses the C library, it builds for the host as well. It is
+ * not reentrant (tables in static memory), call it from one task.
+ */
+#ifndef __SW_JPEG_H
+#define __SW_JPEG_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Return codes */
+#define SW_JPEG_OK                  0
+#define SW_JPEG_ERROR              -1      /* Corrupted stream */
+#define SW_JPEG_UNSUPPORTED        -2      /* Progressive, 12 bit, CMYK, ... */
+#define SW_JPEG_INVALID_PARAM      -3
+
+typedef struct
+{
+	uint16_t width;
+	uint16_t height;
+	uint8_t components;             /* 1 grayscale, 3 YCbCr */
+	uint8_t h_samp;                 /* Luma sampling factors, 2x2 for 4:2:0 */
+	uint8_t v_samp;
+} sw_jpeg_info_t;
+
+/**
+ * @brief Read the frame header
+ * @param data JPEG stream, starting with SOI
+ * @param size Bytes of the stream
+ * @param info Receives the image geometry
+ * @return SW_JPEG_OK, SW_JPEG_UNSUPPORTED or SW_JPEG_ERROR
+ */
+int sw_jpeg_info(const uint8_t *data, uint32_t size, sw_jpeg_info_t *info);
+
+/**
+ * @brief Decode a JPEG image to ARGB8888
+ * @param data JPEG stream, starting with SOI
+ * @param size Bytes of the stream
+ * @param dst Destination of the image pixel (0, 0)
+ * @param dst_stride Pixels per destination line
+ * @param x, y, width, height Area of the image to write, clipped to the image
+ * @return SW_JPEG_OK when decoded
+ */
+int sw_jpeg_decode(const uint8_t *data, uint32_t size, uint32_t *dst, uint32_t dst_stride,
+		uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SW_JPEG_H */
@@ -0,0 +1,121 @@
+/*
+ * swo_prof.h
+ *
+ * Statistical profiler: TIM7 interrupts the CPU at SWO_PROF_RATE_HZ, reads
+ * the PC from the exception frame of whatever it interrupted (task, ISR or
+ * kernel) and sends it over ITM, on the SWO pin that also carries printf.
+ * Scripts/swo_profile.py resolves a capture against the ELF and prints the
+ * CPU share per function, per module (object or library) and per task or
+ * ISR.
+ *
+ * TIM7 runs at priority 0, above configMAX_SYSCALL_INTERRUPT_PRIORITY, so it
+ * also samples the kernel critical sections and the other ISRs; it does not
+ * call the kernel API. The period is dithered by a few percent so that the
+ * sampling does not lock to a periodic activity (tick, VSYNC, audio DMA).
+ *
+ * ITM stimulus ports (printf uses port 0, the SWO packets carry the port
+ * number so the streams do not mix):
+ * - SWO_PROF_PORT_CONTEXT, 16 bits, sent before each PC: the task slot, or
+ *   SWO_PROF_CONTEXT_ISR | exception number when an ISR was interrupted, or
+ *   SWO_PROF_CONTEXT_MAIN before the scheduler runs
+ * - SWO_PROF_PORT_PC, 32 bits: the sampled PC
+ * - SWO_PROF_PORT_NAME, 8 bits: task slot names, 0x80 | slot, the name
+ *   characters and 0. Each slot is announced when first seen and again every
+ *   second, so a capture started late still resolves its tasks.
+ * A sample is dropped (and counted) rather than waiting when the ITM FIFO is
+ * full: the SWO clock bounds the usable rate, about 10 kHz at 2 MHz SWO.
+ *
+ * The debugger must enable the ITM and the SWO output (TCR.ITMENA, TPIU),
+ * as it does for printf over SWO; swo_prof_start enables the three ports.
+ */
+#ifndef __SWO_PROF_H
+#define __SWO_PROF_H
+
+#include "main.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Return codes */
+#define SWO_PROF_OK                 0
+#define SWO_PROF_ERROR             -1
+#define SWO_PROF_INVALID_PARAM     -2
+#define SWO_PROF_NO_ITM            -3      /* ITM not enabled by the debugger */
+
+/* Sampling rate started by the audio task after boot, 0 to leave it off */
+#ifndef SWO_PROF_RATE_HZ
+#define SWO_PROF_RATE_HZ            0
+#endif
+
+#define SWO_PROF_RATE_MAX_HZ        50000U
+
+/* Period of the statistics printed by the housekeeping task, 0 to disable */
+#ifndef SWO_PROF_REPORT_MS
+#define SWO_PROF_REPORT_MS          0
+#endif
+
+/* ITM stimulus ports, see above */
+#ifndef SWO_PROF_PORT_CONTEXT
+#define SWO_PROF_PORT_CONTEXT       1
+#endif
+#define SWO_PROF_PORT_PC            (SWO_PROF_PORT_CONTEXT + 1)
+#define SWO_PROF_PORT_NAME          (SWO_PROF_PORT_CONTEXT + 2)
+
+/* Tasks told apart, the others share SWO_PROF_CONTEXT_OTHER */
+#define SWO_PROF_TASKS              16
+
+/* Context word */
+#define SWO_PROF_CONTEXT_ISR        0x8000U
+#define SWO_PROF_CONTEXT_MAIN       0x4000U
+#define SWO_PROF_CONTEXT_OTHER      0x7FFFU
+
+typedef struct
+{
+	uint32_t rate_hz;               /* 0 when stopped */
+	uint32_t samples;               /* Samples sent */
+	uint32_t dropped;               /* Samples lost to a full ITM FIFO */
+	uint32_t isr;                   /* Samples taken in an ISR */
+	uint32_t tasks;                 /* Task slots in use */
+	uint32_t start_tick;            /* HAL tick at the last reset */
+} swo_prof_stats_t;
+
+/* Statistics since the last swo_prof_reset, readable from the debugger */
+extern volatile swo_prof_stats_t swo_prof_stats;
+
+/**
+ * @brief Start sampling
+ * @param rate_hz Samples per second, up to SWO_PROF_RATE_MAX_HZ
+ * @return SWO_PROF_OK, SWO_PROF_INVALID_PARAM, SWO_PROF_NO_ITM or
+ *         SWO_PROF_ERROR (timer)
+ */
+int swo_prof_start(uint32_t rate_hz);
+
+/**
+ * @brief Stop sampling
+ */
+void swo_prof_stop(void);
+
+/**
+ * @brief Take one sample, from TIM7_IRQHandler
+ * @param frame Exception frame of the interrupted context
+ * @param exc_return EXC_RETURN value of the interrupt
+ */
+void swo_prof_sample(const uint32_t *frame, uint32_t exc_return);
+
+/**
+ * @brief Clear the statistics
+ */
+void swo_prof_reset(void);
+
+/**
+ * @brief Print the statistics over printf
+ */
+void swo_prof_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SWO_PROF_H */
@@ -0,0 +1,153 @@
+/*
+ * sys_mon.h
+ *
+ * System monitor: a small task wakes every SYS_MON_PERIOD_MS and publishes
+ * a snapshot of the last period:
+ * - CPU share of each task, from the FreeRTOS run time statistics clocked by
+ *   the DWT cycle counter plus the cycles it missed in Sleep
+ *   (idle_sleep_cycles, configGENERATE_RUN_TIME_STATS, FreeRTOSConfig.h).
+ *   The idle task gets the sleeps, so the shares add up to the period
+ * - times each task was switched in, counted by traceTASK_SWITCHED_IN
+ * - ISR time and entries, accumulated by sys_mon_isr_enter/exit in the
+ *   peripheral handlers of stm32h7rsxx_it.c
+ * - least free stack of each task since it started, in bytes
+ * - used bytes and high water mark of both tlsf_heap arenas
+ *
+ * The GUI reads the snapshot with sys_mon_read, the housekeeping task prints
+ * it every SYS_MON_REPORT_MS. The monitor also writes it as text to ITM
+ * stimulus port SYS_MON_ITM_PORT when the debugger enabled that port, so it
+ * does not mix with printf (port 0).
+ *
+ * The task time includes the ISRs that interrupted the task: the ISR share
+ * is a part of it, not an addition. The kernel handlers (SysTick, PendSV,
+ * SVC) and the naked TIM7 profiler handler are not counted as ISR time.
+ *
+ * The run time counter is the 32 bit cycle counter, it wraps every 7 s at
+ * 600 MHz. The monitor wakes every period, so no task runs longer than that
+ * without a switch and the per switch differences of the kernel stay exact:
+ * keep SYS_MON_PERIOD_MS well below the wrap time.
+ *
+ * Cost: a few cycles per context switch and per interrupt, and once per
+ * period a walk of the task list with the scheduler suspended (stack fill
+ * check, about 0.1 ms with the current stacks).
+ */
+#ifndef __SYS_MON_H
+#define __SYS_MON_H
+
+#include "main.h"
+#include "tlsf_heap.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Return codes */
+#define SYS_MON_OK                  0
+#define SYS_MON_ERROR              -1
+#define SYS_MON_NO_DATA            -2      /* No period completed yet */
+
+/* Period of the snapshot, 0 to leave the monitor task out */
+#ifndef SYS_MON_PERIOD_MS
+#define SYS_MON_PERIOD_MS           1000
+#endif
+
+/* Period of the printf report of the housekeeping task, 0 to disable */
+#ifndef SYS_MON_REPORT_MS
+#define SYS_MON_REPORT_MS           0
+#endif
+
+/* ITM stimulus port of the text report, -1 to disable (swo_prof uses 1 to 3) */
+#ifndef SYS_MON_ITM_PORT
+#define SYS_MON_ITM_PORT            4
+#endif
+
+/* Tasks in the snapshot, the others are only counted in the load */
+#define SYS_MON_TASKS               16
+
+/* Task name length, configMAX_TASK_NAME_LEN */
+#define SYS_MON_NAME_LEN            16
+
+typedef struct
+{
+	char name[SYS_MON_NAME_LEN];
+	uint16_t cpu_permille;          /* Share of the period, ISRs included */
+	uint16_t priority;
+	uint32_t switches;              /* Times switched in during the period */
+	uint32_t stack_free;            /* Least free stack since the start, bytes */
+} sys_mon_task_t;
+
+typedef struct
+{
+	uint32_t tick;                  /* HAL tick at the end of the period */
+	uint32_t period_ms;             /* Length of the period */
+	uint16_t cpu_permille;          /* Everything but the idle task */
+	uint16_t isr_permille;
+	uint32_t isr_entries;
+	uint32_t switches;              /* Context switches, all tasks */
+	uint32_t heap_size[TLSF_HEAP_TAGS];
+	uint32_t heap_used[TLSF_HEAP_TAGS];
+	uint32_t heap_used_max[TLSF_HEAP_TAGS]; /* Since the last tlsf_heap_reset */
+	uint32_t task_count;            /* Tasks in the system, up to SYS_MON_TASKS in task[] */
+	sys_mon_task_t task[SYS_MON_TASKS];
+} sys_mon_snapshot_t;
+
+/* ISR accounting, updated by sys_mon_isr_enter/exit */
+extern volatile uint32_t sys_mon_isr_nesting;
+extern volatile uint32_t sys_mon_isr_start;
+extern volatile uint32_t sys_mon_isr_cycles;
+extern volatile uint32_t sys_mon_isr_count;
+
+/**
+ * @brief Start the monitor task, call before the scheduler starts
+ * @return SYS_MON_OK or SYS_MON_ERROR
+ */
+int sys_mon_init(void);
+
+/**
+ * @brief Copy the last snapshot, from a task below the monitor priority
+ * @param snapshot Destination
+ * @return SYS_MON_OK, SYS_MON_NO_DATA before the first period
+ */
+int sys_mon_read(sys_mon_snapshot_t *snapshot);
+
+/**
+ * @brief Print the last snapshot over printf
+ */
+void sys_mon_print(void);
+
+/**
+ * @brief Run time statistics clock, portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+ */
+void sys_mon_timer_init(void);
+
+/* First thing in a peripheral IRQ handler. Only the outermost of nested
+ * handlers is timed; the updates run masked so that a preempting handler
+ * cannot split them. */
+static inline void sys_mon_isr_enter(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	if (sys_mon_isr_nesting++ == 0U)
+		sys_mon_isr_start = DWT->CYCCNT;
+	__set_PRIMASK(primask);
+}
+
+/* Last thing in a peripheral IRQ handler */
+static inline void sys_mon_isr_exit(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	sys_mon_isr_count++;
+	if (--sys_mon_isr_nesting == 0U)
+		sys_mon_isr_cycles += DWT->CYCCNT - sys_mon_isr_start;
+	__set_PRIMASK(primask);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SYS_MON_H */
@@ -0,0 +1,53 @@
+/*
+ * tcm.h
+ *
+ * Placement of hot code and tables in the tightly coupled memories.
+ *
+ * The application runs from XIP flash through the ICACHE and reads its
+ * constant tables through the DCACHE, a miss costs an XSPI burst. The hottest
+ * functions are copied to ITCM (64 KB, zero wait state fetch) and the tables
+ * they walk to DTCM by the startup code, before .data, from the .itcm_text and
+ * .dtcm_data sections of the linker script.
+ *
+ * What goes there is chosen in two ways:
+ * - by profile: the linker script lists input sections (one function or one
+ *   table each, the project builds with -ffunction-sections -fdata-sections)
+ *   between the tcm_place markers. Scripts/tcm_place.py rewrites that list
+ *   from the map file and a PC sample profile of a run: functions by samples
+ *   per byte, then the tables they reference, until the budgets are used.
+ *   The list names the sections the compiler emitted, after inlining: a hot
+ *   leaf inlined into its caller is moved with the caller.
+ * - by hand, with TCM_CODE and TCM_DATA on a definition
+ *
+ * Calls between flash and ITCM go through linker veneers (the distance is
+ * larger than a BL), calls within ITCM are direct. DTCM is not reachable by
+ * the DMA masters: only CPU data goes there. tcm_print reports what is left
+ * of both memories, the link fails when either overflows.
+ */
+#ifndef __TCM_H
+#define __TCM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Function copied to ITCM, kept out of line so that it is not inlined into
+ * a caller left in flash */
+#define TCM_CODE                    __attribute__((section(".itcm_text"), noinline))
+
+/* Table or variable copied to DTCM, CPU access only */
+#define TCM_DATA                    __attribute__((section(".dtcm_data")))
+
+/**
+ * @brief Print the TCM usage over printf: code and tables placed, space left
+ *        in ITCM and between the DTCM data and the MSP stack
+ */
+void tcm_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TCM_H */
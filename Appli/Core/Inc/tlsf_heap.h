@@ -0,0 +1,128 @@
+/*
+ * tlsf_heap.h
+ *
+ * Single heap of the application: FreeRTOS (pvPortMalloc, replaces heap_4)
+ * and newlib (malloc and friends, replaces the _sbrk heap) allocate from it.
+ *
+ * Two-level segregated fit allocator: the free blocks are kept in lists by
+ * size class (power of two, split in 16), a pair of bitmaps finds a class with
+ * a large enough block in constant time, freed blocks are merged with their
+ * free neighbours at once. Allocation and free take a bounded time, whatever
+ * the heap history, and run with the interrupts masked (no scheduler
+ * dependency, usable before the kernel starts).
+ *
+ * The FreeRTOS functions are linked in place of the ones of heap_4.c with
+ * -Wl,--wrap, heap_4.c stays in the generated project.
+ *
+ * The heap has two arenas, told apart by their tag:
+ * - TLSF_HEAP_INTERNAL: configTOTAL_HEAP_SIZE bytes of internal RAM, the
+ *   FreeRtosHeapSection of the linker script (DTCM). Kernel objects and task
+ *   stacks, small libc allocations.
+ * - TLSF_HEAP_PSRAM: TLSF_HEAP_PSRAM_SIZE bytes of external RAM
+ *   (HeapPsramSection). malloc requests of TLSF_HEAP_PSRAM_THRESHOLD bytes or
+ *   more (decoded WAV data) go there first.
+ * malloc falls back to the other arena when the first one is full;
+ * pvPortMalloc only uses the internal arena.
+ *
+ * Per arena statistics: used bytes and high water mark, failures,
+ * fragmentation (share of the free memory outside the largest free block)
+ * and a histogram of the allocation times in CPU cycles.
+ */
+#ifndef __TLSF_HEAP_H
+#define __TLSF_HEAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External RAM arena, 0 to keep every allocation in internal RAM */
+#ifndef TLSF_HEAP_PSRAM_SIZE
+#define TLSF_HEAP_PSRAM_SIZE        (4U * 1024U * 1024U)
+#endif
+
+/* malloc requests from this size are placed in external RAM first */
+#ifndef TLSF_HEAP_PSRAM_THRESHOLD
+#define TLSF_HEAP_PSRAM_THRESHOLD   4096U
+#endif
+
+/* Provide malloc, free and their newlib _r versions, 0 to leave them to the
+   C library (host tests) */
+#ifndef TLSF_HEAP_NEWLIB
+#define TLSF_HEAP_NEWLIB            1
+#endif
+
+/* Period of the statistics printed by the housekeeping task, 0 to disable */
+#ifndef TLSF_HEAP_REPORT_MS
+#define TLSF_HEAP_REPORT_MS         0
+#endif
+
+/* Allocation time buckets, bucket n counts the times below 2^(n + 5) cycles */
+#define TLSF_HEAP_HIST_BUCKETS      12
+
+typedef enum
+{
+	TLSF_HEAP_INTERNAL = 0,
+	TLSF_HEAP_PSRAM,
+	TLSF_HEAP_TAGS
+} tlsf_heap_tag_t;
+
+typedef struct
+{
+	uint32_t size;                  /* Arena bytes usable for blocks */
+	uint32_t used;                  /* Allocated bytes, block headers included */
+	uint32_t used_max;              /* High water mark of used */
+	uint32_t allocs;
+	uint32_t frees;
+	uint32_t failures;              /* Requests the arena could not serve */
+	uint32_t alloc_cycles_max;
+	uint32_t alloc_hist[TLSF_HEAP_HIST_BUCKETS];
+} tlsf_heap_arena_stats_t;
+
+typedef struct
+{
+	tlsf_heap_arena_stats_t arena[TLSF_HEAP_TAGS];
+	uint32_t start_tick;            /* HAL tick at the last reset */
+} tlsf_heap_stats_t;
+
+/* Statistics since the last tlsf_heap_reset, readable from the debugger */
+extern volatile tlsf_heap_stats_t tlsf_heap_stats;
+
+/**
+ * @brief Allocate from one arena only
+ * @return 8 byte aligned block, NULL when the arena has no room
+ */
+void *tlsf_heap_alloc(tlsf_heap_tag_t tag, size_t size);
+
+/**
+ * @brief Free a block of either arena, NULL is ignored
+ */
+void tlsf_heap_free(void *ptr);
+
+/**
+ * @brief Resize a block, in the same arena when possible
+ */
+void *tlsf_heap_realloc(void *ptr, size_t size);
+
+/**
+ * @brief Free bytes of an arena and its largest free block
+ */
+size_t tlsf_heap_free_size(tlsf_heap_tag_t tag, size_t *largest);
+
+/**
+ * @brief Clear the counters, the high water marks restart from the current use
+ */
+void tlsf_heap_reset(void);
+
+/**
+ * @brief Print the statistics over printf
+ */
+void tlsf_heap_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TLSF_HEAP_H */
@@ -0,0 +1,130 @@
+/*
+ * touch_async.h
+ *
+ * Interrupt driven sampling of the GT911 touch controller on I2C1.
+ *
+ * The TP_IRQ EXTI queues a chain of transfers on the I2C1 bus manager
+ * (i2c_bus.h), at the touch priority: status read, point read when the
+ * controller has new data, status clear. The completion of the point read
+ * publishes the sample in a one-slot mailbox (sequence counter, the reader
+ * retries when it was written meanwhile), so the TouchGFX task never waits
+ * for the bus: STM32TouchController::sampleTouch only reads the latest
+ * sample. An EXTI arriving while a chain is running is remembered and starts
+ * a new chain at the end of the current one.
+ *
+ * Up to five points are reported. touch_async_state filters them for a
+ * single pointer UI:
+ * - the primary point is the first finger down, tracked by its id; it does
+ *   not jump to another finger, the touch is released when it lifts
+ * - moves below TOUCH_ASYNC_JITTER_PX are ignored while pressed
+ * - with two fingers down the primary position is held (no drag while
+ *   pinching) and the pinch scale and center are reported instead
+ * - no report for TOUCH_ASYNC_TIMEOUT_MS releases the touch (lost IRQ)
+ */
+#ifndef __TOUCH_ASYNC_H
+#define __TOUCH_ASYNC_H
+
+#include "i2c_bus.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TOUCH_ASYNC_MAX_POINTS      5
+#define TOUCH_ASYNC_I2C_ADDR        0xBA
+
+/* Position change ignored while pressed, in pixels */
+#ifndef TOUCH_ASYNC_JITTER_PX
+#define TOUCH_ASYNC_JITTER_PX       2
+#endif
+
+/* A touch without report for this long is released */
+#ifndef TOUCH_ASYNC_TIMEOUT_MS
+#define TOUCH_ASYNC_TIMEOUT_MS      100
+#endif
+
+/* Period of the statistics printed by the housekeeping task, 0 to disable */
+#ifndef TOUCH_ASYNC_REPORT_MS
+#define TOUCH_ASYNC_REPORT_MS       0
+#endif
+
+/* Return codes */
+#define TOUCH_ASYNC_OK              0
+#define TOUCH_ASYNC_ERROR          -1
+
+typedef struct
+{
+	uint8_t id;                     /* Track id, stable while the finger is down */
+	uint16_t x;
+	uint16_t y;
+	uint16_t size;
+} touch_point_t;
+
+typedef struct
+{
+	uint8_t count;
+	touch_point_t point[TOUCH_ASYNC_MAX_POINTS];
+	uint32_t tick;                  /* HAL tick of the report */
+} touch_sample_t;
+
+typedef struct
+{
+	uint8_t pressed;
+	int16_t x;                      /* Filtered position of the primary point */
+	int16_t y;
+	uint8_t fingers;
+	uint16_t pinch_permille;        /* Two finger distance against the start of the pinch */
+	int16_t pinch_x;                /* Center of the two fingers */
+	int16_t pinch_y;
+} touch_state_t;
+
+typedef struct
+{
+	uint32_t irqs;                  /* TP_IRQ edges */
+	uint32_t coalesced;             /* Edges during a running chain */
+	uint32_t samples;               /* Reports published */
+	uint32_t errors;                /* Failed or refused transfers */
+	uint32_t start_tick;            /* HAL tick at the last reset */
+} touch_async_stats_t;
+
+/* Statistics since the last touch_async_reset, readable from the debugger */
+extern volatile touch_async_stats_t touch_async_stats;
+
+/**
+ * @brief Set up the transfers and queue a first read of the controller
+ * @return TOUCH_ASYNC_OK or TOUCH_ASYNC_ERROR
+ */
+int touch_async_init(void);
+
+/**
+ * @brief Start a sampling chain, from the TP_IRQ EXTI callback
+ */
+void touch_async_irq(void);
+
+/**
+ * @brief Copy the latest sample
+ * @return Sequence number of the sample, changes with every report
+ */
+uint32_t touch_async_read(touch_sample_t *sample);
+
+/**
+ * @brief Filter the latest sample for a single pointer, from one task
+ */
+void touch_async_state(touch_state_t *state);
+
+/**
+ * @brief Clear the statistics
+ */
+void touch_async_reset(void);
+
+/**
+ * @brief Print the statistics over printf
+ */
+void touch_async_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TOUCH_ASYNC_H */
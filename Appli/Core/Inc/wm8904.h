@@ -25,6 +25,11 @@
 #include "wm8904_reg.h"
 #include <stddef.h>
 
+/* Register writes held in the object before they are flushed */
+#ifndef WM8904_LOG_SIZE
+#define WM8904_LOG_SIZE          48U
+#endif
+
 /** @addtogroup BSP
   * @{
   */
@@ -45,6 +50,7 @@ typedef int32_t (*WM8904_DeInit_Func)  (void);
 typedef int32_t (*WM8904_GetTick_Func) (void);
 typedef int32_t (*WM8904_WriteReg_Func)(uint16_t, uint16_t, uint8_t*, uint16_t);
 typedef int32_t (*WM8904_ReadReg_Func) (uint16_t, uint16_t, uint8_t*, uint16_t);
+typedef int32_t (*WM8904_WriteBatch_Func)(uint16_t, uint8_t*, uint16_t);
 
 typedef struct
 {
@@ -54,14 +60,41 @@ typedef struct
   WM8904_WriteReg_Func      WriteReg;
   WM8904_ReadReg_Func       ReadReg;
   WM8904_GetTick_Func       GetTick;
+  WM8904_WriteBatch_Func    WriteBatch;   /* Optional: Count records of 3 bytes
+                                             (register, value MSB, value LSB),
+                                             one register write each, in order
+                                             and without other bus traffic in
+                                             between */
 } WM8904_IO_t;
 
+typedef struct
+{
+  uint16_t  Reg;
+  uint16_t  Value;
+} WM8904_Reg_t;
+
+typedef struct
+{
+  uint32_t  BusReads;           /* Register reads sent to the codec */
+  uint32_t  BusWrites;          /* Register writes sent to the codec */
+  uint32_t  Flushes;            /* Batches of logged writes sent */
+  uint32_t  CachedReads;        /* Reads served by the shadow registers */
+  uint32_t  SkippedWrites;      /* Writes of the value the codec already holds */
+  uint32_t  BusBytes;           /* Register and value bytes of the above */
+} WM8904_Stats_t;
 
 typedef struct
 {
   WM8904_IO_t         IO;
   wm8904_ctx_t        Ctx;
   uint8_t             IsInitialized;
+  /* Shadow of the codec registers, the driver being their only writer */
+  uint16_t            Shadow[WM8904_REG_COUNT];
+  uint32_t            ShadowValid[WM8904_REG_COUNT / 32U];
+  /* Writes of the current call, sent in order by one flush */
+  uint8_t             Log[WM8904_LOG_SIZE * 3U];
+  uint16_t            LogCount;
+  WM8904_Stats_t      Stats;
 } WM8904_Object_t;
 
 typedef struct
@@ -205,6 +238,10 @@ int32_t WM8904_GetProtocol(WM8904_Object_t *pObj, uint32_t *Protocol);
 int32_t WM8904_SetFrequency(WM8904_Object_t *pObj, uint32_t AudioFreq);
 int32_t WM8904_GetFrequency(WM8904_Object_t *pObj, uint32_t *AudioFreq);
 int32_t WM8904_Reset(WM8904_Object_t *pObj);
+
+/* Register shadow */
+int32_t WM8904_ApplyProfile(WM8904_Object_t *pObj, const WM8904_Reg_t *pRegs, uint32_t Count);
+void    WM8904_InvalidateCache(WM8904_Object_t *pObj);
 /**
   * @}
   */
@@ -184,6 +184,9 @@ extern "C" {
 
 #define WM8904_FLL_TEST0              0x00F7U
 #define WM8904_FLL_TEST1              0x00F8U
+
+/* Size of the register map */
+#define WM8904_REG_COUNT              0x0100U
 /**
   * @}
   */
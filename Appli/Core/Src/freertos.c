@@ -24,6 +24,7 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "idle_sleep.h"
 
 /* USER CODE END Includes */
 
@@ -69,6 +70,7 @@ void vApplicationIdleHook( void )
    memory allocated by the kernel to any task that has since been deleted. */
   
    vTaskSetApplicationTaskTag(NULL, IdleTaskHook);
+   idle_sleep_wfi();
 }
 /* USER CODE END 2 */
 
@@ -30,17 +30,46 @@
 #include <math.h>
 #include "dsp/fast_math_functions_f16.h"
 #include "audio_drv.h"
+#include "mp3_decoder.h"
 #include "lfs_user.h"
+#include "media_prefetch.h"
+#include "boot_profile.h"
+#include "dcache_maint.h"
+#include "fb_dirty.h"
+#include "fb_strip.h"
+#include "dma2d_batch.h"
+#include "gui_cache.h"
+#include "frame_prof.h"
+#include "touch_async.h"
+#include "i2c_bus.h"
+#include "tlsf_heap.h"
+#include "block_pool.h"
+#include "tcm.h"
+#include "swo_prof.h"
+#include "sys_mon.h"
+#include "idle_sleep.h"
 
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN PTD */
-
+/* Statistics report of the housekeeping task */
+typedef struct
+{
+	uint32_t period_ms;
+	void (*print)(void);
+	void (*reset)(void);            /* NULL: the module keeps its statistics */
+	uint32_t elapsed_ms;
+} report_t;
 /* USER CODE END PTD */
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+/* Audio (littlefs mount, decoder, SAI) starts once the first frame is out */
+#define AUDIO_START_FIRST_FRAME_TIMEOUT_MS  (2000U)
+
+/* Wake period of the housekeeping task */
+#define HOUSEKEEPING_PERIOD_MS  (10U)
 
 /* USER CODE END PD */
 
@@ -74,8 +103,8 @@ DMA_HandleTypeDef handle_GPDMA1_Channel15;
 osThreadId_t defaultTaskHandle;
 const osThreadAttr_t defaultTask_attributes = {
   .name = "defaultTask",
-  .stack_size = 256 * 4,
-  .priority = (osPriority_t) osPriorityNormal,
+  .stack_size = 1024 * 4,
+  .priority = (osPriority_t) osPriorityBelowNormal,
 };
 /* Definitions for TouchGFXTask */
 osThreadId_t TouchGFXTaskHandle;
@@ -89,7 +118,7 @@ osThreadId_t audioTaskHandleHandle;
 const osThreadAttr_t audioTaskHandle_attributes = {
   .name = "audioTaskHandle",
   .stack_size = 4096 * 4,
-  .priority = (osPriority_t) osPriorityNormal,
+  .priority = (osPriority_t) osPriorityRealtime,
 };
 /* Definitions for queue_gpio */
 osMessageQueueId_t queue_gpioHandle;
@@ -110,6 +139,56 @@ ALIGN_32BYTES (int16_t sine_wave_440hz_48khz[SINE_WAVE_SIZE]) __attribute__((sec
 static const float sampling_frequency = 48000.0f;
 static float phase_inc = M_TWOPI * 440.0f / sampling_frequency;
 static volatile uint8_t buffer_is_proccessing = 0;
+
+/* Reports enabled by their X_REPORT_MS, up to the NULL entry */
+static report_t reports[] = {
+#if DCACHE_MAINT_REPORT_MS > 0
+	{ DCACHE_MAINT_REPORT_MS, dcache_maint_print, dcache_maint_reset },
+#endif
+#if FB_DIRTY_REPORT_MS > 0
+	{ FB_DIRTY_REPORT_MS, fb_dirty_print, fb_dirty_reset },
+#endif
+#if FB_STRIP_ENABLE && FB_STRIP_REPORT_MS > 0
+	{ FB_STRIP_REPORT_MS, fb_strip_print, fb_strip_reset },
+#endif
+#if DMA2D_BATCH_REPORT_MS > 0
+	{ DMA2D_BATCH_REPORT_MS, dma2d_batch_print, dma2d_batch_reset },
+#endif
+#if GUI_CACHE_REPORT_MS > 0
+	{ GUI_CACHE_REPORT_MS, gui_cache_print, gui_cache_reset },
+#endif
+#if FRAME_PROF_REPORT_MS > 0
+	{ FRAME_PROF_REPORT_MS, frame_prof_print, NULL },
+#endif
+#if TOUCH_ASYNC_REPORT_MS > 0
+	{ TOUCH_ASYNC_REPORT_MS, touch_async_print, touch_async_reset },
+#endif
+#if I2C_BUS_REPORT_MS > 0
+	{ I2C_BUS_REPORT_MS, i2c_bus_print, i2c_bus_reset },
+#endif
+#if TLSF_HEAP_REPORT_MS > 0
+	{ TLSF_HEAP_REPORT_MS, tlsf_heap_print, tlsf_heap_reset },
+#endif
+#if BLOCK_POOL_REPORT_MS > 0
+	{ BLOCK_POOL_REPORT_MS, block_pool_print, block_pool_reset },
+#endif
+#if MP3_DECODER_REPORT_MS > 0
+	{ MP3_DECODER_REPORT_MS, mp3_decoder_stats_print, mp3_decoder_stats_reset },
+#endif
+#if SWO_PROF_REPORT_MS > 0
+	{ SWO_PROF_REPORT_MS, swo_prof_print, swo_prof_reset },
+#endif
+#if AUDIO_DRV_REPORT_MS > 0
+	{ AUDIO_DRV_REPORT_MS, audio_drv_stats_print, audio_drv_stats_reset },
+#endif
+#if IDLE_SLEEP_REPORT_MS > 0
+	{ IDLE_SLEEP_REPORT_MS, idle_sleep_print, idle_sleep_reset },
+#endif
+#if SYS_MON_REPORT_MS > 0
+	{ SYS_MON_REPORT_MS, sys_mon_print, NULL },
+#endif
+	{ 0, NULL, NULL, 0 },
+};
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -148,7 +227,8 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
-
+  boot_profile_attach();
+  boot_profile_mark(BOOT_PHASE_APPLI_MAIN);
   /* USER CODE END 1 */
 
   /* MPU Configuration--------------------------------------------------------*/
@@ -175,7 +255,7 @@ int main(void)
   /* USER CODE END Init */
 
   /* USER CODE BEGIN SysInit */
-
+  boot_profile_mark(BOOT_PHASE_APPLI_HAL);
   /* USER CODE END SysInit */
 
   /* Initialize all configured peripherals */
@@ -196,7 +276,7 @@ int main(void)
   /* Call PreOsInit function */
   MX_TouchGFX_PreOSInit();
   /* USER CODE BEGIN 2 */
-
+  boot_profile_mark(BOOT_PHASE_APPLI_PERIPH);
   /* USER CODE END 2 */
 
   /* Init scheduler */
@@ -238,10 +318,15 @@ int main(void)
 
   /* USER CODE BEGIN RTOS_THREADS */
   /* add threads, ... */
+  /* I2C1 is shared by the touch controller and the codec */
+  i2c_bus_init(&hi2c1);
+  /* Per task load, stack and heap snapshot every second */
+  sys_mon_init();
   /* USER CODE END RTOS_THREADS */
 
   /* USER CODE BEGIN RTOS_EVENTS */
   /* add events, ... */
+  boot_profile_mark(BOOT_PHASE_SCHEDULER);
   /* USER CODE END RTOS_EVENTS */
 
   /* Start scheduler */
@@ -897,11 +982,22 @@ int __io_putchar(int ch) {
 void StartDefaultTask(void *argument)
 {
   /* USER CODE BEGIN 5 */
-	vTaskDelete(NULL);
+	// Housekeeping below the GUI: the periodic statistics reports
   /* Infinite loop */
   for(;;)
   {
-    osDelay(1);
+	  vTaskDelay(pdMS_TO_TICKS(HOUSEKEEPING_PERIOD_MS));
+	  for (report_t *r = reports; r->print != NULL; r++)
+	  {
+		  r->elapsed_ms += HOUSEKEEPING_PERIOD_MS;
+		  if (r->elapsed_ms >= r->period_ms)
+		  {
+			  r->print();
+			  if (r->reset != NULL)
+				  r->reset();
+			  r->elapsed_ms = 0;
+		  }
+	  }
   }
   /* USER CODE END 5 */
 }
@@ -923,14 +1019,42 @@ void audioTaskHandler(void *argument)
 //	lfs_list_dir("/music");
 //	littlefs_dump_mp3_header("/music/guitar.mp3");
 //	littlefs_list_music();
-	audio_drv_init(&audio_drv);
-	audio_drv_start_dma(&audio_drv);
+	// No spare mem-to-mem DMA channel is configured yet: CPU touch-ahead copy
+	media_prefetch_init(NULL);
+	// Mount, decoder start and the first MP3 reads compete with the GUI for
+	// the CPU and XSPI2: keep them out of the way until the first frame
+	boot_profile_wait(BOOT_PHASE_FIRST_FRAME, AUDIO_START_FIRST_FRAME_TIMEOUT_MS);
+	if (audio_drv_init(&audio_drv) == 0 && audio_drv_start_dma(&audio_drv) == 0)
+	{
+		boot_profile_mark(BOOT_PHASE_AUDIO_READY);
+	}
+	boot_profile_print();
+	tcm_print();
+#if SWO_PROF_RATE_HZ > 0
+	// Fails without a debugger enabling the ITM, swo_prof_stats.rate_hz stays 0
+	swo_prof_start(SWO_PROF_RATE_HZ);
+#endif
+	dcache_maint_reset();
+	fb_dirty_reset();
+	fb_strip_reset();
+	dma2d_batch_reset();
+	gui_cache_reset();
+	frame_prof_reset();
+	touch_async_reset();
+	i2c_bus_reset();
+	tlsf_heap_reset();
+	block_pool_reset();
+	mp3_decoder_stats_reset();
+	swo_prof_reset();
+	audio_drv_stats_reset();
+	idle_sleep_reset();
 	// ---- Public config ----
 
+	// Refill on the SAI DMA interrupts, see audio_drv.h for the priorities
   /* Infinite loop */
   for(;;)
   {
-	  vTaskDelay(pdMS_TO_TICKS(10));
+	  audio_drv_process(&audio_drv, osWaitForever);
   }
   /* USER CODE END audioTaskHandler */
 }
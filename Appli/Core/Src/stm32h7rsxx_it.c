@@ -22,6 +22,10 @@
 #include "stm32h7rsxx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "frame_prof.h"
+#include "idle_sleep.h"
+#include "swo_prof.h"
+#include "sys_mon.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -51,7 +55,20 @@
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+/*
+ * Line event about to be handled by HAL_LTDC_IRQHandler. The TouchGFX HAL
+ * alternates it between the line before the active area (the VSYNC) and the
+ * line before the porch, see HAL_LTDC_LineEventCallback.
+ */
+static int ltdc_line_event(void)
+{
+  return (LTDC->ISR & LTDC_ISR_LIF) != 0U && (LTDC->IER & LTDC_IER_LIE) != 0U;
+}
 
+static int ltdc_line_is_vsync(void)
+{
+  return LTDC->LIPCR == (LTDC->BPCR & LTDC_BPCR_AVBP_Msk) - 1U;
+}
 /* USER CODE END 0 */
 
 /* External variables --------------------------------------------------------*/
@@ -65,6 +82,7 @@ extern DMA_HandleTypeDef handle_GPDMA1_Channel15;
 extern TIM_HandleTypeDef htim6;
 
 /* USER CODE BEGIN EV */
+extern I2C_HandleTypeDef hi2c1;
 
 /* USER CODE END EV */
 
@@ -172,11 +190,11 @@ void DebugMon_Handler(void)
 void EXTI3_IRQHandler(void)
 {
   /* USER CODE BEGIN EXTI3_IRQn 0 */
-
+  sys_mon_isr_enter();
   /* USER CODE END EXTI3_IRQn 0 */
   HAL_GPIO_EXTI_IRQHandler(TP_IRQ_Pin);
   /* USER CODE BEGIN EXTI3_IRQn 1 */
-
+  sys_mon_isr_exit();
   /* USER CODE END EXTI3_IRQn 1 */
 }
 
@@ -186,11 +204,11 @@ void EXTI3_IRQHandler(void)
 void EXTI13_IRQHandler(void)
 {
   /* USER CODE BEGIN EXTI13_IRQn 0 */
-
+  sys_mon_isr_enter();
   /* USER CODE END EXTI13_IRQn 0 */
   HAL_GPIO_EXTI_IRQHandler(USER_BTN_Pin);
   /* USER CODE BEGIN EXTI13_IRQn 1 */
-
+  sys_mon_isr_exit();
   /* USER CODE END EXTI13_IRQn 1 */
 }
 
@@ -200,11 +218,11 @@ void EXTI13_IRQHandler(void)
 void TIM6_IRQHandler(void)
 {
   /* USER CODE BEGIN TIM6_IRQn 0 */
-
+  sys_mon_isr_enter();
   /* USER CODE END TIM6_IRQn 0 */
   HAL_TIM_IRQHandler(&htim6);
   /* USER CODE BEGIN TIM6_IRQn 1 */
-
+  sys_mon_isr_exit();
   /* USER CODE END TIM6_IRQn 1 */
 }
 
@@ -214,11 +232,11 @@ void TIM6_IRQHandler(void)
 void HPDMA1_Channel0_IRQHandler(void)
 {
   /* USER CODE BEGIN HPDMA1_Channel0_IRQn 0 */
-
+  sys_mon_isr_enter();
   /* USER CODE END HPDMA1_Channel0_IRQn 0 */
   HAL_DMA_IRQHandler(&handle_HPDMA1_Channel0);
   /* USER CODE BEGIN HPDMA1_Channel0_IRQn 1 */
-
+  sys_mon_isr_exit();
   /* USER CODE END HPDMA1_Channel0_IRQn 1 */
 }
 
@@ -228,11 +246,11 @@ void HPDMA1_Channel0_IRQHandler(void)
 void HPDMA1_Channel1_IRQHandler(void)
 {
   /* USER CODE BEGIN HPDMA1_Channel1_IRQn 0 */
-
+  sys_mon_isr_enter();
   /* USER CODE END HPDMA1_Channel1_IRQn 0 */
   HAL_DMA_IRQHandler(&handle_HPDMA1_Channel1);
   /* USER CODE BEGIN HPDMA1_Channel1_IRQn 1 */
-
+  sys_mon_isr_exit();
   /* USER CODE END HPDMA1_Channel1_IRQn 1 */
 }
 
@@ -242,11 +260,23 @@ void HPDMA1_Channel1_IRQHandler(void)
 void LTDC_IRQHandler(void)
 {
   /* USER CODE BEGIN LTDC_IRQn 0 */
-
+  sys_mon_isr_enter();
+  if (ltdc_line_event())
+  {
+    if (ltdc_line_is_vsync())
+    {
+      idle_sleep_event(IDLE_SLEEP_SRC_VSYNC);
+      frame_prof_vsync();
+    }
+    else
+    {
+      idle_sleep_event(IDLE_SLEEP_SRC_PORCH);
+    }
+  }
   /* USER CODE END LTDC_IRQn 0 */
   HAL_LTDC_IRQHandler(&hltdc);
   /* USER CODE BEGIN LTDC_IRQn 1 */
-
+  sys_mon_isr_exit();
   /* USER CODE END LTDC_IRQn 1 */
 }
 
@@ -256,11 +286,11 @@ void LTDC_IRQHandler(void)
 void DMA2D_IRQHandler(void)
 {
   /* USER CODE BEGIN DMA2D_IRQn 0 */
-
+  sys_mon_isr_enter();
   /* USER CODE END DMA2D_IRQn 0 */
   HAL_DMA2D_IRQHandler(&hdma2d);
   /* USER CODE BEGIN DMA2D_IRQn 1 */
-
+  sys_mon_isr_exit();
   /* USER CODE END DMA2D_IRQn 1 */
 }
 
@@ -270,11 +300,11 @@ void DMA2D_IRQHandler(void)
 void JPEG_IRQHandler(void)
 {
   /* USER CODE BEGIN JPEG_IRQn 0 */
-
+  sys_mon_isr_enter();
   /* USER CODE END JPEG_IRQn 0 */
   HAL_JPEG_IRQHandler(&hjpeg);
   /* USER CODE BEGIN JPEG_IRQn 1 */
-
+  sys_mon_isr_exit();
   /* USER CODE END JPEG_IRQn 1 */
 }
 
@@ -284,11 +314,11 @@ void JPEG_IRQHandler(void)
 void GPDMA1_Channel15_IRQHandler(void)
 {
   /* USER CODE BEGIN GPDMA1_Channel15_IRQn 0 */
-
+  sys_mon_isr_enter();
   /* USER CODE END GPDMA1_Channel15_IRQn 0 */
   HAL_DMA_IRQHandler(&handle_GPDMA1_Channel15);
   /* USER CODE BEGIN GPDMA1_Channel15_IRQn 1 */
-
+  sys_mon_isr_exit();
   /* USER CODE END GPDMA1_Channel15_IRQn 1 */
 }
 
@@ -298,11 +328,15 @@ void GPDMA1_Channel15_IRQHandler(void)
 void GPU2D_IRQHandler(void)
 {
   /* USER CODE BEGIN GPU2D_IRQn 0 */
-
+  sys_mon_isr_enter();
+  if ((HAL_GPU2D_ReadRegister(&hgpu2d, GPU2D_ITCTRL) & GPU2D_FLAG_CLC) != 0U)
+  {
+    frame_prof_gpu2d_done();
+  }
   /* USER CODE END GPU2D_IRQn 0 */
   HAL_GPU2D_IRQHandler(&hgpu2d);
   /* USER CODE BEGIN GPU2D_IRQn 1 */
-
+  sys_mon_isr_exit();
   /* USER CODE END GPU2D_IRQn 1 */
 }
 
@@ -312,14 +346,50 @@ void GPU2D_IRQHandler(void)
 void GPU2D_ER_IRQHandler(void)
 {
   /* USER CODE BEGIN GPU2D_ER_IRQn 0 */
-
+  sys_mon_isr_enter();
   /* USER CODE END GPU2D_ER_IRQn 0 */
   HAL_GPU2D_ER_IRQHandler(&hgpu2d);
   /* USER CODE BEGIN GPU2D_ER_IRQn 1 */
-
+  sys_mon_isr_exit();
   /* USER CODE END GPU2D_ER_IRQn 1 */
 }
 
 /* USER CODE BEGIN 1 */
 
+/**
+  * @brief This function handles I2C1 event interrupt, touch controller transfers.
+  */
+void I2C1_EV_IRQHandler(void)
+{
+  sys_mon_isr_enter();
+  HAL_I2C_EV_IRQHandler(&hi2c1);
+  sys_mon_isr_exit();
+}
+
+/**
+  * @brief This function handles I2C1 error interrupt.
+  */
+void I2C1_ER_IRQHandler(void)
+{
+  sys_mon_isr_enter();
+  HAL_I2C_ER_IRQHandler(&hi2c1);
+  sys_mon_isr_exit();
+}
+
+/**
+  * @brief This function handles TIM7 interrupt, PC sampling of the profiler.
+  *        Naked: passes the exception frame of the interrupted context and
+  *        EXC_RETURN to swo_prof_sample, which returns from the exception.
+  */
+__attribute__((naked)) void TIM7_IRQHandler(void)
+{
+  __asm volatile(
+    "tst lr, #4          \n"
+    "ite eq              \n"
+    "mrseq r0, msp       \n"
+    "mrsne r0, psp       \n"
+    "mov r1, lr          \n"
+    "b swo_prof_sample   \n");
+}
+
 /* USER CODE END 1 */
@@ -23,7 +23,7 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
-
+#include "boot_profile.h"
 /* USER CODE END Includes */
 
 /* Private define ------------------------------------------------------------*/
@@ -66,7 +66,15 @@ void MX_TouchGFX_Init(void)
 {
     // Calling forward to touchgfx_init in C++ domain
     touchgfx_components_init();
+    /* USER CODE BEGIN MX_TouchGFX_Init */
+    // touchgfx_init() is run by TouchGFX_Task: the framework is built while
+    // the scheduler is already up instead of delaying osKernelStart
+#if 0
+    /* USER CODE END MX_TouchGFX_Init */
     touchgfx_init();
+    /* USER CODE BEGIN MX_TouchGFX_Init 2 */
+#endif
+    /* USER CODE END MX_TouchGFX_Init 2 */
 }
 
 /**
@@ -83,6 +91,11 @@ void MX_TouchGFX_Process(void)
  */
 void TouchGFX_Task(void* argument)
 {
+    /* USER CODE BEGIN TouchGFX_Task */
+    touchgfx_init();
+    boot_profile_mark(BOOT_PHASE_GUI_INIT);
+    /* USER CODE END TouchGFX_Task */
+
     // Calling forward to touchgfx_taskEntry in C++ domain
     touchgfx_taskEntry();
 }
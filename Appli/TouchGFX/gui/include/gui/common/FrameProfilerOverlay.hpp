@@ -0,0 +1,46 @@
+#ifndef FRAMEPROFILEROVERLAY_HPP
+#define FRAMEPROFILEROVERLAY_HPP
+
+#include <touchgfx/widgets/Widget.hpp>
+#include "frame_prof.h"
+
+/**
+ * On-screen summary of the frame profiler (frame_prof.h): frame rate, 99th
+ * percentile render time, missed VSYNCs of the window and MCU load.
+ *
+ * The text is drawn by the CPU with a built-in 3x5 font into a small static
+ * pixel buffer (no font, text resource or dynamic bitmap needed), every
+ * FRAME_PROF_OVERLAY_TICKS; in between a redraw of the widget is one blit of
+ * the buffer.
+ */
+class FrameProfilerOverlay : public touchgfx::Widget
+{
+public:
+    FrameProfilerOverlay();
+    virtual ~FrameProfilerOverlay();
+
+    /**
+     * Size the widget to the buffer and start the refresh, call once the
+     * widget is added to the screen.
+     */
+    void start();
+
+    /**
+     * Stop the refresh, call from tearDownScreen.
+     */
+    void stop();
+
+    virtual void handleTickEvent();
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+
+    virtual touchgfx::Rect getSolidRect() const;
+
+private:
+    void render(const char* text);
+
+    bool running;
+    uint16_t ticks;
+};
+
+#endif // FRAMEPROFILEROVERLAY_HPP
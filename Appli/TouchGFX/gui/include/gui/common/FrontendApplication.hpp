@@ -2,6 +2,7 @@
 #define FRONTENDAPPLICATION_HPP
 
 #include <gui_generated/common/FrontendApplicationBase.hpp>
+#include "frame_prof.h"
 
 class FrontendHeap;
 
@@ -15,6 +16,7 @@ public:
 
     virtual void handleTickEvent()
     {
+        frame_prof_tick();
         model.tick();
         FrontendApplicationBase::handleTickEvent();
     }
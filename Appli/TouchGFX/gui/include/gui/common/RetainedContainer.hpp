@@ -0,0 +1,56 @@
+#ifndef RETAINEDCONTAINER_HPP
+#define RETAINEDCONTAINER_HPP
+
+#include <touchgfx/containers/CacheableContainer.hpp>
+
+/**
+ * Container drawn from a bitmap of its rendered children.
+ *
+ * Meant for the static parts of a screen: backgrounds, frames, labels, vector
+ * icons. retain() renders the children once into a dynamic bitmap, after that
+ * a redraw of the container area (a widget moving over it, a transition) is a
+ * single blit instead of the GPU2D/DMA2D work of every child. A child that
+ * invalidates itself marks its area of the bitmap stale; the area is rendered
+ * again before the next frame uses it, so changing a child property needs
+ * nothing more than the usual invalidate(). Moving the container or changing
+ * its own alpha does not touch the bitmap. See gui_cache.h.
+ */
+class RetainedContainer : public touchgfx::CacheableContainer
+{
+public:
+    RetainedContainer();
+    virtual ~RetainedContainer();
+
+    /**
+     * Allocate the bitmap at the container size and render the children into it.
+     * Call once the container is sized and its children are added.
+     *
+     * @return false when the bitmap cache is full or disabled, the children are
+     *         then drawn every frame as in a plain Container.
+     */
+    bool retain();
+
+    /**
+     * Free the bitmap, call from tearDownScreen.
+     */
+    void release();
+
+    bool isRetained() const
+    {
+        return cacheId != touchgfx::BITMAP_INVALID;
+    }
+
+    virtual void invalidate() const;
+    virtual void invalidateRect(touchgfx::Rect& invalidatedArea) const;
+    virtual void setupDrawChain(const touchgfx::Rect& invalidatedArea, touchgfx::Drawable** nextPreviousElement);
+
+private:
+    void refresh();
+
+    touchgfx::BitmapId cacheId;
+    mutable touchgfx::Rect stale;      // Area of the bitmap to render again
+    mutable bool selfInvalidation;
+    bool rendering;
+};
+
+#endif // RETAINEDCONTAINER_HPP
@@ -3,6 +3,7 @@
 
 #include <gui_generated/screen1_screen/Screen1ViewBase.hpp>
 #include <gui/screen1_screen/Screen1Presenter.hpp>
+#include <gui/common/FrameProfilerOverlay.hpp>
 
 class Screen1View : public Screen1ViewBase
 {
@@ -14,6 +15,9 @@ public:
 
     virtual void handleKeyEvent(uint8_t key);
 protected:
+#if FRAME_PROF_OVERLAY
+    FrameProfilerOverlay profilerOverlay;
+#endif
 };
 
 #endif // SCREEN1VIEW_HPP
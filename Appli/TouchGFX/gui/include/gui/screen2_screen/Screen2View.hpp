@@ -3,6 +3,7 @@
 
 #include <gui_generated/screen2_screen/Screen2ViewBase.hpp>
 #include <gui/screen2_screen/Screen2Presenter.hpp>
+#include <gui/common/FrameProfilerOverlay.hpp>
 
 class Screen2View : public Screen2ViewBase
 {
@@ -12,6 +13,9 @@ public:
     virtual void setupScreen();
     virtual void tearDownScreen();
 protected:
+#if FRAME_PROF_OVERLAY
+    FrameProfilerOverlay profilerOverlay;
+#endif
 };
 
 #endif // SCREEN2VIEW_HPP
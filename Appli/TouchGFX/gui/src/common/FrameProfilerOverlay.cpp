@@ -0,0 +1,164 @@
+#include <gui/common/FrameProfilerOverlay.hpp>
+#include <touchgfx/Application.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <stdio.h>
+#include "dcache_maint.h"
+
+using namespace touchgfx;
+
+namespace
+{
+const int SCALE = 2;                        // Screen pixels per font pixel
+const int PADDING = 2;
+const int CHARS = 40;                       // Longest line
+const int WIDTH = CHARS * 4 * SCALE + 2 * PADDING;
+const int HEIGHT = 5 * SCALE + 2 * PADDING;
+const uint32_t BACKGROUND = 0xA0000000;     // ARGB8888
+const uint32_t FOREGROUND = 0xFFFFFFFF;
+
+// Copy of the profiler window, GUI task only
+frame_prof_record_t records[FRAME_PROF_DEPTH];
+
+// Text of the overlay, read by GPU2D/DMA2D when the widget is drawn. The
+// screens share it, only one overlay is running at a time
+LOCATION_PRAGMA_NOLOAD("TouchGFX_Framebuffer")
+uint32_t pixels[WIDTH * HEIGHT] LOCATION_ATTRIBUTE_NOLOAD("TouchGFX_Framebuffer");
+
+// 3x5 glyphs, one bit per pixel, first row in bits 14..12
+uint16_t glyph(char c)
+{
+    switch (c)
+    {
+    case '0': return 0x7B6F;
+    case '1': return 0x2C97;
+    case '2': return 0x73E7;
+    case '3': return 0x73CF;
+    case '4': return 0x5BC9;
+    case '5': return 0x79CF;
+    case '6': return 0x79EF;
+    case '7': return 0x7249;
+    case '8': return 0x7BEF;
+    case '9': return 0x7BCF;
+    case '.': return 0x0002;
+    case '%': return 0x52A5;
+    case 'C': return 0x7927;
+    case 'F': return 0x79A4;
+    case 'I': return 0x7497;
+    case 'M': return 0x5FED;
+    case 'P': return 0x7BE4;
+    case 'S': return 0x79CF;
+    case 'U': return 0x5B6F;
+    default:  return 0;
+    }
+}
+}
+
+FrameProfilerOverlay::FrameProfilerOverlay()
+    : Widget(), running(false), ticks(0)
+{
+}
+
+FrameProfilerOverlay::~FrameProfilerOverlay()
+{
+    stop();
+}
+
+void FrameProfilerOverlay::start()
+{
+    if (running)
+    {
+        return;
+    }
+
+    setWidthHeight(WIDTH, HEIGHT);
+    render("");
+    running = true;
+    ticks = FRAME_PROF_OVERLAY_TICKS;
+    Application::getInstance()->registerTimerWidget(this);
+    invalidate();
+}
+
+void FrameProfilerOverlay::stop()
+{
+    if (!running)
+    {
+        return;
+    }
+
+    Application::getInstance()->unregisterTimerWidget(this);
+    running = false;
+}
+
+void FrameProfilerOverlay::handleTickEvent()
+{
+    if (--ticks != 0)
+    {
+        return;
+    }
+    ticks = FRAME_PROF_OVERLAY_TICKS;
+
+    frame_prof_summary_t s;
+    char text[CHARS + 1];
+
+    frame_prof_summary(&s, records, FRAME_PROF_DEPTH);
+    snprintf(text, sizeof(text), "%lu.%lu FPS  P99 %lu.%lu MS  MISS %lu  CPU %u%%",
+             (unsigned long)(s.fps_x10 / 10U), (unsigned long)(s.fps_x10 % 10U),
+             (unsigned long)(s.render_us_p99 / 1000U), (unsigned long)((s.render_us_p99 / 100U) % 10U),
+             (unsigned long)s.missed_window, (unsigned)HAL::getInstance()->getMCULoadPct());
+    render(text);
+    invalidate();
+}
+
+void FrameProfilerOverlay::draw(const Rect& invalidatedArea) const
+{
+    if (!running)
+    {
+        return;
+    }
+
+    Rect absolute = getAbsoluteRect();
+    Rect dirty = invalidatedArea;
+    translateRectToAbsolute(dirty);
+    HAL::lcd().blitCopy(reinterpret_cast<const uint8_t*>(pixels), Bitmap::ARGB8888, absolute, dirty, 255, true);
+}
+
+Rect FrameProfilerOverlay::getSolidRect() const
+{
+    return Rect(); // Translucent background
+}
+
+void FrameProfilerOverlay::render(const char* text)
+{
+    for (int i = 0; i < WIDTH * HEIGHT; i++)
+    {
+        pixels[i] = BACKGROUND;
+    }
+
+    for (int n = 0; n < CHARS && text[n] != 0; n++)
+    {
+        const uint16_t bits = glyph(text[n]);
+
+        for (int row = 0; row < 5; row++)
+        {
+            for (int col = 0; col < 3; col++)
+            {
+                if (!(bits & (1U << (14 - row * 3 - col))))
+                {
+                    continue;
+                }
+
+                uint32_t* p = pixels + (PADDING + row * SCALE) * WIDTH + PADDING + (n * 4 + col) * SCALE;
+                for (int y = 0; y < SCALE; y++, p += WIDTH)
+                {
+                    for (int x = 0; x < SCALE; x++)
+                    {
+                        p[x] = FOREGROUND;
+                    }
+                }
+            }
+        }
+    }
+
+    // Read by GPU2D/DMA2D when the image is drawn
+    dcache_maint_mark(pixels, WIDTH * HEIGHT * 4);
+}
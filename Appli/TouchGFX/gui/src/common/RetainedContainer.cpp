@@ -0,0 +1,118 @@
+#include <gui/common/RetainedContainer.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include "gui_cache.h"
+
+using namespace touchgfx;
+
+RetainedContainer::RetainedContainer()
+    : CacheableContainer(), cacheId(BITMAP_INVALID), stale(), selfInvalidation(false), rendering(false)
+{
+}
+
+RetainedContainer::~RetainedContainer()
+{
+    release();
+}
+
+bool RetainedContainer::retain()
+{
+#if GUI_CACHE_ENABLE
+    if (isRetained() || getWidth() <= 0 || getHeight() <= 0)
+    {
+        return isRetained();
+    }
+
+    cacheId = Bitmap::dynamicBitmapCreate(getWidth(), getHeight(), Bitmap::ARGB8888);
+    if (cacheId == BITMAP_INVALID)
+    {
+        return false;
+    }
+
+    setCacheBitmap(cacheId);
+    stale = Rect(0, 0, getWidth(), getHeight());
+    refresh();
+    enableCachedMode(true);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void RetainedContainer::release()
+{
+    if (!isRetained())
+    {
+        return;
+    }
+
+    enableCachedMode(false);
+    setCacheBitmap(BITMAP_INVALID);
+    Bitmap::dynamicBitmapDelete(cacheId);
+    cacheId = BITMAP_INVALID;
+    stale = Rect();
+}
+
+void RetainedContainer::invalidate() const
+{
+    // Position or alpha of the container itself, the bitmap is still valid
+    selfInvalidation = true;
+    CacheableContainer::invalidate();
+    selfInvalidation = false;
+}
+
+void RetainedContainer::invalidateRect(Rect& invalidatedArea) const
+{
+    if (isRetained() && !selfInvalidation && !rendering)
+    {
+        // Children invalidate in the container coordinates
+        Rect area = invalidatedArea & Rect(0, 0, getWidth(), getHeight());
+        if (!area.isEmpty())
+        {
+            if (stale.isEmpty())
+            {
+                stale = area;
+            }
+            else
+            {
+                stale.expandToFit(area);
+            }
+        }
+    }
+    CacheableContainer::invalidateRect(invalidatedArea);
+}
+
+void RetainedContainer::setupDrawChain(const Rect& invalidatedArea, Drawable** nextPreviousElement)
+{
+    if (isRetained())
+    {
+        // First use of the bitmap in this frame, bring it up to date
+        refresh();
+        gui_cache_replay();
+    }
+    CacheableContainer::setupDrawChain(invalidatedArea, nextPreviousElement);
+}
+
+void RetainedContainer::refresh()
+{
+    if (stale.isEmpty())
+    {
+        return;
+    }
+
+    const uint32_t start = HAL::getInstance()->getCPUCycles();
+    const Rect area = stale;
+
+    rendering = true;
+    stale = Rect();
+    if (area.width == getWidth() && area.height == getHeight())
+    {
+        updateCache();
+    }
+    else
+    {
+        updateCache(area);
+    }
+    rendering = false;
+
+    gui_cache_render(HAL::getInstance()->getCPUCycles() - start);
+}
@@ -8,10 +8,17 @@ Screen1View::Screen1View()
 void Screen1View::setupScreen()
 {
     Screen1ViewBase::setupScreen();
+#if FRAME_PROF_OVERLAY
+    add(profilerOverlay);
+    profilerOverlay.start();
+#endif
 }
 
 void Screen1View::tearDownScreen()
 {
+#if FRAME_PROF_OVERLAY
+    profilerOverlay.stop();
+#endif
     Screen1ViewBase::tearDownScreen();
 }
 
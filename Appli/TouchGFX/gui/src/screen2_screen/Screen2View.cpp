@@ -8,9 +8,16 @@ Screen2View::Screen2View()
 void Screen2View::setupScreen()
 {
     Screen2ViewBase::setupScreen();
+#if FRAME_PROF_OVERLAY
+    add(profilerOverlay);
+    profilerOverlay.start();
+#endif
 }
 
 void Screen2View::tearDownScreen()
 {
+#if FRAME_PROF_OVERLAY
+    profilerOverlay.stop();
+#endif
     Screen2ViewBase::tearDownScreen();
 }
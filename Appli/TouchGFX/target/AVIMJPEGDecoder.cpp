@@ -0,0 +1,437 @@
+/**
+  ******************************************************************************
+  * File Name          : AVIMJPEGDecoder.cpp
+  ******************************************************************************
+  * AVI parsing of the MJPEG decoders, see AVIMJPEGDecoder.hpp. This is the
+  * parsing of the generated HardwareMJPEGDecoder.cpp, with the reads checked
+  * against the AVI buffer, the frame index and the video chunks counted
+  * apart from the audio ones.
+  ******************************************************************************
+  */
+
+#include <AVIMJPEGDecoder.hpp>
+
+extern "C"
+{
+#include <string.h>
+}
+
+namespace
+{
+const uint16_t STREAM0 = 0x3030;
+const uint16_t TYPEDC  = 0x6364;
+}
+
+AVIMJPEGDecoder::AVIMJPEGDecoder()
+    : frameNumber(0), currentMovieOffset(0), indexOffset(0), firstFrameOffset(0), lastFrameEnd(0), movieLength(0), movieData(0),
+      reader(0), aviBuffer(0), aviBufferLength(0), aviBufferStartOffset(0),
+      frameIndex(0), frameIndexSize(0), frameIndexCount(0), frameIndexEnd(0), lastError(AVI_NO_ERROR)
+{
+    /* Clear video info */
+    videoInfo.frame_height = 0;
+    videoInfo.frame_width = 0;
+    videoInfo.ms_between_frames = 0;
+    videoInfo.number_of_frames = 0;
+}
+
+int AVIMJPEGDecoder::compare(const uint32_t offset, const char* str, uint32_t num)
+{
+    const char* src;
+    if (isBuffered())
+    {
+        /* Assuming data is in buffer! */
+        src = reinterpret_cast<const char*>(aviBuffer + (offset - aviBufferStartOffset));
+    }
+    else
+    {
+        src = (const char*)movieData + offset;
+    }
+    return strncmp(src, str, num);
+}
+
+uint32_t AVIMJPEGDecoder::getU32(const uint32_t offset)
+{
+    if (isBuffered())
+    {
+        /* Assuming data is in buffer! */
+        const uint32_t index = offset - aviBufferStartOffset;
+        return aviBuffer[index + 0] | (aviBuffer[index + 1] << 8) | (aviBuffer[index + 2] << 16) | (aviBuffer[index + 3] << 24);
+    }
+    else
+    {
+        volatile const uint8_t* const d = movieData + offset;
+        uint32_t val = 0U;
+        val |= d[0];
+        val |= d[1] << 8;
+        val |= d[2] << 16;
+        val |= d[3] << 24;
+        return val;
+    }
+}
+
+uint32_t AVIMJPEGDecoder::getU16(const uint32_t offset)
+{
+    if (isBuffered())
+    {
+        /* Assuming data is in buffer! */
+        const uint32_t index = offset - aviBufferStartOffset;
+        return aviBuffer[index + 0] | (aviBuffer[index + 1] << 8);
+    }
+    else
+    {
+        volatile const uint8_t* const d = movieData + offset;
+        uint32_t val = 0U;
+        val |= d[0];
+        val |= d[1] << 8;
+        return val;
+    }
+}
+
+const uint8_t* AVIMJPEGDecoder::readData(uint32_t offset, uint32_t length)
+{
+    if (!isBuffered())
+    {
+        return movieData + offset;
+    }
+
+    /* Nothing is read, the buffer keeps its contents */
+    if (length > aviBufferLength)
+    {
+        lastError = AVI_ERROR_FILE_BUFFER_TO_SMALL;
+        return 0;
+    }
+
+    reader->seek(offset);
+    if (!reader->readData(aviBuffer, length))
+    {
+        lastError = AVI_ERROR_EOF_REACHED;
+    }
+
+    aviBufferStartOffset = offset;
+    return aviBuffer;
+}
+
+bool AVIMJPEGDecoder::decodeNextFrame(uint8_t* buffer, uint16_t buffer_width, uint16_t buffer_height, uint32_t buffer_stride)
+{
+    assert((frameNumber > 0) && "MJPEGDecoder decoding without frame data!");
+
+    /* find next frame and decode it */
+    if (readData(currentMovieOffset, 8) == 0)
+    {
+        return false;
+    }
+    uint32_t streamNo  = getU16(currentMovieOffset);
+    uint32_t chunkType = getU16(currentMovieOffset + 2);
+    uint32_t chunkSize = getU32(currentMovieOffset + 4);
+
+    bool isCurrentFrameLast;
+    /* play frame if we have it all */
+    if (currentMovieOffset + 8 + chunkSize < movieLength)
+    {
+        currentMovieOffset += 8;
+        if (streamNo == STREAM0 && chunkType == TYPEDC)
+        {
+            /* decode frame, skipped when larger than the AVI buffer or empty */
+            if (chunkSize > 0)
+            {
+                const uint8_t* chunk = readData(currentMovieOffset, chunkSize);
+                decodeChunk(chunk, chunkSize, buffer, buffer_width, buffer_height, buffer_stride);
+            }
+            frameNumber++;
+        }
+
+        isCurrentFrameLast = false;
+
+        /* Advance to next chunk, the audio chunks are skipped whole */
+        currentMovieOffset += chunkSize;
+        currentMovieOffset = (currentMovieOffset + 1) & 0xFFFFFFFE; /* pad to next word */
+
+        if (currentMovieOffset >= lastFrameEnd)
+        {
+            frameNumber = 1;
+            currentMovieOffset = firstFrameOffset; /* start over */
+            isCurrentFrameLast = true;
+        }
+    }
+    else
+    {
+        frameNumber = 1;
+        currentMovieOffset = firstFrameOffset; /* start over */
+        isCurrentFrameLast = true;
+    }
+    return !isCurrentFrameLast;
+}
+
+bool AVIMJPEGDecoder::gotoNextFrame()
+{
+    assert((frameNumber > 0) && "MJPEGDecoder decoding without frame data!");
+
+    if (frameNumber < frameIndexCount)
+    {
+        currentMovieOffset = frameIndex[frameNumber];
+        frameNumber++;
+        return true;
+    }
+    if (frameIndexCount != 0 && frameIndexCount == getNumberOfFrames())
+    {
+        /* skip back to first frame */
+        frameNumber = 1;
+        currentMovieOffset = firstFrameOffset;
+        return false;
+    }
+
+    readData(currentMovieOffset, 8);
+    uint32_t chunkSize = getU32(currentMovieOffset + 4);
+
+    /* increment until next video frame, over the audio chunks */
+    while (currentMovieOffset + 8 + chunkSize < movieLength)
+    {
+        /* increment one chunk */
+        currentMovieOffset += chunkSize + 8;
+        currentMovieOffset = (currentMovieOffset + 1) & 0xFFFFFFFE; /* pad to next word */
+
+        /* next chunk */
+        if (currentMovieOffset >= lastFrameEnd || readData(currentMovieOffset, 8) == 0)
+        {
+            break;
+        }
+        /* check it is a video frame */
+        uint32_t streamNo  = getU16(currentMovieOffset);
+        uint32_t chunkType = getU16(currentMovieOffset + 2);
+        chunkSize = getU32(currentMovieOffset + 4);
+
+        if (streamNo == STREAM0 && chunkType == TYPEDC)
+        {
+            /* Found next frame */
+            frameNumber++;
+            return true;
+        }
+    }
+
+    /* skip back to first frame */
+    frameNumber = 1;
+    currentMovieOffset = firstFrameOffset; /* start over */
+    return false;
+}
+
+void AVIMJPEGDecoder::setVideoData(const uint8_t* movie, const uint32_t length)
+{
+    movieData = movie;
+    movieLength = length;
+    reader = 0; /* not using reader */
+
+    readVideoHeader();
+}
+
+void AVIMJPEGDecoder::setVideoData(touchgfx::VideoDataReader& reader)
+{
+    this->reader = &reader;
+    movieData = 0;
+    movieLength = reader.getDataLength();
+
+    readVideoHeader();
+}
+
+bool AVIMJPEGDecoder::hasVideo()
+{
+    return (reader != 0) || (movieData != 0);
+}
+
+void AVIMJPEGDecoder::readVideoHeader()
+{
+    /*  Start from the start */
+    currentMovieOffset = 0;
+    lastError = AVI_NO_ERROR;
+    frameIndexCount = 0;
+    frameIndexEnd = 0;
+
+    /*  Make header available in buffer */
+    if (readData(0, 72) == 0)
+    {
+        return;
+    }
+
+    /*  Decode the movie header to find first frame */
+    /*  Must be RIFF file */
+    if (compare(currentMovieOffset, "RIFF", 4))
+    {
+        lastError = AVI_ERROR_NOT_RIFF;
+        assert(!"RIFF header not found");
+    }
+
+    /* skip fourcc and length */
+    currentMovieOffset += 8;
+    if (compare(currentMovieOffset, "AVI ", 4))
+    {
+        lastError = AVI_ERROR_AVI_HEADER_NOT_FOUND;
+        assert(!"AVI header not found");
+    }
+
+    currentMovieOffset += 4;
+    if (compare(currentMovieOffset, "LIST", 4))
+    {
+        lastError = AVI_ERROR_AVI_LIST_NOT_FOUND;
+        assert(!"AVI LIST not found");
+    }
+
+    /* save AVI List info */
+    const uint32_t aviListSize = getU32(currentMovieOffset + 4);
+    const uint32_t aviListOffset = currentMovieOffset;
+    assert(aviListSize);
+
+    /* look into header to find frame rate */
+    bool foundFrame = true;
+    uint32_t offset =  currentMovieOffset + 8;
+    if (compare(offset, "hdrl", 4))
+    {
+        lastError = AVI_ERROR_AVI_HDRL_NOT_FOUND;
+        foundFrame = false;
+    }
+
+    offset += 4;
+    if (compare(offset, "avih", 4))
+    {
+        lastError = AVI_ERROR_AVI_AVIH_NOT_FOUND;
+        foundFrame = false;
+    }
+
+    if (foundFrame)
+    {
+        offset += 8; /* skip fourcc and cb in AVIMAINHEADER */
+        videoInfo.ms_between_frames = getU32(offset) / 1000;
+        videoInfo.number_of_frames = getU32(offset + 16);
+        videoInfo.frame_width = getU32(offset + 32);
+        videoInfo.frame_height = getU32(offset + 36);
+    }
+    /* skip rest of AVI header, start from end of AVI List */
+
+    /* look for list with 'movi' header */
+    uint32_t listOffset = aviListOffset + aviListSize + 8;
+    readData(listOffset, 12);
+    while (compare(listOffset + 8, "movi", 4) && (lastError == AVI_NO_ERROR) && listOffset < movieLength)
+    {
+        const uint32_t listSize = getU32(listOffset + 4) + 8;
+        listOffset += listSize;
+        readData(listOffset, 12);
+    }
+
+    if (lastError != AVI_NO_ERROR)
+    {
+        lastError = AVI_ERROR_MOVI_NOT_FOUND;
+        return;
+    }
+
+    /* save first frame and end of last frame */
+    currentMovieOffset = listOffset + 8 + 4; /* skip LIST and 'movi' */
+    lastFrameEnd = listOffset + 8 + getU32(listOffset + 4);
+
+    /* find idx */
+    const uint32_t listSize = getU32(listOffset + 4) + 8;
+    listOffset += listSize;
+    if (listOffset + 8 > movieLength || readData(listOffset, 8) == 0 || compare(listOffset, "idx1", 4))
+    {
+        lastError = AVI_ERROR_IDX1_NOT_FOUND;
+        return;
+    }
+    indexOffset = listOffset;
+
+    /* start on first frame */
+    frameNumber = 1; /* next frame number is 1 */
+    firstFrameOffset = currentMovieOffset;
+
+    readFrameIndex();
+}
+
+void AVIMJPEGDecoder::readFrameIndex()
+{
+    /* gotoFrame walks idx1 from here for the frames past the table */
+    frameIndexEnd = indexOffset + 8;
+
+    if (frameIndex == 0 || frameIndexSize == 0)
+    {
+        return;
+    }
+
+    /* Stream idx1 through the AVI buffer, whole entries at a time */
+    const uint32_t indexEnd = MIN(indexOffset + 8 + getU32(indexOffset + 4), movieLength);
+    const uint32_t block = isBuffered() ? (aviBufferLength & ~15U) : indexEnd - indexOffset;
+    uint32_t offset = indexOffset + 8;
+
+    while ((offset + 16 <= indexEnd) && (frameIndexCount < frameIndexSize) && (block != 0))
+    {
+        const uint32_t end = offset + MIN(block, (indexEnd - offset) & ~15U);
+        if (readData(offset, end - offset) == 0)
+        {
+            return;
+        }
+        for (; (offset < end) && (frameIndexCount < frameIndexSize); offset += 16)
+        {
+            /* Only the video frames, same offset as gotoFrame */
+            if (getU16(offset) == STREAM0 && getU16(offset + 2) == TYPEDC)
+            {
+                frameIndex[frameIndexCount++] = getU32(offset + 8) + firstFrameOffset - 4;
+                frameIndexEnd = offset + 16;
+            }
+        }
+    }
+}
+
+void AVIMJPEGDecoder::gotoFrame(uint32_t frameNumber)
+{
+    if (frameNumber == 0)
+    {
+        frameNumber = 1;
+    }
+
+    if (frameNumber > getNumberOfFrames())
+    {
+        frameNumber = getNumberOfFrames();
+    }
+
+    if (frameNumber <= frameIndexCount)
+    {
+        currentMovieOffset = frameIndex[frameNumber - 1];
+        this->frameNumber = frameNumber;
+        return;
+    }
+
+    /* Continue the video-only walk of idx1 after the last cached frame,
+       the index also holds the audio chunks */
+    if ((frameIndexEnd == 0) || (readData(indexOffset, 8) == 0))
+    {
+        return; /* no idx1 */
+    }
+    const uint32_t indexEnd = MIN(indexOffset + 8 + getU32(indexOffset + 4), movieLength);
+    uint32_t frame = frameIndexCount;
+    uint32_t offset = frameIndexEnd;
+
+    while ((offset + 16 <= indexEnd) && (readData(offset, 16) != 0))
+    {
+        if (getU16(offset) == STREAM0 && getU16(offset + 2) == TYPEDC)
+        {
+            /* Stays on the last video frame found if the index is short */
+            currentMovieOffset = getU32(offset + 8) + firstFrameOffset - 4;
+            this->frameNumber = ++frame;
+            if (frame == frameNumber)
+            {
+                return;
+            }
+        }
+        offset += 16;
+    }
+}
+
+uint32_t AVIMJPEGDecoder::getNumberOfFrames()
+{
+    return videoInfo.number_of_frames;
+}
+
+void AVIMJPEGDecoder::setRepeatVideo(bool repeat)
+{
+
+}
+
+void AVIMJPEGDecoder::getVideoInfo(touchgfx::VideoInformation* data)
+{
+    *data = videoInfo;
+}
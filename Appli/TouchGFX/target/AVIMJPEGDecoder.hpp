@@ -0,0 +1,110 @@
+/**
+  ******************************************************************************
+  * File Name          : AVIMJPEGDecoder.hpp
+  ******************************************************************************
+  * AVI parsing shared by the MJPEG decoders
+  ******************************************************************************
+  */
+#ifndef AVIMJPEGDECODER_HPP
+#define AVIMJPEGDECODER_HPP
+
+#include <MJPEGDecoder.hpp>
+
+/**
+ * AVI parsing of the generated HardwareMJPEGDecoder, shared by
+ * StreamingMJPEGDecoder and SoftwareMJPEGDecoder: the RIFF/AVI header, the
+ * walk through the movi chunks, the seeks through the idx1 index and the
+ * reads from memory or through a VideoDataReader into the AVI file buffer.
+ *
+ * With a frame index buffer, the offsets of the frames are read from idx1
+ * once when the video is set, seeking then reads no file data. Frame numbers
+ * count the video chunks only, the audio chunks in between are skipped.
+ *
+ * A decoder implements decodeChunk, called by decodeNextFrame with each
+ * video chunk, and decodeFrame and decodeThumbnail. readData can be
+ * overridden to keep more of the file buffered.
+ */
+class AVIMJPEGDecoder : public MJPEGDecoder
+{
+public:
+    AVIMJPEGDecoder();
+
+    //Set video data for the decoder
+    virtual void setVideoData(const uint8_t* movie, const uint32_t length);
+    virtual void setVideoData(touchgfx::VideoDataReader& reader);
+    virtual bool hasVideo();
+    //Increment position to next frame and decode
+    virtual bool decodeNextFrame(uint8_t* frameBuffer, uint16_t width, uint16_t height, uint32_t framebuffer_width);
+    //Increment position to next frame
+    virtual bool gotoNextFrame();
+    virtual void gotoFrame(uint32_t frameno);
+    virtual uint32_t getCurrentFrameNumber() const
+    {
+        return frameNumber;
+    }
+    virtual uint32_t getNumberOfFrames();
+    virtual void setRepeatVideo(bool repeat);
+    virtual void getVideoInfo(touchgfx::VideoInformation* data);
+
+    void setAVIFileBuffer(uint8_t* buffer, uint32_t size)
+    {
+        aviBuffer = buffer, aviBufferLength = size;
+    }
+
+    //Table of frame offsets, filled from the idx1 index when the video is set.
+    //gotoFrame and gotoNextFrame use it for the frames it holds
+    void setFrameIndexBuffer(uint32_t* buffer, uint32_t entries)
+    {
+        frameIndex = buffer;
+        frameIndexSize = entries;
+        frameIndexCount = 0;
+    }
+
+    uint32_t getIndexedFrames() const
+    {
+        return frameIndexCount;
+    }
+
+    virtual AVIErrors getLastError()
+    {
+        return lastError;
+    }
+protected:
+    //Decode the video chunk of the current frame, called by decodeNextFrame
+    virtual void decodeChunk(const uint8_t* chunk, uint32_t length, uint8_t* buffer, uint16_t width, uint16_t height, uint32_t stride) = 0;
+    //Make length bytes from offset available to compare and getU16/getU32, 0 if they cannot be
+    virtual const uint8_t* readData(uint32_t offset, uint32_t length);
+
+    bool isBuffered() const
+    {
+        return reader != 0;
+    }
+
+    void readVideoHeader();
+    int compare(const uint32_t offset, const char* str, uint32_t num);
+    uint32_t getU32(const uint32_t offset);
+    uint32_t getU16(const uint32_t offset);
+
+    touchgfx::VideoInformation videoInfo;
+    uint32_t frameNumber;
+    uint32_t currentMovieOffset;
+    uint32_t indexOffset;
+    uint32_t firstFrameOffset;
+    uint32_t lastFrameEnd;
+    uint32_t movieLength;
+    const uint8_t* movieData;
+    touchgfx::VideoDataReader* reader;
+    uint8_t* aviBuffer;
+    uint32_t aviBufferLength;
+    uint32_t aviBufferStartOffset;
+    uint32_t* frameIndex;
+    uint32_t frameIndexSize;
+    uint32_t frameIndexCount;
+    uint32_t frameIndexEnd;
+    AVIErrors lastError;
+
+private:
+    void readFrameIndex();
+};
+
+#endif // AVIMJPEGDECODER_HPP
@@ -0,0 +1,596 @@
+/**
+  ******************************************************************************
+  * File Name          : BatchingDMA.cpp
+  ******************************************************************************
+  * DMA2D driver of the TouchGFX HAL merging contiguous blits, see
+  * BatchingDMA.hpp. Apart from the queue and the dma2d_batch hooks this is
+  * the generated STM32DMA.cpp.
+  ******************************************************************************
+  */
+#include "stm32h7rsxx_hal.h"
+#include "stm32h7rsxx_hal_dma2d.h"
+#include <BatchingDMA.hpp>
+#include <cassert>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/hal/Paint.hpp>
+
+/* Makes touchgfx specific types and variables visible to this file */
+using namespace touchgfx;
+
+typedef struct
+{
+    const uint16_t format;
+    const uint16_t size;
+    const uint32_t* const data;
+} clutData_t;
+
+extern "C" DMA2D_HandleTypeDef hdma2d;
+
+extern "C" {
+    static void DMA2D_XferCpltCallback(DMA2D_HandleTypeDef* handle)
+    {
+        (void)handle; // Unused argument
+        HAL::getInstance()->signalDMAInterrupt();
+    }
+
+    static void DMA2D_XferErrorCallback(DMA2D_HandleTypeDef* handle)
+    {
+        (void)handle; // Unused argument
+        while (1)
+        {
+
+        }
+    }
+}
+
+/* Bytes per pixel of the formats a merged blit may use, 0 for the others */
+static uint32_t batchBytesPerPixel(uint8_t format)
+{
+    switch (format)
+    {
+    case Bitmap::ARGB8888:
+        return 4;
+    case Bitmap::RGB888:
+        return 3;
+    case Bitmap::RGB565:
+        return 2;
+    case Bitmap::L8:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+bool BatchingDMA_Queue::merge(BlitOp& last, const BlitOp& op)
+{
+    bool copy;
+
+    if (op.operation != last.operation || op.dstFormat != last.dstFormat || op.dstLoopStride != last.dstLoopStride
+            || op.alpha != last.alpha || op.replaceBgAlpha != last.replaceBgAlpha || op.replaceFgAlpha != last.replaceFgAlpha)
+    {
+        return false;
+    }
+
+    switch (op.operation)
+    {
+    case BLIT_OP_FILL:
+    case BLIT_OP_FILL_WITH_ALPHA:
+        if (static_cast<uint32_t>(op.color) != static_cast<uint32_t>(last.color))
+        {
+            return false;
+        }
+        copy = false;
+        break;
+    case BLIT_OP_COPY:
+    case BLIT_OP_COPY_WITH_ALPHA:
+    case BLIT_OP_COPY_ARGB8888:
+    case BLIT_OP_COPY_ARGB8888_WITH_ALPHA:
+        if (op.srcFormat != last.srcFormat || op.srcLoopStride != last.srcLoopStride)
+        {
+            return false;
+        }
+        copy = true;
+        break;
+    default: /* Glyphs, CLUT: separate sources, nothing to gain */
+        return false;
+    }
+
+    const uint32_t dstBpp = batchBytesPerPixel(op.dstFormat);
+    const uint32_t srcBpp = copy ? batchBytesPerPixel(op.srcFormat) : 0;
+    if (dstBpp == 0 || (copy && srcBpp == 0))
+    {
+        return false;
+    }
+
+    const uint8_t* const lastDst = reinterpret_cast<const uint8_t*>(last.pDst);
+    const uint8_t* const lastSrc = reinterpret_cast<const uint8_t*>(last.pSrc);
+    const uint8_t* const dst = reinterpret_cast<const uint8_t*>(op.pDst);
+    const uint8_t* const src = reinterpret_cast<const uint8_t*>(op.pSrc);
+
+    /* Next rows below */
+    if (op.nSteps == last.nSteps && (uint32_t)last.nLoops + op.nLoops <= 0xFFFFU
+            && dst == lastDst + last.nLoops * last.dstLoopStride * dstBpp
+            && (!copy || src == lastSrc + last.nLoops * last.srcLoopStride * srcBpp))
+    {
+        last.nLoops += op.nLoops;
+        return true;
+    }
+
+    /* Next columns on the right */
+    if (op.nLoops == last.nLoops && (uint32_t)last.nSteps + op.nSteps <= (DMA2D_NLR_PL >> DMA2D_NLR_PL_Pos)
+            && dst == lastDst + last.nSteps * dstBpp
+            && (!copy || src == lastSrc + last.nSteps * srcBpp))
+    {
+        last.nSteps += op.nSteps;
+        return true;
+    }
+
+    return false;
+}
+
+void BatchingDMA_Queue::pushCopyOf(const BlitOp& op)
+{
+#if DMA2D_BATCH_ENABLE
+    /* The DMA2D and JPEG interrupts take the first blit, the last one may be
+       changed only when another one is in front of it */
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (!isEmpty())
+    {
+        const touchgfx::atomic_t last = (tail + capacity - 1) % capacity;
+        if (last != head && merge(q[last], op))
+        {
+            __set_PRIMASK(primask);
+            dma2d_batch_queued(1);
+            return;
+        }
+    }
+    __set_PRIMASK(primask);
+#endif
+
+    dma2d_batch_queued(0);
+    LockFreeDMA_Queue::pushCopyOf(op);
+}
+
+BatchingDMA::BatchingDMA()
+    : DMA_Interface(dma_queue), dma_queue(queue_storage, sizeof(queue_storage) / sizeof(queue_storage[0])), started_by_external_job(false),
+      in_completion(false)
+{
+
+}
+
+BatchingDMA::~BatchingDMA()
+{
+    /* Disable DMA2D global Interrupt */
+    NVIC_DisableIRQ(DMA2D_IRQn);
+}
+
+void BatchingDMA::initialize()
+{
+    /* Ensure DMA2D Clock is enabled */
+    __HAL_RCC_DMA2D_CLK_ENABLE();
+    __HAL_RCC_DMA2D_FORCE_RESET();
+    __HAL_RCC_DMA2D_RELEASE_RESET();
+
+    /* Add transfer error callback function */
+    hdma2d.XferErrorCallback = DMA2D_XferErrorCallback;
+
+    /* Add transfer complete callback function */
+    hdma2d.XferCpltCallback = DMA2D_XferCpltCallback;
+
+    /* Enable DMA2D global Interrupt */
+    NVIC_EnableIRQ(DMA2D_IRQn);
+}
+
+inline uint32_t BatchingDMA::getChromARTInputFormat(Bitmap::BitmapFormat format)
+{
+    // Default color mode set to ARGB8888
+    uint32_t dma2dColorMode = DMA2D_INPUT_ARGB8888;
+
+    switch (format)
+    {
+    case Bitmap::ARGB8888: /* DMA2D input mode set to 32bit ARGB */
+        dma2dColorMode = DMA2D_INPUT_ARGB8888;
+        break;
+    case Bitmap::RGB888: /* DMA2D input mode set to 24bit RGB */
+        dma2dColorMode = DMA2D_INPUT_RGB888;
+        break;
+    case Bitmap::RGB565: /* DMA2D input mode set to 16bit RGB */
+        dma2dColorMode = DMA2D_INPUT_RGB565;
+        break;
+    case Bitmap::ARGB2222: /* Fall through */
+    case Bitmap::ABGR2222: /* Fall through */
+    case Bitmap::RGBA2222: /* Fall through */
+    case Bitmap::BGRA2222: /* Fall through */
+    case Bitmap::L8:       /* DMA2D input mode set to 8bit Color Look up table*/
+        dma2dColorMode = DMA2D_INPUT_L8;
+        break;
+    case Bitmap::BW:     /* Fall through */
+    case Bitmap::BW_RLE: /* Fall through */
+    case Bitmap::GRAY4:  /* Fall through */
+    case Bitmap::GRAY2:  /* Fall through */
+    default:             /* Unsupported input format for DMA2D */
+        assert(0 && "Unsupported Format!");
+        break;
+    }
+
+    return dma2dColorMode;
+}
+
+inline uint32_t BatchingDMA::getChromARTOutputFormat(Bitmap::BitmapFormat format)
+{
+    // Default color mode set to ARGB8888
+    uint32_t dma2dColorMode = DMA2D_OUTPUT_ARGB8888;
+
+    switch (format)
+    {
+    case Bitmap::ARGB8888: /* DMA2D output mode set to 32bit ARGB */
+        dma2dColorMode = DMA2D_OUTPUT_ARGB8888;
+        break;
+    case Bitmap::RGB888:   /* Fall through */
+    case Bitmap::ARGB2222: /* Fall through */
+    case Bitmap::ABGR2222: /* Fall through */
+    case Bitmap::RGBA2222: /* Fall through */
+    case Bitmap::BGRA2222: /* DMA2D output mode set to 24bit RGB */
+        dma2dColorMode = DMA2D_OUTPUT_RGB888;
+        break;
+    case Bitmap::RGB565: /* DMA2D output mode set to 16bit RGB */
+        dma2dColorMode = DMA2D_OUTPUT_RGB565;
+        break;
+    case Bitmap::L8:     /* Fall through */
+    case Bitmap::BW:     /* Fall through */
+    case Bitmap::BW_RLE: /* Fall through */
+    case Bitmap::GRAY4:  /* Fall through */
+    case Bitmap::GRAY2:  /* Fall through */
+    default:             /* Unsupported output format for DMA2D */
+        assert(0 && "Unsupported Format!");
+        break;
+    }
+
+    return dma2dColorMode;
+}
+
+BlitOperations BatchingDMA::getBlitCaps()
+{
+    return static_cast<BlitOperations>(BLIT_OP_FILL
+                                       | BLIT_OP_FILL_16BIT
+                                       | BLIT_OP_FILL_WITH_ALPHA
+                                       | BLIT_OP_COPY
+                                       | BLIT_OP_COPY_L8
+                                       | BLIT_OP_COPY_16BIT
+                                       | BLIT_OP_COPY_WITH_ALPHA
+                                       | BLIT_OP_COPY_ARGB8888
+                                       | BLIT_OP_COPY_ARGB8888_WITH_ALPHA
+                                       | BLIT_OP_COPY_A4
+                                       | BLIT_OP_COPY_A8);
+}
+
+/*
+ * void BatchingDMA::setupDataCopy(const BlitOp& blitOp) handles blit operation of
+ * BLIT_OP_COPY
+ * BLIT_OP_COPY_L8
+ * BLIT_OP_COPY_16BIT
+ * BLIT_OP_COPY_WITH_ALPHA
+ * BLIT_OP_COPY_ARGB8888
+ * BLIT_OP_COPY_ARGB8888_WITH_ALPHA
+ * BLIT_OP_COPY_A4
+ * BLIT_OP_COPY_A8
+ */
+void BatchingDMA::setupDataCopy(const BlitOp& blitOp)
+{
+    dma2d_batch_start(in_completion);
+
+    uint32_t dma2dForegroundColorMode = getChromARTInputFormat(static_cast<Bitmap::BitmapFormat>(blitOp.srcFormat));
+    uint32_t dma2dBackgroundColorMode = getChromARTInputFormat(static_cast<Bitmap::BitmapFormat>(blitOp.dstFormat));
+    uint32_t dma2dOutputColorMode = getChromARTOutputFormat(static_cast<Bitmap::BitmapFormat>(blitOp.dstFormat));
+
+    /* DMA2D OOR register configuration */
+    WRITE_REG(DMA2D->OOR, blitOp.dstLoopStride - blitOp.nSteps);
+
+    /* DMA2D BGOR register configuration -*/
+    WRITE_REG(DMA2D->BGOR, blitOp.dstLoopStride - blitOp.nSteps);
+
+    /* DMA2D FGOR register configuration -*/
+    WRITE_REG(DMA2D->FGOR, blitOp.srcLoopStride - blitOp.nSteps);
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, dma2dOutputColorMode);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, (blitOp.nLoops | (blitOp.nSteps << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+    /* Configure DMA2D source address */
+    WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(blitOp.pSrc));
+
+    switch (blitOp.operation)
+    {
+    case BLIT_OP_COPY_A4:
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_A4 | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | ((blitOp.alpha << DMA2D_FGPFCCR_ALPHA_Pos) & DMA2D_FGPFCCR_ALPHA));
+
+        /* set DMA2D foreground color */
+        WRITE_REG(DMA2D->FGCOLR, blitOp.color & (DMA2D_FGCOLR_BLUE | DMA2D_FGCOLR_GREEN | DMA2D_FGCOLR_RED));
+
+        /* Write DMA2D BGPFCCR register */
+        if (blitOp.replaceBgAlpha)
+        {
+            WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_REPLACE_ALPHA << DMA2D_BGPFCCR_AM_Pos) | ((0xFFUL << DMA2D_BGPFCCR_ALPHA_Pos) & DMA2D_BGPFCCR_ALPHA));
+        }
+        else
+        {
+            WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+        }
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+        break;
+    case BLIT_OP_COPY_A8:
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_A8 | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | ((blitOp.alpha << DMA2D_FGPFCCR_ALPHA_Pos) & DMA2D_FGPFCCR_ALPHA));
+
+        /* set DMA2D foreground color */
+        WRITE_REG(DMA2D->FGCOLR, blitOp.color & (DMA2D_FGCOLR_BLUE | DMA2D_FGCOLR_GREEN | DMA2D_FGCOLR_RED));
+
+        /* Write DMA2D BGPFCCR register */
+        if (blitOp.replaceBgAlpha)
+        {
+            WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_REPLACE_ALPHA << DMA2D_BGPFCCR_AM_Pos) | ((0xFFUL << DMA2D_BGPFCCR_ALPHA_Pos) & DMA2D_BGPFCCR_ALPHA));
+        }
+        else
+        {
+            WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+        }
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+        break;
+    case BLIT_OP_COPY_WITH_ALPHA:
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, dma2dForegroundColorMode | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | ((blitOp.alpha << DMA2D_FGPFCCR_ALPHA_Pos) & DMA2D_FGPFCCR_ALPHA));
+
+        /* Write DMA2D BGPFCCR register */
+        if (blitOp.replaceBgAlpha)
+        {
+            WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_REPLACE_ALPHA << DMA2D_BGPFCCR_AM_Pos) | ((0xFFUL << DMA2D_BGPFCCR_ALPHA_Pos) & DMA2D_BGPFCCR_ALPHA));
+        }
+        else
+        {
+            WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+        }
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+        break;
+    case BLIT_OP_COPY_L8:
+        {
+            bool blend = true;
+            const clutData_t* const palette = reinterpret_cast<const clutData_t*>(blitOp.pClut);
+
+            /* Write foreground CLUT memory address */
+            WRITE_REG(DMA2D->FGCMAR, reinterpret_cast<uint32_t>(&palette->data));
+
+            /* Set DMA2D color mode and alpha mode */
+            WRITE_REG(DMA2D->FGPFCCR, dma2dForegroundColorMode | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | ((blitOp.alpha << DMA2D_FGPFCCR_ALPHA_Pos) & DMA2D_FGPFCCR_ALPHA));
+
+            /* Write DMA2D BGPFCCR register */
+            if (blitOp.replaceBgAlpha)
+            {
+                WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_REPLACE_ALPHA << DMA2D_BGPFCCR_AM_Pos) | ((0xFFUL << DMA2D_BGPFCCR_ALPHA_Pos) & DMA2D_BGPFCCR_ALPHA));
+            }
+            else
+            {
+                WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+            }
+
+            /* Configure DMA2D Stream source2 address */
+            WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+            /* Configure CLUT */
+            switch ((Bitmap::ClutFormat)palette->format)
+            {
+            case Bitmap::CLUT_FORMAT_L8_ARGB8888:
+                /* Write foreground CLUT size and CLUT color mode */
+                MODIFY_REG(DMA2D->FGPFCCR, (DMA2D_FGPFCCR_CS | DMA2D_FGPFCCR_CCM), (((palette->size - 1) << DMA2D_FGPFCCR_CS_Pos) | (DMA2D_CCM_ARGB8888 << DMA2D_FGPFCCR_CCM_Pos)));
+                break;
+            case Bitmap::CLUT_FORMAT_L8_RGB888:
+                if (blitOp.alpha == 255)
+                {
+                    blend = false;
+                }
+                MODIFY_REG(DMA2D->FGPFCCR, (DMA2D_FGPFCCR_CS | DMA2D_FGPFCCR_CCM), (((palette->size - 1) << DMA2D_FGPFCCR_CS_Pos) | (DMA2D_CCM_RGB888 << DMA2D_FGPFCCR_CCM_Pos)));
+                break;
+            case Bitmap::CLUT_FORMAT_L8_RGB565:
+            default:
+                assert(0 && "Unsupported format");
+                break;
+            }
+
+            /* Enable the CLUT loading for the foreground */
+            SET_BIT(DMA2D->FGPFCCR, DMA2D_FGPFCCR_START);
+
+            while ((READ_REG(DMA2D->FGPFCCR) & DMA2D_FGPFCCR_START) != 0U)
+            {
+            }
+            DMA2D->IFCR = (DMA2D_FLAG_CTC);
+
+            /* Set DMA2D mode */
+            if (blend)
+            {
+                WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+            }
+            else
+            {
+                WRITE_REG(DMA2D->CR, DMA2D_M2M_PFC | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+            }
+        }
+        break;
+    case BLIT_OP_COPY_ARGB8888:
+        /* Write DMA2D FGPFCCR register */
+        if (blitOp.replaceFgAlpha)
+        {
+            WRITE_REG(DMA2D->FGPFCCR, dma2dForegroundColorMode | (DMA2D_REPLACE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | ((blitOp.alpha << DMA2D_FGPFCCR_ALPHA_Pos) & DMA2D_FGPFCCR_ALPHA));
+        }
+        else
+        {
+            WRITE_REG(DMA2D->FGPFCCR, dma2dForegroundColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_FGPFCCR_AM_Pos));
+        }
+
+        /* Write DMA2D BGPFCCR register */
+        if (blitOp.replaceBgAlpha)
+        {
+            WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_REPLACE_ALPHA << DMA2D_BGPFCCR_AM_Pos) | ((0xFFUL << DMA2D_BGPFCCR_ALPHA_Pos) & DMA2D_BGPFCCR_ALPHA));
+        }
+        else
+        {
+            WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+        }
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+        break;
+
+    case BLIT_OP_COPY_ARGB8888_WITH_ALPHA:
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, dma2dForegroundColorMode | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | ((blitOp.alpha << DMA2D_FGPFCCR_ALPHA_Pos) & DMA2D_FGPFCCR_ALPHA));
+
+        /* Write DMA2D BGPFCCR register */
+        if (blitOp.replaceBgAlpha)
+        {
+            WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_REPLACE_ALPHA << DMA2D_BGPFCCR_AM_Pos) | ((0xFFUL << DMA2D_BGPFCCR_ALPHA_Pos) & DMA2D_BGPFCCR_ALPHA));
+        }
+        else
+        {
+            WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+        }
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+        break;
+    default: /* BLIT_OP_COPY & BLIT_OP_COPY_16BIT */
+        /* Set DMA2D color mode and alpha mode */
+        if (blitOp.replaceFgAlpha)
+        {
+            WRITE_REG(DMA2D->FGPFCCR, dma2dForegroundColorMode | (DMA2D_REPLACE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | ((0xFFUL << DMA2D_BGPFCCR_ALPHA_Pos) & DMA2D_BGPFCCR_ALPHA));
+        }
+        else
+        {
+            WRITE_REG(DMA2D->FGPFCCR, dma2dForegroundColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_FGPFCCR_AM_Pos));
+        }
+
+        /* Perform pixel-format-conversion (PFC) If Bitmap format is not same format as framebuffer format */
+        if (blitOp.srcFormat != blitOp.dstFormat)
+        {
+            /* Configure DMA2D Stream source2 address */
+            WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+            /* Start DMA2D : PFC Mode */
+            WRITE_REG(DMA2D->CR, DMA2D_M2M_PFC | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+        }
+        else
+        {
+            /* Start DMA2D : M2M Mode */
+            WRITE_REG(DMA2D->CR, DMA2D_M2M | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+        }
+        break;
+    }
+}
+
+/*
+ * void BatchingDMA::setupDataFill(const BlitOp& blitOp) handles blit operation of
+ * BLIT_OP_FILL
+ * BLIT_OP_FILL_16BIT
+ * BLIT_OP_FILL_WITH_ALPHA
+ */
+void BatchingDMA::setupDataFill(const BlitOp& blitOp)
+{
+    dma2d_batch_start(in_completion);
+
+    uint32_t dma2dOutputColorMode = getChromARTOutputFormat(static_cast<Bitmap::BitmapFormat>(blitOp.dstFormat));
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, dma2dOutputColorMode);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, (blitOp.nLoops | (blitOp.nSteps << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+    /* DMA2D OOR register configuration */
+    WRITE_REG(DMA2D->OOR, blitOp.dstLoopStride - blitOp.nSteps);
+
+    if (blitOp.operation == BLIT_OP_FILL_WITH_ALPHA)
+    {
+        /* DMA2D BGOR register configuration -*/
+        WRITE_REG(DMA2D->BGOR, blitOp.dstLoopStride - blitOp.nSteps);
+
+        /* DMA2D FGOR register configuration -*/
+        WRITE_REG(DMA2D->FGOR, blitOp.dstLoopStride - blitOp.nSteps);
+
+        /* Write DMA2D BGPFCCR register */
+        if (blitOp.replaceBgAlpha)
+        {
+            WRITE_REG(DMA2D->BGPFCCR, dma2dOutputColorMode | (DMA2D_REPLACE_ALPHA << DMA2D_BGPFCCR_AM_Pos) | ((0xFFUL << DMA2D_BGPFCCR_ALPHA_Pos) & DMA2D_BGPFCCR_ALPHA));
+        }
+        else
+        {
+            WRITE_REG(DMA2D->BGPFCCR, dma2dOutputColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+        }
+
+        /* Write DMA2D FGPFCCR register */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_A8 | (DMA2D_REPLACE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | ((blitOp.alpha << DMA2D_FGPFCCR_ALPHA_Pos) & DMA2D_FGPFCCR_ALPHA));
+
+        /* DMA2D FGCOLR register configuration -*/
+        WRITE_REG(DMA2D->FGCOLR, blitOp.color & (DMA2D_FGCOLR_BLUE | DMA2D_FGCOLR_GREEN | DMA2D_FGCOLR_RED));
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+        /* Configure DMA2D source address */
+        WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+        /* Enable the Peripheral and Enable the transfer complete interrupt */
+        WRITE_REG(DMA2D->CR, (DMA2D_IT_TC | DMA2D_CR_START | DMA2D_M2M_BLEND | DMA2D_IT_CE | DMA2D_IT_TE));
+    }
+    else
+    {
+        /* Write DMA2D FGPFCCR register */
+        WRITE_REG(DMA2D->FGPFCCR, dma2dOutputColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_FGPFCCR_AM_Pos));
+
+        /* DMA2D FGOR register configuration -*/
+        WRITE_REG(DMA2D->FGOR, 0);
+
+        /* DMA2D OCOLR register configuration */
+        if (blitOp.dstFormat == Bitmap::RGB565)
+        {
+            /* Set color */
+            WRITE_REG(DMA2D->OCOLR, blitOp.color & (DMA2D_OCOLR_BLUE_2 | DMA2D_OCOLR_GREEN_2 | DMA2D_OCOLR_RED_2));
+        }
+        else
+        {
+            /* Set color */
+            WRITE_REG(DMA2D->OCOLR, ((blitOp.alpha << 24) & DMA2D_OCOLR_ALPHA_1) | ((blitOp.color) & (DMA2D_OCOLR_BLUE_1 | DMA2D_OCOLR_GREEN_1 | DMA2D_OCOLR_RED_1)));
+        }
+
+        /* Enable the Peripheral and Enable the transfer complete interrupt */
+        WRITE_REG(DMA2D->CR, (DMA2D_IT_TC | DMA2D_CR_START | DMA2D_R2M | DMA2D_IT_CE | DMA2D_IT_TE));
+    }
+}
@@ -0,0 +1,257 @@
+/**
+  ******************************************************************************
+  * File Name          : BatchingDMA.hpp
+  ******************************************************************************
+  * DMA2D driver of the TouchGFX HAL merging contiguous blits, see
+  * dma2d_batch.h
+  ******************************************************************************
+  */
+#ifndef BATCHINGDMA_HPP
+#define BATCHINGDMA_HPP
+
+#include <StreamingMJPEGDecoder.hpp>
+#include "dma2d_batch.h"
+
+/**
+ * @class BatchingDMA_Queue
+ *
+ * @brief DMA queue merging a new blit into the last queued one when the DMA2D
+ *        can do both in one transfer, see dma2d_batch.h
+ */
+class BatchingDMA_Queue : public touchgfx::LockFreeDMA_Queue
+{
+public:
+    BatchingDMA_Queue(touchgfx::BlitOp* mem, touchgfx::atomic_t n)
+        : LockFreeDMA_Queue(mem, n)
+    {
+    }
+
+    virtual void pushCopyOf(const touchgfx::BlitOp& op);
+
+private:
+    static bool merge(touchgfx::BlitOp& last, const touchgfx::BlitOp& op);
+};
+
+/**
+ * @class BatchingDMA
+ *
+ * @brief This class specializes DMA_Interface for the STM32 processors.
+ *
+ *        Copy of the generated STM32DMA using a BatchingDMA_Queue, installed
+ *        by TouchGFXHAL in place of the generated instance. The JPEG external
+ *        jobs convert the output of StreamingMJPEGDecoder.
+ *
+ * @sa touchgfx::DMA_Interface
+ */
+class BatchingDMA : public touchgfx::DMA_Interface
+{
+    /**
+     * @typedef touchgfx::DMA_Interface Base
+     *
+     * @brief Defines an alias representing the base.
+     *
+     Defines an alias representing the base.
+     */
+    typedef touchgfx::DMA_Interface Base;
+
+public:
+    /**
+     * @fn BatchingDMA::BatchingDMA();
+     *
+     * @brief Default constructor.
+     *
+     *        Default constructor.
+     */
+    BatchingDMA();
+
+    /**
+     * @fn BatchingDMA::~BatchingDMA();
+     *
+     * @brief Destructor.
+     *
+     *        Destructor.
+     */
+    virtual ~BatchingDMA();
+
+    /**
+     * @fn DMAType touchgfx::BatchingDMA::getDMAType()
+     *
+     * @brief Function for obtaining the DMA type of the concrete DMA_Interface implementation.
+     *
+     *        Function for obtaining the DMA type of the concrete DMA_Interface implementation.
+     *        As default, will return DMA_TYPE_CHROMART type value.
+     *
+     * @return a DMAType value of the concrete DMA_Interface implementation.
+     */
+    virtual touchgfx::DMAType getDMAType(void)
+    {
+        return touchgfx::DMA_TYPE_CHROMART;
+    }
+
+    /**
+     * @fn touchgfx::BlitOperations BatchingDMA::getBlitCaps();
+     *
+     * @brief Gets the blit capabilities.
+     *
+     *        Gets the blit capabilities.
+     *
+     *        This DMA supports a range of blit caps: BLIT_OP_COPY, BLIT_OP_COPY_ARGB8888,
+     *        BLIT_OP_COPY_ARGB8888_WITH_ALPHA, BLIT_OP_COPY_A4, BLIT_OP_COPY_A8.
+     *
+     *
+     * @return Currently supported blitcaps.
+     */
+    virtual touchgfx::BlitOperations getBlitCaps();
+
+    /**
+     * @fn void BatchingDMA::initialize();
+     *
+     * @brief Perform hardware specific initialization.
+     *
+     *        Perform hardware specific initialization.
+     */
+    virtual void initialize();
+
+    /**
+     * @fn void BatchingDMA::signalDMAInterrupt()
+     *
+     * @brief Raises a DMA interrupt signal.
+     *
+     *        Raises a DMA interrupt signal.
+     */
+    virtual void signalDMAInterrupt()
+    {
+        dma2d_batch_done();
+        in_completion = true;
+
+        if (!started_by_external_job)
+        {
+            executeCompleted();
+
+            /* Start new external job if next buffer is full */
+            if (StreamingJPEG::Jpeg_OUT_BufferTab[StreamingJPEG::JPEG_OUT_Read_BufferIndex].State == JPEG_BUFFER_FULL && !StreamingJPEG::DMA2D_CopyBufferEnd && !isRunning)
+            {
+                started_by_external_job = true;
+                externalJobExecute();
+            }
+        }
+        else
+        {
+            externalJobCompleted();
+
+            /* Prioritize BlitOps if there are any pending */
+            if (!queue.isEmpty() && isAllowed)
+            {
+                started_by_external_job = false;
+                execute();
+            }
+        }
+
+        in_completion = false;
+    }
+
+    virtual void start()
+    {
+        if (!queue.isEmpty() && isAllowed && !isRunning)
+        {
+            started_by_external_job = false;
+            execute();
+        }
+        else if ((StreamingJPEG::Jpeg_OUT_BufferTab[StreamingJPEG::JPEG_OUT_Read_BufferIndex].State == JPEG_BUFFER_FULL) && !isRunning)
+        {
+            started_by_external_job = true;
+            externalJobExecute();
+        }
+    }
+
+protected:
+    /**
+     * @fn virtual void BatchingDMA::setupDataCopy(const touchgfx::BlitOp& blitOp);
+     *
+     * @brief Configures the DMA for copying data to the frame buffer.
+     *
+     *        Configures the DMA for copying data to the frame buffer.
+     *
+     * @param blitOp Details on the copy to perform.
+     */
+    virtual void setupDataCopy(const touchgfx::BlitOp& blitOp);
+
+    /**
+     * @fn virtual void BatchingDMA::setupDataFill(const touchgfx::BlitOp& blitOp);
+     *
+     * @brief Configures the DMA for "filling" the frame-buffer with a single color.
+     *
+     *        Configures the DMA for "filling" the frame-buffer with a single color.
+     *
+     * @param blitOp Details on the "fill" to perform.
+     */
+    virtual void setupDataFill(const touchgfx::BlitOp& blitOp);
+
+    /**
+     * @fn void BatchingDMA::externalJobCompleted();
+     *
+     * @brief Handle DMA2D when an external job has been executed
+     *
+     * @param None
+     */
+    void externalJobCompleted()
+    {
+        if (isRunning)
+        {
+            isRunning = false;
+            StreamingJPEG::DMA2D_ExternalJobCompleted(StreamingJPEG::Jpeg_OUT_BufferTab[StreamingJPEG::JPEG_OUT_Read_BufferIndex]);
+        }
+    }
+
+    /**
+     * @fn void BatchingDMA::externalJobExecute();
+     *
+     * @brief Executes an external DMA2D job
+     *
+     * @param None
+     */
+    void externalJobExecute()
+    {
+        isRunning = true;
+        dma2d_batch_start(in_completion);
+        if (StreamingJPEG::Jpeg_OUT_BufferTab[StreamingJPEG::JPEG_OUT_Read_BufferIndex].DoCropping)
+        {
+            StreamingJPEG::DMA2D_CropBuffer(StreamingJPEG::Jpeg_OUT_BufferTab[StreamingJPEG::JPEG_OUT_Read_BufferIndex]);
+        }
+        else
+        {
+            StreamingJPEG::DMA2D_CopyBuffer(StreamingJPEG::Jpeg_OUT_BufferTab[StreamingJPEG::JPEG_OUT_Read_BufferIndex]);
+        }
+    }
+
+private:
+    BatchingDMA_Queue dma_queue;
+    touchgfx::BlitOp queue_storage[96];
+    bool started_by_external_job;
+    volatile bool in_completion; // Next transfer started from the DMA2D interrupt
+
+    /**
+     * @fn void BatchingDMA::getChromARTInputFormat()
+     *
+     * @brief Convert Bitmap format to ChromART Input format.
+     *
+     * @param format Bitmap format.
+     *
+     * @return ChromART Input format.
+     */
+
+    inline uint32_t getChromARTInputFormat(touchgfx::Bitmap::BitmapFormat format);
+
+    /**
+     * @fn void BatchingDMA::getChromARTOutputFormat()
+     *
+     * @brief Convert Bitmap format to ChromART Output format.
+     *
+     * @param format Bitmap format.
+     *
+     * @return ChromART Output format.
+     */
+    inline uint32_t getChromARTOutputFormat(touchgfx::Bitmap::BitmapFormat format);
+};
+
+#endif // BATCHINGDMA_HPP
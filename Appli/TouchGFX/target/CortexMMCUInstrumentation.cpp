@@ -1,5 +1,6 @@
 #include <CortexMMCUInstrumentation.hpp>
 #include <touchgfx/hal/HAL.hpp>
+#include "idle_sleep.h"
 
 namespace touchgfx
 {
@@ -28,9 +29,10 @@ unsigned int CortexMMCUInstrumentation::getElapsedUS(unsigned int start, unsigne
     return ((now - start) + (clockfrequency / 2)) / clockfrequency;
 }
 
+//Cycle counter plus the cycles it missed while the idle task slept
 unsigned int CortexMMCUInstrumentation::getCPUCycles()
 {
-    return *((volatile unsigned int*)0xE0001004);
+    return idle_sleep_cycles();
 }
 
 void CortexMMCUInstrumentation::setMCUActive(bool active)
@@ -25,10 +25,8 @@
 #include <touchgfx/hal/Types.hpp>
 #include <STM32TouchController.hpp>
 #include "main.h"
+#include "touch_async.h"
 
-volatile bool doSampleTouch = false;
-
-extern "C" I2C_HandleTypeDef hi2c1;
 extern "C" void gpio_irq_handler(uint16_t btn);
 
 using namespace touchgfx;
@@ -38,19 +36,10 @@ extern "C"
     {
         if (GPIO_Pin == TP_IRQ_Pin)
         {
-            /* Communication with TS is done via I2C.
-            Often the sw requires ISRs (interrupt service routines) to be quick while communication
-            with I2C can be considered relatively long (depending on SW requirements).
-            Considering that the TS feature don't need immediate reaction,
-            it is suggested to use polling mode instead of EXTI mode,
-            in order to avoid blocking I2C communication on interrupt service routines */
-
-            /* Here an example of implementation is proposed which is a mix between pooling and exit mode:
-            On ISR a flag is set (exti5_received), the main loop polls on the flag rather then polling the TS;
-            Mcu communicates with TS only when the flag has been set by ISR. This is just an example:
-            the users should choose they strategy depending on their application needs.*/
-
-            doSampleTouch = true;
+            /* The controller has a new report: queue its read on the I2C1 bus
+            manager, the result is waiting in the mailbox when the TouchGFX
+            task samples the touch. See touch_async.h */
+            touch_async_irq();
             return;
         }
         else if (GPIO_Pin == USER_BTN_Pin)
@@ -62,37 +51,22 @@ extern "C"
 
 void STM32TouchController::init()
 {
-    // No init needed
+    touch_async_init();
 }
 
 bool STM32TouchController::sampleTouch(int32_t& x, int32_t& y)
 {
-    uint8_t touches = 0;
-    uint8_t buf[6];
-    const uint16_t STATUS_REG = 0x814E;
-    const uint16_t TOUCH_POS_REG = 0x8150;
-    uint8_t ZERO = 0;
+    touch_state_t state;
 
-    NVIC_DisableIRQ(TP_IRQ_EXTI_IRQn);
-    if (doSampleTouch)
+    // No bus access here, the latest report is filtered for a single pointer
+    touch_async_state(&state);
+    if (state.pressed)
     {
-        HAL_I2C_Mem_Read(&hi2c1, 0xBA, STATUS_REG, 2, buf, 1, HAL_MAX_DELAY);
-        touches = (0x0F & buf[0]);
-
-        HAL_I2C_Mem_Write(&hi2c1, 0xBA, STATUS_REG, 2, &ZERO, 1, HAL_MAX_DELAY);
-
-        doSampleTouch = false;
-
-        if (touches > 0)
-        {
-            HAL_I2C_Mem_Read(&hi2c1, 0xBA, TOUCH_POS_REG, 2, buf, 4, HAL_MAX_DELAY);
-            x = buf[0] + (buf[1] << 8);
-            y = buf[2] + (buf[3] << 8);
-        }
+        x = state.x;
+        y = state.y;
     }
-    NVIC_EnableIRQ(TP_IRQ_EXTI_IRQn);
 
-    return (touches > 0);
+    return (state.pressed != 0);
 }
 /* USER CODE END STM32TouchController */
 
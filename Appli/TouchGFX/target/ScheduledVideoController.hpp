@@ -0,0 +1,480 @@
+#ifndef SCHEDULEDVIDEOCONTROLLER_HPP
+#define SCHEDULEDVIDEOCONTROLLER_HPP
+
+#include <touchgfx/transforms/DisplayTransformation.hpp>
+#include <touchgfx/widgets/VideoWidget.hpp>
+#include <MJPEGDecoder.hpp>
+#include <string.h>
+#include "fb_strip.h"
+
+/**
+ * DirectFrameBufferVideoController for several streams.
+ *
+ * Strategy:
+ * Decode directly into the framebuffer in draw.
+ * Tick will decide if we are going to a new frame.
+ *
+ * The streams share the JPEG peripheral. At the start of each tick the
+ * streams asking for a new frame are served in order of lateness, the most
+ * behind its presentation time first, until the decode budget of the tick is
+ * used. The others keep their current frame and catch up by skipping frames.
+ *
+ * The frames are decoded at the widget position of the full framebuffer. In
+ * strip mode (FB_STRIP_ENABLE) the locked buffer is a strip block instead:
+ * the streams keep running but nothing is drawn.
+ */
+template <uint32_t no_streams, touchgfx::Bitmap::BitmapFormat output_format>
+class ScheduledVideoController : public touchgfx::VideoController
+{
+public:
+    ScheduledVideoController()
+        : VideoController(), allowSkipFrames(true), decodeBudget(0)
+    {
+        assert((no_streams > 0) && "Video: Number of streams zero!");
+
+        // Clear arrays
+        memset(mjpegDecoders, 0, sizeof(mjpegDecoders));
+    }
+
+    virtual Handle registerVideoWidget(touchgfx::VideoWidget& widget)
+    {
+        // Find stream handle for Widget
+        Handle handle = getFreeHandle();
+
+        streams[handle].isActive = true;
+        memset(&streams[handle].stats, 0, sizeof(StreamStats));
+
+        //Set Widget buffer format and address
+        widget.setVideoBufferFormat(output_format, 0, 0);
+        widget.setVideoBuffer((uint8_t*)0);
+
+        return handle;
+    }
+
+    virtual void unregisterVideoWidget(const Handle handle)
+    {
+        streams[handle].isActive = false;
+    }
+
+    virtual void setFrameRate(const Handle handle, uint32_t ui_frames, uint32_t video_frames)
+    {
+        assert(handle < no_streams);
+        Stream& stream = streams[handle];
+
+        // Reset counters
+        stream.frameCount = 0;
+        stream.tickCount = 0;
+
+        // Save requested frame rate ratio
+        stream.frame_rate_ticks = ui_frames;
+        stream.frame_rate_video = video_frames;
+    }
+
+    virtual void setVideoData(const Handle handle, const uint8_t* movie, const uint32_t length)
+    {
+        assert(handle < no_streams);
+
+        // Reset decoder to first frame
+        mjpegDecoders[handle]->setVideoData(movie, length);
+
+        // Lower flag to show the first frame
+        Stream& stream = streams[handle];
+        stream.frameNumber = mjpegDecoders[handle]->getCurrentFrameNumber();
+        stream.doDecodeNextFrame = false;
+
+        // Stop playing
+        setCommand(handle, PAUSE, 0);
+    }
+
+    virtual void setVideoData(const Handle handle, touchgfx::VideoDataReader& reader)
+    {
+        assert(handle < no_streams);
+
+        // Reset decoder to first frame
+        mjpegDecoders[handle]->setVideoData(reader);
+
+        // Lower flag to show the first frame
+        Stream& stream = streams[handle];
+        stream.frameNumber = mjpegDecoders[handle]->getCurrentFrameNumber();
+        stream.doDecodeNextFrame = false;
+
+        // Stop playing
+        setCommand(handle, PAUSE, 0);
+    }
+
+    virtual void setCommand(const Handle handle, Command cmd, uint32_t param)
+    {
+        assert(handle < no_streams);
+        Stream& stream = streams[handle];
+
+        switch (cmd)
+        {
+        case PLAY:
+            // Cannot Play without movie
+            if (mjpegDecoders[handle]->hasVideo())
+            {
+                stream.isPlaying = true;
+                stream.isShowingOneFrame = false;
+                // Reset counters
+                stream.frameCount = 0;
+                stream.tickCount = 0;
+                // If non-repeating video stopped at the end, kick to next frame
+                if (!stream.repeat)
+                {
+                    MJPEGDecoder* const decoder = mjpegDecoders[handle];
+                    if (decoder->getCurrentFrameNumber() == decoder->getNumberOfFrames())
+                    {
+                        decoder->gotoNextFrame();
+                    }
+                }
+            }
+            break;
+        case PAUSE:
+            stream.isPlaying = false;
+            stream.isShowingOneFrame = false;
+            break;
+        case SEEK:
+            stream.seek_to_frame = param;
+            // Reset counters
+            stream.frameCount = 0;
+            stream.tickCount = 0;
+            break;
+        case SHOW:
+            stream.seek_to_frame = param;
+            stream.isShowingOneFrame = true;
+            stream.doDecodeNextFrame = true;
+            // Reset counters
+            stream.frameCount = 0;
+            stream.tickCount = 0;
+            break;
+        case STOP:
+            stream.isPlaying = false;
+            stream.isShowingOneFrame = false;
+            stream.seek_to_frame = 1;
+            // Reset counters
+            stream.frameCount = 0;
+            stream.tickCount = 0;
+            break;
+        case SET_REPEAT:
+            stream.repeat = (param > 0);
+            break;
+        }
+    }
+
+    virtual bool updateFrame(const Handle handle, touchgfx::VideoWidget& widget)
+    {
+        assert(handle < no_streams);
+        Stream& stream = streams[handle];
+
+        // Second update of a stream, a new tick has started
+        if (stream.isUpdated)
+        {
+            scheduleDecoding();
+        }
+        stream.isUpdated = true;
+
+        bool hasMoreFrames = true;
+
+        if (stream.isPlaying || stream.isShowingOneFrame)
+        {
+            // Increase tickCount
+            stream.tickCount += HAL::getInstance()->getLCDRefreshCount();
+
+            // Lower flag
+            stream.isShowingOneFrame = false;
+
+            if (stream.doDecodeNextFrame)
+            {
+                MJPEGDecoder* const decoder = mjpegDecoders[handle];
+                // Invalidate to get widget redrawn
+                widget.invalidate();
+                // Seek or increment video frame
+                if (stream.seek_to_frame > 0)
+                {
+                    decoder->gotoFrame(stream.seek_to_frame);
+                    hasMoreFrames = (stream.seek_to_frame < decoder->getNumberOfFrames());
+                    stream.seek_to_frame = 0;
+                }
+                else
+                {
+                    if (stream.skip_frames > 0)
+                    {
+                        decoder->gotoFrame(decoder->getCurrentFrameNumber() + stream.skip_frames);
+                        stream.frameCount += stream.skip_frames;
+                        stream.stats.droppedFrames += stream.skip_frames;
+                        stream.skip_frames = 0;
+                    }
+                    if (stream.repeat)
+                    {
+                        hasMoreFrames = decoder->gotoNextFrame();
+                    }
+                    else
+                    {
+                        if (decoder->getCurrentFrameNumber() < decoder->getNumberOfFrames())
+                        {
+                            hasMoreFrames = decoder->gotoNextFrame();
+                        }
+                        else
+                        {
+                            stream.isPlaying = false;
+                            hasMoreFrames = false;
+                        }
+                    }
+                }
+
+                stream.frameNumber = decoder->getCurrentFrameNumber();
+                stream.frameCount++;
+            }
+
+            // Save decode status for next frame
+            stream.doDecodeNextFrame = decodeForNextTick(stream);
+        }
+
+        return hasMoreFrames;
+    }
+
+    virtual void draw(const Handle handle, const touchgfx::Rect& invalidatedArea, const touchgfx::VideoWidget& widget)
+    {
+        assert(handle < no_streams);
+
+        if (output_format != Bitmap::RGB565 && output_format != Bitmap::RGB888 && output_format != Bitmap::ARGB8888)
+        {
+            return;
+        }
+
+#if FB_STRIP_ENABLE
+        // The locked buffer is a strip block, the offsets below would write past it
+        return;
+#endif
+
+        if (mjpegDecoders[handle]->hasVideo())
+        {
+            uint8_t* wbuf = (uint8_t*)touchgfx::HAL::getInstance()->lockFrameBufferForRenderingMethod(touchgfx::HAL::HARDWARE);
+            touchgfx::Rect absolute = widget.getAbsoluteRect();
+            DisplayTransformation::transformDisplayToFrameBuffer(absolute);
+
+            // Get frame buffer pointer to upper left of widget in framebuffer coordinates
+            switch (output_format)
+            {
+            case Bitmap::RGB565:
+                wbuf += (absolute.x + absolute.y * touchgfx::HAL::FRAME_BUFFER_WIDTH) * 2;
+                break;
+            case Bitmap::RGB888:
+                wbuf += (absolute.x + absolute.y * touchgfx::HAL::FRAME_BUFFER_WIDTH) * 3;
+                break;
+            case Bitmap::ARGB8888:
+                wbuf += (absolute.x + absolute.y * touchgfx::HAL::FRAME_BUFFER_WIDTH) * 4;
+                break;
+            default:
+                break;
+            }
+
+            // Decode relevant part of the frame to the framebuffer
+            const uint32_t start = touchgfx::HAL::getInstance()->getCPUCycles();
+            mjpegDecoders[handle]->decodeFrame(invalidatedArea, wbuf, touchgfx::HAL::FRAME_BUFFER_WIDTH);
+            updateDecodeStats(streams[handle], touchgfx::HAL::getInstance()->getCPUCycles() - start);
+            // Release frame buffer
+            touchgfx::HAL::getInstance()->unlockFrameBuffer();
+        }
+    }
+
+    void addDecoder(MJPEGDecoder& decoder, uint32_t index)
+    {
+        assert(index < no_streams);
+        mjpegDecoders[index] = &decoder;
+    }
+
+    virtual uint32_t getCurrentFrameNumber(const Handle handle)
+    {
+        assert(handle < no_streams);
+        Stream& stream = streams[handle];
+
+        return stream.frameNumber;
+    }
+
+    virtual void getVideoInformation(const Handle handle, touchgfx::VideoInformation* data)
+    {
+        assert(handle < no_streams);
+        mjpegDecoders[handle]->getVideoInfo(data);
+    }
+
+    virtual bool getIsPlaying(const Handle handle)
+    {
+        assert(handle < no_streams);
+        Stream& stream = streams[handle];
+        return stream.isPlaying;
+    }
+
+    virtual void setVideoFrameRateCompensation(const bool allow)
+    {
+        allowSkipFrames = allow;
+    }
+
+    struct StreamStats
+    {
+        uint32_t decodes;          // Calls to decodeFrame
+        uint32_t droppedFrames;    // Frames skipped to keep the frame rate
+        uint32_t deferredFrames;   // Frames postponed for a later stream
+        uint32_t decodeCyclesMax;  // Longest decodeFrame
+        uint32_t decodeCyclesAvg;  // Running average used by the scheduler
+        uint64_t decodeCycles;     // Sum of decodeFrame cycles
+    };
+
+    const StreamStats& getStreamStats(const Handle handle) const
+    {
+        assert(handle < no_streams);
+        return streams[handle].stats;
+    }
+
+    // CPU cycles of decoding allowed per tick, 0 for no limit. The most
+    // late stream is always decoded.
+    void setDecodeBudget(uint32_t cycles)
+    {
+        decodeBudget = cycles;
+    }
+
+private:
+    class Stream
+    {
+    public:
+        Stream()
+            : frameCount(0), frameNumber(0), tickCount(0),
+              frame_rate_video(0), frame_rate_ticks(0),
+              seek_to_frame(0), skip_frames(0),
+              isActive(false), isPlaying(false), isShowingOneFrame(false), repeat(true),
+              doDecodeNextFrame(false), isUpdated(false)
+        {
+            memset(&stats, 0, sizeof(stats));
+        }
+        uint32_t frameCount;       // Video frames decoded since play
+        uint32_t frameNumber;      // Video frame showed number
+        uint32_t tickCount;        // UI frames since play
+        uint32_t frame_rate_video; // Ratio of frames wanted counter
+        uint32_t frame_rate_ticks; // Ratio of frames wanted divider
+        uint32_t seek_to_frame;    // Requested next frame number
+        uint32_t skip_frames;      // Number of frames to skip to keep frame rate
+        bool isActive;
+        bool isPlaying;
+        bool isShowingOneFrame;
+        bool repeat;
+        bool doDecodeNextFrame; // High if we should go to next frame in next tick
+        bool isUpdated;         // updateFrame called in this tick
+        StreamStats stats;
+    };
+
+    MJPEGDecoder* mjpegDecoders[no_streams];
+    Stream streams[no_streams];
+    bool allowSkipFrames;
+    uint32_t decodeBudget;
+
+    /**
+     * How far the stream is behind its next presentation time, in 1/256 tick
+     */
+    uint32_t getLateness(const Stream& stream) const
+    {
+        const uint32_t due = stream.tickCount * stream.frame_rate_video;
+        const uint32_t shown = stream.frame_rate_ticks * stream.frameCount;
+        if (due <= shown || stream.frame_rate_video == 0)
+        {
+            return 0;
+        }
+        return (due - shown) * 256 / stream.frame_rate_video;
+    }
+
+    /**
+     * Grant the decodes requested for this tick, most late stream first
+     */
+    void scheduleDecoding()
+    {
+        bool considered[no_streams];
+        uint32_t used = 0;
+        bool first = true;
+
+        for (uint32_t i = 0; i < no_streams; i++)
+        {
+            streams[i].isUpdated = false;
+            considered[i] = !(streams[i].isActive && streams[i].doDecodeNextFrame);
+        }
+
+        for (;;)
+        {
+            uint32_t next = no_streams;
+            for (uint32_t i = 0; i < no_streams; i++)
+            {
+                if (!considered[i] && (next == no_streams || getLateness(streams[i]) > getLateness(streams[next])))
+                {
+                    next = i;
+                }
+            }
+            if (next == no_streams)
+            {
+                break;
+            }
+            considered[next] = true;
+
+            Stream& stream = streams[next];
+            if (first || decodeBudget == 0 || used + stream.stats.decodeCyclesAvg <= decodeBudget)
+            {
+                used += stream.stats.decodeCyclesAvg;
+                first = false;
+            }
+            else
+            {
+                // Try again next tick, frames then late are skipped
+                stream.doDecodeNextFrame = false;
+                stream.stats.deferredFrames++;
+            }
+        }
+    }
+
+    void updateDecodeStats(Stream& stream, uint32_t cycles)
+    {
+        StreamStats& stats = stream.stats;
+        stats.decodes++;
+        stats.decodeCycles += cycles;
+        if (cycles > stats.decodeCyclesMax)
+        {
+            stats.decodeCyclesMax = cycles;
+        }
+        stats.decodeCyclesAvg = (stats.decodeCyclesAvg == 0) ? cycles : (stats.decodeCyclesAvg * 7 + cycles) / 8;
+    }
+
+    /**
+     * Return true, if new video frame should be decoded for the next tick (keep video decode framerate low)
+     */
+    bool decodeForNextTick(Stream& stream)
+    {
+        // Running in UI thread
+
+        // Compare tickCount/frameNumber to frame_rate_ticks/frame_rate_video
+        if ((stream.tickCount * stream.frame_rate_video) > (stream.frame_rate_ticks * stream.frameCount))
+        {
+            if (allowSkipFrames)
+            {
+                stream.skip_frames = (stream.tickCount * stream.frame_rate_video - stream.frame_rate_ticks * stream.frameCount) / stream.frame_rate_ticks;
+                if (stream.skip_frames > 0)
+                {
+                    stream.skip_frames--;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+
+    Handle getFreeHandle()
+    {
+        for (uint32_t i = 0; i < no_streams; i++)
+        {
+            if (streams[i].isActive == false)
+            {
+                return static_cast<VideoController::Handle>(i);
+            }
+        }
+
+        assert(0 && "Unable to find free video stream handle!");
+        return static_cast<VideoController::Handle>(0);
+    }
+};
+
+#endif // SCHEDULEDVIDEOCONTROLLER_HPP
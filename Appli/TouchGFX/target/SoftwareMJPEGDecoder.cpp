@@ -0,0 +1,81 @@
+/**
+  ******************************************************************************
+  * File Name          : SoftwareMJPEGDecoder.cpp
+  ******************************************************************************
+  * MJPEG decoder on the CPU, see SoftwareMJPEGDecoder.hpp. The AVI parsing is
+  * in AVIMJPEGDecoder.cpp.
+  ******************************************************************************
+  */
+
+#include <SoftwareMJPEGDecoder.hpp>
+
+extern "C"
+{
+#include <string.h>
+#include <stm32h7rsxx_hal.h>
+#include "sw_jpeg.h"
+#include "dcache_maint.h"
+}
+
+SoftwareMJPEGDecoder::SoftwareMJPEGDecoder()
+    : AVIMJPEGDecoder()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool SoftwareMJPEGDecoder::decode(const uint8_t* mjpgdata, uint32_t length, uint8_t* buffer, uint32_t stride, const touchgfx::Rect& rect)
+{
+    const touchgfx::Rect area = rect & touchgfx::Rect(0, 0, videoInfo.frame_width, videoInfo.frame_height);
+    if (mjpgdata == 0 || length == 0 || buffer == 0 || area.isEmpty())
+    {
+        return false;
+    }
+
+    const uint32_t start = DWT->CYCCNT;
+    const int ret = sw_jpeg_decode(mjpgdata, length, reinterpret_cast<uint32_t*>(buffer), stride,
+                                   area.x, area.y, area.width, area.height);
+    const uint32_t cycles = DWT->CYCCNT - start;
+
+    stats.frames++;
+    stats.cycles += cycles;
+    if (cycles > stats.cyclesMax)
+    {
+        stats.cyclesMax = cycles;
+    }
+    if (ret != SW_JPEG_OK)
+    {
+        stats.errors++;
+        return false;
+    }
+
+    /* Written by the CPU, read by DMA2D/GPU2D or the LTDC */
+    uint8_t* const first = buffer + (area.y * stride + area.x) * 4;
+    dcache_maint_mark(first, ((area.height - 1) * stride + area.width) * 4);
+    return true;
+}
+
+void SoftwareMJPEGDecoder::decodeChunk(const uint8_t* chunk, uint32_t length, uint8_t* buffer, uint16_t width, uint16_t height, uint32_t stride)
+{
+    decode(chunk, length, buffer, stride / 4, touchgfx::Rect(0, 0, width, height));
+}
+
+bool SoftwareMJPEGDecoder::decodeFrame(const touchgfx::Rect& area, uint8_t* frameBuffer, uint32_t framebuffer_width)
+{
+    /*  Assuming that chunk is available and streamNo and chunkType is correct. */
+    /*  Check by gotoNextFrame */
+    if (readData(currentMovieOffset, 8) == 0)
+    {
+        return false;
+    }
+    const uint32_t length = getU32(currentMovieOffset + 4);
+
+    /*  Ensure whole frame is read */
+    const uint8_t* mjpgdata = readData(currentMovieOffset + 8, length);
+
+    return decode(mjpgdata, length, frameBuffer, framebuffer_width, area);
+}
+
+bool SoftwareMJPEGDecoder::decodeThumbnail(uint32_t frameno, uint8_t* buffer, uint16_t width, uint16_t height)
+{
+    return false;
+}
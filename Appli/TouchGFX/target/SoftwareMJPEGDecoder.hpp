@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * File Name          : SoftwareMJPEGDecoder.hpp
+  ******************************************************************************
+  * MJPEG decoder running on the CPU (sw_jpeg), without the JPEG peripheral
+  ******************************************************************************
+  */
+#ifndef SOFTWAREMJPEGDECODER_HPP
+#define SOFTWAREMJPEGDECODER_HPP
+
+#include <AVIMJPEGDecoder.hpp>
+
+/**
+ * AVI parsing of AVIMJPEGDecoder with the frames decoded by sw_jpeg straight
+ * into the ARGB8888 destination. Only the MCUs of the requested area are
+ * transformed and converted.
+ *
+ * Selected with MJPEG_SOFTWARE_DECODING in TouchGFXHAL.cpp, to compare the
+ * decode time of both backends on the same videos (getDecodeStats against
+ * StreamingMJPEGDecoder::getPipelineStats) or when the JPEG peripheral is
+ * used by something else. It has no other target dependency and is tested
+ * on the host (Tests/test_mjpeg_decoder.cpp).
+ *
+ * sw_jpeg is not reentrant, the decoders must decode from one task.
+ * Thumbnails are not supported.
+ */
+class SoftwareMJPEGDecoder : public AVIMJPEGDecoder
+{
+public:
+    SoftwareMJPEGDecoder();
+
+    //Decode part of the current frame
+    virtual bool decodeFrame(const touchgfx::Rect& area, uint8_t* frameBuffer, uint32_t framebuffer_width);
+    virtual bool decodeThumbnail(uint32_t frameno, uint8_t* buffer, uint16_t width, uint16_t height);
+
+    struct DecodeStats
+    {
+        uint32_t frames;          //Frames and areas decoded
+        uint32_t errors;          //Frames sw_jpeg rejected
+        uint32_t cyclesMax;       //Longest decode
+        uint64_t cycles;          //Time spent in sw_jpeg
+    };
+
+    const DecodeStats& getDecodeStats() const
+    {
+        return stats;
+    }
+
+protected:
+    virtual void decodeChunk(const uint8_t* chunk, uint32_t length, uint8_t* buffer, uint16_t width, uint16_t height, uint32_t stride);
+
+private:
+    bool decode(const uint8_t* mjpgdata, uint32_t length, uint8_t* buffer, uint32_t stride, const touchgfx::Rect& rect);
+
+    DecodeStats stats;
+};
+
+#endif // SOFTWAREMJPEGDECODER_HPP
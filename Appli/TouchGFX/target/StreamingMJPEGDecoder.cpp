@@ -0,0 +1,921 @@
+/**
+  ******************************************************************************
+  * File Name          : StreamingMJPEGDecoder.cpp
+  ******************************************************************************
+  * MJPEG decoder with read-ahead, see StreamingMJPEGDecoder.hpp. Apart from
+  * the second AVI buffer, the thumbnails, the callback registration and the
+  * DMA2D start from the data ready interrupt this is the decoding of the
+  * generated HardwareMJPEGDecoder.cpp, the AVI parsing is in
+  * AVIMJPEGDecoder.cpp.
+  ******************************************************************************
+  */
+
+#include <StreamingMJPEGDecoder.hpp>
+#include <touchgfx/hal/BlitOp.hpp>
+
+extern "C"
+{
+#include <string.h>
+#include <stm32h7rsxx_hal.h>
+#include "cmsis_os2.h"
+#include "idle_sleep.h"
+
+    extern JPEG_HandleTypeDef hjpeg;
+}
+
+#if (USE_HAL_JPEG_REGISTER_CALLBACKS != 1)
+#error "StreamingMJPEGDecoder registers its JPEG callbacks, enable USE_HAL_JPEG_REGISTER_CALLBACKS"
+#endif
+
+#define MCU_WIDTH_PIXELS            ((uint32_t)16)
+#define MCU_HEIGHT_PIXELS           ((uint32_t)16)
+#define MCU_CHROMA_420_SIZE_BYTES   ((uint32_t)384)
+
+#define CHUNK_SIZE_IN  ((uint32_t)(1024*52))  /* Max block size */
+
+/* Output and cropping buffers of the generated decoder. TouchGFXGeneratedHAL
+   constructs it but it never decodes, these decoders reuse its buffers. */
+extern uint8_t MCU_Data_OutBuffer0[];
+extern uint8_t MCU_Data_OutBuffer1[];
+extern uint8_t MCU_Cropping_Buffer[];
+
+namespace StreamingJPEG
+{
+namespace
+{
+uint8_t* FrameBufferAddress;
+uint32_t JPEG_InputImageIndex;
+uint32_t JPEG_InputImageSize_Bytes;
+uint32_t JPEG_InputImageAddress;
+volatile uint32_t Jpeg_HWDecodingEnd = 0;
+volatile uint32_t JPEG_output_is_paused = 0;
+volatile uint32_t JpegProcessing_End = 0;
+uint32_t MCU_TotalNb = 0;
+touchgfx::DMA_Interface* DMA2D_reference;
+volatile uint32_t JPEG_OUT_Write_BufferIndex = 0;
+uint32_t FrameBufferWidth;
+volatile uint32_t line_count = 0;
+
+/* Shared by all decoders like the JPEG peripheral */
+osSemaphoreId_t semDecodingDone;
+
+/* Thumbnail decoded by the JPEG core, sampled from the YCbCr MCU rows */
+struct
+{
+    volatile bool active;
+    uint8_t* buffer;
+    uint32_t width;
+    uint32_t height;
+    uint32_t frameWidth;
+    uint32_t frameHeight;
+    uint32_t row;           /* Next thumbnail row to fill */
+} thumbnail;
+
+struct JPEG_MCU_RGB_Converter
+{
+    uint32_t WidthExtend;
+    uint32_t ScaledWidth;
+    uint32_t LastLineHeight;
+    uint32_t MCU_pr_line;
+    uint32_t bytes_pr_pixel;
+    uint32_t startY;
+    uint32_t endY;
+    uint32_t startX;
+    uint32_t endX;
+    uint32_t MCUStart;
+    uint32_t MCUEnd;
+    uint32_t MCU_pr_job;
+    uint32_t firstColOffset;
+    uint32_t firstRowOffset;
+    uint32_t lastColOffset;
+    uint32_t lastRowOffset;
+} JPEG_ConvertorParams;
+
+uint32_t JPEG_Decode_DMA(JPEG_HandleTypeDef* hjpeg, uint8_t* input, uint32_t chunkSizeIn, uint8_t* output);
+uint32_t JPEG_OutputHandler(JPEG_HandleTypeDef* hjpeg);
+void JPEG_ThumbnailRow(const uint8_t* data, uint32_t firstLine);
+void JPEG_InfoReadyCallback(JPEG_HandleTypeDef* hjpeg, JPEG_ConfTypeDef* pInfo);
+void JPEG_GetDataCallback(JPEG_HandleTypeDef* hjpeg, uint32_t NbDecodedData);
+void JPEG_DataReadyCallback(JPEG_HandleTypeDef* hjpeg, uint8_t* pDataOut, uint32_t OutDataLength);
+void JPEG_ErrorCallback(JPEG_HandleTypeDef* hjpeg);
+void JPEG_DecodeCpltCallback(JPEG_HandleTypeDef* hjpeg);
+}
+
+volatile uint32_t JPEG_OUT_Read_BufferIndex = 0;
+volatile uint32_t DMA2D_CopyBufferEnd = 0;
+
+JPEG_Data_BufferTypeDef Jpeg_OUT_BufferTab[NB_OUTPUT_DATA_BUFFERS] =
+{
+    {JPEG_BUFFER_EMPTY, MCU_Data_OutBuffer0, 0, 0, NULL, false, false, 0, false},
+    {JPEG_BUFFER_EMPTY, MCU_Data_OutBuffer1, 0, 0, NULL, false, false, 0, false},
+};
+}
+
+using namespace StreamingJPEG;
+
+StreamingMJPEGDecoder::StreamingMJPEGDecoder()
+    : AVIMJPEGDecoder(), aviBufferValid(0),
+      aheadBuffer(0), aheadOffset(0), aheadLength(0), aheadHidden(0), nextChunkOffset(0), dma(0)
+{
+    memset(&stats, 0, sizeof(stats));
+
+    /* Create decoding semaphore */
+    if (semDecodingDone == 0)
+    {
+        semDecodingDone = osSemaphoreNew(1, 0, 0);
+    }
+}
+
+void StreamingMJPEGDecoder::initializeJPEG()
+{
+    HAL_JPEG_RegisterInfoReadyCallback(&hjpeg, JPEG_InfoReadyCallback);
+    HAL_JPEG_RegisterGetDataCallback(&hjpeg, JPEG_GetDataCallback);
+    HAL_JPEG_RegisterDataReadyCallback(&hjpeg, JPEG_DataReadyCallback);
+    HAL_JPEG_RegisterCallback(&hjpeg, HAL_JPEG_ERROR_CB_ID, JPEG_ErrorCallback);
+    HAL_JPEG_RegisterCallback(&hjpeg, HAL_JPEG_DECODE_CPLT_CB_ID, JPEG_DecodeCpltCallback);
+}
+
+bool StreamingMJPEGDecoder::fillBuffer(uint8_t* buffer, uint32_t offset, uint32_t length)
+{
+    reader->seek(offset);
+    const bool ok = reader->readData(buffer, length);
+
+    /* JPEG input DMA reads the buffer, push the copy out of the D-cache */
+    const uint32_t start = reinterpret_cast<uint32_t>(buffer) & ~31U;
+    const uint32_t end = reinterpret_cast<uint32_t>(buffer) + length;
+    SCB_CleanDCache_by_Addr(reinterpret_cast<uint32_t*>(start), static_cast<int32_t>(end - start));
+
+    return ok;
+}
+
+const uint8_t* StreamingMJPEGDecoder::readData(uint32_t offset, uint32_t length)
+{
+    if (!isBuffered())
+    {
+        return movieData + offset;
+    }
+
+    /* Nothing is read, the buffers keep their contents */
+    if (length > aviBufferLength)
+    {
+        lastError = AVI_ERROR_FILE_BUFFER_TO_SMALL;
+        return 0;
+    }
+
+    /* Header and payload of the same chunk, or another area of the same frame */
+    if (offset >= aviBufferStartOffset && offset + length <= aviBufferStartOffset + aviBufferValid)
+    {
+        stats.bufferHits++;
+        return aviBuffer + (offset - aviBufferStartOffset);
+    }
+
+    /* Chunk read while the previous frame was decoded: swap the buffers */
+    if (aheadLength != 0 && offset >= aheadOffset && offset + length <= aheadOffset + aheadLength)
+    {
+        uint8_t* const previous = aviBuffer;
+        aviBuffer = aheadBuffer;
+        aheadBuffer = previous;
+        aviBufferStartOffset = aheadOffset;
+        aviBufferValid = aheadLength;
+        aheadLength = 0;
+        stats.aheadHits++;
+        stats.savedCycles += aheadHidden;
+        return aviBuffer + (offset - aviBufferStartOffset);
+    }
+
+    const uint32_t start = idle_sleep_cycles();
+    if (!fillBuffer(aviBuffer, offset, length))
+    {
+        lastError = AVI_ERROR_EOF_REACHED;
+    }
+    stats.readCycles += idle_sleep_cycles() - start;
+
+    aviBufferStartOffset = offset;
+    aviBufferValid = length;
+    return aviBuffer;
+}
+
+void StreamingMJPEGDecoder::readAhead(uint32_t offset)
+{
+    if (aheadBuffer == 0 || !isBuffered() || offset + 8 > movieLength)
+    {
+        return;
+    }
+
+    if (aheadLength != 0)
+    {
+        if (aheadOffset == offset)
+        {
+            return;
+        }
+        stats.aheadMisses++;
+        aheadLength = 0;
+    }
+
+    /* Chunk header, then the payload if the whole chunk fits */
+    const uint32_t start = idle_sleep_cycles();
+    if (!fillBuffer(aheadBuffer, offset, 8))
+    {
+        return;
+    }
+    const uint32_t chunkSize = aheadBuffer[4] | (aheadBuffer[5] << 8) | (aheadBuffer[6] << 16) | (aheadBuffer[7] << 24);
+    uint32_t length = 8;
+    if (8 + chunkSize <= aviBufferLength && offset + 8 + chunkSize <= movieLength)
+    {
+        if (fillBuffer(aheadBuffer + 8, offset + 8, chunkSize))
+        {
+            length += chunkSize;
+        }
+    }
+
+    /* Hidden behind the decode only if the JPEG core is still working on it,
+       a paused output stalls the core until the task resumes it */
+    const uint32_t cycles = idle_sleep_cycles() - start;
+    stats.aheadCycles += cycles;
+    aheadHidden = (Jpeg_HWDecodingEnd == 0 && JPEG_output_is_paused == 0) ? cycles : 0;
+
+    aheadOffset = offset;
+    aheadLength = length;
+}
+
+void StreamingMJPEGDecoder::waitForDecoding(uint32_t nextOffset)
+{
+    const uint32_t start = idle_sleep_cycles();
+
+    /* The JPEG core and the DMA2D work on this frame, fetch the next one */
+    readAhead(nextOffset);
+
+    do
+    {
+        JpegProcessing_End = JPEG_OutputHandler(&hjpeg);
+
+        /* If nothing to do, allow other tasks */
+        if (JpegProcessing_End == 2)
+        {
+            osSemaphoreAcquire(semDecodingDone, osWaitForever);
+        }
+    } while (JpegProcessing_End != 1);
+
+    /* reset flag */
+    Jpeg_HWDecodingEnd = 0;
+    StreamingJPEG::DMA2D_CopyBufferEnd = 0;
+
+    const uint32_t cycles = idle_sleep_cycles() - start;
+    stats.frames++;
+    stats.waitCycles += cycles;
+    if (cycles > stats.waitCyclesMax)
+    {
+        stats.waitCyclesMax = cycles;
+    }
+}
+
+void StreamingMJPEGDecoder::setVideoData(const uint8_t* movie, const uint32_t length)
+{
+    aviBufferValid = 0;
+    aheadLength = 0;
+
+    AVIMJPEGDecoder::setVideoData(movie, length);
+}
+
+void StreamingMJPEGDecoder::setVideoData(touchgfx::VideoDataReader& reader)
+{
+    aviBufferValid = 0;
+    aheadLength = 0;
+
+    AVIMJPEGDecoder::setVideoData(reader);
+}
+
+void StreamingMJPEGDecoder::decodeChunk(const uint8_t* chunk, uint32_t length, uint8_t* buffer, uint16_t width, uint16_t height, uint32_t stride)
+{
+    /* Read ahead while this chunk is decoded */
+    nextChunkOffset = (currentMovieOffset + length + 1) & 0xFFFFFFFE;
+    if (nextChunkOffset == lastFrameEnd)
+    {
+        nextChunkOffset = firstFrameOffset;
+    }
+    decodeMJPEGFrame(chunk, length, buffer, width, height, stride);
+}
+
+void StreamingMJPEGDecoder::decodeMJPEGFrame(const uint8_t* const mjpgdata, const uint32_t length, uint8_t* outputBuffer, uint16_t bufferWidth, uint16_t bufferHeight, uint32_t bufferStride)
+{
+    if (length == 0 || mjpgdata == 0)
+    {
+        return;
+    }
+
+    if (outputBuffer) /* only decode if buffers are assigned. */
+    {
+        /* Update JPEG conversion parameters */
+        JPEG_ConvertorParams.bytes_pr_pixel = 4;
+        JPEG_ConvertorParams.WidthExtend = videoInfo.frame_width;
+        if ((JPEG_ConvertorParams.WidthExtend % 16) != 0)
+        {
+            JPEG_ConvertorParams.WidthExtend += 16 - (JPEG_ConvertorParams.WidthExtend % 16);
+        }
+        JPEG_ConvertorParams.ScaledWidth = 800 * JPEG_ConvertorParams.bytes_pr_pixel;
+        JPEG_ConvertorParams.MCU_pr_line = JPEG_ConvertorParams.WidthExtend / MCU_WIDTH_PIXELS;
+        JPEG_ConvertorParams.LastLineHeight = (videoInfo.frame_height % MCU_HEIGHT_PIXELS) == 0 ? 0 : MCU_HEIGHT_PIXELS - (videoInfo.frame_height % MCU_HEIGHT_PIXELS);
+
+        FrameBufferWidth = bufferStride / 4;
+        FrameBufferAddress = outputBuffer;
+
+        /* The data ready interrupt may start the DMA2D from the first MCU row */
+        DMA2D_reference = dma;
+        JPEG_Decode_DMA(&hjpeg, const_cast<uint8_t*>(mjpgdata), length, outputBuffer);
+        waitForDecoding(nextChunkOffset);
+    }
+}
+
+bool StreamingMJPEGDecoder::decodeFrame(const touchgfx::Rect& area, uint8_t* frameBuffer, uint32_t framebuffer_width)
+{
+    /*  Assuming that chunk is available and streamNo and chunkType is correct. */
+    /*  Check by gotoNextFrame */
+    readData(currentMovieOffset, 8);
+    const uint32_t length = getU32(currentMovieOffset + 4);
+
+    /*  Ensure whole frame is read */
+    const uint8_t* mjpgdata = readData(currentMovieOffset + 8, length);
+    if (mjpgdata == 0)
+    {
+        return false;
+    }
+
+    /* Update JPEG conversion parameters */
+    JPEG_ConvertorParams.bytes_pr_pixel = 4;
+    JPEG_ConvertorParams.WidthExtend = videoInfo.frame_width;
+    if ((JPEG_ConvertorParams.WidthExtend % 16) != 0)
+    {
+        JPEG_ConvertorParams.WidthExtend += 16 - (JPEG_ConvertorParams.WidthExtend % 16);
+    }
+    JPEG_ConvertorParams.ScaledWidth = 800 * JPEG_ConvertorParams.bytes_pr_pixel;
+    JPEG_ConvertorParams.MCU_pr_line = JPEG_ConvertorParams.WidthExtend / MCU_WIDTH_PIXELS;
+    JPEG_ConvertorParams.startY = area.y;
+    JPEG_ConvertorParams.endY = MIN((uint32_t)area.bottom(), videoInfo.frame_height);
+    JPEG_ConvertorParams.startX = area.x;
+    JPEG_ConvertorParams.endX = MIN((uint32_t)area.right(), videoInfo.frame_width);
+    JPEG_ConvertorParams.MCUStart = JPEG_ConvertorParams.startX / MCU_WIDTH_PIXELS;
+    JPEG_ConvertorParams.MCUEnd = (JPEG_ConvertorParams.endX + MCU_WIDTH_PIXELS - 1) / MCU_WIDTH_PIXELS; // Ceil division
+    JPEG_ConvertorParams.MCU_pr_job = JPEG_ConvertorParams.MCUEnd - JPEG_ConvertorParams.MCUStart;
+    JPEG_ConvertorParams.firstColOffset = JPEG_ConvertorParams.startX % MCU_WIDTH_PIXELS;
+    JPEG_ConvertorParams.firstRowOffset = JPEG_ConvertorParams.startY % MCU_HEIGHT_PIXELS;
+    JPEG_ConvertorParams.lastColOffset = (JPEG_ConvertorParams.endX % MCU_WIDTH_PIXELS) == 0 ? 0 : MCU_WIDTH_PIXELS - (JPEG_ConvertorParams.endX % MCU_WIDTH_PIXELS);
+    JPEG_ConvertorParams.lastRowOffset = (JPEG_ConvertorParams.endY % MCU_HEIGHT_PIXELS) == 0 ? 0 : MCU_HEIGHT_PIXELS - (JPEG_ConvertorParams.endY % MCU_HEIGHT_PIXELS);
+
+    FrameBufferWidth = framebuffer_width;
+    FrameBufferAddress = frameBuffer;
+
+    /* Next chunk in the movie, read ahead while this one is decoded */
+    uint32_t next = (currentMovieOffset + 8 + length + 1) & 0xFFFFFFFE;
+    if (next == lastFrameEnd)
+    {
+        next = firstFrameOffset;
+    }
+
+    /* The data ready interrupt may start the DMA2D from the first MCU row */
+    DMA2D_reference = dma;
+    JPEG_Decode_DMA(&hjpeg, const_cast<uint8_t*>(mjpgdata), length, frameBuffer);
+    waitForDecoding(next);
+
+    return true;
+}
+
+bool StreamingMJPEGDecoder::decodeThumbnail(uint32_t frameno, uint8_t* buffer, uint16_t width, uint16_t height)
+{
+    if ((buffer == 0) || (width == 0) || (height == 0) || (videoInfo.frame_width == 0) || (videoInfo.frame_height == 0))
+    {
+        return false;
+    }
+
+    /* Keep the playback position */
+    const uint32_t savedFrameNumber = frameNumber;
+    const uint32_t savedMovieOffset = currentMovieOffset;
+    const AVIErrors savedError = lastError;
+
+    lastError = AVI_NO_ERROR;
+    gotoFrame(frameno);
+    readData(currentMovieOffset, 8);
+    const uint32_t length = getU32(currentMovieOffset + 4);
+    const uint8_t* mjpgdata = readData(currentMovieOffset + 8, length);
+
+    const AVIErrors readError = lastError;
+
+    frameNumber = savedFrameNumber;
+    currentMovieOffset = savedMovieOffset;
+    lastError = savedError;
+
+    if (length == 0 || mjpgdata == 0 || readError != AVI_NO_ERROR)
+    {
+        return false;
+    }
+
+    /* Update JPEG conversion parameters, the whole frame is decoded */
+    JPEG_ConvertorParams.WidthExtend = videoInfo.frame_width;
+    if ((JPEG_ConvertorParams.WidthExtend % 16) != 0)
+    {
+        JPEG_ConvertorParams.WidthExtend += 16 - (JPEG_ConvertorParams.WidthExtend % 16);
+    }
+    JPEG_ConvertorParams.MCU_pr_line = JPEG_ConvertorParams.WidthExtend / MCU_WIDTH_PIXELS;
+    JPEG_ConvertorParams.startY = 0;
+    JPEG_ConvertorParams.endY = videoInfo.frame_height;
+
+    /* The JPEG core has no downscaling, the data ready interrupt samples the
+       thumbnail pixels from each MCU row and the DMA2D is not used */
+    thumbnail.buffer = buffer;
+    thumbnail.width = width;
+    thumbnail.height = height;
+    thumbnail.frameWidth = videoInfo.frame_width;
+    thumbnail.frameHeight = videoInfo.frame_height;
+    thumbnail.row = 0;
+    thumbnail.active = true;
+
+    JPEG_Decode_DMA(&hjpeg, const_cast<uint8_t*>(mjpgdata), length, buffer);
+    while (Jpeg_HWDecodingEnd == 0)
+    {
+        osSemaphoreAcquire(semDecodingDone, osWaitForever);
+    }
+    if (HAL_JPEG_GetState(&hjpeg) == HAL_JPEG_STATE_BUSY_DECODING)
+    {
+        HAL_JPEG_Abort(&hjpeg);
+    }
+
+    thumbnail.active = false;
+    Jpeg_HWDecodingEnd = 0;
+    StreamingJPEG::DMA2D_CopyBufferEnd = 0;
+
+    /* Written by the CPU, drawn later by the DMA2D */
+    const uint32_t start = reinterpret_cast<uint32_t>(buffer) & ~31U;
+    const uint32_t end = reinterpret_cast<uint32_t>(buffer) + width * height * 4;
+    SCB_CleanDCache_by_Addr(reinterpret_cast<uint32_t*>(start), static_cast<int32_t>(end - start));
+
+    return thumbnail.row >= height;
+}
+
+/* C HELPER FUNCTIONS */
+
+namespace StreamingJPEG
+{
+namespace
+{
+/**
+ * @brief  Decode_DMA
+ * @param hjpeg: JPEG handle pointer
+ * @param  JPEGImageBufferAddress : jpg image buffer Address.
+ * @param  JPEGImageSize_Bytes    : jpg image size in bytes.
+ * @param  DestAddress : ARGB8888 destination Frame Buffer Address.
+ * @retval None
+ */
+uint32_t JPEG_Decode_DMA(JPEG_HandleTypeDef* hjpeg, uint8_t* input, uint32_t chunkSizeIn /* length */, uint8_t* output)
+{
+    JPEG_output_is_paused = 0;
+    JPEG_OUT_Read_BufferIndex = 0;
+    JPEG_OUT_Write_BufferIndex = 0;
+    JPEG_InputImageIndex = 0;
+    JPEG_InputImageAddress = (uint32_t)input;
+    JPEG_InputImageSize_Bytes = chunkSizeIn;
+    line_count = 0;
+
+    /* Init buffers */
+    for (uint32_t i = 0; i < NB_OUTPUT_DATA_BUFFERS; ++i)
+    {
+        Jpeg_OUT_BufferTab[i].State = JPEG_BUFFER_EMPTY;
+        Jpeg_OUT_BufferTab[i].DataBufferSize = 0;
+        Jpeg_OUT_BufferTab[i].MCU_index = 0;
+        Jpeg_OUT_BufferTab[i].OutputBuffer = NULL;
+        Jpeg_OUT_BufferTab[i].MCU_drawn = 0;
+        Jpeg_OUT_BufferTab[i].DoCropping = false;
+        Jpeg_OUT_BufferTab[i].FirstJob = false;
+        Jpeg_OUT_BufferTab[i].LastJob = false;
+    }
+    Jpeg_OUT_BufferTab[0].FirstJob = true;
+    if (JPEG_ConvertorParams.firstRowOffset != 0)
+    {
+        Jpeg_OUT_BufferTab[0].DoCropping = true;
+    }
+
+    /* Do not return from this function until done with decoding all chunks. */
+    HAL_JPEG_Decode_DMA(hjpeg, input, CHUNK_SIZE_IN, Jpeg_OUT_BufferTab[JPEG_OUT_Write_BufferIndex].DataBuffer, MCU_CHROMA_420_SIZE_BYTES * JPEG_ConvertorParams.MCU_pr_line);
+
+    return 0;
+}
+
+/**
+ * @brief  Sample the thumbnail pixels covered by one decoded MCU row
+ * @param  data: YCbCr 4:2:0 MCU row from the JPEG core
+ * @param  firstLine: First frame line of the MCU row
+ * @retval None
+ */
+void JPEG_ThumbnailRow(const uint8_t* data, uint32_t firstLine)
+{
+    while (thumbnail.row < thumbnail.height)
+    {
+        /* Nearest frame line of the thumbnail row */
+        const uint32_t sy = thumbnail.row * thumbnail.frameHeight / thumbnail.height;
+        if (sy >= firstLine + MCU_HEIGHT_PIXELS)
+        {
+            return;
+        }
+
+        const uint32_t py = sy - firstLine;
+        uint32_t* dst = reinterpret_cast<uint32_t*>(thumbnail.buffer) + thumbnail.row * thumbnail.width;
+        for (uint32_t x = 0; x < thumbnail.width; x++)
+        {
+            const uint32_t sx = x * thumbnail.frameWidth / thumbnail.width;
+            const uint32_t px = sx % MCU_WIDTH_PIXELS;
+            /* MCU: 4 Y blocks of 8x8, then the Cb and Cr blocks */
+            const uint8_t* mcu = data + (sx / MCU_WIDTH_PIXELS) * MCU_CHROMA_420_SIZE_BYTES;
+            const int32_t y = mcu[((py / 8) * 2 + (px / 8)) * 64 + (py % 8) * 8 + (px % 8)];
+            const int32_t cb = mcu[256 + (py / 2) * 8 + (px / 2)] - 128;
+            const int32_t cr = mcu[320 + (py / 2) * 8 + (px / 2)] - 128;
+
+            /* JFIF full range, 16.16 fixed point */
+            int32_t r = y + ((91881 * cr) >> 16);
+            int32_t g = y - ((22554 * cb + 46802 * cr) >> 16);
+            int32_t b = y + ((116130 * cb) >> 16);
+            r = r < 0 ? 0 : (r > 255 ? 255 : r);
+            g = g < 0 ? 0 : (g > 255 ? 255 : g);
+            b = b < 0 ? 0 : (b > 255 ? 255 : b);
+            dst[x] = 0xFF000000U | (r << 16) | (g << 8) | b;
+        }
+        thumbnail.row++;
+    }
+}
+
+/**
+ * @brief  JPEG Info ready callback
+ * @param hjpeg: JPEG handle pointer
+ * @param pInfo: JPEG Info Struct pointer
+ * @retval None
+ */
+void JPEG_InfoReadyCallback(JPEG_HandleTypeDef* hjpeg, JPEG_ConfTypeDef* pInfo)
+{
+    uint32_t hMCU, vMCU;
+
+    if (pInfo->ChromaSubsampling == JPEG_420_SUBSAMPLING)
+    {
+        if ((pInfo->ImageWidth % 16) != 0)
+        {
+            pInfo->ImageWidth += (16 - (pInfo->ImageWidth % 16));
+        }
+
+        if ((pInfo->ImageHeight % 16) != 0)
+        {
+            pInfo->ImageHeight += (16 - (pInfo->ImageHeight % 16));
+        }
+
+        hMCU = (pInfo->ImageWidth / MCU_WIDTH_PIXELS);
+        vMCU = (pInfo->ImageHeight / MCU_HEIGHT_PIXELS);
+        MCU_TotalNb = (hMCU * vMCU);
+    }
+    else
+    {
+        if (pInfo->ChromaSubsampling == JPEG_422_SUBSAMPLING)
+        {
+            if ((pInfo->ImageWidth % 16) != 0)
+            {
+                pInfo->ImageWidth += (16 - (pInfo->ImageWidth % 16));
+            }
+
+            if ((pInfo->ImageHeight % 8) != 0)
+            {
+                pInfo->ImageHeight += (8 - (pInfo->ImageHeight % 8));
+            }
+        }
+
+        if (pInfo->ChromaSubsampling == JPEG_444_SUBSAMPLING)
+        {
+            if ((pInfo->ImageWidth % 8) != 0)
+            {
+                pInfo->ImageWidth += (8 - (pInfo->ImageWidth % 8));
+            }
+
+            if ((pInfo->ImageHeight % 8) != 0)
+            {
+                pInfo->ImageHeight += (8 - (pInfo->ImageHeight % 8));
+            }
+        }
+    }
+}
+
+/**
+ * @brief  JPEG Get Data callback.
+ * @param hjpeg: JPEG handle pointer
+ * @param NbDecodedData: Number of decoded (consummed) bytes from input buffer
+ * @retval None
+ */
+void JPEG_GetDataCallback(JPEG_HandleTypeDef* hjpeg, uint32_t NbDecodedData)
+{
+    /* Input buffer has been consumed by the peripheral and to ask for a new data chunk if the operation (encoding/decoding) has not been complete yet. */
+    JPEG_InputImageIndex += NbDecodedData;
+    if (JPEG_InputImageIndex < JPEG_InputImageSize_Bytes)
+    {
+        JPEG_InputImageAddress = JPEG_InputImageAddress + NbDecodedData;
+        uint32_t inDataLength = JPEG_InputImageSize_Bytes - JPEG_InputImageIndex;
+        HAL_JPEG_ConfigInputBuffer(hjpeg, (uint8_t*)JPEG_InputImageAddress, inDataLength >= CHUNK_SIZE_IN ? CHUNK_SIZE_IN : inDataLength);
+    }
+}
+
+/**
+ * @brief  JPEG Data Ready callback. Data has been converted from JPEG to YCbCr.
+ * @param hjpeg: JPEG handle pointer
+ * @param pDataOut: pointer to the output data buffer
+ * @param OutDataLength: length of output buffer in bytes
+ * @retval None
+ */
+void JPEG_DataReadyCallback(JPEG_HandleTypeDef* hjpeg, uint8_t* pDataOut, uint32_t OutDataLength)
+{
+    line_count += MCU_HEIGHT_PIXELS;
+
+    if (thumbnail.active)
+    {
+        /* Written by the JPEG output DMA */
+        SCB_InvalidateDCache_by_Addr(reinterpret_cast<uint32_t*>(pDataOut), static_cast<int32_t>(OutDataLength));
+        JPEG_ThumbnailRow(pDataOut, line_count - MCU_HEIGHT_PIXELS);
+
+        if (thumbnail.row >= thumbnail.height || line_count >= thumbnail.frameHeight)
+        {
+            /* Rest of the frame is not needed */
+            HAL_JPEG_Pause(hjpeg, JPEG_PAUSE_RESUME_OUTPUT);
+            Jpeg_HWDecodingEnd = 1;
+            osSemaphoreRelease(semDecodingDone);
+        }
+        else
+        {
+            HAL_JPEG_ConfigOutputBuffer(hjpeg, pDataOut, MCU_CHROMA_420_SIZE_BYTES * JPEG_ConvertorParams.MCU_pr_line);
+        }
+        return;
+    }
+
+    Jpeg_OUT_BufferTab[JPEG_OUT_Write_BufferIndex].OutputBuffer = FrameBufferAddress;
+
+    /* Increment framebuffer */
+    FrameBufferAddress += FrameBufferWidth * MCU_HEIGHT_PIXELS * JPEG_ConvertorParams.bytes_pr_pixel;
+
+    /* Decode until we reach area to draw */
+    if (line_count <= JPEG_ConvertorParams.startY)
+    {
+        HAL_JPEG_ConfigOutputBuffer(hjpeg, Jpeg_OUT_BufferTab[JPEG_OUT_Write_BufferIndex].DataBuffer, MCU_CHROMA_420_SIZE_BYTES * JPEG_ConvertorParams.MCU_pr_line);
+        return;
+    }
+
+    Jpeg_OUT_BufferTab[JPEG_OUT_Write_BufferIndex].State = JPEG_BUFFER_FULL;
+    Jpeg_OUT_BufferTab[JPEG_OUT_Write_BufferIndex].DataBufferSize = OutDataLength;
+    Jpeg_OUT_BufferTab[JPEG_OUT_Write_BufferIndex].MCU_drawn = 0;
+
+    /* Left column requires cropping */
+    if (JPEG_ConvertorParams.firstColOffset != 0)
+    {
+        Jpeg_OUT_BufferTab[JPEG_OUT_Write_BufferIndex].DoCropping = true;
+    }
+
+    if (line_count < JPEG_ConvertorParams.endY)
+    {
+        Jpeg_OUT_BufferTab[JPEG_OUT_Write_BufferIndex].LastJob = false;
+
+        JPEG_OUT_Write_BufferIndex++;
+        if (JPEG_OUT_Write_BufferIndex >= NB_OUTPUT_DATA_BUFFERS)
+        {
+            JPEG_OUT_Write_BufferIndex = 0;
+        }
+
+        /* if the other buffer is full, then ui thread might be converting it */
+        if (Jpeg_OUT_BufferTab[JPEG_OUT_Write_BufferIndex].State != JPEG_BUFFER_EMPTY)
+        {
+            HAL_JPEG_Pause(hjpeg, JPEG_PAUSE_RESUME_OUTPUT);
+            JPEG_output_is_paused = 1;
+        }
+
+        HAL_JPEG_ConfigOutputBuffer(hjpeg, Jpeg_OUT_BufferTab[JPEG_OUT_Write_BufferIndex].DataBuffer, MCU_CHROMA_420_SIZE_BYTES * JPEG_ConvertorParams.MCU_pr_line);
+    }
+
+    /* Stop decoding when we exit area to draw */
+    if (line_count >= JPEG_ConvertorParams.endY)
+    {
+        Jpeg_OUT_BufferTab[JPEG_OUT_Write_BufferIndex].LastJob = true;
+        Jpeg_HWDecodingEnd = 1;
+
+        HAL_JPEG_Pause(hjpeg, JPEG_PAUSE_RESUME_OUTPUT);
+    }
+
+    /* Convert the row right away when the DMA2D is idle instead of waiting
+       for the decoding task to be scheduled. Not while the DMA2D interrupt
+       is preempted, it chains the next row itself. */
+    if (!DMA2D_reference->isDMARunning())
+    {
+        if (NVIC_GetActive(DMA2D_IRQn) == 0U)
+        {
+            DMA2D_reference->start();
+        }
+        osSemaphoreRelease(semDecodingDone);
+    }
+}
+
+/**
+ * @brief  JPEG Error callback
+ * @param hjpeg: JPEG handle pointer
+ * @retval None
+ */
+void JPEG_ErrorCallback(JPEG_HandleTypeDef* hjpeg)
+{
+    __disable_irq();
+    while (1)
+    {
+    }
+}
+
+/**
+ * @brief  JPEG Decode complete callback
+ * @param hjpeg: JPEG handle pointer
+ * @retval None
+ */
+void JPEG_DecodeCpltCallback(JPEG_HandleTypeDef* hjpeg)
+{
+    Jpeg_HWDecodingEnd = 1;
+
+    if (thumbnail.active)
+    {
+        osSemaphoreRelease(semDecodingDone);
+    }
+}
+
+/**
+ * @brief  JPEG Ouput Data BackGround Postprocessing .
+ * @param hjpeg: JPEG handle pointer
+ * @retval 1 : if JPEG processing has finished, 0 : if JPEG processing still ongoing
+ */
+uint32_t JPEG_OutputHandler(JPEG_HandleTypeDef* hjpeg)
+{
+    /* Decode frame complete */
+    if (Jpeg_HWDecodingEnd && DMA2D_CopyBufferEnd)
+    {
+        /* Abort any ongoing operations */
+        if (HAL_JPEG_GetState(hjpeg) == HAL_JPEG_STATE_BUSY_DECODING)
+        {
+            HAL_JPEG_Abort(hjpeg);
+        }
+        return 1;
+    }
+
+    /* Try to start DMA2D video transfer if next buffer if full, the JPEG
+       interrupt starts it too */
+    NVIC_DisableIRQ(JPEG_IRQn);
+    if (!DMA2D_reference->isDMARunning() && (Jpeg_OUT_BufferTab[JPEG_OUT_Read_BufferIndex].State == JPEG_BUFFER_FULL) && (DMA2D_CopyBufferEnd == 0))
+    {
+        DMA2D_reference->start();
+    }
+    NVIC_EnableIRQ(JPEG_IRQn);
+
+    /* Start JPEG IP if paused and next buffer is empty */
+    if ((JPEG_output_is_paused == 1) && (Jpeg_OUT_BufferTab[JPEG_OUT_Write_BufferIndex].State == JPEG_BUFFER_EMPTY) && (Jpeg_HWDecodingEnd == 0))
+    {
+        JPEG_output_is_paused = 0;
+        HAL_JPEG_Resume(hjpeg, JPEG_PAUSE_RESUME_OUTPUT);
+    }
+
+    return 2;
+}
+}
+
+/**
+ * @brief  Configures external DMA2D job to copy YCbCr data to RGB buffer(s)
+ * @param job: External job reference
+ * @retval None
+ */
+void DMA2D_CopyBuffer(JPEG_Data_BufferTypeDef& job)
+{
+    const uint32_t width = JPEG_ConvertorParams.MCU_pr_job * MCU_WIDTH_PIXELS - job.MCU_drawn * MCU_WIDTH_PIXELS - JPEG_ConvertorParams.lastColOffset;
+    const uint32_t scaledWidth = (width % MCU_WIDTH_PIXELS) == 0 ? 0 : MCU_WIDTH_PIXELS - (width % MCU_WIDTH_PIXELS);
+    const uint32_t srcOffset = (JPEG_ConvertorParams.MCUStart + job.MCU_drawn) * MCU_CHROMA_420_SIZE_BYTES;
+    const uint32_t dstOffset = JPEG_ConvertorParams.MCUStart * MCU_WIDTH_PIXELS * JPEG_ConvertorParams.bytes_pr_pixel
+                               + job.MCU_drawn * MCU_WIDTH_PIXELS * JPEG_ConvertorParams.bytes_pr_pixel;
+
+    /* Mark job as fully drawn */
+    job.MCU_drawn = JPEG_ConvertorParams.MCU_pr_job;
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, DMA2D_OUTPUT_ARGB8888);
+
+    /* Configure DMA2D data size */
+    if (job.LastJob)  /* Last line of frame */
+    {
+        WRITE_REG(DMA2D->NLR, (MCU_HEIGHT_PIXELS - JPEG_ConvertorParams.lastRowOffset) | (width << DMA2D_NLR_PL_Pos));
+    }
+    else
+    {
+        WRITE_REG(DMA2D->NLR, MCU_HEIGHT_PIXELS | (width << DMA2D_NLR_PL_Pos));
+    }
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(job.OutputBuffer + dstOffset));
+
+    /* DMA2D OOR register configuration */
+    WRITE_REG(DMA2D->OOR, FrameBufferWidth - width);
+
+    /* DMA2D FGOR register configuration */
+    WRITE_REG(DMA2D->FGOR, scaledWidth);
+
+    /* DMA2D FGPFCCR register configuration */
+    WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_YCBCR | (DMA2D_CSS_420 << DMA2D_FGPFCCR_CSS_Pos) | (DMA2D_REPLACE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (0xFFU << DMA2D_FGPFCCR_ALPHA_Pos));
+
+    /* Configure DMA2D source address */
+    WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(job.DataBuffer + srcOffset));
+
+    /* Configure DMA2D contol register */
+    WRITE_REG(DMA2D->CR, DMA2D_M2M_PFC | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+}
+
+/**
+ * @brief  Configures external DMA2D job to copy and crop YCbCr data to an RGB cropping buffer
+ * @param job: External job reference
+ * @retval None
+ */
+void DMA2D_CropBuffer(JPEG_Data_BufferTypeDef& job)
+{
+    const uint32_t colLeftOffset = job.MCU_drawn == 0 ? JPEG_ConvertorParams.firstColOffset : 0;
+    const uint32_t colRightOffset = job.MCU_drawn == JPEG_ConvertorParams.MCU_pr_job - 1 ? JPEG_ConvertorParams.lastColOffset : 0;
+    const uint32_t rowTopOffset = job.FirstJob ? JPEG_ConvertorParams.firstRowOffset : 0;
+    const uint32_t rowBottomOffset = job.LastJob ? JPEG_ConvertorParams.lastRowOffset : 0;
+    const uint32_t srcOffset = (JPEG_ConvertorParams.MCUStart + job.MCU_drawn) * MCU_CHROMA_420_SIZE_BYTES;
+    const uint32_t dstOffset = JPEG_ConvertorParams.MCUStart * MCU_WIDTH_PIXELS * JPEG_ConvertorParams.bytes_pr_pixel
+                               + job.MCU_drawn * MCU_WIDTH_PIXELS * JPEG_ConvertorParams.bytes_pr_pixel
+                               + rowTopOffset * JPEG_ConvertorParams.bytes_pr_pixel * FrameBufferWidth
+                               + colLeftOffset * JPEG_ConvertorParams.bytes_pr_pixel;
+    const uint32_t cropSrcOffset = colLeftOffset * JPEG_ConvertorParams.bytes_pr_pixel
+                                   + rowTopOffset * JPEG_ConvertorParams.bytes_pr_pixel * MCU_HEIGHT_PIXELS;
+
+    /* Update job and assert if more cropping is needed */
+    job.MCU_drawn++;
+    if ((JPEG_ConvertorParams.firstRowOffset == 0) || !job.FirstJob)
+    {
+        job.DoCropping = false;
+    }
+
+    /* Configure BlitOp */
+    touchgfx::BlitOp blitOp;
+    blitOp.operation = touchgfx::BLIT_OP_COPY;
+    blitOp.pSrc = reinterpret_cast<uint16_t*>(MCU_Cropping_Buffer + cropSrcOffset);
+    blitOp.nSteps = MCU_WIDTH_PIXELS - colLeftOffset - colRightOffset;
+    blitOp.nLoops = MCU_HEIGHT_PIXELS - rowTopOffset - rowBottomOffset;
+    blitOp.srcLoopStride = MCU_WIDTH_PIXELS;
+    blitOp.dstLoopStride = FrameBufferWidth;
+    blitOp.pDst = reinterpret_cast<uint16_t*>(job.OutputBuffer + dstOffset);
+    blitOp.srcFormat = touchgfx::Bitmap::ARGB8888;
+    blitOp.dstFormat = touchgfx::Bitmap::ARGB8888;
+    DMA2D_reference->addToQueue(blitOp);
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, DMA2D_OUTPUT_ARGB8888);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, MCU_HEIGHT_PIXELS | (MCU_WIDTH_PIXELS << DMA2D_NLR_PL_Pos));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(MCU_Cropping_Buffer));
+
+    /* DMA2D OOR register configuration */
+    WRITE_REG(DMA2D->OOR, 0);
+
+    /* DMA2D FGOR register configuration */
+    WRITE_REG(DMA2D->FGOR, 0);
+
+    /* DMA2D FGPFCCR register configuration */
+    WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_YCBCR | (DMA2D_CSS_420 << DMA2D_FGPFCCR_CSS_Pos) | (DMA2D_REPLACE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (0xFFU << DMA2D_FGPFCCR_ALPHA_Pos));
+
+    /* Configure DMA2D source address */
+    WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(job.DataBuffer + srcOffset));
+
+    /* Configure DMA2D contol register */
+    WRITE_REG(DMA2D->CR, DMA2D_M2M_PFC | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+}
+
+/**
+ * @brief  External DMA2D job complete callback
+ * @param job: External job reference
+ * @retval None
+ */
+void DMA2D_ExternalJobCompleted(JPEG_Data_BufferTypeDef& job)
+{
+    /* Mark job done if all MCUs are drawn */
+    if (job.MCU_drawn == JPEG_ConvertorParams.MCU_pr_job)
+    {
+        job.State = JPEG_BUFFER_EMPTY;
+        job.DataBufferSize = 0;
+        job.DoCropping = false;
+        job.FirstJob = false;
+
+        JPEG_OUT_Read_BufferIndex++;
+        if (JPEG_OUT_Read_BufferIndex >= NB_OUTPUT_DATA_BUFFERS)
+        {
+            JPEG_OUT_Read_BufferIndex = 0;
+        }
+
+        /* Check if last line */
+        if (job.LastJob)
+        {
+            DMA2D_CopyBufferEnd = 1;
+        }
+
+        /* Signal decoder thread to wake up and continue decoding */
+        osSemaphoreRelease(semDecodingDone);
+    }
+}
+}
@@ -0,0 +1,122 @@
+/**
+  ******************************************************************************
+  * File Name          : StreamingMJPEGDecoder.hpp
+  ******************************************************************************
+  * MJPEG decoder reading the next AVI chunk while the JPEG core decodes the
+  * current one
+  ******************************************************************************
+  */
+#ifndef STREAMINGMJPEGDECODER_HPP
+#define STREAMINGMJPEGDECODER_HPP
+
+#include <AVIMJPEGDecoder.hpp>
+#include <STM32DMA.hpp>
+
+/**
+ * Output buffers of the JPEG core and the DMA2D jobs converting them, run by
+ * BatchingDMA. Same as the ones of the generated HardwareMJPEGDecoder, which
+ * is left unused.
+ */
+namespace StreamingJPEG
+{
+extern volatile uint32_t JPEG_OUT_Read_BufferIndex;
+extern volatile uint32_t DMA2D_CopyBufferEnd;
+extern JPEG_Data_BufferTypeDef Jpeg_OUT_BufferTab[NB_OUTPUT_DATA_BUFFERS];
+
+void DMA2D_CropBuffer(JPEG_Data_BufferTypeDef& job);
+void DMA2D_CopyBuffer(JPEG_Data_BufferTypeDef& job);
+void DMA2D_ExternalJobCompleted(JPEG_Data_BufferTypeDef& job);
+}
+
+/**
+ * The JPEG core decoding of the generated HardwareMJPEGDecoder, on the AVI
+ * parsing of AVIMJPEGDecoder, with a second AVI file buffer.
+ *
+ * When reading through a VideoDataReader, the chunk after the current frame
+ * is read into the second buffer while the JPEG core and the DMA2D work on
+ * the frame; the next decode then swaps the buffers instead of waiting for
+ * the reader. The JPEG data ready interrupt starts the DMA2D conversion of a
+ * full MCU row itself when the DMA2D is idle.
+ *
+ * Thumbnails are decoded by the JPEG core and sampled from its MCU rows.
+ *
+ * This is read-ahead only: the video widget draw still waits for the whole
+ * frame, so the TouchGFX task does not render while the JPEG core decodes.
+ * PipelineStats::savedCycles measures what the read-ahead takes off the
+ * decode calls.
+ *
+ * The decoders share the JPEG peripheral and must decode from one task.
+ */
+class StreamingMJPEGDecoder : public AVIMJPEGDecoder
+{
+public:
+    StreamingMJPEGDecoder();
+
+    /**
+     * Route the JPEG callbacks of the HAL to the decoders, after MX_JPEG_Init
+     */
+    static void initializeJPEG();
+
+    //Set video data for the decoder
+    virtual void setVideoData(const uint8_t* movie, const uint32_t length);
+    virtual void setVideoData(touchgfx::VideoDataReader& reader);
+    //Decode part of the current frame
+    virtual bool decodeFrame(const touchgfx::Rect& area, uint8_t* frameBuffer, uint32_t framebuffer_width);
+    virtual bool decodeThumbnail(uint32_t frameno, uint8_t* buffer, uint16_t width, uint16_t height);
+
+    void setAVIFileBuffer(uint8_t* buffer, uint32_t size)
+    {
+        AVIMJPEGDecoder::setAVIFileBuffer(buffer, size);
+        aviBufferValid = 0;
+    }
+
+    //Second AVI file buffer of the same size, reader only
+    void setAVIReadAheadBuffer(uint8_t* buffer)
+    {
+        aheadBuffer = buffer;
+        aheadLength = 0;
+    }
+
+    struct PipelineStats
+    {
+        uint32_t frames;          //Decode calls
+        uint32_t bufferHits;      //Reads served by the current AVI buffer
+        uint32_t aheadHits;       //Reads served by the read-ahead buffer
+        uint32_t aheadMisses;     //Chunks read ahead and never used
+        uint32_t waitCyclesMax;   //Longest decode call
+        uint64_t waitCycles;      //Time spent in decode calls
+        uint64_t readCycles;      //Reads the decode calls waited for
+        uint64_t aheadCycles;     //Reads done ahead, during the previous decode
+        uint64_t savedCycles;     //Ahead reads of used chunks done while the JPEG core was busy
+    };
+
+    const PipelineStats& getPipelineStats() const
+    {
+        return stats;
+    }
+
+    void addDMA(touchgfx::DMA_Interface& dma)
+    {
+        this->dma = &dma;
+    }
+protected:
+    virtual void decodeChunk(const uint8_t* chunk, uint32_t length, uint8_t* buffer, uint16_t width, uint16_t height, uint32_t stride);
+    virtual const uint8_t* readData(uint32_t offset, uint32_t length);
+
+private:
+    void decodeMJPEGFrame(const uint8_t* const mjpgdata, const uint32_t length, uint8_t* buffer, uint16_t width, uint16_t height, uint32_t stride);
+    bool fillBuffer(uint8_t* buffer, uint32_t offset, uint32_t length);
+    void readAhead(uint32_t offset);
+    void waitForDecoding(uint32_t nextOffset);
+
+    uint32_t aviBufferValid;
+    uint8_t* aheadBuffer;
+    uint32_t aheadOffset;
+    uint32_t aheadLength;
+    uint32_t aheadHidden;
+    uint32_t nextChunkOffset;
+    PipelineStats stats;
+    touchgfx::DMA_Interface* dma;
+};
+
+#endif // STREAMINGMJPEGDECODER_HPP
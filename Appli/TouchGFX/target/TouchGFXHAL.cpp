@@ -25,15 +25,80 @@
 /* USER CODE BEGIN TouchGFXHAL.cpp */
 #include "FreeRTOS.h"
 #include "stm32h7rsxx_hal.h"
+#include "boot_profile.h"
+#include "dcache_maint.h"
+#include "fb_dirty.h"
+#include "fb_strip.h"
+#include "dma2d_batch.h"
+#include "gui_cache.h"
+#include "frame_prof.h"
+#include "idle_sleep.h"
+#include "block_pool.h"
+#include <StreamingMJPEGDecoder.hpp>
+#include <SoftwareMJPEGDecoder.hpp>
+#include <ScheduledVideoController.hpp>
+extern "C"
+{
+#include <nema_regs.h>
+}
+#if FB_STRIP_ENABLE
+#include <touchgfx/hal/FrameBufferAllocator.hpp>
+#include <touchgfx/Application.hpp>
+#endif
 
 using namespace touchgfx;
 
 extern GFXMMU_HandleTypeDef hgfxmmu;
 
+/* AVI chunk buffer of a decoder, the largest video frame it can read */
+#ifndef MJPEG_AVI_BUFFER_SIZE
+#define MJPEG_AVI_BUFFER_SIZE (128U * 1024U)
+#endif
+
+/* Frames of a video found through the cached idx1 index, seeks past them read the file */
+#ifndef MJPEG_FRAME_INDEX_SIZE
+#define MJPEG_FRAME_INDEX_SIZE (4U * 1024U)
+#endif
+
+/* Decode the videos with sw_jpeg on the CPU, the JPEG peripheral stays idle */
+#ifndef MJPEG_SOFTWARE_DECODING
+#define MJPEG_SOFTWARE_DECODING 0
+#endif
+
+/* Current and read-ahead chunk buffers of both decoders, in external RAM */
+BLOCK_POOL_DEFINE(mjpeg_avi_pool, MJPEG_AVI_BUFFER_SIZE, 4, PSRAM, 1);
+
 namespace
 {
+// Two video widgets sharing the JPEG peripheral
+ScheduledVideoController<2, Bitmap::ARGB8888> videoController;
+#if MJPEG_SOFTWARE_DECODING
+SoftwareMJPEGDecoder videoDecoders[2];
+#else
+StreamingMJPEGDecoder videoDecoders[2];
+#endif
+
+// Frame offsets of the decoders, read by the CPU only
+LOCATION_PRAGMA_NOLOAD("TouchGFX_Framebuffer")
+uint32_t frameIndex[2][MJPEG_FRAME_INDEX_SIZE] LOCATION_ATTRIBUTE_NOLOAD("TouchGFX_Framebuffer");
+
+struct AVIBuffer
+{
+    uint8_t data[MJPEG_AVI_BUFFER_SIZE];
+};
+
+#if FB_STRIP_ENABLE
+// Strip blocks in internal SRAM, the single framebuffer is GFXMMU buffer 0
+ManyBlockAllocator<800 * FB_STRIP_LINES * 4, FB_STRIP_BLOCKS, 4> stripAllocator;
+#else
 LOCATION_PRAGMA_NOLOAD("TouchGFX_Framebuffer")
 uint32_t animationBuffer[800 * 480] LOCATION_ATTRIBUTE_NOLOAD("TouchGFX_Framebuffer");
+#endif
+#if GUI_CACHE_ENABLE
+// Dynamic bitmaps of the RetainedContainers
+LOCATION_PRAGMA_NOLOAD("TouchGFX_Framebuffer")
+uint32_t bitmapCache[GUI_CACHE_SIZE / 4] LOCATION_ATTRIBUTE_NOLOAD("TouchGFX_Framebuffer");
+#endif
 }
 
 void TouchGFXHAL::initialize()
@@ -45,10 +110,72 @@ void TouchGFXHAL::initialize()
     // Please note, HAL::initialize() must be called to initialize the framework.
 
     TouchGFXGeneratedHAL::initialize();
+#if FB_STRIP_ENABLE
+    // Render in strips, the LTDC keeps scanning out buffer 0
+    setFrameBufferAllocator(&stripAllocator);
+    setFrameRefreshStrategy(HAL::REFRESH_STRATEGY_PARTIAL_FRAMEBUFFER);
+    fb_strip_init((void*)GFXMMU_VIRTUAL_BUFFER0_BASE, lcd().framebufferStride(), lcd().bitDepth() / 8, DISPLAY_HEIGHT);
+#else
     setAnimationStorage((void*)animationBuffer);  //enable the animation storage to allow slide animations
+#endif
     instrumentation.init();
     setMCUInstrumentation(&instrumentation);
     enableMCULoadCalculation(true);
+
+    // Everything GPU2D/DMA2D render into, decides if range maintenance is safe
+#if FB_STRIP_ENABLE
+    dcache_maint_target((void*)GFXMMU_VIRTUAL_BUFFER0_BASE, GFXMMU_VIRTUAL_BUFFER1_BASE - GFXMMU_VIRTUAL_BUFFER0_BASE);
+    dcache_maint_target((void*)&stripAllocator, sizeof(stripAllocator));
+#else
+    dcache_maint_target((void*)GFXMMU_VIRTUAL_BUFFER0_BASE, GFXMMU_VIRTUAL_BUFFER1_BASE - GFXMMU_VIRTUAL_BUFFER0_BASE);
+    dcache_maint_target((void*)GFXMMU_VIRTUAL_BUFFER1_BASE, GFXMMU_VIRTUAL_BUFFER1_BASE - GFXMMU_VIRTUAL_BUFFER0_BASE);
+    dcache_maint_target((void*)animationBuffer, sizeof(animationBuffer));
+#endif
+#if GUI_CACHE_ENABLE
+    Bitmap::setCache((uint16_t*)bitmapCache, sizeof(bitmapCache), GUI_CACHE_BITMAPS);
+    dcache_maint_target((void*)bitmapCache, sizeof(bitmapCache));
+#endif
+
+    fb_dirty_init(DISPLAY_WIDTH, DISPLAY_HEIGHT, lcd().bitDepth() / 8);
+
+    // The generated decoder stays idle, the JPEG interrupts go to these
+    StreamingMJPEGDecoder::initializeJPEG();
+
+    // AVI chunk buffers of the decoders, used when reading through a VideoDataReader
+    BlockPool<AVIBuffer, BLOCK_POOL_STRIDE(MJPEG_AVI_BUFFER_SIZE)> aviBuffers(mjpeg_avi_pool);
+    for (uint32_t i = 0; i < sizeof(videoDecoders) / sizeof(videoDecoders[0]); i++)
+    {
+#if MJPEG_SOFTWARE_DECODING
+        AVIBuffer* const buffer = aviBuffers.alloc();
+
+        if (buffer)
+        {
+            videoDecoders[i].setAVIFileBuffer(buffer->data, sizeof(buffer->data));
+        }
+#else
+        AVIBuffer* const buffer = aviBuffers.alloc();
+        AVIBuffer* const ahead = aviBuffers.alloc();
+
+        if (buffer && ahead)
+        {
+            videoDecoders[i].setAVIFileBuffer(buffer->data, sizeof(buffer->data));
+            videoDecoders[i].setAVIReadAheadBuffer(ahead->data);
+        }
+        videoDecoders[i].addDMA(dma);
+#endif
+        videoDecoders[i].setFrameIndexBuffer(frameIndex[i], MJPEG_FRAME_INDEX_SIZE);
+        videoController.addDecoder(videoDecoders[i], i);
+    }
+
+    // Decode at most half of a 60 Hz frame when several videos play
+    videoController.setDecodeBudget(SystemCoreClock / 120);
+}
+
+touchgfx::DMA_Interface& TouchGFXHAL::getBatchingDMA()
+{
+    // Built on first use, by the constructor of the HAL in another file
+    static BatchingDMA batchingDMA;
+    return batchingDMA;
 }
 
 static uint16_t* tft = 0;
@@ -99,7 +226,42 @@ void TouchGFXHAL::flushFrameBuffer(const touchgfx::Rect& rect)
     // use advanceFrameBufferToRect(uint8_t* fbPtr, const touchgfx::Rect& rect)
     // defined in TouchGFXGeneratedHAL.cpp
 
+    frame_prof_flush();
+#if FB_STRIP_ENABLE
+    TouchGFXGeneratedHAL::flushFrameBuffer(rect);
+
+    // The strip is rendered: copy every ready block to the framebuffer. The
+    // DMA2D is shared with the TouchGFX DMA queue, drain it first.
+    dma.flush();
+    FrameBufferAllocator* allocator = getFrameBufferAllocator();
+    allocator->markBlockReadyForTransfer();
+    while (allocator->hasBlockReadyForTransfer())
+    {
+        Rect block;
+        const uint8_t* pixels = allocator->getBlockForTransfer(block);
+        if (fb_strip_copy(pixels, block.x, block.y, block.width, block.height) != FB_STRIP_OK)
+        {
+            // Counted as dropped, the panel keeps the old pixels: draw it again
+            Application::getInstance()->invalidateArea(block);
+        }
+        allocator->freeBlockAfterTransfer();
+    }
+#else
+    if (!rect.isEmpty())
+    {
+        // Lines covered by the rect in the buffer being drawn, the next hand-off
+        // maintains this range only (nothing when the buffer is not cacheable)
+        const uint32_t stride = lcd().framebufferStride();
+        const uint32_t bpp = lcd().bitDepth() / 8;
+        const uint8_t* start = (const uint8_t*)getClientFrameBuffer() + rect.y * stride + rect.x * bpp;
+        const uint32_t size = (rect.height - 1) * stride + rect.width * bpp;
+
+        dcache_maint_mark(start, size);
+        fb_dirty_add(rect.x, rect.y, rect.width, rect.height);
+    }
+
     TouchGFXGeneratedHAL::flushFrameBuffer(rect);
+#endif
 }
 
 bool TouchGFXHAL::blockCopy(void* RESTRICT dest, const void* RESTRICT src, uint32_t numBytes)
@@ -163,18 +325,82 @@ void TouchGFXHAL::enableLCDControllerInterrupt()
 
 bool TouchGFXHAL::beginFrame()
 {
+    frameStart = idle_sleep_cycles();
+    frame_prof_begin();
     return TouchGFXGeneratedHAL::beginFrame();
 }
 
 void TouchGFXHAL::endFrame()
 {
+    static bool firstFrameDone = false;
+
     TouchGFXGeneratedHAL::endFrame();
+    const uint32_t frameCycles = idle_sleep_cycles() - frameStart;
+    dcache_maint_frame(frameCycles);
+    gui_cache_frame(frameCycles);
+    frame_prof_end();
+    dma2d_batch_end_frame();
+#if FB_STRIP_ENABLE
+    fb_strip_end_frame();
+#else
+    // Areas TouchGFX copies to the other buffer, only measured
+    fb_dirty_end_frame();
+#endif
+
+    if (!firstFrameDone)
+    {
+        // Shown on the next VSYNC, the audio start is waiting for this
+        boot_profile_mark(BOOT_PHASE_FIRST_FRAME);
+        firstFrameDone = true;
+    }
+}
+
+void TouchGFXHAL::InvalidateCache()
+{
+    dcache_maint_invalidate();
+}
+
+void TouchGFXHAL::FlushCache()
+{
+    dcache_maint_clean();
 }
 
 extern "C"
 {
+    /**
+     * VideoController::getInstance() of the framework, redirected here with
+     * -Wl,--wrap: the generated singleton only has one stream.
+     */
+    VideoController& __wrap__ZN8touchgfx15VideoController11getInstanceEv()
+    {
+        return videoController;
+    }
+
+    void __real_nema_reg_write(uint32_t reg, uint32_t value);
+
+    /**
+     * nema_reg_write() of nema_hal.c, redirected here with -Wl,--wrap for the
+     * calls of the NemaGFX library: moving the ring stop hands a new command
+     * list to the GPU2D.
+     */
+    void __wrap_nema_reg_write(uint32_t reg, uint32_t value)
+    {
+#ifdef NEMA_CMDRINGSTOP
+        if (reg == NEMA_CMDRINGSTOP)
+        {
+            frame_prof_gpu2d_submit();
+        }
+#endif
+        __real_nema_reg_write(reg, value);
+    }
+
     portBASE_TYPE IdleTaskHook(void* p)
     {
+        // The idle task runs before TouchGFX_Task has built the HAL
+        if (!touchgfx::HAL::getInstance())
+        {
+            return pdTRUE;
+        }
         if ((int)p) //idle task sched out
         {
             touchgfx::HAL::getInstance()->setMCUActive(true);
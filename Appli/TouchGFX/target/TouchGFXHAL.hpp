@@ -26,6 +26,7 @@
 
 #include <TouchGFXGeneratedHAL.hpp>
 #include <CortexMMCUInstrumentation.hpp>
+#include <BatchingDMA.hpp>
 
 /**
  * @class TouchGFXHAL
@@ -44,14 +45,16 @@ public:
      *
      *        Constructor. Initializes members.
      *
-     * @param [in,out] dma     Reference to DMA interface.
+     * @param [in,out] dma     Reference to DMA interface, not used: the HAL
+     *                         runs on the BatchingDMA of getBatchingDMA().
      * @param [in,out] display Reference to LCD interface.
      * @param [in,out] tc      Reference to Touch Controller driver.
      * @param width            Width of the display.
      * @param height           Height of the display.
      */
-    TouchGFXHAL(touchgfx::DMA_Interface& dma, touchgfx::LCD& display, touchgfx::TouchController& tc, uint16_t width, uint16_t height) : TouchGFXGeneratedHAL(dma, display, tc, width, height)
+    TouchGFXHAL(touchgfx::DMA_Interface& dma, touchgfx::LCD& display, touchgfx::TouchController& tc, uint16_t width, uint16_t height) : TouchGFXGeneratedHAL(getBatchingDMA(), display, tc, width, height), frameStart(0)
     {
+        (void)dma;
     }
 
     virtual void initialize();
@@ -163,8 +166,39 @@ protected:
      * @param [in,out] adr New frame buffer address.
      */
     virtual void setTFTFrameBuffer(uint16_t* adr);
+
+    /**
+     * @fn virtual void TouchGFXHAL::InvalidateCache();
+     *
+     * @brief Clean and invalidate the D-cache after a GPU2D/DMA2D operation.
+     *
+     *        Only the cacheable part of the areas drawn by the CPU is maintained,
+     *        see dcache_maint.h. The generated version works on the whole cache.
+     */
+    virtual void InvalidateCache();
+
+    /**
+     * @fn virtual void TouchGFXHAL::FlushCache();
+     *
+     * @brief Clean the D-cache before a GPU2D/DMA2D operation.
+     *
+     *        Only the cacheable part of the areas drawn by the CPU is maintained,
+     *        see dcache_maint.h. The generated version works on the whole cache.
+     */
+    virtual void FlushCache();
 private:
+    /**
+     * @fn static touchgfx::DMA_Interface& TouchGFXHAL::getBatchingDMA();
+     *
+     * @brief DMA of the HAL, replaces the generated STM32DMA instance.
+     *
+     *        DMA of the HAL, replaces the generated STM32DMA instance to merge
+     *        contiguous blits in its queue (BatchingDMA_Queue).
+     */
+    static touchgfx::DMA_Interface& getBatchingDMA();
+
     touchgfx::CortexMMCUInstrumentation instrumentation;
+    uint32_t frameStart;
 };
 
 /* USER CODE END TouchGFXHAL.hpp */
@@ -0,0 +1,68 @@
+/*
+ * extmem_bench.h
+ *
+ * Memory-mapped read benchmark of the external memories.
+ *
+ * Sweeps the EXTMEM memory-mapped profiles on one memory and measures, with
+ * the DWT cycle counter and a cold D-cache, the sequential read bandwidth and
+ * the latency of random cache line fills. Results are kept in a table (for the
+ * debugger) and printed over ITM port 0.
+ *
+ * Runs from Boot, before the application is started: the memory under test
+ * must not hold the code being executed.
+ */
+#ifndef __EXTMEM_BENCH_H
+#define __EXTMEM_BENCH_H
+
+#include "main.h"
+#include "stm32_extmem.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Set to 1 to run the sweep before jumping to the application */
+#ifndef EXTMEM_BENCH_ENABLE
+#define EXTMEM_BENCH_ENABLE          0
+#endif
+
+/* Return codes */
+#define EXTMEM_BENCH_OK              0
+#define EXTMEM_BENCH_ERROR          -1
+#define EXTMEM_BENCH_INVALID_PARAM  -2
+
+#define EXTMEM_BENCH_SEQ_SIZE        (256U * 1024U)    /* Bytes read per sequential pass */
+#define EXTMEM_BENCH_RAND_WINDOW     (4U * 1024U * 1024U)
+#define EXTMEM_BENCH_RAND_COUNT      (1024U)           /* Random line fills per pass */
+
+typedef struct
+{
+	EXTMEM_MapProfileTypeDef profile;
+	uint32_t seq_kbps;              /* Sequential bandwidth, KB/s */
+	uint32_t seq_cycles_per_line;   /* Average cycles per 32B line, sequential */
+	uint32_t rand_cycles_avg;       /* Average latency of a random line fill, cycles */
+	uint32_t rand_cycles_max;       /* Worst random line fill, cycles */
+	uint32_t rand_kbps;             /* Bandwidth of random line fills, KB/s */
+} extmem_bench_result_t;
+
+/**
+ * @brief Sweep all profiles on one memory
+ * @param MemId EXTMEM memory identifier
+ * @param results Table of EXTMEM_MAP_PROFILE_COUNT entries
+ * @return EXTMEM_BENCH_OK on success
+ * @note The memory is left with memory-mapped mode disabled and the
+ *       default profile selected
+ */
+int extmem_bench_run(uint32_t MemId, extmem_bench_result_t *results);
+
+/**
+ * @brief Print a result table over printf
+ */
+void extmem_bench_print(const char *name, const extmem_bench_result_t *results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EXTMEM_BENCH_H */
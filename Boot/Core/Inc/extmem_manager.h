@@ -47,7 +47,14 @@
  * -- Insert your variables declaration here --
  */
 /* USER CODE BEGIN VARIABLES */
-
+extern uint32_t extmem_init_cycles;
+/* Memory-mapped profiles selected before jumping to the application */
+#ifndef EXTMEM_NOR_MAP_PROFILE
+#define EXTMEM_NOR_MAP_PROFILE       EXTMEM_MAP_PROFILE_XIP_CODE
+#endif
+#ifndef EXTMEM_PSRAM_MAP_PROFILE
+#define EXTMEM_PSRAM_MAP_PROFILE     EXTMEM_MAP_PROFILE_PSRAM_FRAMEBUFFER
+#endif
 /* USER CODE END VARIABLES */
 
 void MX_EXTMEM_MANAGER_Init(void);
@@ -56,7 +63,7 @@ void MX_EXTMEM_MANAGER_Init(void);
  * -- Insert functions declaration here --
  */
 /* USER CODE BEGIN FD */
-
+void MX_EXTMEM_MANAGER_ApplyMapProfiles(void);
 /* USER CODE END FD */
 
 #ifdef __cplusplus
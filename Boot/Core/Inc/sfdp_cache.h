@@ -0,0 +1,29 @@
+/*
+ * sfdp_cache.h
+ *
+ * Backup SRAM storage of the NOR SFDP cache record.
+ *
+ * The ExtMem NOR SFDP driver saves the tables it parsed, keyed by the JEDEC ID
+ * of the memory, through EXTMEM_DRIVER_NOR_SFDP_CacheSave and reads them back
+ * on the next boot through EXTMEM_DRIVER_NOR_SFDP_CacheLoad. The record is
+ * CRC protected by the driver. BKPSRAM keeps it across resets as long as the
+ * board stays powered (or VBAT is present), a cold boot runs the discovery.
+ */
+#ifndef __SFDP_CACHE_H
+#define __SFDP_CACHE_H
+
+#include "main.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* BKPSRAM area reserved for the record */
+#define SFDP_CACHE_ADDR      (BKPSRAM_BASE)
+#define SFDP_CACHE_SIZE      (0x400U)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SFDP_CACHE_H */
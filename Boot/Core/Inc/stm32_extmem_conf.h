@@ -75,7 +75,8 @@ enum {
 #define EXTMEM_MEMORY_BOOTXIP  EXTMEMORY_1
 
 /* USER CODE BEGIN EC */
-
+/* Keep the parsed SFDP tables of the NOR in BKPSRAM (sfdp_cache.c) to skip the discovery on warm boots */
+#define EXTMEM_DRIVER_NOR_SFDP_CACHE 1
 /* USER CODE END EC */
 
 /* Exported configuration --------------------------------------------------------*/
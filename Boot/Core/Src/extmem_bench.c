@@ -0,0 +1,146 @@
+/*
+ * extmem_bench.c
+ *
+ * Memory-mapped read benchmark of the external memories, see extmem_bench.h
+ */
+#include "extmem_bench.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_LINE_SIZE     (32U)
+
+static const char *const profile_name[EXTMEM_MAP_PROFILE_COUNT] =
+{
+	"default",
+	"xip-code",
+	"asset-streaming",
+	"psram-framebuffer"
+};
+
+/* Results of the last sweep, readable from the debugger */
+extmem_bench_result_t extmem_bench_last[EXTMEM_MAP_PROFILE_COUNT];
+
+/* Only enable the counter: boot_profile.h owns it and keeps its stamps from it */
+static void bench_dwt_init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static uint32_t bench_kbps(uint32_t bytes, uint32_t cycles)
+{
+	if (cycles == 0)
+		return 0;
+	return (uint32_t)(((uint64_t)bytes * SystemCoreClock) / ((uint64_t)cycles * 1024U));
+}
+
+static void bench_sequential(uint32_t base, extmem_bench_result_t *res)
+{
+	const volatile uint32_t *p = (const volatile uint32_t *)base;
+	uint32_t words = EXTMEM_BENCH_SEQ_SIZE / sizeof(uint32_t);
+	uint32_t sum = 0;
+	uint32_t start, cycles;
+
+	SCB_CleanInvalidateDCache_by_Addr((void *)base, EXTMEM_BENCH_SEQ_SIZE);
+
+	start = DWT->CYCCNT;
+	for (uint32_t i = 0; i < words; i++)
+		sum += p[i];
+	__DSB();
+	cycles = DWT->CYCCNT - start;
+
+	(void)sum;
+	res->seq_kbps = bench_kbps(EXTMEM_BENCH_SEQ_SIZE, cycles);
+	res->seq_cycles_per_line = cycles / (EXTMEM_BENCH_SEQ_SIZE / BENCH_LINE_SIZE);
+}
+
+static void bench_random(uint32_t base, extmem_bench_result_t *res)
+{
+	uint32_t seed = 0x12345678U;
+	uint32_t total = 0, worst = 0;
+	uint32_t sum = 0;
+
+	for (uint32_t i = 0; i < EXTMEM_BENCH_RAND_COUNT; i++)
+	{
+		uint32_t addr, start, cycles;
+
+		/* Numerical Recipes LCG, same sequence for every profile */
+		seed = seed * 1664525U + 1013904223U;
+		addr = base + ((seed >> 8) % (EXTMEM_BENCH_RAND_WINDOW / BENCH_LINE_SIZE)) * BENCH_LINE_SIZE;
+
+		/* Make sure the access is a line fill from the memory */
+		SCB_CleanInvalidateDCache_by_Addr((void *)addr, BENCH_LINE_SIZE);
+
+		start = DWT->CYCCNT;
+		sum += *(const volatile uint32_t *)addr;
+		__DSB();
+		cycles = DWT->CYCCNT - start;
+
+		total += cycles;
+		if (cycles > worst)
+			worst = cycles;
+	}
+
+	(void)sum;
+	res->rand_cycles_avg = total / EXTMEM_BENCH_RAND_COUNT;
+	res->rand_cycles_max = worst;
+	res->rand_kbps = bench_kbps(EXTMEM_BENCH_RAND_COUNT * BENCH_LINE_SIZE, total);
+}
+
+int extmem_bench_run(uint32_t MemId, extmem_bench_result_t *results)
+{
+	uint32_t base;
+	int ret = EXTMEM_BENCH_OK;
+
+	if (results == NULL)
+		return EXTMEM_BENCH_INVALID_PARAM;
+
+	if (EXTMEM_GetMapAddress(MemId, &base) != EXTMEM_OK)
+		return EXTMEM_BENCH_INVALID_PARAM;
+
+	bench_dwt_init();
+	memset(results, 0, sizeof(extmem_bench_result_t) * EXTMEM_MAP_PROFILE_COUNT);
+
+	for (uint32_t p = 0; p < EXTMEM_MAP_PROFILE_COUNT; p++)
+	{
+		results[p].profile = (EXTMEM_MapProfileTypeDef)p;
+
+		if (EXTMEM_MemoryMappedProfile(MemId, (EXTMEM_MapProfileTypeDef)p) != EXTMEM_OK
+				|| EXTMEM_MemoryMappedMode(MemId, EXTMEM_ENABLE) != EXTMEM_OK)
+		{
+			ret = EXTMEM_BENCH_ERROR;
+			break;
+		}
+
+		bench_sequential(base, &results[p]);
+		bench_random(base, &results[p]);
+
+		/* BOOT_Application maps the memories itself */
+		if (EXTMEM_MemoryMappedMode(MemId, EXTMEM_DISABLE) != EXTMEM_OK)
+		{
+			ret = EXTMEM_BENCH_ERROR;
+			break;
+		}
+	}
+
+	(void)EXTMEM_MemoryMappedProfile(MemId, EXTMEM_MAP_PROFILE_DEFAULT);
+	memcpy(extmem_bench_last, results, sizeof(extmem_bench_last));
+
+	return ret;
+}
+
+void extmem_bench_print(const char *name, const extmem_bench_result_t *results)
+{
+	printf("\r\n%s @ %lu MHz\r\n", name, SystemCoreClock / 1000000U);
+	printf("%-18s %10s %10s %10s %10s %10s\r\n",
+			"profile", "seq KB/s", "seq cyc/l", "rnd avg", "rnd max", "rnd KB/s");
+
+	for (uint32_t p = 0; p < EXTMEM_MAP_PROFILE_COUNT; p++)
+	{
+		printf("%-18s %10lu %10lu %10lu %10lu %10lu\r\n",
+				profile_name[results[p].profile],
+				results[p].seq_kbps, results[p].seq_cycles_per_line,
+				results[p].rand_cycles_avg, results[p].rand_cycles_max,
+				results[p].rand_kbps);
+	}
+}
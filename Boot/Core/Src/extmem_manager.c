@@ -23,7 +23,8 @@
 #include <string.h>
 
 /* USER CODE BEGIN Includes */
-
+#include "main.h"
+#include "boot_profile.h"
 /* USER CODE END Includes */
 
 /* USER CODE BEGIN PV */
@@ -40,14 +41,29 @@
  * -- Insert your variables declaration here --
  */
 /* USER CODE BEGIN 0 */
-
+/* CPU cycles spent in MX_EXTMEM_MANAGER_Init, DWT must be running */
+uint32_t extmem_init_cycles;
 /* USER CODE END 0 */
 
 /*
  * -- Insert your external function declaration here --
  */
 /* USER CODE BEGIN 1 */
-
+/**
+  * Select the memory-mapped profiles used by BOOT_Application
+  * @retval None
+  */
+void MX_EXTMEM_MANAGER_ApplyMapProfiles(void)
+{
+  if (EXTMEM_MemoryMappedProfile(EXTMEMORY_1, EXTMEM_NOR_MAP_PROFILE) != EXTMEM_OK)
+  {
+    Error_Handler();
+  }
+  if (EXTMEM_MemoryMappedProfile(EXTMEMORY_2, EXTMEM_PSRAM_MAP_PROFILE) != EXTMEM_OK)
+  {
+    Error_Handler();
+  }
+}
 /* USER CODE END 1 */
 
 /**
@@ -58,7 +74,8 @@ void MX_EXTMEM_MANAGER_Init(void)
 {
 
   /* USER CODE BEGIN MX_EXTMEM_Init_PreTreatment */
-
+  uint32_t init_start = DWT->CYCCNT;
+  boot_profile_mark(BOOT_PHASE_EXTMEM_START);
   /* USER CODE END MX_EXTMEM_Init_PreTreatment */
   HAL_RCCEx_EnableClockProtection(RCC_CLOCKPROTECT_XSPI);
 
@@ -99,6 +116,9 @@ void MX_EXTMEM_MANAGER_Init(void)
   EXTMEM_Init(EXTMEMORY_2, HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_XSPI1));
 
   /* USER CODE BEGIN MX_EXTMEM_Init_PostTreatment */
-
+  extmem_init_cycles = DWT->CYCCNT - init_start;
+  MX_EXTMEM_MANAGER_ApplyMapProfiles();
+  boot_profile_mark(BOOT_PHASE_EXTMEM_DONE);
   /* USER CODE END MX_EXTMEM_Init_PostTreatment */
 }
+
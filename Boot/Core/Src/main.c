@@ -22,7 +22,9 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
-
+#include "extmem_bench.h"
+#include "boot_profile.h"
+#include <stdio.h>
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -99,7 +101,7 @@ int main(void)
   SystemClock_Config();
 
   /* USER CODE BEGIN SysInit */
-
+  boot_profile_start();
   /* USER CODE END SysInit */
 
   /* Initialize all configured peripherals */
@@ -112,7 +114,33 @@ int main(void)
   MX_SBS_Init();
   MX_EXTMEM_MANAGER_Init();
   /* USER CODE BEGIN 2 */
-
+#if EXTMEM_BENCH_ENABLE
+  {
+    static extmem_bench_result_t bench[EXTMEM_MAP_PROFILE_COUNT];
+
+    if (extmem_bench_run(EXTMEMORY_1, bench) == EXTMEM_BENCH_OK)
+    {
+      extmem_bench_print("NOR (XSPI2)", bench);
+    }
+    if (extmem_bench_run(EXTMEMORY_2, bench) == EXTMEM_BENCH_OK)
+    {
+      extmem_bench_print("PSRAM (XSPI1)", bench);
+    }
+    MX_EXTMEM_MANAGER_ApplyMapProfiles();
+  }
+#endif /* EXTMEM_BENCH_ENABLE */
+  {
+    uint32_t mhz = SystemCoreClock / 1000000U;
+    uint32_t boot_cycles = boot_profile_now();
+
+    /* Boot to BOOT_Application, the memory mapping and the jump take a few us more */
+    printf("boot: extmem init %lu us (SFDP %s), total %lu us\r\n",
+           extmem_init_cycles / mhz,
+           (extmem_list_config[EXTMEMORY_1].NorSfdpObject.sfdp_private.FromCache != 0U) ? "cached" : "discovered",
+           boot_cycles / mhz);
+  }
+  boot_profile_mark(BOOT_PHASE_JUMP);
+  boot_profile_flush();
   /* USER CODE END 2 */
 
   /* Launch the application */
@@ -452,6 +480,12 @@ static void MX_GPIO_Init(void)
 }
 
 /* USER CODE BEGIN 4 */
+/* Boot has no console: route printf to the SWO (ITM stimulus port 0) */
+int __io_putchar(int ch)
+{
+  ITM_SendChar((uint32_t)ch);
+  return ch;
+}
 
 /* USER CODE END 4 */
 
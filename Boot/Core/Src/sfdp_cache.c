@@ -0,0 +1,45 @@
+/*
+ * sfdp_cache.c
+ *
+ * Backup SRAM storage of the NOR SFDP cache record, see sfdp_cache.h
+ */
+#include "sfdp_cache.h"
+#include "stm32_extmem_conf.h"
+#include "nor_sfdp/stm32_sfdp_driver_api.h"
+#include <string.h>
+
+#if defined(EXTMEM_DRIVER_NOR_SFDP_CACHE) && (EXTMEM_DRIVER_NOR_SFDP_CACHE == 1)
+
+static void sfdp_cache_access(void)
+{
+	__HAL_RCC_BKPRAM_CLK_ENABLE();
+	HAL_PWR_EnableBkUpAccess();
+}
+
+EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_CacheLoad(uint8_t *Data, uint32_t Size)
+{
+	if (Size > SFDP_CACHE_SIZE)
+		return EXTMEM_DRIVER_NOR_SFDP_ERROR;
+
+	sfdp_cache_access();
+	memcpy(Data, (const void *)SFDP_CACHE_ADDR, Size);
+
+	return EXTMEM_DRIVER_NOR_SFDP_OK;
+}
+
+void EXTMEM_DRIVER_NOR_SFDP_CacheSave(const uint8_t *Data, uint32_t Size)
+{
+	if (Size > SFDP_CACHE_SIZE)
+		return;
+
+	sfdp_cache_access();
+	if (Data == NULL)
+		memset((void *)SFDP_CACHE_ADDR, 0, SFDP_CACHE_SIZE);
+	else
+		memcpy((void *)SFDP_CACHE_ADDR, Data, Size);
+
+	/* BKPSRAM is cacheable in Boot, the record must reach the RAM before the jump */
+	SCB_CleanDCache_by_Addr((void *)SFDP_CACHE_ADDR, SFDP_CACHE_SIZE);
+}
+
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
@@ -0,0 +1,136 @@
+/*
+ * boot_profile.h
+ *
+ * Boot-phase timestamps shared by Boot and Appli.
+ *
+ * Boot resets the DWT cycle counter right after the clock tree is configured
+ * and the application does not touch the clocks again, so a single cycle
+ * count runs from SystemClock_Config in Boot to the first frame of the GUI.
+ * Each phase stores the counter in a record placed in BKPSRAM, behind the
+ * SFDP cache. The area is not initialized by either startup code, so the
+ * application can print the whole timeline (boot_profile_print) and it can
+ * also be read with the debugger after the fact.
+ *
+ * Both images include this file from Common/Inc, each with its own main.h.
+ */
+#ifndef __BOOT_PROFILE_H
+#define __BOOT_PROFILE_H
+
+#include "main.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* BKPSRAM area of the record, the first 1KB holds the SFDP cache */
+#define BOOT_PROFILE_ADDR           (BKPSRAM_BASE + 0x400U)
+#define BOOT_PROFILE_MAGIC          (0x544F4F42U)   /* "BOOT" */
+
+typedef enum
+{
+	/* Boot */
+	BOOT_PHASE_CLOCK,               /* SystemClock_Config done, counter origin */
+	BOOT_PHASE_EXTMEM_START,        /* MX_EXTMEM_MANAGER_Init entered */
+	BOOT_PHASE_EXTMEM_DONE,         /* External memories ready */
+	BOOT_PHASE_JUMP,                /* BOOT_Application called */
+	/* Appli */
+	BOOT_PHASE_APPLI_MAIN,          /* Appli main() entered */
+	BOOT_PHASE_APPLI_HAL,           /* MPU, caches and HAL_Init done */
+	BOOT_PHASE_APPLI_PERIPH,        /* MX_xxx_Init and MX_TouchGFX_Init done */
+	BOOT_PHASE_SCHEDULER,           /* osKernelStart called */
+	BOOT_PHASE_GUI_INIT,            /* TouchGFX HAL initialized */
+	BOOT_PHASE_FIRST_FRAME,         /* First frame rendered and handed to the LTDC */
+	BOOT_PHASE_LFS_MOUNTED,         /* littlefs mounted */
+	BOOT_PHASE_AUDIO_READY,         /* Decoder started and SAI DMA running */
+	BOOT_PHASE_COUNT
+} boot_phase_e;
+
+typedef struct
+{
+	uint32_t magic;
+	uint32_t boot_count;            /* Boots since the backup domain was powered */
+	uint32_t core_clock;            /* SystemCoreClock of the counter, Hz */
+	volatile uint32_t reached;      /* Bit n set when phase n has been stamped */
+	uint32_t stamp[BOOT_PHASE_COUNT];
+} boot_profile_t;
+
+#define boot_profile                ((boot_profile_t *)BOOT_PROFILE_ADDR)
+
+/**
+ * @brief Restart the counter and the record, called once by Boot after
+ *        SystemClock_Config. Stamps BOOT_PHASE_CLOCK.
+ */
+static inline void boot_profile_start(void)
+{
+	uint32_t count;
+
+	__HAL_RCC_BKPRAM_CLK_ENABLE();
+	HAL_PWR_EnableBkUpAccess();
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	count = (boot_profile->magic == BOOT_PROFILE_MAGIC) ? boot_profile->boot_count + 1U : 1U;
+	for (uint32_t i = 0; i < BOOT_PHASE_COUNT; i++)
+		boot_profile->stamp[i] = 0;
+	boot_profile->reached = 1UL << BOOT_PHASE_CLOCK;
+	boot_profile->core_clock = SystemCoreClock;
+	boot_profile->boot_count = count;
+	boot_profile->magic = BOOT_PROFILE_MAGIC;
+}
+
+/**
+ * @brief Stamp a phase with the current cycle count
+ */
+static inline void boot_profile_mark(boot_phase_e phase)
+{
+	boot_profile->stamp[phase] = DWT->CYCCNT;
+	boot_profile->reached |= 1UL << phase;
+}
+
+/**
+ * @brief Cycles elapsed since BOOT_PHASE_CLOCK
+ */
+static inline uint32_t boot_profile_now(void)
+{
+	return DWT->CYCCNT - boot_profile->stamp[BOOT_PHASE_CLOCK];
+}
+
+/**
+ * @brief Push the record out of the D-cache, Boot calls it before the jump
+ */
+static inline void boot_profile_flush(void)
+{
+	SCB_CleanDCache_by_Addr((void *)BOOT_PROFILE_ADDR, sizeof(boot_profile_t));
+}
+
+/* Provided by the application, boot_profile.c */
+
+/**
+ * @brief Attach to the record left by Boot. When the application was started
+ *        without Boot (debugger download) a fresh record is started instead.
+ */
+void boot_profile_attach(void);
+
+/**
+ * @brief Wait until a phase has been stamped
+ * @param phase Phase to wait for
+ * @param timeout_ms Give up after this many milliseconds
+ * @return 0 when the phase was reached, -1 on timeout
+ * @note Task context only
+ */
+int boot_profile_wait(boot_phase_e phase, uint32_t timeout_ms);
+
+/**
+ * @brief Print the timeline over printf (time since the clock setup in Boot
+ *        and time spent since the previous phase)
+ */
+void boot_profile_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BOOT_PROFILE_H */
@@ -26,6 +26,7 @@
 #include <stdio.h>
 #endif /* EXTMEM_DRIVER_NOR_SFDP_DEBUG_LEVEL != 0 && EXTMEM_MACRO_DEBUG */
 #include <string.h>
+#include <stddef.h>
 
 /** @defgroup NOR_SFDP_DATA Data module
   * @ingroup NOR_SFDP
@@ -93,6 +94,12 @@ typedef enum
   */
 #define SFDP_SIGNATURE                0x50444653U
 #define SFDP_SIGNATURE_INVERTED       0x44505346U
+
+/**
+  * @brief SFDP cache record magic value ("SFDC")
+  */
+#define SFDP_CACHE_MAGIC              0x43444653U
+
 /**
   * @brief SFDP header size
   */
@@ -320,7 +327,7 @@ typedef struct
         uint32_t SuspendInProgress_ProgramMaxLatency:7;
         uint32_t EraseResumeToSuspendInterval:4;
         uint32_t SuspendInProgress_EraseMaxLatency:7;
-        uint32_t :1;
+        uint32_t SuspendResume_NotSupported:1;
       } D12;
       struct
       {
@@ -1095,6 +1102,30 @@ typedef union
   * @}
   */
 
+#if defined(EXTMEM_DRIVER_NOR_SFDP_CACHE) && (EXTMEM_DRIVER_NOR_SFDP_CACHE == 1)
+/**
+  * @brief SFDP cache record, the parsed tables of one memory keyed by its JEDEC ID
+  */
+typedef struct
+{
+  uint32_t                        Magic;                /*!< SFDP_CACHE_MAGIC */
+  uint32_t                        Size;                 /*!< sizeof(SFDP_CacheRecord_t), catches layout changes */
+  uint8_t                         JedecId[EXTMEM_READ_JEDEC_ID_SIZE]; /*!< Key of the record */
+  uint8_t                         Sfdp_param_number;    /*!< Number of parameters from the SFDP header table */
+  uint8_t                         Sfdp_AccessProtocol;  /*!< Access protocol type from the SFDP header table */
+  uint8_t                         PhyLink;              /*!< Link used after the driver build, for the reset */
+  uint8_t                         CommandExtension;     /*!< Command extension used with PhyLink */
+  uint32_t                        Sfdp_table_mask;      /*!< Sfdp table mask */
+  uint32_t                        Reset_info;           /*!< Copy of JEDEC Basic 16 Reset/Rescue info */
+  SFDP_JEDECBasic_Params_t        Basic;                /*!< JEDEC basic table */
+  SFDP_JEDEC4ByteAddress_Params_t Address4Bytes;        /*!< JEDEC 4-byte address table */
+  SFDP_JEDEC_XSPI10_t             XSPI10;               /*!< JEDEC XSPI 1.0 table */
+  SFDP_JEDEC_SCCR_Map_t           SCCR_Map;             /*!< JEDEC SCCR table */
+  SFDP_JEDEC_OCTALDDR_t           OctalDdr;             /*!< JEDEC octal DDR table */
+  uint32_t                        Crc;                  /*!< CRC32 of all the fields above */
+} SFDP_CacheRecord_t;
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
+
 /* Private variables ---------------------------------------------------------*/
 /** @defgroup NOR_SFDP_DATA_Private_Variables Private Variables
   * @{
@@ -1129,6 +1160,12 @@ static SFDP_JEDEC_SCCR_Map_t           JEDEC_SCCR_Map;
   */
 static SFDP_JEDEC_OCTALDDR_t           JEDEC_OctalDdr;
 
+#if defined(EXTMEM_DRIVER_NOR_SFDP_CACHE) && (EXTMEM_DRIVER_NOR_SFDP_CACHE == 1)
+/**
+  * @brief this variable contains the record built during the SFDP discovery
+  */
+static SFDP_CacheRecord_t              sfdp_cache_record;
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
 
 /**
   * @}
@@ -1157,6 +1194,10 @@ SFDP_StatusTypeDef JEDEC_Basic_Manage4S4S4SEnableSequence(EXTMEM_DRIVER_NOR_SFDP
   * @{
   */
 SFDP_StatusTypeDef CheckSFDP_Signature(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object, uint32_t Signature);
+SFDP_StatusTypeDef sfdp_reset_send(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object);
+#if defined(EXTMEM_DRIVER_NOR_SFDP_CACHE) && (EXTMEM_DRIVER_NOR_SFDP_CACHE == 1)
+uint32_t sfdp_cache_crc(const uint8_t *Data, uint32_t Size);
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
 /**
   * @}
   */
@@ -1356,7 +1397,6 @@ error:
   */
 SFDP_StatusTypeDef SFDP_MemoryReset(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object)
 {
-  RESET_METHOD reset_method;
   SFDP_StatusTypeDef retr = EXTMEM_SFDP_ERROR_NO_PARAMTABLE_BASIC;
   uint32_t sfdp_address = SFDP_HEADER_SIZE;
   uint8_t find = 0u;
@@ -1403,6 +1443,23 @@ SFDP_StatusTypeDef SFDP_MemoryReset(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object
     goto error;
   }
 
+  retr = sfdp_reset_send(Object);
+
+error :
+  return retr;
+}
+
+/**
+  * @brief Sends the reset sequence described by the JEDEC basic table on the current link.
+  * @param Object Pointer to the NOR SFDP memory instance object descriptor.
+  * @retval SFDP_StatusTypeDef Status of the operation: EXTMEM_SFDP_OK if successful, error code otherwise.
+  */
+SFDP_StatusTypeDef sfdp_reset_send(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object)
+{
+  RESET_METHOD reset_method;
+  SFDP_StatusTypeDef retr = EXTMEM_SFDP_OK;
+  SFDP_DEBUG_STR(__func__);
+
   /* Determine how to proceed memory reset */
   if (0x0u == JEDEC_Basic.Params.Param_DWORD.D16.SoftResetRescueSequence_Support)
   {
@@ -1606,6 +1663,28 @@ SFDP_StatusTypeDef SFDP_BuildGenericDriver(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef
     (JEDEC_Basic.Params.Param_DWORD.D11.ChipErase_TypicalTime_count + 1u) *
     chip_erase_unit[JEDEC_Basic.Params.Param_DWORD.D11.ChipErase_TypicalTime_units];
 
+  /* ---------------------------------------------------
+   *  Erase suspend/resume
+   * ---------------------------------------------------
+   */
+  Object->sfdp_private.DriverInfo.EraseSuspendCommand = 0u;
+  Object->sfdp_private.DriverInfo.EraseResumeCommand  = 0u;
+  if ((JEDEC_Basic.size >= 13u) && (JEDEC_Basic.Params.Param_DWORD.D12.SuspendResume_NotSupported == 0u))
+  {
+    /* latency 6:5 units (00b: 128 ns, 01b: 1 us, 10b: 8 us, 11b: 64 us), 4:0 count */
+    static const uint32_t suspend_latency_unit_ns[] = { 128u, 1000u, 8000u, 64000u };
+    uint32_t latency = JEDEC_Basic.Params.Param_DWORD.D12.SuspendInProgress_EraseMaxLatency;
+
+    Object->sfdp_private.DriverInfo.EraseSuspendCommand = (uint8_t)JEDEC_Basic.Params.Param_DWORD.D13.Suspend_Intruction;
+    Object->sfdp_private.DriverInfo.EraseResumeCommand  = (uint8_t)JEDEC_Basic.Params.Param_DWORD.D13.Resume_Intruction;
+    Object->sfdp_private.DriverInfo.EraseSuspendLatency =
+      ((((latency & 0x1Fu) + 1u) * suspend_latency_unit_ns[(latency >> 5u) & 0x3u]) + 999u) / 1000u;
+    /* count of 64 us */
+    Object->sfdp_private.DriverInfo.EraseResumeInterval =
+      (JEDEC_Basic.Params.Param_DWORD.D12.EraseResumeToSuspendInterval + 1u) * 64u;
+    SFDP_DEBUG_INT("-> erase suspend latency us:", Object->sfdp_private.DriverInfo.EraseSuspendLatency);
+  }
+
   /* ------------------------------------------------------
    *   WIP/WEL : write in progress/ write enable management
    * ------------------------------------------------------
@@ -2899,6 +2978,155 @@ SFDP_StatusTypeDef CheckSFDP_Signature(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Obj
   }
   return retr;
 }
+#if defined(EXTMEM_DRIVER_NOR_SFDP_CACHE) && (EXTMEM_DRIVER_NOR_SFDP_CACHE == 1)
+/**
+  * @brief Computes the CRC32 (IEEE 802.3) of a buffer.
+  * @param Data Pointer to the data.
+  * @param Size Size of the data in bytes.
+  * @retval uint32_t CRC value.
+  */
+uint32_t sfdp_cache_crc(const uint8_t *Data, uint32_t Size)
+{
+  uint32_t crc = 0xFFFFFFFFu;
+
+  for (uint32_t index = 0u; index < Size; index++)
+  {
+    crc ^= Data[index];
+    for (uint8_t bit = 0u; bit < 8u; bit++)
+    {
+      crc = ((crc & 1u) != 0u) ? ((crc >> 1u) ^ 0xEDB88320u) : (crc >> 1u);
+    }
+  }
+  return ~crc;
+}
+
+/**
+  * @brief Restores the SFDP data of the memory from the cache record.
+  * @note  The memory is reset on the link saved in the record and on the 1S1S1S link, and its
+  *        JEDEC ID is compared with the record key before any data is used.
+  * @param Object Pointer to the NOR SFDP memory instance object descriptor.
+  * @retval SFDP_StatusTypeDef Status of the operation: EXTMEM_SFDP_OK if the record can be used.
+  */
+SFDP_StatusTypeDef SFDP_CacheRestore(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object)
+{
+  SFDP_CacheRecord_t *record = &sfdp_cache_record;
+  SFDP_StatusTypeDef retr = EXTMEM_SFDP_ERROR_CACHE;
+  uint8_t DataID[6];
+  SFDP_DEBUG_STR(__func__);
+
+  if (EXTMEM_DRIVER_NOR_SFDP_OK != EXTMEM_DRIVER_NOR_SFDP_CacheLoad((uint8_t *)record, sizeof(SFDP_CacheRecord_t)))
+  {
+    goto error;
+  }
+
+  if ((record->Magic != SFDP_CACHE_MAGIC) || (record->Size != sizeof(SFDP_CacheRecord_t))
+      || (record->Crc != sfdp_cache_crc((const uint8_t *)record, offsetof(SFDP_CacheRecord_t, Crc))))
+  {
+    SFDP_DEBUG_STR("invalid cache record");
+    goto error;
+  }
+
+  /* The reset sequence comes from the cached JEDEC basic table */
+  (void)memcpy(&JEDEC_Basic, &record->Basic, sizeof(JEDEC_Basic));
+
+  /* The memory may still be in the mode set by the previous run */
+  Object->sfdp_private.DriverInfo.SpiPhyLink = (SAL_XSPI_PhysicalLinkTypeDef)record->PhyLink;
+  (void)SAL_XSPI_MemoryConfig(&Object->sfdp_private.SALObject, PARAM_PHY_LINK,
+                              &Object->sfdp_private.DriverInfo.SpiPhyLink);
+  SAL_XSPI_SET_COMMANDEXTENSION(Object->sfdp_private.SALObject, record->CommandExtension);
+  (void)sfdp_reset_send(Object);
+
+  Object->sfdp_private.DriverInfo.SpiPhyLink = PHY_LINK_1S1S1S;
+  (void)SAL_XSPI_MemoryConfig(&Object->sfdp_private.SALObject, PARAM_PHY_LINK,
+                              &Object->sfdp_private.DriverInfo.SpiPhyLink);
+  SAL_XSPI_SET_COMMANDEXTENSION(Object->sfdp_private.SALObject, 0u);
+  SAL_XSPI_SET_SFDPDUMMYCYLE(Object->sfdp_private.SALObject, EXTMEM_READ_SFDP_NB_DUMMY_CYCLES_DEFAULT);
+  (void)sfdp_reset_send(Object);
+
+  /* Same recovery time as the discovery path */
+  HAL_Delay(10);
+
+  /* Check the record key */
+  if (HAL_OK != SAL_XSPI_GetId(&Object->sfdp_private.SALObject, DataID, EXTMEM_READ_JEDEC_ID_SIZE))
+  {
+    goto error;
+  }
+  if (0 != memcmp(DataID, record->JedecId, EXTMEM_READ_JEDEC_ID_SIZE))
+  {
+    SFDP_DEBUG_STR("cache record of another memory");
+    goto error;
+  }
+
+  /* Restore the SFDP data */
+  Object->sfdp_private.ManuID              = DataID[0];
+  Object->sfdp_private.Sfdp_param_number   = record->Sfdp_param_number;
+  Object->sfdp_private.Sfdp_AccessProtocol = record->Sfdp_AccessProtocol;
+  Object->sfdp_private.Sfdp_table_mask     = record->Sfdp_table_mask;
+  Object->sfdp_private.Reset_info          = record->Reset_info;
+  (void)memcpy(&JEDEC_Address4Bytes, &record->Address4Bytes, sizeof(JEDEC_Address4Bytes));
+  (void)memcpy(&JEDEC_XSPI10, &record->XSPI10, sizeof(JEDEC_XSPI10));
+  (void)memcpy(&JEDEC_SCCR_Map, &record->SCCR_Map, sizeof(JEDEC_SCCR_Map));
+  (void)memcpy(&JEDEC_OctalDdr, &record->OctalDdr, sizeof(JEDEC_OctalDdr));
+  retr = EXTMEM_SFDP_OK;
+
+error:
+  return retr;
+}
+
+/**
+  * @brief Captures the SFDP data collected by the discovery, before the driver build.
+  * @param Object Pointer to the NOR SFDP memory instance object descriptor.
+  * @param JedecId JEDEC ID of the memory.
+  */
+void SFDP_CacheCapture(const EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object, const uint8_t *JedecId)
+{
+  SFDP_CacheRecord_t *record = &sfdp_cache_record;
+
+  (void)memset(record, 0x0, sizeof(SFDP_CacheRecord_t));
+  record->Size = sizeof(SFDP_CacheRecord_t);
+  (void)memcpy(record->JedecId, JedecId, EXTMEM_READ_JEDEC_ID_SIZE);
+  record->Sfdp_param_number   = Object->sfdp_private.Sfdp_param_number;
+  record->Sfdp_AccessProtocol = Object->sfdp_private.Sfdp_AccessProtocol;
+  record->Sfdp_table_mask     = Object->sfdp_private.Sfdp_table_mask;
+  record->Reset_info          = Object->sfdp_private.Reset_info;
+  (void)memcpy(&record->Basic, &JEDEC_Basic, sizeof(JEDEC_Basic));
+  (void)memcpy(&record->Address4Bytes, &JEDEC_Address4Bytes, sizeof(JEDEC_Address4Bytes));
+  (void)memcpy(&record->XSPI10, &JEDEC_XSPI10, sizeof(JEDEC_XSPI10));
+  (void)memcpy(&record->SCCR_Map, &JEDEC_SCCR_Map, sizeof(JEDEC_SCCR_Map));
+  (void)memcpy(&record->OctalDdr, &JEDEC_OctalDdr, sizeof(JEDEC_OctalDdr));
+}
+
+/**
+  * @brief Completes the captured record with the final link and saves it.
+  * @param Object Pointer to the NOR SFDP memory instance object descriptor.
+  */
+void SFDP_CacheCommit(const EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object)
+{
+  SFDP_CacheRecord_t *record = &sfdp_cache_record;
+
+  if (record->Size != sizeof(SFDP_CacheRecord_t))
+  {
+    /* Nothing has been captured */
+    return;
+  }
+
+  record->PhyLink          = (uint8_t)Object->sfdp_private.DriverInfo.SpiPhyLink;
+  record->CommandExtension = Object->sfdp_private.SALObject.CommandExtension;
+  record->Magic            = SFDP_CACHE_MAGIC;
+  record->Crc              = sfdp_cache_crc((const uint8_t *)record, offsetof(SFDP_CacheRecord_t, Crc));
+  EXTMEM_DRIVER_NOR_SFDP_CacheSave((const uint8_t *)record, sizeof(SFDP_CacheRecord_t));
+}
+
+/**
+  * @brief Invalidates the saved record.
+  */
+void SFDP_CacheInvalidate(void)
+{
+  (void)memset(&sfdp_cache_record, 0x0, sizeof(SFDP_CacheRecord_t));
+  EXTMEM_DRIVER_NOR_SFDP_CacheSave(NULL, 0u);
+}
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
+
 /**
   * @}
   */
@@ -97,7 +97,8 @@ typedef enum
   EXTMEM_SFDP_ERROR_DRIVER,
   EXTMEM_SFDP_ERROR_SETCLOCK,
   EXTMEM_SFDP_ERROR_CONFIGDUMMY,
-  EXTMEM_SFDP_ERROR_NOTYETHANDLED
+  EXTMEM_SFDP_ERROR_NOTYETHANDLED,
+  EXTMEM_SFDP_ERROR_CACHE                    /*!< No usable cache record */
 } SFDP_StatusTypeDef;
 
 /**
@@ -128,6 +129,12 @@ SFDP_StatusTypeDef SFDP_ReadHeader(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object,
 SFDP_StatusTypeDef SFDP_CollectData(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object);
 SFDP_StatusTypeDef SFDP_MemoryReset(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object);
 SFDP_StatusTypeDef SFDP_BuildGenericDriver(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object, uint8_t *FreqUpdated);
+#if defined(EXTMEM_DRIVER_NOR_SFDP_CACHE) && (EXTMEM_DRIVER_NOR_SFDP_CACHE == 1)
+SFDP_StatusTypeDef SFDP_CacheRestore(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object);
+void SFDP_CacheCapture(const EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object, const uint8_t *JedecId);
+void SFDP_CacheCommit(const EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object);
+void SFDP_CacheInvalidate(void);
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
 EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef driver_check_FlagBUSY(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject,
                                                            uint32_t Timeout);
 
@@ -119,6 +119,9 @@
   */
 static EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef driver_set_FlagWEL(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject,
                                                                uint32_t Timeout);
+static EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef driver_get_EraseType(
+  const EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject, EXTMEM_DRIVER_NOR_SFDP_SectorTypeTypeDef SectorType,
+  uint8_t *Command, uint8_t *Size, uint32_t *Timeout);
 __weak void EXTMEM_MemCopy(uint32_t *Destination_Address, const uint8_t *ptrData, uint32_t DataSize);
 
 /**
@@ -166,6 +169,16 @@ EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_Init(void *Periphera
   /* Abort any ongoing XSPI action */
   (void)SAL_XSPI_DisableMapMode(&SFDPObject->sfdp_private.SALObject);
 
+#if defined(EXTMEM_DRIVER_NOR_SFDP_CACHE) && (EXTMEM_DRIVER_NOR_SFDP_CACHE == 1)
+  /* Use the SFDP data saved by a previous boot when the memory is the same */
+  SFDP_DEBUG_STR("4 - restore the SFDP data from the cache")
+  if (EXTMEM_SFDP_OK == SFDP_CacheRestore(SFDPObject))
+  {
+    SFDPObject->sfdp_private.FromCache = 1u;
+    goto build;
+  }
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
+
   /* Analyze the SFDP structure to get driver information */
   SFDP_DEBUG_STR("4 - analyze the SFDP structure to get driver information")
   if (EXTMEM_SFDP_OK != SFDP_GetHeader(SFDPObject, &JEDEC_SFDP_Header))
@@ -229,6 +242,11 @@ EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_Init(void *Periphera
     retr = EXTMEM_DRIVER_NOR_SFDP_ERROR_SFDP;
     goto error;
   }
+#if defined(EXTMEM_DRIVER_NOR_SFDP_CACHE) && (EXTMEM_DRIVER_NOR_SFDP_CACHE == 1)
+  SFDP_CacheCapture(SFDPObject, DataID);
+
+build:
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
 
   /* Setup the generic driver information and prepare the physical layer */
   SFDP_DEBUG_STR("9 - build the generic driver information and prepare the physical layer")
@@ -257,7 +275,24 @@ EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_Init(void *Periphera
     goto error;
   }
 
+#if defined(EXTMEM_DRIVER_NOR_SFDP_CACHE) && (EXTMEM_DRIVER_NOR_SFDP_CACHE == 1)
+  if (SFDPObject->sfdp_private.FromCache == 0u)
+  {
+    /* Save the SFDP data for the next boot */
+    SFDP_CacheCommit(SFDPObject);
+  }
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
+
 error:
+#if defined(EXTMEM_DRIVER_NOR_SFDP_CACHE) && (EXTMEM_DRIVER_NOR_SFDP_CACHE == 1)
+  if ((retr != EXTMEM_DRIVER_NOR_SFDP_OK) && (SFDPObject->sfdp_private.FromCache == 1u))
+  {
+    /* The record does not describe the memory anymore, run the full discovery */
+    SFDP_DEBUG_STR("ERROR::cached data rejected, restart with the SFDP discovery")
+    SFDP_CacheInvalidate();
+    retr = EXTMEM_DRIVER_NOR_SFDP_Init(Peripheral, Config, ClockInput, SFDPObject);
+  }
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
   return retr;
 }
 
@@ -617,39 +652,45 @@ EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_SectorErase(EXTMEM_D
   uint32_t timeout;
   DEBUG_DRIVER((uint8_t *)__func__)
 
-  /* Check if the selected sector type is available */
-  switch (SectorType)
+  retr = EXTMEM_DRIVER_NOR_SFDP_SectorEraseStart(SFDPObject, Address, SectorType);
+  if (EXTMEM_DRIVER_NOR_SFDP_OK != retr)
   {
-    case EXTMEM_DRIVER_NOR_SFDP_SECTOR_TYPE1:
-      command = SFDPObject->sfdp_private.DriverInfo.EraseType1Command;
-      size = SFDPObject->sfdp_private.DriverInfo.EraseType1Size;
-      timeout = SFDPObject->sfdp_private.DriverInfo.EraseType1Timing;
-      break;
-    case EXTMEM_DRIVER_NOR_SFDP_SECTOR_TYPE2:
-      command = SFDPObject->sfdp_private.DriverInfo.EraseType2Command;
-      size = SFDPObject->sfdp_private.DriverInfo.EraseType2Size;
-      timeout = SFDPObject->sfdp_private.DriverInfo.EraseType2Timing;
-      break;
-    case EXTMEM_DRIVER_NOR_SFDP_SECTOR_TYPE3:
-      command = SFDPObject->sfdp_private.DriverInfo.EraseType3Command;
-      size = SFDPObject->sfdp_private.DriverInfo.EraseType3Size;
-      timeout = SFDPObject->sfdp_private.DriverInfo.EraseType3Timing;
-      break;
-    case EXTMEM_DRIVER_NOR_SFDP_SECTOR_TYPE4:
-      command = SFDPObject->sfdp_private.DriverInfo.EraseType4Command;
-      size = SFDPObject->sfdp_private.DriverInfo.EraseType4Size;
-      timeout = SFDPObject->sfdp_private.DriverInfo.EraseType4Timing;
-      break;
-    default :
-      retr = EXTMEM_DRIVER_NOR_SFDP_ERROR_SECTORTYPE;
-      goto error;
-      break;
+    goto error;
   }
 
-  /* Check if the command for this sector size is available */
-  if (0x0u == command)
+  /* Check busy flag */
+  /* Timeout is set according the memory characteristic */
+  (void)driver_get_EraseType(SFDPObject, SectorType, &command, &size, &timeout);
+  retr = driver_check_FlagBUSY(SFDPObject, timeout);
+
+error:
+  return retr;
+}
+
+/**
+  * @brief This function launches a sector erase and returns without waiting for its end
+  *
+  * @param SFDPObject Memory object
+  * @param Address Memory address to start erase operation
+  * @param SectorType Type of sector
+  * @return @ref EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef
+  * @note The end of the operation is detected with @ref EXTMEM_DRIVER_NOR_SFDP_CheckBusy
+  **/
+EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_SectorEraseStart(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef
+                                                                             *SFDPObject, uint32_t Address,
+                                                                             EXTMEM_DRIVER_NOR_SFDP_SectorTypeTypeDef
+                                                                             SectorType)
+{
+  EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef retr;
+  uint8_t command;
+  uint8_t size;
+  uint32_t timeout;
+  DEBUG_DRIVER((uint8_t *)__func__)
+
+  /* Check if the selected sector type is available */
+  retr = driver_get_EraseType(SFDPObject, SectorType, &command, &size, &timeout);
+  if (EXTMEM_DRIVER_NOR_SFDP_OK != retr)
   {
-    retr = EXTMEM_DRIVER_NOR_SFDP_ERROR_SECTORTYPE_UNAVAILABLE;
     goto error;
   }
 
@@ -677,19 +718,90 @@ EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_SectorErase(EXTMEM_D
   /* Launch erase command */
   (void)SAL_XSPI_CommandSendAddress(&SFDPObject->sfdp_private.SALObject, command, Address);
 
-  /* Check busy flag */
-  /* Timeout is set according the memory characteristic */
-  retr = driver_check_FlagBUSY(SFDPObject, timeout);
-  if (EXTMEM_DRIVER_NOR_SFDP_OK != retr)
+error:
+  return retr;
+}
+
+/**
+  * @brief This function checks if a program or erase operation is still running
+  *
+  * @param SFDPObject Memory object
+  * @return EXTMEM_DRIVER_NOR_SFDP_OK when the memory is ready,
+  *         EXTMEM_DRIVER_NOR_SFDP_ERROR_BUSY while the operation runs
+  * @note The status register is polled for at most one tick
+  **/
+EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_CheckBusy(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject)
+{
+  DEBUG_DRIVER((uint8_t *)__func__)
+  return driver_check_FlagBUSY(SFDPObject, 1u);
+}
+
+/**
+  * @brief This function suspends the erase operation in progress
+  *
+  * @param SFDPObject Memory object
+  * @return @ref EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef
+  * @note Once suspended, the memory can be read (indirect or memory-mapped) outside of the
+  *       sector being erased
+  **/
+EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_EraseSuspend(
+  EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject)
+{
+  EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef retr;
+  uint32_t interval;
+  DEBUG_DRIVER((uint8_t *)__func__)
+
+  if (0x0u == SFDPObject->sfdp_private.DriverInfo.EraseSuspendCommand)
   {
+    retr = EXTMEM_DRIVER_NOR_SFDP_ERROR_SUSPEND_UNAVAILABLE;
     goto error;
   }
 
+  /* The erase must progress for a minimum time after a resume before it can be suspended again */
+  interval = (SFDPObject->sfdp_private.DriverInfo.EraseResumeInterval + 999u) / 1000u;
+  while ((HAL_GetTick() - SFDPObject->sfdp_private.EraseResumeTick) < interval)
+  {
+  }
+
+  /* Launch suspend command */
+  (void)SAL_XSPI_CommandSendData(&SFDPObject->sfdp_private.SALObject,
+                                 SFDPObject->sfdp_private.DriverInfo.EraseSuspendCommand, NULL, 0);
+
+  /* The busy flag is released once the memory is suspended */
+  retr = driver_check_FlagBUSY(SFDPObject,
+                               ((SFDPObject->sfdp_private.DriverInfo.EraseSuspendLatency + 999u) / 1000u) + 1u);
 
 error:
   return retr;
 }
 
+/**
+  * @brief This function resumes a suspended erase operation
+  *
+  * @param SFDPObject Memory object
+  * @return @ref EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef
+  **/
+EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_EraseResume(
+  EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject)
+{
+  EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef retr = EXTMEM_DRIVER_NOR_SFDP_OK;
+  DEBUG_DRIVER((uint8_t *)__func__)
+
+  if (0x0u == SFDPObject->sfdp_private.DriverInfo.EraseResumeCommand)
+  {
+    retr = EXTMEM_DRIVER_NOR_SFDP_ERROR_SUSPEND_UNAVAILABLE;
+  }
+  else
+  {
+    /* Launch resume command */
+    (void)SAL_XSPI_CommandSendData(&SFDPObject->sfdp_private.SALObject,
+                                   SFDPObject->sfdp_private.DriverInfo.EraseResumeCommand, NULL, 0);
+    SFDPObject->sfdp_private.EraseResumeTick = HAL_GetTick();
+  }
+
+  return retr;
+}
+
 /**
   * @brief This function enables the memory mapped mode
   *
@@ -786,6 +898,61 @@ EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef driver_set_FlagWEL(EXTMEM_DRIVER_NOR_SFDP_O
   return retr;
 }
 
+/**
+  * @brief This function returns the command, size and timing of an erase type
+  *
+  * @param SFDPObject Memory object
+  * @param SectorType Type of sector
+  * @param Command Erase command
+  * @param Size Erase size as a power of two
+  * @param Timeout Erase timing in ms
+  * @return @ref EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef
+  **/
+static EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef driver_get_EraseType(
+  const EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject, EXTMEM_DRIVER_NOR_SFDP_SectorTypeTypeDef SectorType,
+  uint8_t *Command, uint8_t *Size, uint32_t *Timeout)
+{
+  EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef retr = EXTMEM_DRIVER_NOR_SFDP_OK;
+
+  switch (SectorType)
+  {
+    case EXTMEM_DRIVER_NOR_SFDP_SECTOR_TYPE1:
+      *Command = SFDPObject->sfdp_private.DriverInfo.EraseType1Command;
+      *Size = SFDPObject->sfdp_private.DriverInfo.EraseType1Size;
+      *Timeout = SFDPObject->sfdp_private.DriverInfo.EraseType1Timing;
+      break;
+    case EXTMEM_DRIVER_NOR_SFDP_SECTOR_TYPE2:
+      *Command = SFDPObject->sfdp_private.DriverInfo.EraseType2Command;
+      *Size = SFDPObject->sfdp_private.DriverInfo.EraseType2Size;
+      *Timeout = SFDPObject->sfdp_private.DriverInfo.EraseType2Timing;
+      break;
+    case EXTMEM_DRIVER_NOR_SFDP_SECTOR_TYPE3:
+      *Command = SFDPObject->sfdp_private.DriverInfo.EraseType3Command;
+      *Size = SFDPObject->sfdp_private.DriverInfo.EraseType3Size;
+      *Timeout = SFDPObject->sfdp_private.DriverInfo.EraseType3Timing;
+      break;
+    case EXTMEM_DRIVER_NOR_SFDP_SECTOR_TYPE4:
+      *Command = SFDPObject->sfdp_private.DriverInfo.EraseType4Command;
+      *Size = SFDPObject->sfdp_private.DriverInfo.EraseType4Size;
+      *Timeout = SFDPObject->sfdp_private.DriverInfo.EraseType4Timing;
+      break;
+    default :
+      *Command = 0u;
+      *Size = 0u;
+      *Timeout = 0u;
+      retr = EXTMEM_DRIVER_NOR_SFDP_ERROR_SECTORTYPE;
+      break;
+  }
+
+  /* Check if the command for this sector size is available */
+  if ((EXTMEM_DRIVER_NOR_SFDP_OK == retr) && (0x0u == *Command))
+  {
+    retr = EXTMEM_DRIVER_NOR_SFDP_ERROR_SECTORTYPE_UNAVAILABLE;
+  }
+
+  return retr;
+}
+
 /**
   * @brief This function provides a default implementation of MemCopy functionality
   *
@@ -806,6 +973,34 @@ __weak void EXTMEM_MemCopy(uint32_t *Destination_Address, const uint8_t *ptrData
   }
 }
 
+#if defined(EXTMEM_DRIVER_NOR_SFDP_CACHE) && (EXTMEM_DRIVER_NOR_SFDP_CACHE == 1)
+/**
+  * @brief This function loads the SFDP cache record from its storage, to be provided by the application
+  *
+  * @param Data Buffer receiving the record
+  * @param Size Size of the record (in bytes)
+  * @return @ref EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef, the content is checked by the driver
+  **/
+__weak EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_CacheLoad(uint8_t *Data, uint32_t Size)
+{
+  (void)Data;
+  (void)Size;
+  return EXTMEM_DRIVER_NOR_SFDP_ERROR;
+}
+
+/**
+  * @brief This function saves the SFDP cache record in its storage, to be provided by the application
+  *
+  * @param Data Record to save, NULL to invalidate the storage
+  * @param Size Size of the record (in bytes)
+  **/
+__weak void EXTMEM_DRIVER_NOR_SFDP_CacheSave(const uint8_t *Data, uint32_t Size)
+{
+  (void)Data;
+  (void)Size;
+}
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
+
 /**
   * @}
   */
@@ -59,6 +59,7 @@ typedef enum
   EXTMEM_DRIVER_NOR_SFDP_ERROR_FLASHBUSY              = -12,
   EXTMEM_DRIVER_NOR_SFDP_ERROR_MAP_ENABLE             = -13,
   EXTMEM_DRIVER_NOR_SFDP_ERROR_MEMTYPE_CHECK          = -14,
+  EXTMEM_DRIVER_NOR_SFDP_ERROR_SUSPEND_UNAVAILABLE    = -15,
   EXTMEM_DRIVER_NOR_SFDP_ERROR                        = -128,
 } EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef;
 
@@ -101,10 +102,21 @@ EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_SectorErase(
   EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef
   *SFDPObject, uint32_t Address,
   EXTMEM_DRIVER_NOR_SFDP_SectorTypeTypeDef SectorType);
+EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_SectorEraseStart(
+  EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef
+  *SFDPObject, uint32_t Address,
+  EXTMEM_DRIVER_NOR_SFDP_SectorTypeTypeDef SectorType);
+EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_CheckBusy(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject);
+EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_EraseSuspend(
+  EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject);
+EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_EraseResume(
+  EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject);
 EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_Enable_MemoryMappedMode(
   EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject);
 EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_Disable_MemoryMappedMode(
   EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject);
+EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_CacheLoad(uint8_t *Data, uint32_t Size);
+void EXTMEM_DRIVER_NOR_SFDP_CacheSave(const uint8_t *Data, uint32_t Size);
 
 /**
   * @}
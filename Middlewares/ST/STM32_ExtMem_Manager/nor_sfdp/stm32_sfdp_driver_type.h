@@ -101,6 +101,12 @@ typedef struct
   uint32_t EraseType3Timing;                         /*!< Erase 3 timing */
   uint32_t EraseType4Timing;                         /*!< Erase 4 timing */
   uint32_t EraseChipTiming;                          /*!< Erase chip timing */
+
+  /* Erase suspend/resume (a command equal to zero means not supported) */
+  uint8_t EraseSuspendCommand;                       /*!< Erase suspend command */
+  uint8_t EraseResumeCommand;                        /*!< Erase resume command */
+  uint32_t EraseSuspendLatency;                      /*!< Max time for an erase to suspend, in us */
+  uint32_t EraseResumeInterval;                      /*!< Min time from a resume to the next suspend, in us */
 } EXTMEM_DRIVER_NOR_SFDP_InfoTypeDef;
 
 
@@ -128,6 +134,8 @@ typedef struct
     uint32_t                  Reset_info;            /*!< Copy of JEDEC Basic 16 Reset/Rescue info */
     uint8_t                   Sfdp_param_number;     /*!< Number of parameters from the SFDP header table */
     uint8_t                   Sfdp_AccessProtocol;   /*!< Access protocol type from the SFDP header table */
+    uint8_t                   FromCache;             /*!< 1 when the SFDP data came from the cache record */
+    uint32_t                  EraseResumeTick;       /*!< HAL tick of the last erase resume */
   } sfdp_private;
 } EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef;
 
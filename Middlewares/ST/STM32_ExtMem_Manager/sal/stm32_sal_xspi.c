@@ -153,6 +153,7 @@ volatile SAL_XSPI_TRANSFER_STATUS salXSPI_status = SALXSPI_TRANSFER_NONE;
 uint16_t XSPI_FormatCommand(uint8_t CommandExtension, uint32_t InstructionWidth, uint8_t Command);
 HAL_StatusTypeDef XSPI_Transmit(SAL_XSPI_ObjectTypeDef *SalXspi, const uint8_t *Data);
 HAL_StatusTypeDef XSPI_Receive(SAL_XSPI_ObjectTypeDef *SalXspi,  uint8_t *Data);
+void XSPI_ApplyMapTuning(SAL_XSPI_ObjectTypeDef *SalXspi);
 #if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
 void SAL_XSPI_ErrorCallback(struct __XSPI_HandleTypeDef *hxspi);
 void SAL_XSPI_CompleteCallback(struct __XSPI_HandleTypeDef *hxspi);
@@ -990,6 +991,9 @@ HAL_StatusTypeDef SAL_XSPI_EnableMapMode(SAL_XSPI_ObjectTypeDef *SalXspi, uint8_
   XSPI_RegularCmdTypeDef s_command = SalXspi->Commandbase;
   XSPI_MemoryMappedTypeDef sMemMappedCfg = {0};
 
+  /* Apply the device configuration tuning while the peripheral is idle */
+  XSPI_ApplyMapTuning(SalXspi);
+
   /* Initialize the read ID command */
   s_command.OperationType = HAL_XSPI_OPTYPE_READ_CFG;
   s_command.Instruction = XSPI_FormatCommand(SalXspi->CommandExtension, s_command.InstructionWidth, CommandRead);
@@ -1013,8 +1017,16 @@ HAL_StatusTypeDef SAL_XSPI_EnableMapMode(SAL_XSPI_ObjectTypeDef *SalXspi, uint8_
   }
 
   /* Activation of memory-mapped mode */
-  sMemMappedCfg.TimeOutActivation  = HAL_XSPI_TIMEOUT_COUNTER_DISABLE;
-  sMemMappedCfg.TimeoutPeriodClock = 0x50;
+  if (SalXspi->MapTuning.Enable != 0U)
+  {
+    sMemMappedCfg.TimeOutActivation  = SalXspi->MapTuning.TimeOutActivation;
+    sMemMappedCfg.TimeoutPeriodClock = SalXspi->MapTuning.TimeoutPeriod;
+  }
+  else
+  {
+    sMemMappedCfg.TimeOutActivation  = HAL_XSPI_TIMEOUT_COUNTER_DISABLE;
+    sMemMappedCfg.TimeoutPeriodClock = 0x50;
+  }
   retr = HAL_XSPI_MemoryMapped(SalXspi->hxspi, &sMemMappedCfg);
 
 error:
@@ -1037,6 +1049,32 @@ HAL_StatusTypeDef SAL_XSPI_DisableMapMode(SAL_XSPI_ObjectTypeDef *SalXspi)
   return HAL_XSPI_Abort(SalXspi->hxspi);
 }
 
+/**
+  * @brief This function sets the tuning used by the next SAL_XSPI_EnableMapMode call
+  * @param SalXspi SAL XSPI handle
+  * @param Tuning memory-mapped tuning, NULL restores the legacy settings and the init
+  *        device configuration at the next SAL_XSPI_EnableMapMode
+  * @return @ref HAL_StatusTypeDef
+  **/
+HAL_StatusTypeDef SAL_XSPI_SetMapTuning(SAL_XSPI_ObjectTypeDef *SalXspi, const SAL_XSPI_MapTuningTypeDef *Tuning)
+{
+  if (Tuning == NULL)
+  {
+    SalXspi->MapTuning.Enable = 0U;
+    return HAL_OK;
+  }
+
+  if ((Tuning->TimeOutActivation != HAL_XSPI_TIMEOUT_COUNTER_DISABLE)
+      && (Tuning->TimeOutActivation != HAL_XSPI_TIMEOUT_COUNTER_ENABLE))
+  {
+    return HAL_ERROR;
+  }
+
+  SalXspi->MapTuning = *Tuning;
+  SalXspi->MapTuning.Enable = 1U;
+  return HAL_OK;
+}
+
 /**
   * @brief This function updates the memory according the SFDP signature value
   * @param SalXspi SAL XSPI handle
@@ -1127,6 +1165,61 @@ uint16_t XSPI_FormatCommand(uint8_t CommandExtension, uint32_t InstructionWidth,
   return retr;
 }
 
+/**
+  * @brief This function programs the device configuration part of the map tuning
+  * @note DCR2/DCR3 can only be written while the peripheral is not busy,
+  *       the caller must have left the memory mapped mode.
+  *       The init settings are saved before the first tuning and written back
+  *       first, so a disabled tuning and SAL_XSPI_MAP_KEEP mean the init values.
+  * @param SalXspi SAL XSPI handle
+  **/
+void XSPI_ApplyMapTuning(SAL_XSPI_ObjectTypeDef *SalXspi)
+{
+  const SAL_XSPI_MapTuningTypeDef *tuning = &SalXspi->MapTuning;
+  SAL_XSPI_MapTuningTypeDef *initial = &SalXspi->MapDefault;
+  XSPI_TypeDef *instance = SalXspi->hxspi->Instance;
+
+  if (initial->Enable == 0U)
+  {
+    if (tuning->Enable == 0U)
+    {
+      /* Never tuned, the registers still hold the init settings */
+      return;
+    }
+    initial->WrapSize   = SalXspi->hxspi->Init.WrapSize;
+    initial->CSBoundary = SalXspi->hxspi->Init.ChipSelectBoundary;
+    initial->MaxTran    = (uint8_t)SalXspi->hxspi->Init.MaxTran;
+    initial->Enable     = 1U;
+  }
+
+  MODIFY_REG(instance->DCR2, XSPI_DCR2_WRAPSIZE, initial->WrapSize);
+  MODIFY_REG(instance->DCR3, (XSPI_DCR3_CSBOUND | XSPI_DCR3_MAXTRAN),
+             ((initial->CSBoundary << XSPI_DCR3_CSBOUND_Pos) | ((uint32_t)initial->MaxTran << XSPI_DCR3_MAXTRAN_Pos)));
+  SalXspi->hxspi->Init.WrapSize = initial->WrapSize;
+  SalXspi->hxspi->Init.ChipSelectBoundary = initial->CSBoundary;
+  SalXspi->hxspi->Init.MaxTran = initial->MaxTran;
+
+  if (tuning->Enable == 0U)
+  {
+    return;
+  }
+
+  if (tuning->WrapSize != SAL_XSPI_MAP_KEEP)
+  {
+    MODIFY_REG(instance->DCR2, XSPI_DCR2_WRAPSIZE, tuning->WrapSize);
+    SalXspi->hxspi->Init.WrapSize = tuning->WrapSize;
+  }
+
+  if (tuning->CSBoundary != SAL_XSPI_MAP_KEEP)
+  {
+    MODIFY_REG(instance->DCR3, XSPI_DCR3_CSBOUND, (tuning->CSBoundary << XSPI_DCR3_CSBOUND_Pos));
+    SalXspi->hxspi->Init.ChipSelectBoundary = tuning->CSBoundary;
+  }
+
+  MODIFY_REG(instance->DCR3, XSPI_DCR3_MAXTRAN, ((uint32_t)tuning->MaxTran << XSPI_DCR3_MAXTRAN_Pos));
+  SalXspi->hxspi->Init.MaxTran = tuning->MaxTran;
+}
+
 /**
   * @brief This function transmits the data
   *
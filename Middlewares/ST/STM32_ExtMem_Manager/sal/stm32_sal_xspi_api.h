@@ -71,6 +71,7 @@ HAL_StatusTypeDef SAL_XSPI_ConfigureWrappMode(SAL_XSPI_ObjectTypeDef *SalXspi, u
 HAL_StatusTypeDef SAL_XSPI_EnableMapMode(SAL_XSPI_ObjectTypeDef *SalXspi, uint8_t CommandRead, uint8_t DummyRead,
                                          uint8_t CommandWrite, uint8_t DummyWrite);
 HAL_StatusTypeDef SAL_XSPI_DisableMapMode(SAL_XSPI_ObjectTypeDef *SalXspi);
+HAL_StatusTypeDef SAL_XSPI_SetMapTuning(SAL_XSPI_ObjectTypeDef *SalXspi, const SAL_XSPI_MapTuningTypeDef *Tuning);
 HAL_StatusTypeDef SAL_XSPI_UpdateMemoryType(SAL_XSPI_ObjectTypeDef *SalXspi, SAL_XSPI_DataOrderTypeDef DataOrder);
 
 /**
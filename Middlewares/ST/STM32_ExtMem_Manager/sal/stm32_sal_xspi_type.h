@@ -70,6 +70,19 @@ typedef enum
 #endif /* defined(HAL_XSPI_DATA_16_LINES) */
 } SAL_XSPI_PhysicalLinkTypeDef;
 
+/**
+  * @brief Memory-mapped mode tuning, applied by SAL_XSPI_EnableMapMode.
+  */
+typedef struct
+{
+  uint8_t                      Enable;             /*!< 0: legacy settings (timeout counter off, period 0x50) */
+  uint32_t                     TimeOutActivation;  /*!< @ref HAL_XSPI_TIMEOUT_COUNTER_DISABLE or _ENABLE */
+  uint16_t                     TimeoutPeriod;      /*!< Clock cycles before nCS is released once the FIFO is full */
+  uint32_t                     WrapSize;           /*!< HAL_XSPI_WRAP_xxx or @ref SAL_XSPI_MAP_KEEP */
+  uint32_t                     CSBoundary;         /*!< HAL_XSPI_BONDARYOF_xxx or @ref SAL_XSPI_MAP_KEEP */
+  uint8_t                      MaxTran;            /*!< Max transfer length before releasing the bus, 0 disabled */
+} SAL_XSPI_MapTuningTypeDef;
+
 typedef struct
 {
   XSPI_HandleTypeDef           *hxspi;            /*!< Handle on the XSPI instance */
@@ -78,6 +91,8 @@ typedef struct
   uint8_t                      SFDPDummyCycle;    /*!< SDPF dummy cycle */
   SAL_XSPI_PhysicalLinkTypeDef PhyLink;           /*!< Only used for data Read in 4S4D4d 2S2D2D 1S1D1D */
   uint8_t                      DTRDummyCycle;     /*!< Specify that DTR read only valid for data read using DTRDummyCycle value */
+  SAL_XSPI_MapTuningTypeDef    MapTuning;         /*!< Memory-mapped mode tuning */
+  SAL_XSPI_MapTuningTypeDef    MapDefault;        /*!< Init settings before the first tuning, Enable: saved */
 } SAL_XSPI_ObjectTypeDef;
 
 /**
@@ -97,6 +112,8 @@ typedef enum
 
 /* Exported Macro ------------------------------------------------------------*/
 
+#define SAL_XSPI_MAP_KEEP                          0xFFFFFFFFU   /*!< Keep the value programmed by HAL_XSPI_Init */
+
 #define SAL_XSPI_SET_DTRREADDUMMYCYLE(_OBJ_,_VAL_) (_OBJ_).DTRDummyCycle = (_VAL_)
 #define SAL_XSPI_SET_SFDPDUMMYCYLE(_OBJ_,_VAL_)    (_OBJ_).SFDPDummyCycle = (_VAL_)
 #define SAL_XSPI_SET_COMMANDEXTENSION(_OBJ_,_VAL_) (_OBJ_).CommandExtension = (_VAL_)
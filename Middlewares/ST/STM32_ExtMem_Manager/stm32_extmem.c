@@ -32,6 +32,10 @@
 #include "psram/stm32_psram_driver_api.h"
 #endif /* EXTMEM_DRIVER_PSRAM */
 
+#if (EXTMEM_DRIVER_NOR_SFDP == 1) || (EXTMEM_DRIVER_PSRAM == 1)
+#include "sal/stm32_sal_xspi_api.h"
+#endif /* (EXTMEM_DRIVER_NOR_SFDP == 1) || (EXTMEM_DRIVER_PSRAM == 1) */
+
 #if EXTMEM_DRIVER_SDCARD == 1
 #include "sdcard/stm32_sdcard_driver_api.h"
 #endif /* EXTMEM_DRIVER_SDCARD */
@@ -116,7 +120,73 @@
   */
 
 /* Private typedefs ---------------------------------------------------------*/
+#if EXTMEM_DRIVER_NOR_SFDP == 1
+/**
+  * @brief State of the erase operation of a NOR memory
+  */
+typedef enum
+{
+  EXTMEM_ERASE_IDLE,               /*!< No asynchronous erase */
+  EXTMEM_ERASE_RUNNING,            /*!< A block erase is running on the memory */
+  EXTMEM_ERASE_SUSPENDED           /*!< The block erase is suspended */
+} EXTMEM_EraseStateTypeDef;
+
+/**
+  * @brief Erase context of a NOR memory
+  */
+typedef struct
+{
+  EXTMEM_EraseStateTypeDef State;  /*!< Asynchronous erase state */
+  uint8_t  Mapped;                 /*!< Memory-mapped mode is enabled */
+  uint8_t  MapSuspended;           /*!< The erase was suspended to enter memory-mapped mode */
+  uint32_t Address;                /*!< Address of the block being erased */
+  uint32_t Remaining;              /*!< Bytes left to erase, block in progress included */
+  uint32_t BlockSize;              /*!< Size of the block being erased */
+  uint32_t BlockTimeout;           /*!< Erase time of the block, in ms */
+  uint32_t BlockTick;              /*!< HAL tick of the block start (or resume) */
+  uint32_t *Counters;              /*!< Erase counters, NULL when wear monitoring is off */
+  uint32_t CounterNb;              /*!< Number of counters */
+  uint8_t  CounterShift;           /*!< One counter covers (1 << CounterShift) bytes */
+} EXTMEM_EraseContextTypeDef;
+#endif /* EXTMEM_DRIVER_NOR_SFDP == 1 */
+
+/* Private variables ---------------------------------------------------------*/
+#if EXTMEM_DRIVER_NOR_SFDP == 1
+/**
+  * @brief Erase context of each memory, only used by the NOR SFDP memories
+  */
+static EXTMEM_EraseContextTypeDef extmem_erase_ctx[sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)];
+#endif /* EXTMEM_DRIVER_NOR_SFDP == 1 */
+#if (EXTMEM_DRIVER_NOR_SFDP == 1) || (EXTMEM_DRIVER_PSRAM == 1)
+/**
+  * @brief Memory-mapped tuning of each profile, index is @ref EXTMEM_MapProfileTypeDef
+  * @note  The XSPI keeps fetching the next bytes into its FIFO as long as nCS is held, the
+  *        timeout counter bounds that prefetch: a short period frees the bus quickly for the
+  *        next random code fetch, a long one lets sequential readers find their data ready.
+  */
+static const EXTMEM_MapTuningTypeDef extmem_map_profile[EXTMEM_MAP_PROFILE_COUNT] =
+{
+  /* EXTMEM_MAP_PROFILE_DEFAULT : unused, restores the middleware settings */
+  { HAL_XSPI_TIMEOUT_COUNTER_DISABLE, 0x50U, EXTMEM_MAP_KEEP, EXTMEM_MAP_KEEP, 0U },
+  /* EXTMEM_MAP_PROFILE_XIP_CODE */
+  { HAL_XSPI_TIMEOUT_COUNTER_ENABLE, 0x08U, EXTMEM_MAP_KEEP, EXTMEM_MAP_KEEP, 0U },
+  /* EXTMEM_MAP_PROFILE_ASSET_STREAMING */
+  { HAL_XSPI_TIMEOUT_COUNTER_ENABLE, 0xFFFFU, EXTMEM_MAP_KEEP, EXTMEM_MAP_KEEP, 0U },
+  /* EXTMEM_MAP_PROFILE_PSRAM_FRAMEBUFFER */
+  { HAL_XSPI_TIMEOUT_COUNTER_ENABLE, 0x100U, HAL_XSPI_WRAP_32_BYTES, EXTMEM_MAP_KEEP, 0U },
+};
+#endif /* (EXTMEM_DRIVER_NOR_SFDP == 1) || (EXTMEM_DRIVER_PSRAM == 1) */
+
 /* Private functions ---------------------------------------------------------*/
+#if EXTMEM_DRIVER_NOR_SFDP == 1
+static EXTMEM_StatusTypeDef extmem_nor_select_erase(const EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object,
+                                                    uint32_t Address, uint32_t Size,
+                                                    EXTMEM_DRIVER_NOR_SFDP_SectorTypeTypeDef *SectorType,
+                                                    uint32_t *SectorSize, uint32_t *Timeout);
+static EXTMEM_StatusTypeDef extmem_nor_erase_next(uint32_t MemId);
+static void extmem_erase_count(uint32_t MemId, uint32_t Address, uint32_t Size);
+#endif /* EXTMEM_DRIVER_NOR_SFDP == 1 */
+
 /* Exported variables ---------------------------------------------------------*/
 
 
@@ -622,60 +692,44 @@ EXTMEM_StatusTypeDef EXTMEM_EraseSector(uint32_t MemId, uint32_t Address, uint32
       case EXTMEM_NOR_SFDP:
       {
         /* Perform the Sector Erase operation using the NOR SFDP driver */
-        const EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *const object = &extmem_list_config[MemId].NorSfdpObject;
-        EXTMEM_DRIVER_NOR_SFDP_SectorTypeTypeDef sector_type = EXTMEM_DRIVER_NOR_SFDP_SECTOR_TYPE1;
+        EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *const object = &extmem_list_config[MemId].NorSfdpObject;
+        EXTMEM_DRIVER_NOR_SFDP_SectorTypeTypeDef sector_type;
         uint32_t local_address = Address;
         uint32_t local_size = Size;
-        uint32_t sector_size = (uint32_t)1u << object->sfdp_private.DriverInfo.EraseType4Size;
+        uint32_t sector_size;
+        uint32_t timeout;
 
-        while (local_size != 0u)
+        /* The memory is owned by an asynchronous erase */
+        if (extmem_erase_ctx[MemId].State != EXTMEM_ERASE_IDLE)
         {
-          /* if address is a modulo a sector size if sector  */
-          if ((object->sfdp_private.DriverInfo.EraseType4Size != 0u)
-              && (local_size >= sector_size)
-              && ((local_address % sector_size) == 0u))
+          retr = EXTMEM_BUSY;
+          break;
+        }
+
+        /* Whole memory : a chip erase is much faster than erasing it block by block */
+        if ((local_address == 0u) && (object->sfdp_private.FlashSize < 32u)
+            && (local_size >= ((uint32_t)1u << object->sfdp_private.FlashSize)))
+        {
+          if (EXTMEM_DRIVER_NOR_SFDP_OK != EXTMEM_DRIVER_NOR_SFDP_MassErase(object))
           {
-            sector_type = EXTMEM_DRIVER_NOR_SFDP_SECTOR_TYPE4;
+            retr = EXTMEM_ERROR_DRIVER;
           }
           else
           {
-            sector_size = (uint32_t)1u << object->sfdp_private.DriverInfo.EraseType3Size;
-            if ((object->sfdp_private.DriverInfo.EraseType3Size != 0u)
-                && (local_size >= sector_size)
-                && ((local_address % sector_size) == 0u))
-            {
-              sector_type = EXTMEM_DRIVER_NOR_SFDP_SECTOR_TYPE3;
-            }
-            else
-            {
-              sector_size = (uint32_t)1u << object->sfdp_private.DriverInfo.EraseType2Size;
-              if ((object->sfdp_private.DriverInfo.EraseType2Size != 0u)
-                  && (local_size >= sector_size)
-                  && ((local_address % sector_size) == 0u))
-              {
-                sector_type = EXTMEM_DRIVER_NOR_SFDP_SECTOR_TYPE2;
-              }
-              else
-              {
-                sector_size = (uint32_t)1u << object->sfdp_private.DriverInfo.EraseType1Size;
-                if ((object->sfdp_private.DriverInfo.EraseType1Size != 0u)
-                    && ((local_address % sector_size) == 0u))
-                {
-                  sector_type = EXTMEM_DRIVER_NOR_SFDP_SECTOR_TYPE1;
-                }
-                else
-                {
-                  retr = EXTMEM_ERROR_SECTOR_SIZE;
-                }
-              }
-            }
+            extmem_erase_count(MemId, 0u, (uint32_t)1u << object->sfdp_private.FlashSize);
           }
+          break;
+        }
+
+        while (local_size != 0u)
+        {
+          /* Largest erase type matching the alignment and the size left */
+          retr = extmem_nor_select_erase(object, local_address, local_size, &sector_type, &sector_size, &timeout);
 
           if (retr == EXTMEM_OK)
           {
             if (EXTMEM_DRIVER_NOR_SFDP_OK !=
-                EXTMEM_DRIVER_NOR_SFDP_SectorErase(&extmem_list_config[MemId].NorSfdpObject,
-                                                   local_address, sector_type))
+                EXTMEM_DRIVER_NOR_SFDP_SectorErase(object, local_address, sector_type))
             {
               retr = EXTMEM_ERROR_DRIVER;
             }
@@ -687,6 +741,7 @@ EXTMEM_StatusTypeDef EXTMEM_EraseSector(uint32_t MemId, uint32_t Address, uint32
           }
           else
           {
+            extmem_erase_count(MemId, local_address, sector_size);
             local_address = local_address + sector_size;
             if (sector_size > local_size)
             {
@@ -959,14 +1014,44 @@ EXTMEM_StatusTypeDef EXTMEM_MemoryMappedMode(uint32_t MemId, EXTMEM_StateTypeDef
       case EXTMEM_NOR_SFDP:
       {
         /* Perform the memory Map operation using the NOR SFDP driver */
+        EXTMEM_EraseContextTypeDef *const ctx = &extmem_erase_ctx[MemId];
         if (EXTMEM_ENABLE == State)
         {
+          /* A read request preempts the asynchronous erase */
+          if (ctx->State == EXTMEM_ERASE_RUNNING)
+          {
+            retr = EXTMEM_EraseSuspend(MemId);
+            if (retr == EXTMEM_OK)
+            {
+              ctx->MapSuspended = 1u;
+            }
+            else if (retr == EXTMEM_ERROR_NOTSUPPORTED)
+            {
+              /* No suspend on this memory : let the block in progress complete */
+              uint32_t tickstart = HAL_GetTick();
+              while (EXTMEM_DRIVER_NOR_SFDP_OK !=
+                     EXTMEM_DRIVER_NOR_SFDP_CheckBusy(&extmem_list_config[MemId].NorSfdpObject))
+              {
+                if ((HAL_GetTick() - tickstart) > ctx->BlockTimeout)
+                {
+                  return EXTMEM_ERROR_DRIVER;
+                }
+              }
+              retr = EXTMEM_OK;
+            }
+            else
+            {
+              return retr;
+            }
+          }
+
           /* Start the memory mapped mode */
           if (EXTMEM_DRIVER_NOR_SFDP_OK !=
               EXTMEM_DRIVER_NOR_SFDP_Enable_MemoryMappedMode(&extmem_list_config[MemId].NorSfdpObject))
           {
             return EXTMEM_ERROR_DRIVER;
           }
+          ctx->Mapped = 1u;
         }
         else
         {
@@ -976,6 +1061,14 @@ EXTMEM_StatusTypeDef EXTMEM_MemoryMappedMode(uint32_t MemId, EXTMEM_StateTypeDef
           {
             return EXTMEM_ERROR_DRIVER;
           }
+          ctx->Mapped = 0u;
+
+          /* Give the memory back to the erase that was preempted */
+          if (ctx->MapSuspended != 0u)
+          {
+            ctx->MapSuspended = 0u;
+            retr = EXTMEM_EraseResume(MemId);
+          }
         }
         break;
       }
@@ -1180,9 +1273,544 @@ EXTMEM_StatusTypeDef EXTMEM_GetMapAddress(uint32_t MemId, uint32_t *BaseAddress)
   }
   return retr;
 }
+
+/**
+  * @brief Sets the memory-mapped mode tuning of an XSPI memory.
+  * @note  When the memory is already mapped, the mapped mode is stopped and restarted with the
+  *        new tuning: no code or data may be fetched from that memory during the call.
+  * @param MemId Memory identifier.
+  * @param Tuning Tuning to apply, NULL restores the default settings.
+  * @retval EXTMEM_StatusTypeDef Status of the operation.
+  */
+EXTMEM_StatusTypeDef EXTMEM_MemoryMappedTuning(uint32_t MemId, const EXTMEM_MapTuningTypeDef *Tuning)
+{
+  EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
+  EXTMEM_FUNC_CALL();
+
+  /* Check the memory ID */
+  if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
+  {
+#if (EXTMEM_DRIVER_NOR_SFDP == 1) || (EXTMEM_DRIVER_PSRAM == 1)
+    SAL_XSPI_ObjectTypeDef *salobject = NULL;
+    SAL_XSPI_MapTuningTypeDef saltuning = {0};
+    uint32_t mapped;
+
+    switch (extmem_list_config[MemId].MemType)
+    {
+#if EXTMEM_DRIVER_NOR_SFDP == 1
+      case EXTMEM_NOR_SFDP:
+      {
+        salobject = &extmem_list_config[MemId].NorSfdpObject.sfdp_private.SALObject;
+        break;
+      }
+#endif /* EXTMEM_DRIVER_NOR_SFDP == 1 */
+#if EXTMEM_DRIVER_PSRAM == 1
+      case EXTMEM_PSRAM :
+      {
+        salobject = &extmem_list_config[MemId].PsramObject.psram_private.SALObject;
+        break;
+      }
+#endif /* EXTMEM_DRIVER_PSRAM == 1 */
+      default :
+      {
+        /* Only the XSPI based memories have a mapped mode tuning */
+        break;
+      }
+    }
+
+    if ((salobject == NULL) || (salobject->hxspi == NULL))
+    {
+      return EXTMEM_ERROR_NOTSUPPORTED;
+    }
+
+    if (Tuning != NULL)
+    {
+      saltuning.TimeOutActivation = Tuning->TimeOutActivation;
+      saltuning.TimeoutPeriod     = Tuning->TimeoutPeriod;
+      saltuning.WrapSize          = Tuning->WrapSize;
+      saltuning.CSBoundary        = Tuning->CSBoundary;
+      saltuning.MaxTran           = Tuning->MaxTran;
+    }
+
+    /* The device configuration registers can only be changed outside of the mapped mode */
+    mapped = HAL_XSPI_IsMemoryMapped(salobject->hxspi);
+    if (mapped != 0U)
+    {
+      retr = EXTMEM_MemoryMappedMode(MemId, EXTMEM_DISABLE);
+      if (retr != EXTMEM_OK)
+      {
+        return retr;
+      }
+    }
+
+    if (HAL_OK != SAL_XSPI_SetMapTuning(salobject, (Tuning != NULL) ? &saltuning : NULL))
+    {
+      retr = EXTMEM_ERROR_PARAM;
+    }
+    else
+    {
+      retr = EXTMEM_OK;
+    }
+
+    if (mapped != 0U)
+    {
+      /* Restart the mapped mode, with the previous tuning if the new one has been rejected */
+      if (EXTMEM_OK != EXTMEM_MemoryMappedMode(MemId, EXTMEM_ENABLE))
+      {
+        retr = EXTMEM_ERROR_DRIVER;
+      }
+    }
+#else
+    (void)Tuning;
+    retr = EXTMEM_ERROR_NOTSUPPORTED;
+#endif /* (EXTMEM_DRIVER_NOR_SFDP == 1) || (EXTMEM_DRIVER_PSRAM == 1) */
+  }
+  return retr;
+}
+
+/**
+  * @brief Sets the memory-mapped mode tuning of an XSPI memory from a predefined profile.
+  * @param MemId Memory identifier.
+  * @param Profile Profile to apply (@ref EXTMEM_MapProfileTypeDef).
+  * @retval EXTMEM_StatusTypeDef Status of the operation.
+  */
+EXTMEM_StatusTypeDef EXTMEM_MemoryMappedProfile(uint32_t MemId, EXTMEM_MapProfileTypeDef Profile)
+{
+  EXTMEM_FUNC_CALL();
+
+  if (Profile >= EXTMEM_MAP_PROFILE_COUNT)
+  {
+    return EXTMEM_ERROR_PARAM;
+  }
+
+#if (EXTMEM_DRIVER_NOR_SFDP == 1) || (EXTMEM_DRIVER_PSRAM == 1)
+  if (Profile == EXTMEM_MAP_PROFILE_DEFAULT)
+  {
+    return EXTMEM_MemoryMappedTuning(MemId, NULL);
+  }
+  return EXTMEM_MemoryMappedTuning(MemId, &extmem_map_profile[Profile]);
+#else
+  return EXTMEM_ERROR_NOTSUPPORTED;
+#endif /* (EXTMEM_DRIVER_NOR_SFDP == 1) || (EXTMEM_DRIVER_PSRAM == 1) */
+}
+
+/**
+  * @brief Starts an erase of a range of sectors and returns without waiting for its end.
+  * @param MemId Memory identifier.
+  * @param Address Address in memory to start erase operation.
+  * @param Size Number of bytes to erase.
+  * @retval EXTMEM_StatusTypeDef Status of the operation.
+  * @note The range is erased block by block, each block being the largest erase type that
+  *       fits, the caller drives the operation with @ref EXTMEM_EraseProcess.
+  *       @ref EXTMEM_MemoryMappedMode can be enabled at any time: the erase is suspended
+  *       (or the block in progress completed when the memory has no suspend) and it is resumed
+  *       when the memory-mapped mode is disabled.
+  */
+EXTMEM_StatusTypeDef EXTMEM_EraseSectorStart(uint32_t MemId, uint32_t Address, uint32_t Size)
+{
+  EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
+  EXTMEM_FUNC_CALL();
+
+  /* Check the memory ID */
+  if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
+  {
+    retr = EXTMEM_ERROR_NOTSUPPORTED;
+#if EXTMEM_DRIVER_NOR_SFDP == 1
+    if (extmem_list_config[MemId].MemType == EXTMEM_NOR_SFDP)
+    {
+      EXTMEM_EraseContextTypeDef *const ctx = &extmem_erase_ctx[MemId];
+
+      if ((ctx->State != EXTMEM_ERASE_IDLE) || (ctx->Mapped != 0u))
+      {
+        retr = EXTMEM_BUSY;
+      }
+      else if (Size == 0u)
+      {
+        retr = EXTMEM_ERROR_PARAM;
+      }
+      else
+      {
+        ctx->Address = Address;
+        ctx->Remaining = Size;
+        retr = extmem_nor_erase_next(MemId);
+      }
+    }
+#else
+    (void)Address;
+    (void)Size;
+#endif /* EXTMEM_DRIVER_NOR_SFDP == 1 */
+  }
+  return retr;
+}
+
+/**
+  * @brief Makes an asynchronous erase progress, to be called periodically.
+  * @param MemId Memory identifier.
+  * @retval EXTMEM_OK when the erase is complete (or none is running), EXTMEM_BUSY while the
+  *         erase is in progress, suspended or the memory is mapped, error code otherwise.
+  */
+EXTMEM_StatusTypeDef EXTMEM_EraseProcess(uint32_t MemId)
+{
+  EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
+  EXTMEM_FUNC_CALL();
+
+  /* Check the memory ID */
+  if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
+  {
+    retr = EXTMEM_ERROR_NOTSUPPORTED;
+#if EXTMEM_DRIVER_NOR_SFDP == 1
+    if (extmem_list_config[MemId].MemType == EXTMEM_NOR_SFDP)
+    {
+      EXTMEM_EraseContextTypeDef *const ctx = &extmem_erase_ctx[MemId];
+
+      if (ctx->State == EXTMEM_ERASE_IDLE)
+      {
+        retr = EXTMEM_OK;
+      }
+      else if ((ctx->State == EXTMEM_ERASE_SUSPENDED) || (ctx->Mapped != 0u))
+      {
+        /* The bus belongs to the memory-mapped reads */
+        retr = EXTMEM_BUSY;
+      }
+      else if (EXTMEM_DRIVER_NOR_SFDP_OK !=
+               EXTMEM_DRIVER_NOR_SFDP_CheckBusy(&extmem_list_config[MemId].NorSfdpObject))
+      {
+        retr = EXTMEM_BUSY;
+        if ((HAL_GetTick() - ctx->BlockTick) > ctx->BlockTimeout)
+        {
+          EXTMEM_DEBUG("\terror : erase timeout\n");
+          ctx->State = EXTMEM_ERASE_IDLE;
+          retr = EXTMEM_ERROR_DRIVER;
+        }
+      }
+      else
+      {
+        /* Block done, continue with the next one */
+        extmem_erase_count(MemId, ctx->Address, ctx->BlockSize);
+        ctx->Address = ctx->Address + ctx->BlockSize;
+        ctx->Remaining = (ctx->BlockSize >= ctx->Remaining) ? 0u : (ctx->Remaining - ctx->BlockSize);
+
+        if (ctx->Remaining == 0u)
+        {
+          ctx->State = EXTMEM_ERASE_IDLE;
+          retr = EXTMEM_OK;
+        }
+        else
+        {
+          retr = extmem_nor_erase_next(MemId);
+          if (retr == EXTMEM_OK)
+          {
+            retr = EXTMEM_BUSY;
+          }
+        }
+      }
+    }
+#endif /* EXTMEM_DRIVER_NOR_SFDP == 1 */
+  }
+  return retr;
+}
+
+/**
+  * @brief Suspends the asynchronous erase so that the memory can be read.
+  * @param MemId Memory identifier.
+  * @retval EXTMEM_StatusTypeDef Status of the operation, EXTMEM_ERROR_NOTSUPPORTED when the
+  *         memory does not advertise erase suspend in its SFDP table.
+  */
+EXTMEM_StatusTypeDef EXTMEM_EraseSuspend(uint32_t MemId)
+{
+  EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
+  EXTMEM_FUNC_CALL();
+
+  /* Check the memory ID */
+  if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
+  {
+    retr = EXTMEM_ERROR_NOTSUPPORTED;
+#if EXTMEM_DRIVER_NOR_SFDP == 1
+    if (extmem_list_config[MemId].MemType == EXTMEM_NOR_SFDP)
+    {
+      EXTMEM_EraseContextTypeDef *const ctx = &extmem_erase_ctx[MemId];
+
+      retr = EXTMEM_OK;
+      if (ctx->State == EXTMEM_ERASE_RUNNING)
+      {
+        switch (EXTMEM_DRIVER_NOR_SFDP_EraseSuspend(&extmem_list_config[MemId].NorSfdpObject))
+        {
+          case EXTMEM_DRIVER_NOR_SFDP_OK:
+            ctx->State = EXTMEM_ERASE_SUSPENDED;
+            break;
+          case EXTMEM_DRIVER_NOR_SFDP_ERROR_SUSPEND_UNAVAILABLE:
+            retr = EXTMEM_ERROR_NOTSUPPORTED;
+            break;
+          default:
+            retr = EXTMEM_ERROR_DRIVER;
+            break;
+        }
+      }
+    }
+#endif /* EXTMEM_DRIVER_NOR_SFDP == 1 */
+  }
+  return retr;
+}
+
+/**
+  * @brief Resumes an erase suspended with @ref EXTMEM_EraseSuspend.
+  * @param MemId Memory identifier.
+  * @retval EXTMEM_StatusTypeDef Status of the operation.
+  */
+EXTMEM_StatusTypeDef EXTMEM_EraseResume(uint32_t MemId)
+{
+  EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
+  EXTMEM_FUNC_CALL();
+
+  /* Check the memory ID */
+  if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
+  {
+    retr = EXTMEM_ERROR_NOTSUPPORTED;
+#if EXTMEM_DRIVER_NOR_SFDP == 1
+    if (extmem_list_config[MemId].MemType == EXTMEM_NOR_SFDP)
+    {
+      EXTMEM_EraseContextTypeDef *const ctx = &extmem_erase_ctx[MemId];
+
+      retr = EXTMEM_OK;
+      if (ctx->State == EXTMEM_ERASE_SUSPENDED)
+      {
+        if (ctx->Mapped != 0u)
+        {
+          /* Resume is a command, it cannot be sent in memory-mapped mode */
+          retr = EXTMEM_BUSY;
+        }
+        else if (EXTMEM_DRIVER_NOR_SFDP_OK !=
+                 EXTMEM_DRIVER_NOR_SFDP_EraseResume(&extmem_list_config[MemId].NorSfdpObject))
+        {
+          retr = EXTMEM_ERROR_DRIVER;
+        }
+        else
+        {
+          /* The time spent suspended does not count in the block timeout */
+          ctx->BlockTick = HAL_GetTick();
+          ctx->State = EXTMEM_ERASE_RUNNING;
+        }
+      }
+    }
+#endif /* EXTMEM_DRIVER_NOR_SFDP == 1 */
+  }
+  return retr;
+}
+
+/**
+  * @brief Configures the erase counters used for wear monitoring.
+  * @param MemId Memory identifier.
+  * @param Counters Table of counters provided by the application, NULL to stop counting.
+  * @param Count Number of counters in the table.
+  * @param SectorSize Bytes covered by one counter, power of two.
+  * @retval EXTMEM_StatusTypeDef Status of the operation.
+  * @note Every erase operation (sector, block or chip) increments the counters of all the
+  *       areas it covers. The counters are kept in RAM, saving them is up to the application.
+  */
+EXTMEM_StatusTypeDef EXTMEM_EraseCounterConfig(uint32_t MemId, uint32_t *Counters, uint32_t Count,
+                                               uint32_t SectorSize)
+{
+  EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
+  EXTMEM_FUNC_CALL();
+
+  /* Check the memory ID */
+  if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
+  {
+    retr = EXTMEM_ERROR_NOTSUPPORTED;
+#if EXTMEM_DRIVER_NOR_SFDP == 1
+    if (extmem_list_config[MemId].MemType == EXTMEM_NOR_SFDP)
+    {
+      EXTMEM_EraseContextTypeDef *const ctx = &extmem_erase_ctx[MemId];
+
+      if ((Counters != NULL) && ((SectorSize == 0u) || ((SectorSize & (SectorSize - 1u)) != 0u)))
+      {
+        retr = EXTMEM_ERROR_PARAM;
+      }
+      else
+      {
+        ctx->Counters = NULL;
+        ctx->CounterNb = (Counters == NULL) ? 0u : Count;
+        ctx->CounterShift = (Counters == NULL) ? 0u : (uint8_t)(31u - (uint32_t)__CLZ(SectorSize));
+        ctx->Counters = Counters;
+        retr = EXTMEM_OK;
+      }
+    }
+#else
+    (void)Counters;
+    (void)Count;
+    (void)SectorSize;
+#endif /* EXTMEM_DRIVER_NOR_SFDP == 1 */
+  }
+  return retr;
+}
+
+/**
+  * @brief Gets the number of erase operations seen by an area of the memory.
+  * @param MemId Memory identifier.
+  * @param Address Address in the area.
+  * @param Count Pointer to variable to receive the count.
+  * @retval EXTMEM_StatusTypeDef Status of the operation.
+  */
+EXTMEM_StatusTypeDef EXTMEM_GetEraseCount(uint32_t MemId, uint32_t Address, uint32_t *Count)
+{
+  EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
+  EXTMEM_FUNC_CALL();
+
+  /* Check the memory ID */
+  if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
+  {
+    retr = EXTMEM_ERROR_NOTSUPPORTED;
+#if EXTMEM_DRIVER_NOR_SFDP == 1
+    if ((extmem_list_config[MemId].MemType == EXTMEM_NOR_SFDP) && (extmem_erase_ctx[MemId].Counters != NULL))
+    {
+      const EXTMEM_EraseContextTypeDef *const ctx = &extmem_erase_ctx[MemId];
+      uint32_t index = Address >> ctx->CounterShift;
+
+      if ((Count == NULL) || (index >= ctx->CounterNb))
+      {
+        retr = EXTMEM_ERROR_PARAM;
+      }
+      else
+      {
+        *Count = ctx->Counters[index];
+        retr = EXTMEM_OK;
+      }
+    }
+#else
+    (void)Address;
+    (void)Count;
+#endif /* EXTMEM_DRIVER_NOR_SFDP == 1 */
+  }
+  return retr;
+}
+/**
+  * @}
+  */
+
+#if EXTMEM_DRIVER_NOR_SFDP == 1
+/** @defgroup EXTMEM_Private_Functions External Memory Private Functions
+  * @{
+  */
+
+/**
+  * @brief Selects the largest erase type usable at an address.
+  * @param Object NOR SFDP memory object.
+  * @param Address Address of the erase.
+  * @param Size Bytes left to erase.
+  * @param SectorType Selected erase type.
+  * @param SectorSize Size of the selected erase type.
+  * @param Timeout Erase time of the selected type, in ms.
+  * @retval EXTMEM_StatusTypeDef Status of the operation.
+  * @note The SFDP table does not sort the erase types by size, all four are compared. When the
+  *       size left is below every erase size, the smallest aligned type is used.
+  */
+static EXTMEM_StatusTypeDef extmem_nor_select_erase(const EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object,
+                                                    uint32_t Address, uint32_t Size,
+                                                    EXTMEM_DRIVER_NOR_SFDP_SectorTypeTypeDef *SectorType,
+                                                    uint32_t *SectorSize, uint32_t *Timeout)
+{
+  const EXTMEM_DRIVER_NOR_SFDP_InfoTypeDef *const info = &Object->sfdp_private.DriverInfo;
+  const uint8_t size[4] = { info->EraseType1Size, info->EraseType2Size, info->EraseType3Size, info->EraseType4Size };
+  const uint8_t command[4] = { info->EraseType1Command, info->EraseType2Command,
+                               info->EraseType3Command, info->EraseType4Command };
+  const uint32_t timing[4] = { info->EraseType1Timing, info->EraseType2Timing,
+                               info->EraseType3Timing, info->EraseType4Timing };
+  uint32_t best = 4u;
+  uint32_t smallest = 4u;
+
+  for (uint32_t index = 0u; index < 4u; index++)
+  {
+    uint32_t sector_size = (uint32_t)1u << size[index];
+
+    if ((size[index] == 0u) || (command[index] == 0u) || ((Address % sector_size) != 0u))
+    {
+      continue;
+    }
+    if ((sector_size <= Size) && ((best == 4u) || (size[index] > size[best])))
+    {
+      best = index;
+    }
+    if ((smallest == 4u) || (size[index] < size[smallest]))
+    {
+      smallest = index;
+    }
+  }
+
+  if (best == 4u)
+  {
+    best = smallest;
+  }
+  if (best == 4u)
+  {
+    return EXTMEM_ERROR_SECTOR_SIZE;
+  }
+
+  *SectorType = (EXTMEM_DRIVER_NOR_SFDP_SectorTypeTypeDef)best;
+  *SectorSize = (uint32_t)1u << size[best];
+  *Timeout = timing[best];
+  return EXTMEM_OK;
+}
+
+/**
+  * @brief Launches the erase of the next block of an asynchronous erase.
+  * @param MemId Memory identifier.
+  * @retval EXTMEM_StatusTypeDef Status of the operation.
+  */
+static EXTMEM_StatusTypeDef extmem_nor_erase_next(uint32_t MemId)
+{
+  EXTMEM_EraseContextTypeDef *const ctx = &extmem_erase_ctx[MemId];
+  EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *const object = &extmem_list_config[MemId].NorSfdpObject;
+  EXTMEM_DRIVER_NOR_SFDP_SectorTypeTypeDef sector_type;
+  EXTMEM_StatusTypeDef retr;
+
+  retr = extmem_nor_select_erase(object, ctx->Address, ctx->Remaining, &sector_type, &ctx->BlockSize,
+                                 &ctx->BlockTimeout);
+  if (retr == EXTMEM_OK)
+  {
+    if (EXTMEM_DRIVER_NOR_SFDP_OK != EXTMEM_DRIVER_NOR_SFDP_SectorEraseStart(object, ctx->Address, sector_type))
+    {
+      retr = EXTMEM_ERROR_DRIVER;
+    }
+  }
+
+  if (retr == EXTMEM_OK)
+  {
+    ctx->BlockTick = HAL_GetTick();
+    ctx->State = EXTMEM_ERASE_RUNNING;
+  }
+  else
+  {
+    ctx->State = EXTMEM_ERASE_IDLE;
+  }
+  return retr;
+}
+
+/**
+  * @brief Increments the erase counters of a range.
+  * @param MemId Memory identifier.
+  * @param Address Start of the erased range.
+  * @param Size Size of the erased range.
+  */
+static void extmem_erase_count(uint32_t MemId, uint32_t Address, uint32_t Size)
+{
+  const EXTMEM_EraseContextTypeDef *const ctx = &extmem_erase_ctx[MemId];
+
+  if ((ctx->Counters != NULL) && (Size != 0u))
+  {
+    uint32_t first = Address >> ctx->CounterShift;
+    uint32_t last = (Address + Size - 1u) >> ctx->CounterShift;
+
+    for (uint32_t index = first; (index <= last) && (index < ctx->CounterNb); index++)
+    {
+      ctx->Counters[index]++;
+    }
+  }
+}
+
 /**
   * @}
   */
+#endif /* EXTMEM_DRIVER_NOR_SFDP == 1 */
 
 /**
   * @}
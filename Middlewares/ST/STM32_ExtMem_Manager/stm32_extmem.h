@@ -61,6 +61,7 @@ typedef enum
 typedef enum
 {
   EXTMEM_OK,                       /*!< Action performed with a status ok */
+  EXTMEM_BUSY                =  1, /*!< Asynchronous operation still in progress */
   EXTMEM_ERROR_NOTSUPPORTED  = -1, /*!< Action not supported by the memory type */
   EXTMEM_ERROR_UNKNOWNMEMORY = -2, /*!< Unknown memory type */
   EXTMEM_ERROR_DRIVER        = -3, /*!< Error return by the driver layer */
@@ -92,6 +93,36 @@ typedef struct
 } EXTMEM_NOR_SFDP_FlashInfoTypeDef;
 
 
+/**
+  * @brief Memory-mapped mode profiles, see @ref EXTMEM_MemoryMappedProfile
+  */
+typedef enum
+{
+  EXTMEM_MAP_PROFILE_DEFAULT,           /*!< Settings used by the middleware before tuning (timeout counter off) */
+  EXTMEM_MAP_PROFILE_XIP_CODE,          /*!< Random code fetch: short nCS timeout, little wasted prefetch */
+  EXTMEM_MAP_PROFILE_ASSET_STREAMING,   /*!< Sequential assets: deep prefetch, long nCS timeout */
+  EXTMEM_MAP_PROFILE_PSRAM_FRAMEBUFFER, /*!< Framebuffer traffic: cache line wrap, medium nCS timeout */
+  EXTMEM_MAP_PROFILE_COUNT
+} EXTMEM_MapProfileTypeDef;
+
+/**
+  * @brief Value used in @ref EXTMEM_MapTuningTypeDef to keep the peripheral init setting
+  */
+#define EXTMEM_MAP_KEEP 0xFFFFFFFFU
+
+/**
+  * @brief Memory-mapped mode tuning of an XSPI memory
+  */
+typedef struct
+{
+  uint32_t TimeOutActivation;  /*!< HAL_XSPI_TIMEOUT_COUNTER_DISABLE keeps nCS low and prefetches until the FIFO
+                                    is full, HAL_XSPI_TIMEOUT_COUNTER_ENABLE releases it after TimeoutPeriod */
+  uint16_t TimeoutPeriod;      /*!< Kernel clock cycles nCS stays active with no access once the FIFO is full */
+  uint32_t WrapSize;           /*!< HAL_XSPI_WRAP_xxx or EXTMEM_MAP_KEEP */
+  uint32_t CSBoundary;         /*!< HAL_XSPI_BONDARYOF_xxx or EXTMEM_MAP_KEEP */
+  uint8_t  MaxTran;            /*!< Max transfer length before releasing the bus, 0 disabled */
+} EXTMEM_MapTuningTypeDef;
+
 /**
   * @brief USER memory information structure
   */
@@ -146,9 +177,18 @@ EXTMEM_StatusTypeDef EXTMEM_WriteInMappedMode(uint32_t MemId, uint32_t Address,
                                               uint32_t Size);
 EXTMEM_StatusTypeDef EXTMEM_EraseSector(uint32_t MemId, uint32_t Address, uint32_t Size);
 EXTMEM_StatusTypeDef EXTMEM_EraseAll(uint32_t MemId);
+EXTMEM_StatusTypeDef EXTMEM_EraseSectorStart(uint32_t MemId, uint32_t Address, uint32_t Size);
+EXTMEM_StatusTypeDef EXTMEM_EraseProcess(uint32_t MemId);
+EXTMEM_StatusTypeDef EXTMEM_EraseSuspend(uint32_t MemId);
+EXTMEM_StatusTypeDef EXTMEM_EraseResume(uint32_t MemId);
+EXTMEM_StatusTypeDef EXTMEM_EraseCounterConfig(uint32_t MemId, uint32_t *Counters, uint32_t Count,
+                                               uint32_t SectorSize);
+EXTMEM_StatusTypeDef EXTMEM_GetEraseCount(uint32_t MemId, uint32_t Address, uint32_t *Count);
 EXTMEM_StatusTypeDef EXTMEM_GetInfo(uint32_t MemId, void *Info);
 EXTMEM_StatusTypeDef EXTMEM_MemoryMappedMode(uint32_t MemId, EXTMEM_StateTypeDef State);
 EXTMEM_StatusTypeDef EXTMEM_GetMapAddress(uint32_t MemId, uint32_t *BaseAddress);
+EXTMEM_StatusTypeDef EXTMEM_MemoryMappedTuning(uint32_t MemId, const EXTMEM_MapTuningTypeDef *Tuning);
+EXTMEM_StatusTypeDef EXTMEM_MemoryMappedProfile(uint32_t MemId, EXTMEM_MapProfileTypeDef Profile);
 
 /**
   * @}
@@ -10,6 +10,11 @@
 #include "stdio.h"
 #include "mp3_decoder.h"
 #include "lfs_user.h"
+#include "media_prefetch.h"
+#include "boot_profile.h"
+#include "dcache_maint.h"
+#include "idle_sleep.h"
+#include "cmsis_os2.h"
 // Global değişkenler
 extern DMA_HandleTypeDef handle_GPDMA1_Channel15;
 // MP3 decoder internal buffer (decoder'ın kendi işlemleri için)
@@ -17,12 +22,23 @@ extern DMA_HandleTypeDef handle_GPDMA1_Channel15;
 ALIGN_32BYTES (int16_t mp3_decoder_internal_buffer[MP3_DECODER_BUFFER_SIZE])
     __attribute__((section(".AudioBufferSection")));
 
-// MP3 file buffer (LittleFS'den okunan dosya için)
-#define MP3_FILE_BUFFER_SIZE (1024 * 1024)  // 256KB max file size
-ALIGN_32BYTES (static uint8_t mp3_file_buffer[MP3_FILE_BUFFER_SIZE])
-    __attribute__((section(".AudioBufferSection")));
+// MP3 dosyası LittleFS'den read-ahead ile stream ediliyor (tamamı RAM'e okunmuyor)
+#define MP3_FILE_PATH        "/music/guitar.mp3"
+#define MP3_MAX_BYTE_RATE    (320000 / 8)   // 320 kbps worst case, sizes the read-ahead
+
+static media_prefetch_stream_t mp3_stream;
+
+volatile audio_drv_stats_t audio_drv_stats;
 
-static size_t mp3_file_loaded_size = 0;
+/* Refill requests of the DMA interrupts: cycle stamp (half, full), flags not served yet */
+static volatile uint32_t request_cycles[2];
+static volatile uint32_t pending;
+
+/* Normal DMA: chunk decoded ahead, NULL while the audio task decodes it; the
+   SAI is idle when a transfer ended before it was ready */
+static int16_t *volatile ready_chunk;
+static volatile size_t ready_samples;
+static volatile uint8_t dma_idle;
 
 mp3_decoder_streaming_t mp3_decoder;
 
@@ -35,6 +51,8 @@ extern const size_t dog_mp3_file_size;
 static void audio_drv_tx_half_callback(void* self);
 static void audio_drv_tx_callback(void* self);
 static void audio_drv_fill_sine_wave(audio_drv_t *self, int16_t* pData, size_t len);
+static int16_t *audio_drv_decode_next(size_t *samples);
+static void audio_drv_request(audio_drv_t *self, uint32_t flag);
 
 int audio_drv_init(audio_drv_t *self)
 {
@@ -44,6 +62,7 @@ int audio_drv_init(audio_drv_t *self)
 
 	self->callback.tx_cplt = audio_drv_tx_callback;
 	self->callback.tx_half_cplt = audio_drv_tx_half_callback;
+	self->task_handle = xTaskGetCurrentTaskHandle();
 
 
 	if (self->sine.p_tx_data== NULL || self->sine.tx_data_size == 0)
@@ -80,47 +99,27 @@ int audio_drv_init(audio_drv_t *self)
 			return -10;
 		}
 		printf("LittleFS mounted successfully\r\n");
+		boot_profile_mark(BOOT_PHASE_LFS_MOUNTED);
 
 		// List directory contents
 		lfs_list_dir("/music");
 
-		// Get file size
-		size_t file_size = 0;
-		if (lfs_get_file_size("/music/guitar.mp3", &file_size) != 0) {
-			printf("Failed to get file size\r\n");
+		// Open MP3 file as a prefetched stream
+		int pf_result = media_prefetch_open_lfs(&mp3_stream, MP3_FILE_PATH, 0, MP3_MAX_BYTE_RATE);
+		if (pf_result != MEDIA_PF_OK) {
+			printf("MP3 stream open failed: %d\r\n", pf_result);
 			return -11;
 		}
-
-		// Check if file fits in buffer
-		if (file_size > MP3_FILE_BUFFER_SIZE) {
-			printf("File too large: %lu > %lu\r\n", 
-			       (unsigned long)file_size, (unsigned long)MP3_FILE_BUFFER_SIZE);
-			return -12;
-		}
-
-		// Read MP3 file from LittleFS
-		size_t bytes_read = 0;
-		if (lfs_read_file("/music/guitar.mp3", mp3_file_buffer, MP3_FILE_BUFFER_SIZE, &bytes_read) != 0) {
-			printf("Failed to read MP3 file\r\n");
-			return -13;
-		}
-
-		mp3_file_loaded_size = bytes_read;
-		printf("MP3 file loaded: %lu bytes\r\n", (unsigned long)mp3_file_loaded_size);
-
-		// Dump header for verification
-		printf("MP3 Header: ");
-		for (int i = 0; i < 16 && i < (int)mp3_file_loaded_size; i++) {
-			printf("%02X ", mp3_file_buffer[i]);
-		}
-		printf("\r\n");
+		media_prefetch_set_loop(&mp3_stream, 1);
+		printf("MP3 stream opened: %lu bytes, %lu bytes ahead\r\n",
+		       (unsigned long)mp3_stream.length, (unsigned long)mp3_stream.ahead_bytes);
 
 		uint32_t buffer_size = self->is_circular_dma_enabled ? self->mp3.tx_data_size / 2 : self->mp3.tx_data_size;
 		// 1. Initialize decoder
 		mp3_decoder_streaming_init(&mp3_decoder, mp3_decoder_internal_buffer, sizeof(mp3_decoder_internal_buffer));
 
-		// 2. Load MP3 data from LittleFS
-		mp3_decoder_streaming_load(&mp3_decoder, mp3_file_buffer, mp3_file_loaded_size);
+		// 2. Attach MP3 stream
+		mp3_decoder_streaming_load_stream(&mp3_decoder, &mp3_stream);
 
 		// 3. Enable loop
 		mp3_decoder_streaming_set_loop(&mp3_decoder, 1);
@@ -190,7 +189,11 @@ int audio_drv_start_dma(audio_drv_t* self)
 			int16_t *first_chunk = mp3_decoder_streaming_next_chunk(&mp3_decoder, &samples);
 			if (first_chunk != NULL) {
 				size_t bytes_to_send = samples * sizeof(int16_t);
+				ready_chunk = NULL;
+				dma_idle = 0;
 				HAL_SAI_Transmit_DMA(self->hsai, (uint8_t*)first_chunk, bytes_to_send);
+				// The next chunk is decoded by the audio task while this one plays
+				audio_drv_request(self, AUDIO_DRV_FLAG_FULL);
 			}
 			else {
 				return -1;  // Chunk alınamadı
@@ -205,6 +208,24 @@ int audio_drv_start_dma(audio_drv_t* self)
 	return 0;
 }
 
+/* Time the DMA takes to play what one refill writes */
+static uint32_t audio_drv_deadline(audio_drv_t *self)
+{
+	uint32_t rate = self->type == __MP3_FILE ? mp3_decoder.sample_rate : (uint32_t)self->sampling_frequency;
+	size_t samples;
+
+	if (self->is_circular_dma_enabled)
+		samples = (self->type == __MP3_FILE ? self->mp3.tx_data_size : self->sine.tx_data_size) / 2;
+	else if (self->type == __MP3_FILE)
+		samples = mp3_decoder.chunk_size;
+	else
+		return 0;               // The interrupt resends the same sine buffer
+	if (rate == 0)
+		return 0;
+	// Interleaved stereo: two samples per frame
+	return (uint32_t)((uint64_t)(samples / 2) * SystemCoreClock / rate);
+}
+
 void audio_drv_update_frequency(audio_drv_t* self, float frequency)
 {
 	if ((frequency <= 0) || (frequency > 1000.0f))
@@ -244,80 +265,183 @@ static void audio_drv_fill_sine_wave(audio_drv_t *self, int16_t* pData, size_t l
 	}
 }
 
+/* Decode call of the refill, its duration spread is the decode jitter */
+static int16_t *audio_drv_decode_next(size_t *samples)
+{
+	uint32_t t0 = DWT->CYCCNT;
+	int16_t *chunk = mp3_decoder_streaming_next_chunk(&mp3_decoder, samples);
+
+	dcache_maint_decode(DWT->CYCCNT - t0);
+	return chunk;
+}
+
+/* From the SAI DMA interrupts: stamp the request and wake the audio task */
+static void audio_drv_request(audio_drv_t *self, uint32_t flag)
+{
+	request_cycles[flag == AUDIO_DRV_FLAG_HALF ? 0 : 1] = DWT->CYCCNT;
+	if (pending & flag)
+		audio_drv_stats.overruns++;
+	pending |= flag;
+	idle_sleep_event(IDLE_SLEEP_SRC_AUDIO);
+	osThreadFlagsSet((osThreadId_t)self->task_handle, flag);
+}
+
 static void audio_drv_tx_half_callback(void* self)
 {
 	audio_drv_t *audio_drv = (audio_drv_t *)self;
-	if (audio_drv->type == __SINE_WAVE )
+
+	// Circular DMA: the first half is free. Normal DMA: only the complete callback comes
+	if (audio_drv->is_circular_dma_enabled)
+		audio_drv_request(audio_drv, AUDIO_DRV_FLAG_HALF);
+}
+
+static void audio_drv_tx_callback(void* self)
+{
+	audio_drv_t *audio_drv = (audio_drv_t *)self;
+
+	if (audio_drv->is_circular_dma_enabled)
 	{
-		audio_drv_fill_sine_wave(audio_drv, audio_drv->sine.p_tx_data, audio_drv->sine.tx_data_size / 2);
+		// The second half is free
+		audio_drv_request(audio_drv, AUDIO_DRV_FLAG_FULL);
+	}
+	else if (audio_drv->type == __SINE_WAVE)
+	{
+		HAL_SAI_Transmit_DMA(audio_drv->hsai, (uint8_t *)audio_drv->sine.p_tx_data, audio_drv->sine.tx_data_size);
 	}
 	else
 	{
-		// Sine wave ile AYNI mantık: İLK yarıyı doldur
+		// Normal DMA: send the chunk decoded ahead at once, no gap for the decode
+		int16_t *chunk = ready_chunk;
 
-		if (audio_drv->is_circular_dma_enabled)
+		if (chunk != NULL)
 		{
-			size_t samples;
-			int16_t *next_chunk = mp3_decoder_streaming_next_chunk(&mp3_decoder, &samples);
-			if (next_chunk == NULL) {
-				HAL_SAI_DMAStop(audio_drv->hsai);
-			}
-			else {
-				size_t bytes_to_copy = samples * sizeof(int16_t);
-				memcpy(audio_drv->mp3.p_tx_data,  // ✅ İLK yarı (baştan)
-				       next_chunk,
-				       bytes_to_copy);
-			}
+			ready_chunk = NULL;
+			HAL_SAI_Transmit_DMA(audio_drv->hsai, (uint8_t *)chunk, ready_samples);
 		}
 		else
 		{
-			// Normal DMA: Half callback GELMEZ, sadece complete callback gelir
+			dma_idle = 1;
+			audio_drv_stats.underruns++;
 		}
+		audio_drv_request(audio_drv, AUDIO_DRV_FLAG_FULL);
 	}
 }
 
-static void audio_drv_tx_callback(void* self)
+/* Refill of the buffer released by one request, -1 at the end of the stream */
+static int audio_drv_refill(audio_drv_t *self, uint32_t flag)
 {
-	audio_drv_t *audio_drv = (audio_drv_t *)self;
-	if (audio_drv->type == __SINE_WAVE )
+	size_t samples;
+	int16_t *next_chunk;
+
+	if (self->type == __SINE_WAVE)
 	{
-		if (audio_drv->is_circular_dma_enabled)
-		{
-			audio_drv_fill_sine_wave(audio_drv, &audio_drv->sine.p_tx_data[audio_drv->sine.tx_data_size / 2], audio_drv->sine.tx_data_size / 2);
-		}
-		else
-		{
-			HAL_SAI_Transmit_DMA(audio_drv->hsai, audio_drv->sine.p_tx_data, audio_drv->sine.tx_data_size);
-		}
+		size_t half = self->sine.tx_data_size / 2;
+
+		audio_drv_fill_sine_wave(self, &self->sine.p_tx_data[flag == AUDIO_DRV_FLAG_HALF ? 0 : half], half);
+		return 0;
+	}
+
+	next_chunk = audio_drv_decode_next(&samples);
+	if (next_chunk == NULL)
+	{
+		HAL_SAI_DMAStop(self->hsai);
+		return -1;
+	}
+
+	if (self->is_circular_dma_enabled)
+	{
+		size_t offset = flag == AUDIO_DRV_FLAG_HALF ? 0 : self->mp3.tx_data_size / 2;
+
+		memcpy(&self->mp3.p_tx_data[offset], next_chunk, samples * sizeof(int16_t));
 	}
 	else
 	{
-		// Sine wave ile AYNI mantık: İKİNCİ yarıyı doldur
-		size_t samples;
-		int16_t *next_chunk = mp3_decoder_streaming_next_chunk(&mp3_decoder, &samples);
+		uint32_t primask = __get_PRIMASK();
 
-		if (audio_drv->is_circular_dma_enabled)
+		__disable_irq();
+		if (dma_idle)
 		{
-			if (next_chunk == NULL) {
-				HAL_SAI_DMAStop(audio_drv->hsai);
-			}
-			else {
-				size_t bytes_to_copy = samples * sizeof(int16_t);
-				memcpy(&audio_drv->mp3.p_tx_data[audio_drv->mp3.tx_data_size / 2],  // ✅ İKİNCİ yarı (ortadan)
-				       next_chunk,
-				       bytes_to_copy);
-			}
+			// Late: the previous transfer ended without a chunk to follow
+			dma_idle = 0;
+			HAL_SAI_Transmit_DMA(self->hsai, (uint8_t *)next_chunk, samples);
 		}
 		else
 		{
-			// Normal DMA: Sonraki chunk'ı direkt gönder (memcpy yok!)
-			if (next_chunk == NULL) {
-				HAL_SAI_DMAStop(audio_drv->hsai);
-			}
-			else {
-				size_t bytes_to_send = samples;
-				HAL_SAI_Transmit_DMA(audio_drv->hsai, (uint8_t*)next_chunk, bytes_to_send);
-			}
+			ready_samples = samples;
+			ready_chunk = next_chunk;
 		}
+		__set_PRIMASK(primask);
 	}
+	return 0;
+}
+
+int audio_drv_process(audio_drv_t *self, uint32_t timeout)
+{
+	static const uint32_t flag[2] = { AUDIO_DRV_FLAG_HALF, AUDIO_DRV_FLAG_FULL };
+	uint32_t flags = osThreadFlagsWait(AUDIO_DRV_FLAG_HALF | AUDIO_DRV_FLAG_FULL, osFlagsWaitAny, timeout);
+	uint32_t woken = DWT->CYCCNT;
+
+	if (flags & osFlagsError)
+		return -1;
+
+	if (audio_drv_stats.deadline_cycles == 0)
+		audio_drv_stats.deadline_cycles = audio_drv_deadline(self);
+
+	for (uint32_t i = 0; i < 2; i++)
+	{
+		uint32_t primask;
+		uint32_t requested;
+		uint32_t latency;
+		uint32_t elapsed;
+
+		if ((flags & flag[i]) == 0)
+			continue;
+
+		primask = __get_PRIMASK();
+		__disable_irq();
+		pending &= ~flag[i];
+		requested = request_cycles[i];
+		__set_PRIMASK(primask);
+
+		latency = woken - requested;
+		audio_drv_refill(self, flag[i]);
+		elapsed = DWT->CYCCNT - requested;
+
+		audio_drv_stats.refills++;
+		if (latency > audio_drv_stats.latency_max_cycles)
+			audio_drv_stats.latency_max_cycles = latency;
+		if (elapsed > audio_drv_stats.refill_max_cycles)
+			audio_drv_stats.refill_max_cycles = elapsed;
+		if (audio_drv_stats.deadline_cycles != 0 && elapsed > audio_drv_stats.deadline_cycles)
+			audio_drv_stats.misses++;
+	}
+	return 0;
+}
+
+void audio_drv_stats_reset(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	uint32_t deadline = audio_drv_stats.deadline_cycles;
+
+	__disable_irq();
+	memset((void *)&audio_drv_stats, 0, sizeof(audio_drv_stats));
+	audio_drv_stats.deadline_cycles = deadline;
+	audio_drv_stats.start_tick = HAL_GetTick();
+	__set_PRIMASK(primask);
+}
+
+void audio_drv_stats_print(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	uint32_t mhz = SystemCoreClock / 1000000U;
+	audio_drv_stats_t s;
+
+	__disable_irq();
+	memcpy(&s, (const void *)&audio_drv_stats, sizeof(s));
+	__set_PRIMASK(primask);
+
+	printf("\r\naudio: %lu refills in %lu ms, deadline %lu us\r\n",
+			s.refills, HAL_GetTick() - s.start_tick, s.deadline_cycles / mhz);
+	printf("%lu missed, %lu underruns, %lu overruns, wakeup max %lu us, refill max %lu us\r\n",
+			s.misses, s.underruns, s.overruns, s.latency_max_cycles / mhz, s.refill_max_cycles / mhz);
 }
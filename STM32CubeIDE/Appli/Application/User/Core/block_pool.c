@@ -0,0 +1,158 @@
+/*
+ * block_pool.c
+ *
+ * Lock-free fixed-block pools, see block_pool.h
+ */
+#include "block_pool.h"
+#include <stddef.h>
+#include <stdio.h>
+
+/*
+ * The free list is a stack threaded through the free blocks, their first word
+ * holds the index of the next one. The head packs the first index with a tag
+ * bumped by every push and pop, so a compare-and-swap against a head read
+ * before an interleaved pop and push fails (ABA). Blocks never allocated are
+ * not on the list, they are taken in order from 'fresh': a pool needs no
+ * initialization.
+ *
+ * The allocated bitmap is set once a block is taken and cleared before it
+ * goes back on the list. A second free of the same block finds its bit
+ * clear and is refused: pushing it twice would link the list into a loop.
+ */
+#define HEAD_INDEX(h)               ((h) & 0xFFFFU)
+#define HEAD_NEXT(h, index)         ((((h) + 0x10000U) & 0xFFFF0000U) | (index))
+
+static block_pool_t *pools[BLOCK_POOL_MAX];
+static volatile uint32_t pool_count;
+
+static inline uint8_t *block_at(const block_pool_t *pool, uint32_t index)
+{
+	return pool->base + index * pool->block_size;
+}
+
+static void pool_register(block_pool_t *pool)
+{
+	uint32_t slot;
+
+	if (__atomic_exchange_n(&pool->registered, 1U, __ATOMIC_RELAXED) != 0U)
+		return;
+	slot = __atomic_fetch_add(&pool_count, 1U, __ATOMIC_RELAXED);
+	if (slot < BLOCK_POOL_MAX)
+		pools[slot] = pool;
+}
+
+static void account_alloc(block_pool_t *pool, uint32_t index)
+{
+	__atomic_or_fetch(&pool->allocated[index / 32U], 1UL << (index % 32U), __ATOMIC_RELAXED);
+
+	uint32_t used = __atomic_add_fetch(&pool->used, 1U, __ATOMIC_RELAXED);
+	uint32_t max = pool->used_max;
+
+	while (used > max && !__atomic_compare_exchange_n(&pool->used_max, &max, used, 1,
+			__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+	{
+	}
+	__atomic_add_fetch(&pool->allocs, 1U, __ATOMIC_RELAXED);
+}
+
+void *block_pool_alloc(block_pool_t *pool)
+{
+	uint32_t head = __atomic_load_n(&pool->head, __ATOMIC_ACQUIRE);
+	uint32_t index;
+
+	if (!pool->registered)
+		pool_register(pool);
+
+	/* Recycled block first */
+	for (;;)
+	{
+		uint32_t next;
+
+		index = HEAD_INDEX(head);
+		if (index == BLOCK_POOL_NONE)
+			break;
+		/* May read a block popped meanwhile, the tag then fails the swap */
+		next = HEAD_NEXT(head, *(volatile uint32_t *)block_at(pool, index));
+		if (__atomic_compare_exchange_n(&pool->head, &head, next, 1, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		{
+			account_alloc(pool, index);
+			return block_at(pool, index);
+		}
+	}
+
+	/* Then a block never handed out */
+	index = __atomic_load_n(&pool->fresh, __ATOMIC_RELAXED);
+	while (index < pool->count)
+	{
+		if (__atomic_compare_exchange_n(&pool->fresh, &index, index + 1U, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+		{
+			account_alloc(pool, index);
+			return block_at(pool, index);
+		}
+	}
+
+	__atomic_add_fetch(&pool->failures, 1U, __ATOMIC_RELAXED);
+	return NULL;
+}
+
+int block_pool_free(block_pool_t *pool, void *block)
+{
+	uint32_t offset, index, head, bit;
+
+	if (block == NULL)
+		return BLOCK_POOL_OK;
+
+	offset = (uint32_t)((uint8_t *)block - pool->base);
+	index = offset / pool->block_size;
+	if ((uint8_t *)block < pool->base || index >= pool->fresh || (offset % pool->block_size) != 0U)
+		return BLOCK_POOL_INVALID_PARAM;
+
+	bit = 1UL << (index % 32U);
+	if ((__atomic_fetch_and(&pool->allocated[index / 32U], ~bit, __ATOMIC_RELAXED) & bit) == 0U)
+		return BLOCK_POOL_NOT_ALLOCATED;
+
+	head = __atomic_load_n(&pool->head, __ATOMIC_RELAXED);
+	do
+	{
+		*(volatile uint32_t *)block = HEAD_INDEX(head);
+	} while (!__atomic_compare_exchange_n(&pool->head, &head, HEAD_NEXT(head, index), 1,
+			__ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+	__atomic_sub_fetch(&pool->used, 1U, __ATOMIC_RELAXED);
+	return BLOCK_POOL_OK;
+}
+
+void block_pool_reset(void)
+{
+	uint32_t n = pool_count < BLOCK_POOL_MAX ? pool_count : BLOCK_POOL_MAX;
+
+	for (uint32_t i = 0; i < n; i++)
+	{
+		block_pool_t *p = pools[i];
+
+		if (p == NULL)
+			continue;
+		p->allocs = 0;
+		p->failures = 0;
+		p->used_max = p->used;
+	}
+}
+
+void block_pool_print(void)
+{
+	uint32_t n = pool_count < BLOCK_POOL_MAX ? pool_count : BLOCK_POOL_MAX;
+
+	if (n == 0U)
+		return;
+
+	printf("\r\npools:\r\n");
+	for (uint32_t i = 0; i < n; i++)
+	{
+		const block_pool_t *p = pools[i];
+
+		if (p == NULL)
+			continue;
+		printf("%s: %lu/%lu blocks of %lu bytes, max %lu, %lu allocs, %lu failed\r\n",
+				p->name, p->used, p->count, p->block_size, p->used_max, p->allocs, p->failures);
+	}
+}
@@ -0,0 +1,80 @@
+/*
+ * boot_profile.c
+ *
+ * Application side of the boot-phase timestamps, see boot_profile.h
+ */
+#include "boot_profile.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <stdio.h>
+
+#define BOOT_PROFILE_POLL_MS        (5U)
+
+static const char *const phase_name[BOOT_PHASE_COUNT] =
+{
+	"boot clock",
+	"boot extmem start",
+	"boot extmem done",
+	"boot jump",
+	"appli main",
+	"appli hal",
+	"appli peripherals",
+	"scheduler start",
+	"gui init",
+	"first frame",
+	"lfs mounted",
+	"audio ready"
+};
+
+void boot_profile_attach(void)
+{
+	__HAL_RCC_BKPRAM_CLK_ENABLE();
+	HAL_PWR_EnableBkUpAccess();
+
+	if (boot_profile->magic != BOOT_PROFILE_MAGIC
+			|| (boot_profile->reached & (1UL << BOOT_PHASE_JUMP)) == 0)
+	{
+		/* Not started by Boot, the timeline begins here */
+		boot_profile_start();
+	}
+}
+
+int boot_profile_wait(boot_phase_e phase, uint32_t timeout_ms)
+{
+	uint32_t waited = 0;
+
+	while ((boot_profile->reached & (1UL << phase)) == 0)
+	{
+		if (waited >= timeout_ms)
+			return -1;
+		vTaskDelay(pdMS_TO_TICKS(BOOT_PROFILE_POLL_MS));
+		waited += BOOT_PROFILE_POLL_MS;
+	}
+	return 0;
+}
+
+void boot_profile_print(void)
+{
+	uint32_t mhz = boot_profile->core_clock / 1000000U;
+	uint32_t origin = boot_profile->stamp[BOOT_PHASE_CLOCK];
+	uint32_t prev = origin;
+
+	if (boot_profile->magic != BOOT_PROFILE_MAGIC || mhz == 0)
+		return;
+
+	printf("\r\nboot #%lu @ %lu MHz\r\n", boot_profile->boot_count, mhz);
+	printf("%-20s %10s %10s\r\n", "phase", "t (us)", "step (us)");
+
+	for (uint32_t i = 0; i < BOOT_PHASE_COUNT; i++)
+	{
+		if ((boot_profile->reached & (1UL << i)) == 0)
+		{
+			printf("%-20s %10s %10s\r\n", phase_name[i], "-", "-");
+			continue;
+		}
+		printf("%-20s %10lu %10lu\r\n", phase_name[i],
+				(boot_profile->stamp[i] - origin) / mhz,
+				(boot_profile->stamp[i] - prev) / mhz);
+		prev = boot_profile->stamp[i];
+	}
+}
@@ -0,0 +1,220 @@
+/*
+ * dcache_maint.c
+ *
+ * Range based D-cache maintenance for the GPU2D/DMA2D hand-offs, see
+ * dcache_maint.h
+ */
+#include "dcache_maint.h"
+#include <stdio.h>
+#include <string.h>
+
+typedef struct
+{
+	uint32_t start;
+	uint32_t end;
+} dcache_window_t;
+
+/* Cacheable windows of MPU_Config (main.c), keep both in sync */
+static const dcache_window_t cacheable_window[] =
+{
+	{ 0x24000000U, 0x2406C000U },   /* AXI SRAM, region 5 below RAM_CMD */
+	{ 0x24072000U, 0x24080000U },   /* AXI SRAM, region 5 above region 7 */
+	{ 0x30000000U, 0x40000000U },   /* AHB SRAM and BKPSRAM, default map */
+	{ 0x70000000U, 0x78000000U },   /* XSPI2 flash, region 1 */
+};
+
+#define CACHEABLE_WINDOW_COUNT      (sizeof(cacheable_window) / sizeof(cacheable_window[0]))
+
+volatile dcache_maint_stats_t dcache_maint_stats;
+
+/* Pending range [pending_start, pending_end), empty when equal */
+static uint32_t pending_start;
+static uint32_t pending_end;
+static uint32_t cached_targets;
+
+int dcache_maint_is_cacheable(const void *addr, uint32_t size)
+{
+	uint32_t start = (uint32_t)addr;
+	uint32_t end = start + size;
+
+	for (uint32_t i = 0; i < CACHEABLE_WINDOW_COUNT; i++)
+	{
+		if (start < cacheable_window[i].end && end > cacheable_window[i].start)
+			return 1;
+	}
+	return 0;
+}
+
+void dcache_maint_target(const void *addr, uint32_t size)
+{
+	if (dcache_maint_is_cacheable(addr, size))
+	{
+		cached_targets++;
+		dcache_maint_stats.cached_targets = cached_targets;
+	}
+}
+
+void dcache_maint_mark(const void *addr, uint32_t size)
+{
+	uint32_t start = (uint32_t)addr;
+	uint32_t end = start + size;
+	uint32_t primask;
+
+	if (size == 0)
+		return;
+
+	if (!dcache_maint_is_cacheable(addr, size))
+	{
+		dcache_maint_stats.skipped_bytes += size;
+		return;
+	}
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	if (pending_start == pending_end)
+	{
+		pending_start = start;
+		pending_end = end;
+	}
+	else
+	{
+		if (start < pending_start)
+			pending_start = start;
+		if (end > pending_end)
+			pending_end = end;
+	}
+	__set_PRIMASK(primask);
+}
+
+static void dcache_maint_account(uint32_t cycles)
+{
+	dcache_maint_stats.maint_cycles += cycles;
+	if (cycles > dcache_maint_stats.maint_cycles_max)
+		dcache_maint_stats.maint_cycles_max = cycles;
+}
+
+/* Take the pending range, aligned on cache lines, 0 when there is none */
+static uint32_t dcache_maint_take(uint32_t *start)
+{
+	uint32_t primask, end;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	*start = pending_start & ~(DCACHE_MAINT_LINE_SIZE - 1U);
+	end = (pending_end + DCACHE_MAINT_LINE_SIZE - 1U) & ~(DCACHE_MAINT_LINE_SIZE - 1U);
+	pending_start = 0;
+	pending_end = 0;
+	__set_PRIMASK(primask);
+
+	return end - *start;
+}
+
+static int dcache_maint_full(void)
+{
+	return DCACHE_MAINT_FULL || cached_targets != 0;
+}
+
+void dcache_maint_clean(void)
+{
+	uint32_t t0 = DWT->CYCCNT;
+	uint32_t start, size;
+
+	if ((SCB->CCR & SCB_CCR_DC_Msk) == 0)
+		return;
+
+	dcache_maint_stats.clean_calls++;
+	size = dcache_maint_take(&start);
+
+	if (dcache_maint_full() || size > DCACHE_MAINT_CACHE_SIZE)
+	{
+		SCB_CleanInvalidateDCache();
+		dcache_maint_stats.full_ops++;
+	}
+	else if (size != 0)
+	{
+		SCB_CleanDCache_by_Addr((void *)start, (int32_t)size);
+		dcache_maint_stats.range_ops++;
+	}
+
+	dcache_maint_account(DWT->CYCCNT - t0);
+}
+
+void dcache_maint_invalidate(void)
+{
+	uint32_t t0 = DWT->CYCCNT;
+	uint32_t start, size;
+
+	if ((SCB->CCR & SCB_CCR_DC_Msk) == 0)
+		return;
+
+	dcache_maint_stats.invalidate_calls++;
+	size = dcache_maint_take(&start);
+
+	if (dcache_maint_full() || size > DCACHE_MAINT_CACHE_SIZE)
+	{
+		SCB_CleanInvalidateDCache();
+		dcache_maint_stats.full_ops++;
+	}
+	else if (size != 0)
+	{
+		SCB_CleanInvalidateDCache_by_Addr((void *)start, (int32_t)size);
+		dcache_maint_stats.range_ops++;
+	}
+
+	dcache_maint_account(DWT->CYCCNT - t0);
+}
+
+void dcache_maint_frame(uint32_t cycles)
+{
+	dcache_maint_stats.frames++;
+	dcache_maint_stats.frame_cycles += cycles;
+	if (cycles > dcache_maint_stats.frame_cycles_max)
+		dcache_maint_stats.frame_cycles_max = cycles;
+}
+
+void dcache_maint_decode(uint32_t cycles)
+{
+	if (dcache_maint_stats.decode_calls == 0 || cycles < dcache_maint_stats.decode_cycles_min)
+		dcache_maint_stats.decode_cycles_min = cycles;
+	if (cycles > dcache_maint_stats.decode_cycles_max)
+		dcache_maint_stats.decode_cycles_max = cycles;
+	dcache_maint_stats.decode_cycles += cycles;
+	dcache_maint_stats.decode_calls++;
+}
+
+void dcache_maint_reset(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	memset((void *)&dcache_maint_stats, 0, sizeof(dcache_maint_stats));
+	dcache_maint_stats.cached_targets = cached_targets;
+	__set_PRIMASK(primask);
+}
+
+void dcache_maint_print(void)
+{
+	dcache_maint_stats_t s;
+	uint32_t mhz = SystemCoreClock / 1000000U;
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	memcpy(&s, (const void *)&dcache_maint_stats, sizeof(s));
+	__set_PRIMASK(primask);
+
+	if (mhz == 0)
+		return;
+
+	printf("\r\ndcache %s: %lu clean, %lu inval, %lu range, %lu full, %lu B skipped\r\n",
+			dcache_maint_full() ? "full" : "range",
+			s.clean_calls, s.invalidate_calls, s.range_ops, s.full_ops, s.skipped_bytes);
+	printf("maint %lu us total, %lu us max\r\n",
+			(uint32_t)(s.maint_cycles / mhz), s.maint_cycles_max / mhz);
+	if (s.frames != 0)
+		printf("frame %lu us avg, %lu us max (%lu frames)\r\n",
+				(uint32_t)(s.frame_cycles / s.frames / mhz), s.frame_cycles_max / mhz, s.frames);
+	if (s.decode_calls != 0)
+		printf("decode %lu us avg, %lu us min, %lu us max, jitter %lu us\r\n",
+				(uint32_t)(s.decode_cycles / s.decode_calls / mhz), s.decode_cycles_min / mhz,
+				s.decode_cycles_max / mhz, (s.decode_cycles_max - s.decode_cycles_min) / mhz);
+}
@@ -0,0 +1,95 @@
+/*
+ * dma2d_batch.c
+ *
+ * DMA2D blit batching statistics, see dma2d_batch.h
+ */
+#include "dma2d_batch.h"
+#include "idle_sleep.h"
+#include "main.h"
+#include <stdio.h>
+#include <string.h>
+
+volatile dma2d_batch_stats_t dma2d_batch_stats;
+
+/* Start of the running transfer and end of the last one */
+static uint32_t start_cycles;
+static uint32_t done_cycles;
+static uint8_t running;
+static uint8_t done_valid;
+
+void dma2d_batch_queued(int merged)
+{
+	dma2d_batch_stats.blits++;
+	if (merged)
+		dma2d_batch_stats.merged++;
+}
+
+void dma2d_batch_start(int chained)
+{
+	uint32_t now = idle_sleep_cycles();
+
+	if (chained && done_valid)
+	{
+		uint32_t gap = now - done_cycles;
+
+		dma2d_batch_stats.gaps++;
+		dma2d_batch_stats.gap_cycles += gap;
+		if (gap > dma2d_batch_stats.gap_cycles_max)
+			dma2d_batch_stats.gap_cycles_max = gap;
+	}
+	done_valid = 0;
+	running = 1;
+	start_cycles = now;
+	dma2d_batch_stats.transfers++;
+}
+
+void dma2d_batch_done(void)
+{
+	uint32_t now = idle_sleep_cycles();
+
+	if (running)
+	{
+		dma2d_batch_stats.busy_cycles += now - start_cycles;
+		running = 0;
+	}
+	done_cycles = now;
+	done_valid = 1;
+}
+
+void dma2d_batch_end_frame(void)
+{
+	dma2d_batch_stats.frames++;
+}
+
+void dma2d_batch_reset(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	memset((void *)&dma2d_batch_stats, 0, sizeof(dma2d_batch_stats));
+	dma2d_batch_stats.start_tick = HAL_GetTick();
+	__set_PRIMASK(primask);
+}
+
+void dma2d_batch_print(void)
+{
+	dma2d_batch_stats_t s;
+	uint32_t mhz = SystemCoreClock / 1000000U;
+	uint32_t primask = __get_PRIMASK();
+	uint32_t ms;
+
+	__disable_irq();
+	memcpy(&s, (const void *)&dma2d_batch_stats, sizeof(s));
+	__set_PRIMASK(primask);
+
+	ms = HAL_GetTick() - s.start_tick;
+	if (s.frames == 0 || ms == 0 || mhz == 0)
+		return;
+
+	printf("\r\ndma2d: %lu frames, %lu blits/frame, %lu merged, %lu transfers/frame\r\n",
+			s.frames, s.blits / s.frames, s.merged, s.transfers / s.frames);
+	printf("busy %lu us/frame (%lu%%), gaps %lu us/frame, %lu us max (%lu gaps)\r\n",
+			(uint32_t)(s.busy_cycles / s.frames / mhz),
+			(uint32_t)(s.busy_cycles / 10U / mhz / ms),
+			(uint32_t)(s.gap_cycles / s.frames / mhz), s.gap_cycles_max / mhz, s.gaps);
+}
@@ -0,0 +1,100 @@
+/*
+ * fb_dirty.c
+ *
+ * Dirty region meter of the double buffered framebuffer, see fb_dirty.h
+ */
+#include "fb_dirty.h"
+#include "main.h"
+#include <stdio.h>
+#include <string.h>
+
+volatile fb_dirty_stats_t fb_dirty_stats;
+
+static uint16_t fb_width;
+static uint16_t fb_height;
+static uint8_t fb_bpp;
+
+/* Frame being drawn, only used by the TouchGFX task */
+static uint32_t frame_bytes;
+static uint32_t frame_rects;
+
+void fb_dirty_init(uint16_t width, uint16_t height, uint8_t bytes_per_pixel)
+{
+	fb_width = width;
+	fb_height = height;
+	fb_bpp = bytes_per_pixel;
+	frame_bytes = 0;
+	frame_rects = 0;
+	fb_dirty_reset();
+}
+
+void fb_dirty_add(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+	/* Clip to the screen */
+	if (x < 0) { width += x; x = 0; }
+	if (y < 0) { height += y; y = 0; }
+	if (x + width > fb_width)
+		width = fb_width - x;
+	if (y + height > fb_height)
+		height = fb_height - y;
+	if (width <= 0 || height <= 0)
+		return;
+
+	frame_rects++;
+	frame_bytes += (uint32_t)width * (uint32_t)height * fb_bpp;
+}
+
+uint32_t fb_dirty_end_frame(void)
+{
+	uint32_t bytes = frame_bytes;
+
+	if (frame_rects != 0)
+	{
+		fb_dirty_stats.frames++;
+		fb_dirty_stats.rects += frame_rects;
+		fb_dirty_stats.dirty_bytes += bytes;
+		if (bytes > fb_dirty_stats.dirty_bytes_max)
+			fb_dirty_stats.dirty_bytes_max = bytes;
+	}
+
+	frame_bytes = 0;
+	frame_rects = 0;
+	return bytes;
+}
+
+void fb_dirty_reset(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	memset((void *)&fb_dirty_stats, 0, sizeof(fb_dirty_stats));
+	fb_dirty_stats.start_tick = HAL_GetTick();
+	__set_PRIMASK(primask);
+}
+
+void fb_dirty_print(void)
+{
+	fb_dirty_stats_t s;
+	uint32_t full = (uint32_t)fb_width * fb_height * fb_bpp;
+	uint32_t primask = __get_PRIMASK();
+	uint32_t ms, avg;
+	uint64_t saved;
+
+	__disable_irq();
+	memcpy(&s, (const void *)&fb_dirty_stats, sizeof(s));
+	__set_PRIMASK(primask);
+
+	ms = HAL_GetTick() - s.start_tick;
+	if (s.frames == 0 || ms == 0)
+		return;
+
+	avg = (uint32_t)(s.dirty_bytes / s.frames);
+	/* A full frame copy reads and writes the whole buffer, the region copy the rects */
+	saved = ((uint64_t)full * s.frames - s.dirty_bytes) * 2U * 1000U / ms;
+
+	printf("\r\nfb dirty: %lu frames in %lu ms (%lu.%lu fps), %lu rects\r\n",
+			s.frames, ms, s.frames * 1000U / ms, (s.frames * 10000U / ms) % 10U, s.rects);
+	printf("copied %lu KB/frame avg (%lu%% of the frame), %lu KB max, full frame %lu KB\r\n",
+			avg / 1024U, (uint32_t)((uint64_t)avg * 100U / full), s.dirty_bytes_max / 1024U, full / 1024U);
+	printf("PSRAM bandwidth saved against full frame copies: %lu KB/s\r\n", (uint32_t)(saved / 1024U));
+}
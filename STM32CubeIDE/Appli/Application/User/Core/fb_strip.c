@@ -0,0 +1,158 @@
+/*
+ * fb_strip.c
+ *
+ * Single framebuffer, strip rendering mode of the TouchGFX HAL, see fb_strip.h
+ */
+#include "fb_strip.h"
+#include "main.h"
+#include <stdio.h>
+#include <string.h>
+
+/* A strip is a few hundred us of DMA2D, a frame is the upper bound of a wait */
+#define FB_STRIP_TIMEOUT_MS         (20U)
+
+volatile fb_strip_stats_t fb_strip_stats;
+
+static uint8_t *fb_base;
+static uint32_t fb_stride;
+static uint8_t fb_bpp;
+static uint16_t fb_height;
+
+void fb_strip_init(void *framebuffer, uint32_t stride, uint8_t bytes_per_pixel, uint16_t height)
+{
+	fb_base = (uint8_t *)framebuffer;
+	fb_stride = stride;
+	fb_bpp = bytes_per_pixel;
+	fb_height = height;
+	fb_strip_reset();
+}
+
+/* Active line being scanned out by the LTDC, negative or >= height in the blanking */
+static int32_t fb_strip_scanline(void)
+{
+	int32_t first = (int32_t)(LTDC->BPCR & LTDC_BPCR_AVBP) + 1;
+
+	return (int32_t)(LTDC->CPSR & LTDC_CPSR_CYPOS) - first;
+}
+
+static int fb_strip_can_copy(uint16_t y, uint16_t height)
+{
+	int32_t line = fb_strip_scanline();
+
+	if (line < 0 || line >= fb_height)
+		return 1;       /* Blanking */
+	if (line >= (int32_t)(y + height))
+		return 1;       /* Strip already shown, the copy ends long before the next pass */
+	return line + (int32_t)FB_STRIP_TEAR_MARGIN <= (int32_t)y;
+}
+
+int fb_strip_copy(const void *pixels, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+	uint32_t bytes = (uint32_t)width * height * fb_bpp;
+	uint32_t tick, t0, cycles;
+	int ret = FB_STRIP_OK;
+
+	if (fb_base == NULL || pixels == NULL || fb_bpp != 4U || width == 0 || height == 0)
+	{
+		fb_strip_stats.dropped++;
+		return FB_STRIP_ERROR;
+	}
+
+	/* CPU drawn pixels must be in the SRAM before the DMA2D reads them */
+	SCB_CleanDCache_by_Addr((void *)pixels, (int32_t)bytes);
+
+	tick = HAL_GetTick();
+	t0 = DWT->CYCCNT;
+	while (!fb_strip_can_copy(y, height))
+	{
+		if (HAL_GetTick() - tick > FB_STRIP_TIMEOUT_MS)
+		{
+			fb_strip_stats.timeouts++;
+			break;
+		}
+	}
+	cycles = DWT->CYCCNT - t0;
+	if (cycles > fb_strip_stats.wait_cycles_max)
+		fb_strip_stats.wait_cycles_max = cycles;
+
+	/* Plain M2M, the block and the framebuffer are both ARGB8888 */
+	t0 = DWT->CYCCNT;
+	WRITE_REG(DMA2D->IFCR, DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTEIF | DMA2D_IFCR_CCEIF);
+	WRITE_REG(DMA2D->FGMAR, (uint32_t)pixels);
+	WRITE_REG(DMA2D->FGOR, 0U);
+	WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_ARGB8888);
+	WRITE_REG(DMA2D->OMAR, (uint32_t)(fb_base + (uint32_t)y * fb_stride + (uint32_t)x * fb_bpp));
+	WRITE_REG(DMA2D->OOR, fb_stride / fb_bpp - width);
+	WRITE_REG(DMA2D->OPFCCR, DMA2D_OUTPUT_ARGB8888);
+	WRITE_REG(DMA2D->NLR, height | ((uint32_t)width << DMA2D_NLR_PL_Pos));
+	WRITE_REG(DMA2D->CR, DMA2D_M2M | DMA2D_CR_START);
+
+	tick = HAL_GetTick();
+	while ((DMA2D->ISR & (DMA2D_ISR_TCIF | DMA2D_ISR_TEIF | DMA2D_ISR_CEIF)) == 0)
+	{
+		if (HAL_GetTick() - tick > FB_STRIP_TIMEOUT_MS)
+		{
+			SET_BIT(DMA2D->CR, DMA2D_CR_ABORT);
+			fb_strip_stats.timeouts++;
+			ret = FB_STRIP_TIMEOUT;
+			break;
+		}
+	}
+	if (DMA2D->ISR & (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF))
+		ret = FB_STRIP_ERROR;
+	WRITE_REG(DMA2D->IFCR, DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTEIF | DMA2D_IFCR_CCEIF);
+
+	cycles = DWT->CYCCNT - t0;
+	if (cycles > fb_strip_stats.copy_cycles_max)
+		fb_strip_stats.copy_cycles_max = cycles;
+
+	if (ret == FB_STRIP_OK)
+	{
+		fb_strip_stats.strips++;
+		fb_strip_stats.bytes += bytes;
+	}
+	else
+	{
+		fb_strip_stats.dropped++;
+	}
+	return ret;
+}
+
+void fb_strip_end_frame(void)
+{
+	fb_strip_stats.frames++;
+}
+
+void fb_strip_reset(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	memset((void *)&fb_strip_stats, 0, sizeof(fb_strip_stats));
+	fb_strip_stats.start_tick = HAL_GetTick();
+	__set_PRIMASK(primask);
+}
+
+void fb_strip_print(void)
+{
+	fb_strip_stats_t s;
+	uint32_t mhz = SystemCoreClock / 1000000U;
+	uint32_t primask = __get_PRIMASK();
+	uint32_t ms;
+
+	__disable_irq();
+	memcpy(&s, (const void *)&fb_strip_stats, sizeof(s));
+	__set_PRIMASK(primask);
+
+	ms = HAL_GetTick() - s.start_tick;
+	if (s.frames == 0 || ms == 0 || mhz == 0)
+		return;
+
+	printf("\r\nfb strip: %lu frames in %lu ms (%lu.%lu fps), %lu strips, %lu timeouts, %lu dropped\r\n",
+			s.frames, ms, s.frames * 1000U / ms, (s.frames * 10000U / ms) % 10U,
+			s.strips, s.timeouts, s.dropped);
+	printf("written %lu KB/frame, %lu KB/s of PSRAM, wait max %lu us, copy max %lu us\r\n",
+			(uint32_t)(s.bytes / s.frames / 1024U),
+			(uint32_t)(s.bytes * 1000U / ms / 1024U),
+			s.wait_cycles_max / mhz, s.copy_cycles_max / mhz);
+}
@@ -0,0 +1,248 @@
+/*
+ * frame_prof.c
+ *
+ * Frame profiler of the TouchGFX rendering, see frame_prof.h
+ */
+#include "frame_prof.h"
+#include "dma2d_batch.h"
+#include "idle_sleep.h"
+#include "main.h"
+#include <stdio.h>
+#include <string.h>
+
+#define FRAME_PROF_MASK             (FRAME_PROF_DEPTH - 1U)
+
+#if (FRAME_PROF_DEPTH & FRAME_PROF_MASK) != 0
+#error "FRAME_PROF_DEPTH must be a power of two"
+#endif
+
+static frame_prof_record_t ring[FRAME_PROF_DEPTH];
+static uint32_t head;                           /* Next record to fill */
+static uint32_t count;                          /* Complete records */
+
+/* Record of the last begun frame, late GPU2D completions still land in it */
+static frame_prof_record_t *volatile current;
+
+static volatile uint32_t last_vsync;
+static volatile uint32_t vsync_count;
+static uint32_t frame_vsync_count;              /* vsync_count at the previous frame */
+static uint32_t missed_total;
+static uint64_t dma2d_busy_start;
+static uint8_t started;                         /* A frame was seen since the reset */
+
+/* Copy of the window for frame_prof_print, housekeeping task only */
+static frame_prof_record_t print_records[FRAME_PROF_DEPTH];
+
+#if FRAME_PROF_ENABLE
+static uint64_t dma2d_busy(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	uint64_t busy;
+
+	__disable_irq();
+	busy = dma2d_batch_stats.busy_cycles;
+	__set_PRIMASK(primask);
+	return busy;
+}
+
+void frame_prof_vsync(void)
+{
+	last_vsync = idle_sleep_cycles();
+	vsync_count++;
+}
+
+void frame_prof_begin(void)
+{
+	frame_prof_record_t *r = &ring[head];
+	uint32_t vsyncs = vsync_count - frame_vsync_count;
+
+	memset(r, 0, sizeof(*r));
+	r->render_start = idle_sleep_cycles();
+	r->vsync = last_vsync;
+
+	frame_vsync_count += vsyncs;
+	if (!started)
+	{
+		vsyncs = 1;
+		started = 1;
+	}
+	r->vsyncs = (vsyncs > 0xFFFFU) ? 0xFFFFU : (uint16_t)vsyncs;
+	if (vsyncs > 1)
+		missed_total += vsyncs - 1;
+
+	dma2d_busy_start = dma2d_busy();
+	current = r;
+}
+
+void frame_prof_tick(void)
+{
+	frame_prof_record_t *r = current;
+
+	if (r != NULL && r->tick == 0)
+		r->tick = idle_sleep_cycles();
+}
+
+void frame_prof_gpu2d_submit(void)
+{
+	frame_prof_record_t *r = current;
+
+	if (r == NULL)
+		return;
+	if (r->gpu2d_lists == 0)
+		r->gpu2d_submit = idle_sleep_cycles();
+	r->gpu2d_lists++;
+}
+
+void frame_prof_gpu2d_done(void)
+{
+	frame_prof_record_t *r = current;
+
+	if (r != NULL && r->gpu2d_lists != 0)
+		r->gpu2d_done = idle_sleep_cycles();
+}
+
+void frame_prof_flush(void)
+{
+	frame_prof_record_t *r = current;
+
+	if (r != NULL)
+		r->flush = idle_sleep_cycles();
+}
+
+void frame_prof_end(void)
+{
+	frame_prof_record_t *r = current;
+	uint64_t busy = dma2d_busy();
+	uint32_t primask;
+
+	if (r != &ring[head])
+		return;
+
+	r->render_end = idle_sleep_cycles();
+	/* dma2d_batch_reset in the middle of the frame */
+	r->dma2d_busy = (busy >= dma2d_busy_start) ? (uint32_t)(busy - dma2d_busy_start) : 0;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	head = (head + 1U) & FRAME_PROF_MASK;
+	if (count < FRAME_PROF_DEPTH - 1U)
+		count++;
+	__set_PRIMASK(primask);
+}
+#endif
+
+uint32_t frame_prof_read(frame_prof_record_t *records, uint32_t max)
+{
+	uint32_t primask = __get_PRIMASK();
+	uint32_t n, first;
+
+	__disable_irq();
+	n = (count < max) ? count : max;
+	first = (head - n) & FRAME_PROF_MASK;
+	for (uint32_t i = 0; i < n; i++)
+		records[i] = ring[(first + i) & FRAME_PROF_MASK];
+	__set_PRIMASK(primask);
+	return n;
+}
+
+static uint32_t render_time(const frame_prof_record_t *r)
+{
+	return r->render_end - r->render_start;
+}
+
+void frame_prof_summary(frame_prof_summary_t *summary, frame_prof_record_t *records, uint32_t max)
+{
+	uint32_t mhz = SystemCoreClock / 1000000U;
+	uint32_t primask;
+	uint64_t render = 0, latency = 0, gpu2d = 0, dma2d = 0;
+	uint32_t gpu2d_frames = 0;
+	uint32_t n;
+
+	memset(summary, 0, sizeof(*summary));
+
+	/* The hooks keep writing the ring, only the copy is read below */
+	n = frame_prof_read(records, max);
+	primask = __get_PRIMASK();
+	__disable_irq();
+	summary->missed_total = missed_total;
+	__set_PRIMASK(primask);
+
+	if (n == 0 || mhz == 0)
+		return;
+
+	for (uint32_t i = 0; i < n; i++)
+	{
+		const frame_prof_record_t *r = &records[i];
+
+		render += render_time(r);
+		latency += r->render_end - r->vsync;
+		dma2d += r->dma2d_busy;
+		if (r->gpu2d_lists != 0 && r->gpu2d_done != 0)
+		{
+			gpu2d += r->gpu2d_done - r->gpu2d_submit;
+			gpu2d_frames++;
+		}
+		if (r->vsyncs > 1)
+			summary->missed_window += r->vsyncs - 1U;
+	}
+
+	summary->frames = n;
+	if (n > 1)
+	{
+		uint32_t span = records[n - 1U].render_start - records[0].render_start;
+
+		if (span != 0)
+			summary->fps_x10 = (uint32_t)(((uint64_t)(n - 1U) * 10U * SystemCoreClock) / span);
+	}
+
+	/* Insertion sort on the render time, the window is small and this runs twice a second */
+	for (uint32_t i = 1; i < n; i++)
+	{
+		frame_prof_record_t v = records[i];
+		uint32_t j = i;
+
+		while (j > 0 && render_time(&records[j - 1]) > render_time(&v))
+		{
+			records[j] = records[j - 1];
+			j--;
+		}
+		records[j] = v;
+	}
+
+	summary->render_us_avg = (uint32_t)(render / n / mhz);
+	summary->render_us_p99 = render_time(&records[(n * 99U) / 100U]) / mhz;
+	summary->render_us_max = render_time(&records[n - 1U]) / mhz;
+	summary->vsync_us_avg = (uint32_t)(latency / n / mhz);
+	summary->dma2d_us_avg = (uint32_t)(dma2d / n / mhz);
+	if (gpu2d_frames != 0)
+		summary->gpu2d_us_avg = (uint32_t)(gpu2d / gpu2d_frames / mhz);
+}
+
+void frame_prof_reset(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	head = 0;
+	count = 0;
+	current = NULL;
+	missed_total = 0;
+	started = 0;
+	frame_vsync_count = vsync_count;
+	__set_PRIMASK(primask);
+}
+
+void frame_prof_print(void)
+{
+	frame_prof_summary_t s;
+
+	frame_prof_summary(&s, print_records, FRAME_PROF_DEPTH);
+	if (s.frames == 0)
+		return;
+
+	printf("\r\nframes: %lu.%lu fps over %lu, render %lu us avg, %lu us p99, %lu us max\r\n",
+			s.fps_x10 / 10U, s.fps_x10 % 10U, s.frames,
+			s.render_us_avg, s.render_us_p99, s.render_us_max);
+	printf("vsync to ready %lu us, gpu2d %lu us, dma2d %lu us, missed vsync %lu (%lu total)\r\n",
+			s.vsync_us_avg, s.gpu2d_us_avg, s.dma2d_us_avg, s.missed_window, s.missed_total);
+}
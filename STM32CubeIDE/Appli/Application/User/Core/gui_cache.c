@@ -0,0 +1,62 @@
+/*
+ * gui_cache.c
+ *
+ * Retained GUI rendering statistics, see gui_cache.h
+ */
+#include "gui_cache.h"
+#include "main.h"
+#include <stdio.h>
+#include <string.h>
+
+volatile gui_cache_stats_t gui_cache_stats;
+
+void gui_cache_frame(uint32_t cycles)
+{
+	gui_cache_stats.frames++;
+	gui_cache_stats.frame_cycles += cycles;
+	if (cycles > gui_cache_stats.frame_cycles_max)
+		gui_cache_stats.frame_cycles_max = cycles;
+}
+
+void gui_cache_render(uint32_t cycles)
+{
+	gui_cache_stats.renders++;
+	gui_cache_stats.render_cycles += cycles;
+}
+
+void gui_cache_replay(void)
+{
+	gui_cache_stats.replays++;
+}
+
+void gui_cache_reset(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	memset((void *)&gui_cache_stats, 0, sizeof(gui_cache_stats));
+	gui_cache_stats.start_tick = HAL_GetTick();
+	__set_PRIMASK(primask);
+}
+
+void gui_cache_print(void)
+{
+	gui_cache_stats_t s;
+	uint32_t mhz = SystemCoreClock / 1000000U;
+	uint32_t primask = __get_PRIMASK();
+	uint32_t ms;
+
+	__disable_irq();
+	memcpy(&s, (const void *)&gui_cache_stats, sizeof(s));
+	__set_PRIMASK(primask);
+
+	ms = HAL_GetTick() - s.start_tick;
+	if (s.frames == 0 || ms == 0 || mhz == 0)
+		return;
+
+	printf("\r\ngui cache %s: %lu frames, cpu %lu us/frame avg, %lu us max\r\n",
+			GUI_CACHE_ENABLE ? "on" : "off", s.frames,
+			(uint32_t)(s.frame_cycles / s.frames / mhz), s.frame_cycles_max / mhz);
+	printf("%lu renders (%lu us total), %lu replays\r\n",
+			s.renders, (uint32_t)(s.render_cycles / mhz), s.replays);
+}
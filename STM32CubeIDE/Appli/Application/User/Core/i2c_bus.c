@@ -0,0 +1,384 @@
+/*
+ * i2c_bus.c
+ *
+ * I2C1 bus manager, see i2c_bus.h
+ */
+#include "i2c_bus.h"
+#include "cmsis_os2.h"
+#include <stdio.h>
+#include <string.h>
+
+#define I2C_BUS_TASK_PRIORITY       (osPriorityHigh)
+#define I2C_BUS_TASK_STACK_SIZE     (256 * 4)
+
+#define I2C_BUS_FLAG_KICK           (0x0001U)
+#define I2C_BUS_FLAG_DONE           (0x0002U)
+#define I2C_BUS_FLAG_ERROR          (0x0004U)
+
+volatile i2c_bus_stats_t i2c_bus_stats;
+
+static I2C_HandleTypeDef *bus;
+static osThreadId_t bus_task;
+static i2c_bus_xfer_t *queue;
+static uint32_t queue_depth;
+
+static const osThreadAttr_t bus_task_attributes = {
+	.name = "i2c_bus",
+	.stack_size = I2C_BUS_TASK_STACK_SIZE,
+	.priority = (osPriority_t) I2C_BUS_TASK_PRIORITY,
+};
+
+static i2c_bus_xfer_t *queue_pop(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	i2c_bus_xfer_t *x;
+
+	__disable_irq();
+	x = queue;
+	if (x != NULL)
+	{
+		queue = x->next;
+		queue_depth--;
+	}
+	__set_PRIMASK(primask);
+	return x;
+}
+
+/* Head of the queue if it outranks priority, the queue is sorted */
+static i2c_bus_xfer_t *queue_pop_above(uint8_t priority)
+{
+	uint32_t primask = __get_PRIMASK();
+	i2c_bus_xfer_t *x;
+
+	__disable_irq();
+	x = queue;
+	if (x != NULL && x->priority > priority)
+	{
+		queue = x->next;
+		queue_depth--;
+	}
+	else
+		x = NULL;
+	__set_PRIMASK(primask);
+	return x;
+}
+
+/* One HAL transfer, waits for the completion interrupt */
+static int run_one(const i2c_bus_xfer_t *x, uint16_t reg, uint8_t *data, uint16_t length)
+{
+	HAL_StatusTypeDef hal;
+	uint32_t flags;
+
+	osThreadFlagsClear(I2C_BUS_FLAG_DONE | I2C_BUS_FLAG_ERROR);
+	if (x->read)
+		hal = HAL_I2C_Mem_Read_IT(bus, x->addr, reg, x->reg_size, data, length);
+	else
+		hal = HAL_I2C_Mem_Write_IT(bus, x->addr, reg, x->reg_size, data, length);
+	if (hal != HAL_OK)
+		return I2C_BUS_ERROR;
+
+	flags = osThreadFlagsWait(I2C_BUS_FLAG_DONE | I2C_BUS_FLAG_ERROR, osFlagsWaitAny, I2C_BUS_TIMEOUT_MS);
+	if (flags & osFlagsError)
+	{
+		/* No completion: start over from a clean peripheral */
+		HAL_I2C_DeInit(bus);
+		HAL_I2C_Init(bus);
+		return I2C_BUS_TIMEOUT;
+	}
+	return (flags & I2C_BUS_FLAG_ERROR) ? I2C_BUS_ERROR : I2C_BUS_OK;
+}
+
+static void finish(i2c_bus_xfer_t *x, int status);
+
+static int run(i2c_bus_xfer_t *x)
+{
+	const uint32_t record = x->reg_size + x->length;
+	int status = I2C_BUS_OK;
+
+	if (x->records == 0)
+		return run_one(x, x->reg, x->data, x->length);
+
+	/* Batch: one write per record, without going back to the queue. Only a
+	   transfer of higher priority goes in between, the touch waits for one
+	   record at most */
+	for (uint32_t i = 0; i < x->records && status == I2C_BUS_OK; i++)
+	{
+		uint8_t *r = &x->data[i * record];
+		uint16_t reg = (x->reg_size == I2C_MEMADD_SIZE_16BIT) ? ((r[0] << 8) | r[1]) : r[0];
+		i2c_bus_xfer_t *u;
+
+		while (i > 0 && (u = queue_pop_above(x->priority)) != NULL)
+			finish(u, run(u));
+		status = run_one(x, reg, r + x->reg_size, x->length);
+	}
+	return status;
+}
+
+static void account(const i2c_bus_xfer_t *x, int status)
+{
+	volatile i2c_bus_client_stats_t *s;
+	uint32_t latency = DWT->CYCCNT - x->queued;
+
+	if (x->client >= I2C_BUS_CLIENTS)
+		return;
+
+	s = &i2c_bus_stats.client[x->client];
+	s->transfers++;
+	if (status == I2C_BUS_TIMEOUT)
+		s->timeouts++;
+	else if (status != I2C_BUS_OK)
+		s->errors++;
+	s->latency_cycles += latency;
+	if (latency > s->latency_cycles_max)
+		s->latency_cycles_max = latency;
+}
+
+static void finish(i2c_bus_xfer_t *x, int status)
+{
+	account(x, status);
+	x->status = status;
+	x->busy = 0;
+	if (x->done != NULL)
+		x->done(x, status);
+}
+
+static void bus_task_entry(void *argument)
+{
+	(void)argument;
+
+	for (;;)
+	{
+		i2c_bus_xfer_t *x;
+
+		osThreadFlagsWait(I2C_BUS_FLAG_KICK, osFlagsWaitAny, osWaitForever);
+		while ((x = queue_pop()) != NULL)
+			finish(x, run(x));
+	}
+}
+
+int i2c_bus_init(I2C_HandleTypeDef *hi2c)
+{
+	if (bus_task != NULL)
+		return I2C_BUS_OK;
+
+	// Latency is measured with the cycle counter
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	bus = hi2c;
+	i2c_bus_reset();
+
+	HAL_NVIC_SetPriority(I2C1_EV_IRQn, 5, 0);
+	HAL_NVIC_EnableIRQ(I2C1_EV_IRQn);
+	HAL_NVIC_SetPriority(I2C1_ER_IRQn, 5, 0);
+	HAL_NVIC_EnableIRQ(I2C1_ER_IRQn);
+
+	bus_task = osThreadNew(bus_task_entry, NULL, &bus_task_attributes);
+	if (bus_task == NULL)
+		return I2C_BUS_NO_RESOURCES;
+
+	// Transfers queued before the task existed
+	osThreadFlagsSet(bus_task, I2C_BUS_FLAG_KICK);
+	return I2C_BUS_OK;
+}
+
+int i2c_bus_submit(i2c_bus_xfer_t *xfer)
+{
+	uint32_t primask;
+	i2c_bus_xfer_t **p;
+
+	if (xfer == NULL || xfer->data == NULL || xfer->length == 0)
+		return I2C_BUS_INVALID_PARAM;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	if (xfer->busy)
+	{
+		__set_PRIMASK(primask);
+		return I2C_BUS_BUSY;
+	}
+	xfer->busy = 1;
+	xfer->status = I2C_BUS_OK;
+	xfer->queued = DWT->CYCCNT;
+
+	/* After every queued transfer of the same or higher priority */
+	p = &queue;
+	while (*p != NULL && (*p)->priority >= xfer->priority)
+		p = &(*p)->next;
+	xfer->next = *p;
+	*p = xfer;
+
+	queue_depth++;
+	if (queue_depth > i2c_bus_stats.queue_max)
+		i2c_bus_stats.queue_max = queue_depth;
+	__set_PRIMASK(primask);
+
+	if (bus_task != NULL)
+		osThreadFlagsSet(bus_task, I2C_BUS_FLAG_KICK);
+	return I2C_BUS_OK;
+}
+
+static void wake_caller(i2c_bus_xfer_t *xfer, int status)
+{
+	(void)status;
+	osThreadFlagsSet((osThreadId_t)xfer->ctx, I2C_BUS_FLAG_WAIT);
+}
+
+int i2c_bus_transfer(i2c_bus_xfer_t *xfer)
+{
+	int status;
+
+	xfer->done = wake_caller;
+	xfer->ctx = osThreadGetId();
+	osThreadFlagsClear(I2C_BUS_FLAG_WAIT);
+
+	status = i2c_bus_submit(xfer);
+	if (status != I2C_BUS_OK)
+		return status;
+
+	osThreadFlagsWait(I2C_BUS_FLAG_WAIT, osFlagsWaitAny, osWaitForever);
+	return xfer->status;
+}
+
+static int32_t codec_access(uint8_t read, uint16_t addr, uint16_t reg, uint8_t *data, uint16_t length)
+{
+	i2c_bus_xfer_t xfer;
+
+	memset(&xfer, 0, sizeof(xfer));
+	xfer.client = I2C_BUS_CLIENT_CODEC;
+	xfer.priority = I2C_BUS_PRIO_CODEC;
+	xfer.read = read;
+	xfer.reg_size = I2C_MEMADD_SIZE_8BIT;
+	xfer.addr = addr;
+	xfer.reg = reg;
+	xfer.data = data;
+	xfer.length = length;
+
+	return (i2c_bus_transfer(&xfer) == I2C_BUS_OK) ? 0 : -1;
+}
+
+int32_t i2c_bus_codec_write(uint16_t addr, uint16_t reg, uint8_t *data, uint16_t length)
+{
+	return codec_access(0, addr, reg, data, length);
+}
+
+int32_t i2c_bus_codec_read(uint16_t addr, uint16_t reg, uint8_t *data, uint16_t length)
+{
+	return codec_access(1, addr, reg, data, length);
+}
+
+int32_t i2c_bus_codec_batch(uint16_t addr, uint8_t *records, uint16_t count)
+{
+	i2c_bus_xfer_t xfer;
+
+	if (count == 0)
+		return 0;
+
+	memset(&xfer, 0, sizeof(xfer));
+	xfer.client = I2C_BUS_CLIENT_CODEC;
+	xfer.priority = I2C_BUS_PRIO_CODEC;
+	xfer.reg_size = I2C_MEMADD_SIZE_8BIT;
+	xfer.addr = addr;
+	xfer.data = records;
+	xfer.length = 2;
+	xfer.records = count;
+
+	return (i2c_bus_transfer(&xfer) == I2C_BUS_OK) ? 0 : -1;
+}
+
+void i2c_bus_batch_init(i2c_bus_batch_t *batch, uint16_t addr)
+{
+	memset(&batch->xfer, 0, sizeof(batch->xfer));
+	batch->xfer.client = I2C_BUS_CLIENT_CODEC;
+	batch->xfer.priority = I2C_BUS_PRIO_CODEC;
+	batch->xfer.reg_size = I2C_MEMADD_SIZE_8BIT;
+	batch->xfer.addr = addr;
+	batch->xfer.data = batch->data;
+	batch->xfer.length = 2;
+	batch->count = 0;
+}
+
+int i2c_bus_batch_write(i2c_bus_batch_t *batch, uint8_t reg, uint16_t value)
+{
+	uint8_t *r;
+
+	if (batch->count >= I2C_BUS_BATCH_MAX)
+		return I2C_BUS_NO_RESOURCES;
+
+	/* WM8904 registers are 16 bit, MSB first */
+	r = &batch->data[batch->count * 3U];
+	r[0] = reg;
+	r[1] = (uint8_t)(value >> 8);
+	r[2] = (uint8_t)value;
+	batch->count++;
+	return I2C_BUS_OK;
+}
+
+int i2c_bus_batch_submit(i2c_bus_batch_t *batch)
+{
+	int status;
+
+	if (batch->count == 0)
+		return I2C_BUS_OK;
+
+	batch->xfer.records = batch->count;
+	status = i2c_bus_transfer(&batch->xfer);
+	batch->count = 0;
+	return status;
+}
+
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c == bus && bus_task != NULL)
+		osThreadFlagsSet(bus_task, I2C_BUS_FLAG_DONE);
+}
+
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c == bus && bus_task != NULL)
+		osThreadFlagsSet(bus_task, I2C_BUS_FLAG_DONE);
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c == bus && bus_task != NULL)
+		osThreadFlagsSet(bus_task, I2C_BUS_FLAG_ERROR);
+}
+
+void i2c_bus_reset(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	memset((void *)&i2c_bus_stats, 0, sizeof(i2c_bus_stats));
+	i2c_bus_stats.start_tick = HAL_GetTick();
+	__set_PRIMASK(primask);
+}
+
+void i2c_bus_print(void)
+{
+	static const char *const names[I2C_BUS_CLIENTS] = { "touch", "codec" };
+	i2c_bus_stats_t s;
+	uint32_t mhz = SystemCoreClock / 1000000U;
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	memcpy(&s, (const void *)&i2c_bus_stats, sizeof(s));
+	__set_PRIMASK(primask);
+
+	if (mhz == 0)
+		return;
+
+	printf("\r\ni2c1: %lu ms, queue max %lu\r\n", HAL_GetTick() - s.start_tick, s.queue_max);
+	for (uint32_t i = 0; i < I2C_BUS_CLIENTS; i++)
+	{
+		const i2c_bus_client_stats_t *c = &s.client[i];
+
+		if (c->transfers == 0)
+			continue;
+		printf("%s: %lu transfers, %lu errors, %lu timeouts, latency %lu us avg, %lu us max\r\n",
+				names[i], c->transfers, c->errors, c->timeouts,
+				(uint32_t)(c->latency_cycles / c->transfers / mhz), c->latency_cycles_max / mhz);
+	}
+}
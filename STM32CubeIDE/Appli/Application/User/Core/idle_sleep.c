@@ -0,0 +1,205 @@
+/*
+ * idle_sleep.c
+ *
+ * Idle sleep and tickless idle hooks, see idle_sleep.h
+ */
+#include "idle_sleep.h"
+#include "FreeRTOS.h"
+#include <stdio.h>
+#include <string.h>
+
+/* HAL time base, stm32h7rsxx_hal_timebase_tim.c */
+extern TIM_HandleTypeDef htim6;
+
+volatile idle_sleep_stats_t idle_sleep_stats;
+
+volatile uint32_t idle_sleep_slept_cycles;
+
+/* Last occurrence and period of each wake source, in idle_sleep_cycles */
+static volatile uint32_t event_last[IDLE_SLEEP_SOURCES];
+static volatile uint32_t event_period[IDLE_SLEEP_SOURCES];
+
+/* Tickless sleep in progress */
+static uint32_t sleep_load;
+static uint32_t sleep_tim_start;
+
+/* A debugger may set DBG_SLEEP too: checked at each sleep, not at build time */
+static void idle_sleep_account(uint32_t cycles)
+{
+	if ((DBGMCU->CR & DBGMCU_CR_DBG_SLEEP) == 0U)
+		idle_sleep_slept_cycles += cycles;
+}
+
+void idle_sleep_event(idle_sleep_source_t source)
+{
+	uint32_t primask = __get_PRIMASK();
+	uint32_t now;
+
+	__disable_irq();
+	now = idle_sleep_cycles();
+	if (event_last[source] != 0U)
+		event_period[source] = now - event_last[source];
+	event_last[source] = now;
+	__set_PRIMASK(primask);
+}
+
+/* Cycles until the first predicted interrupt, UINT32_MAX when none is */
+static uint32_t idle_sleep_next_event(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	uint32_t next = UINT32_MAX;
+	uint32_t now;
+
+	__disable_irq();
+	now = idle_sleep_cycles();
+	for (uint32_t i = 0; i < IDLE_SLEEP_SOURCES; i++)
+	{
+		uint32_t period = event_period[i];
+		uint32_t since = now - event_last[i];
+
+		// Stopped source: the audio at the end of the stream, the LTDC off
+		if (period == 0U || since / 2U > period)
+			continue;
+		if (since >= period)
+		{
+			// Overdue, any moment now
+			next = 0;
+			break;
+		}
+		if (period - since < next)
+			next = period - since;
+	}
+	__set_PRIMASK(primask);
+	return next;
+}
+
+void idle_sleep_wfi(void)
+{
+	uint32_t v0;
+	uint32_t v1;
+
+	// Masked: the wakeup is measured before the interrupt runs
+	__disable_irq();
+	v0 = SysTick->VAL;
+	__DSB();
+	__WFI();
+	__ISB();
+	v1 = SysTick->VAL;
+
+	// SysTick counts down, a reload in between means the tick woke us
+	v0 = v0 >= v1 ? v0 - v1 : v0 + (SysTick->LOAD + 1U - v1);
+	idle_sleep_account(v0);
+	idle_sleep_stats.wfi++;
+	idle_sleep_stats.wfi_cycles += v0;
+	__enable_irq();
+}
+
+void idle_sleep_pre_suppress(uint32_t *ticks)
+{
+	uint32_t next = idle_sleep_next_event();
+	uint32_t limit;
+
+	if (next == UINT32_MAX)
+		return;
+
+	limit = next / (SystemCoreClock / configTICK_RATE_HZ);
+	if (limit < IDLE_SLEEP_MIN_TICKS)
+	{
+		*ticks = 0;
+		idle_sleep_stats.refused++;
+	}
+	else if (limit + 1U < *ticks)
+	{
+		// The tick in progress plus the whole ticks up to the interrupt
+		*ticks = limit + 1U;
+		idle_sleep_stats.shortened++;
+	}
+}
+
+void idle_sleep_pre(uint32_t *ticks)
+{
+	(void)ticks;
+
+	// SysTick was just restarted from 0 with the length of the sleep
+	sleep_load = SysTick->LOAD;
+	sleep_tim_start = htim6.Instance->CNT;
+	HAL_SuspendTick();
+}
+
+void idle_sleep_post(uint32_t ticks)
+{
+	uint32_t period = htim6.Instance->ARR + 1U;
+	uint32_t cycles = sleep_load - SysTick->VAL;
+	uint32_t elapsed;
+	uint32_t update;
+	uint32_t count;
+	uint32_t wraps;
+
+	(void)ticks;
+
+	// Not the CTRL count flag: the port reads it after this hook
+	if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+		cycles += sleep_load + 1U;
+
+	idle_sleep_account(cycles);
+	idle_sleep_stats.tickless++;
+	idle_sleep_stats.tickless_cycles += cycles;
+	if (cycles > idle_sleep_stats.tickless_max_cycles)
+		idle_sleep_stats.tickless_max_cycles = cycles;
+
+	// TIM6 kept counting with its interrupt off. The sleep gives the wraps
+	// to within half a period, the counter the exact phase.
+	update = __HAL_TIM_GET_FLAG(&htim6, TIM_FLAG_UPDATE);
+	count = htim6.Instance->CNT;
+	if (!update && __HAL_TIM_GET_FLAG(&htim6, TIM_FLAG_UPDATE))
+	{
+		update = 1;
+		count = htim6.Instance->CNT;
+	}
+	elapsed = cycles / (SystemCoreClock / 1000000U);
+	wraps = (sleep_tim_start + elapsed + period / 2U - count) / period;
+
+	// A pending update is counted by its interrupt, after the resume
+	if (update && wraps > 0U)
+		wraps--;
+	uwTick += wraps * uwTickFreq;
+	HAL_ResumeTick();
+}
+
+void idle_sleep_reset(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+#if IDLE_SLEEP_DEBUG_CLOCK
+	DBGMCU->CR |= DBGMCU_CR_DBG_SLEEP;
+#endif
+	__disable_irq();
+	memset((void *)&idle_sleep_stats, 0, sizeof(idle_sleep_stats));
+	idle_sleep_stats.start_tick = HAL_GetTick();
+	__set_PRIMASK(primask);
+}
+
+void idle_sleep_print(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	uint32_t mhz = SystemCoreClock / 1000000U;
+	idle_sleep_stats_t s;
+	uint32_t ms;
+	uint64_t total;
+
+	__disable_irq();
+	memcpy(&s, (const void *)&idle_sleep_stats, sizeof(s));
+	__set_PRIMASK(primask);
+
+	ms = HAL_GetTick() - s.start_tick;
+	total = (uint64_t)ms * (SystemCoreClock / 1000U);
+	if (total == 0U)
+		total = 1;
+
+	printf("\r\nidle sleep: %lu ms, wfi %lu.%lu%% (%lu), tickless %lu.%lu%% (%lu, max %lu us)\r\n",
+			ms,
+			(uint32_t)(s.wfi_cycles * 100U / total), (uint32_t)(s.wfi_cycles * 1000U / total % 10U), s.wfi,
+			(uint32_t)(s.tickless_cycles * 100U / total), (uint32_t)(s.tickless_cycles * 1000U / total % 10U),
+			s.tickless, s.tickless_max_cycles / mhz);
+	printf("tickless refused %lu, shortened %lu\r\n", s.refused, s.shortened);
+}
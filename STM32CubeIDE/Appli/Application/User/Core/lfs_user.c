@@ -204,3 +204,35 @@ int lfs_read_file(const char *path, uint8_t *buffer, size_t buffer_size, size_t
     lfs_file_close(&g_lfs, &file);
     return 0;
 }
+
+// Open a file for random-access reads (used by streaming clients)
+int lfs_open_file_ro(lfs_file_t *file, const char *path, size_t *size) {
+    int err = lfs_file_open(&g_lfs, file, path, LFS_O_RDONLY);
+    if (err < 0) {
+        printf("lfs_file_open(%s) failed: %d\r\n", path, err);
+        return err;
+    }
+
+    if (size != NULL) {
+        lfs_soff_t file_size = lfs_file_size(&g_lfs, file);
+        if (file_size < 0) {
+            lfs_file_close(&g_lfs, file);
+            return (int)file_size;
+        }
+        *size = (size_t)file_size;
+    }
+    return 0;
+}
+
+// Read 'len' bytes at 'offset', returns bytes read or negative error
+int lfs_read_file_at(lfs_file_t *file, uint32_t offset, uint8_t *buffer, size_t len) {
+    lfs_soff_t pos = lfs_file_seek(&g_lfs, file, (lfs_soff_t)offset, LFS_SEEK_SET);
+    if (pos < 0) {
+        return (int)pos;
+    }
+    return (int)lfs_file_read(&g_lfs, file, buffer, (lfs_size_t)len);
+}
+
+int lfs_close_file(lfs_file_t *file) {
+    return lfs_file_close(&g_lfs, file);
+}
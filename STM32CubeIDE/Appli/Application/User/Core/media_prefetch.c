@@ -0,0 +1,595 @@
+/*
+ * media_prefetch.c
+ *
+ *  Read-ahead engine for sequential media streams.
+ *
+ *  Every open stream owns a handful of blocks from a shared internal SRAM
+ *  pool. The prefetch task keeps those blocks filled with the data right
+ *  after the consumer's read position, so the consumer only pays XSPI
+ *  latency when it outruns the read-ahead or seeks.
+ */
+#include "media_prefetch.h"
+#include "lfs_user.h"
+#include "block_pool.h"
+#include "cmsis_os2.h"
+#include <string.h>
+#include <stdio.h>
+
+#define MEDIA_PF_TASK_PRIORITY     (osPriorityAboveNormal)
+#define MEDIA_PF_TASK_STACK_SIZE   (512 * 4)
+#define MEDIA_PF_IDLE_POLL_MS      (50U)
+#define MEDIA_PF_DMA_TIMEOUT_MS    (20U)
+
+#define MEDIA_PF_FLAG_KICK         (0x0001U)
+#define MEDIA_PF_FLAG_DMA_DONE     (0x0002U)
+
+#define MEDIA_PF_CACHE_LINE        (32U)
+#define MEDIA_PF_TOUCH_DISTANCE    (256U)      /* Lines touched ahead of the copy cursor */
+
+// Block pool in AXI SRAM (cacheable, reachable by HPDMA/GPDMA)
+BLOCK_POOL_DEFINE(media_pf_pool, MEDIA_PF_BLOCK_SIZE, MEDIA_PF_POOL_BLOCKS, AXI, 1);
+
+static media_prefetch_stream_t *media_pf_streams[MEDIA_PF_MAX_STREAMS];
+
+static DMA_HandleTypeDef *media_pf_hdma;
+static volatile int media_pf_dma_status;
+
+static osThreadId_t media_pf_task;
+static osMutexId_t media_pf_mutex;
+
+static const osThreadAttr_t media_pf_task_attributes = {
+	.name = "media_pf",
+	.stack_size = MEDIA_PF_TASK_STACK_SIZE,
+	.priority = (osPriority_t) MEDIA_PF_TASK_PRIORITY,
+};
+
+static const osMutexAttr_t media_pf_mutex_attributes = {
+	.name = "media_pf_mutex",
+	.attr_bits = osMutexPrioInherit,
+};
+
+static void media_pf_task_entry(void *argument);
+
+static inline uint32_t media_pf_min(uint32_t a, uint32_t b)
+{
+	return (a < b) ? a : b;
+}
+
+static inline uint32_t media_pf_cycles(void)
+{
+	return DWT->CYCCNT;
+}
+
+static inline void media_pf_kick(void)
+{
+	if (media_pf_task != NULL)
+	{
+		osThreadFlagsSet(media_pf_task, MEDIA_PF_FLAG_KICK);
+	}
+}
+
+/* Bytes from 'from' forward to 'to', wrapping for looped streams.
+ * Returns UINT32_MAX when 'to' is behind 'from' on a linear stream. */
+static uint32_t media_pf_distance(const media_prefetch_stream_t *s, uint32_t from, uint32_t to)
+{
+	if (to >= from)
+		return to - from;
+
+	return s->loop ? (s->length - from) + to : UINT32_MAX;
+}
+
+static void media_pf_touch_lines(const uint8_t *p, uint32_t len)
+{
+	const volatile uint32_t *line = (const volatile uint32_t *)((uint32_t)p & ~(MEDIA_PF_CACHE_LINE - 1U));
+	const uint8_t *end = p + len;
+
+	while ((const uint8_t *)line < end)
+	{
+		(void)*line;
+		line += MEDIA_PF_CACHE_LINE / sizeof(uint32_t);
+	}
+}
+
+/* CPU copy out of the mapped window. The lines MEDIA_PF_TOUCH_DISTANCE ahead
+ * are touched before each step so the XSPI burst for the next step is
+ * already in flight while the current one is copied. */
+static void media_pf_touch_copy(uint8_t *dst, const uint8_t *src, uint32_t len)
+{
+	uint32_t done = 0;
+
+	media_pf_touch_lines(src, media_pf_min(len, MEDIA_PF_TOUCH_DISTANCE));
+	while (done < len)
+	{
+		uint32_t n = media_pf_min(len - done, MEDIA_PF_TOUCH_DISTANCE);
+		uint32_t next = done + n;
+
+		if (next < len)
+		{
+			media_pf_touch_lines(src + next, media_pf_min(len - next, MEDIA_PF_TOUCH_DISTANCE));
+		}
+		memcpy(dst + done, src + done, n);
+		done = next;
+	}
+}
+
+static void media_pf_dma_cplt(DMA_HandleTypeDef *hdma)
+{
+	(void)hdma;
+	media_pf_dma_status = MEDIA_PF_OK;
+	osThreadFlagsSet(media_pf_task, MEDIA_PF_FLAG_DMA_DONE);
+}
+
+static void media_pf_dma_error(DMA_HandleTypeDef *hdma)
+{
+	(void)hdma;
+	media_pf_dma_status = MEDIA_PF_ERROR;
+	osThreadFlagsSet(media_pf_task, MEDIA_PF_FLAG_DMA_DONE);
+}
+
+// Only called from the prefetch task, completion comes back as a thread flag
+static int media_pf_dma_copy(uint8_t *dst, const uint8_t *src, uint32_t len)
+{
+	uint32_t flags;
+
+	/* Drop whatever the CPU copy may have left in the cache for this block */
+	SCB_InvalidateDCache_by_Addr((uint32_t *)dst, (int32_t)MEDIA_PF_BLOCK_SIZE);
+
+	media_pf_dma_status = MEDIA_PF_NOT_READY;
+	osThreadFlagsClear(MEDIA_PF_FLAG_DMA_DONE);
+	if (HAL_DMA_Start_IT(media_pf_hdma, (uint32_t)src, (uint32_t)dst, len) != HAL_OK)
+		return MEDIA_PF_ERROR;
+
+	flags = osThreadFlagsWait(MEDIA_PF_FLAG_DMA_DONE, osFlagsWaitAny, MEDIA_PF_DMA_TIMEOUT_MS);
+	if ((flags & osFlagsError) != 0U)
+	{
+		HAL_DMA_Abort(media_pf_hdma);
+		return MEDIA_PF_ERROR;
+	}
+
+	SCB_InvalidateDCache_by_Addr((uint32_t *)dst, (int32_t)MEDIA_PF_BLOCK_SIZE);
+	return media_pf_dma_status;
+}
+
+// Caller holds media_pf_mutex for lfs sources
+static int media_pf_fetch(media_prefetch_stream_t *s, uint8_t *dst, uint32_t offset, uint32_t len, uint8_t use_dma)
+{
+	if (s->src == MEDIA_PF_SRC_LFS)
+	{
+		int res = lfs_read_file_at(&s->file, offset, dst, len);
+		return (res == (int)len) ? MEDIA_PF_OK : MEDIA_PF_ERROR;
+	}
+
+	if (use_dma && (media_pf_hdma != NULL))
+	{
+		if (media_pf_dma_copy(dst, s->base + offset, len) == MEDIA_PF_OK)
+			return MEDIA_PF_OK;
+		// DMA failed, fall back to the CPU path for this block
+	}
+
+	media_pf_touch_copy(dst, s->base + offset, len);
+	return MEDIA_PF_OK;
+}
+
+static media_pf_slot_t *media_pf_find_slot(media_prefetch_stream_t *s, uint32_t offset)
+{
+	for (uint8_t i = 0; i < s->nslots; i++)
+	{
+		media_pf_slot_t *slot = &s->slot[i];
+		if ((slot->state == MEDIA_PF_SLOT_READY) &&
+		    (offset >= slot->offset) && (offset < slot->offset + slot->len))
+		{
+			return slot;
+		}
+	}
+	return NULL;
+}
+
+/* A slot may be recycled when it is empty or holds data outside the window
+ * [read block, read block + nslots blocks) the consumer is working in. */
+static media_pf_slot_t *media_pf_free_slot(media_prefetch_stream_t *s, uint32_t read_block)
+{
+	const uint32_t window = (uint32_t)s->nslots * MEDIA_PF_BLOCK_SIZE;
+
+	for (uint8_t i = 0; i < s->nslots; i++)
+	{
+		media_pf_slot_t *slot = &s->slot[i];
+		if (slot->state == MEDIA_PF_SLOT_EMPTY)
+			return slot;
+		if ((slot->state == MEDIA_PF_SLOT_READY) &&
+		    (media_pf_distance(s, read_block, slot->offset) >= window))
+			return slot;
+	}
+	return NULL;
+}
+
+// Top up one stream until its read-ahead distance is covered
+static void media_pf_service(media_prefetch_stream_t *s)
+{
+	const uint32_t window = (uint32_t)s->nslots * MEDIA_PF_BLOCK_SIZE;
+	uint32_t budget = (uint32_t)s->nslots * 2U;   /* bounds the loop on streams shorter than the window */
+
+	while (s->in_use && budget--)
+	{
+		uint32_t read_pos = s->read_pos;
+		uint32_t read_block = read_pos - (read_pos % MEDIA_PF_BLOCK_SIZE);
+		uint32_t ahead;
+		media_pf_slot_t *slot;
+
+		if (s->fill_pos >= s->length)
+		{
+			if (!s->loop)
+				return;
+			s->fill_pos = 0;
+		}
+
+		// Consumer seeked outside what we have been filling: restart at its block
+		ahead = media_pf_distance(s, read_block, s->fill_pos);
+		if (ahead >= window)
+		{
+			s->fill_pos = read_block;
+			ahead = 0;
+		}
+
+		if (ahead > s->ahead_bytes)
+			return;
+
+		// Already resident (e.g. after a short seek back)
+		slot = media_pf_find_slot(s, s->fill_pos);
+		if (slot != NULL)
+		{
+			s->fill_pos = slot->offset + slot->len;
+			continue;
+		}
+
+		slot = media_pf_free_slot(s, read_block);
+		if (slot == NULL)
+			return;
+
+		uint32_t len = media_pf_min(MEDIA_PF_BLOCK_SIZE, s->length - s->fill_pos);
+
+		slot->state = MEDIA_PF_SLOT_FILLING;
+		slot->offset = s->fill_pos;
+		if (media_pf_fetch(s, slot->buf, s->fill_pos, len, 1) != MEDIA_PF_OK)
+		{
+			slot->state = MEDIA_PF_SLOT_EMPTY;
+			return;
+		}
+		slot->len = len;
+		__DMB();
+		slot->state = MEDIA_PF_SLOT_READY;
+
+		s->stats.bytes_prefetched += len;
+		s->fill_pos += len;
+	}
+}
+
+static void media_pf_task_entry(void *argument)
+{
+	(void)argument;
+
+	for (;;)
+	{
+		osThreadFlagsWait(MEDIA_PF_FLAG_KICK, osFlagsWaitAny, MEDIA_PF_IDLE_POLL_MS);
+
+		osMutexAcquire(media_pf_mutex, osWaitForever);
+		for (uint32_t i = 0; i < MEDIA_PF_MAX_STREAMS; i++)
+		{
+			if (media_pf_streams[i] != NULL)
+			{
+				media_pf_service(media_pf_streams[i]);
+			}
+		}
+		osMutexRelease(media_pf_mutex);
+	}
+}
+
+static void media_pf_release_blocks(media_prefetch_stream_t *s)
+{
+	for (uint8_t i = 0; i < s->nslots; i++)
+	{
+		block_pool_free(&media_pf_pool, s->slot[i].buf);
+		s->slot[i].buf = NULL;
+		s->slot[i].state = MEDIA_PF_SLOT_EMPTY;
+	}
+	s->nslots = 0;
+}
+
+static int media_pf_open(media_prefetch_stream_t *s, uint32_t offset, uint32_t rate_bps)
+{
+	uint32_t ahead;
+	uint32_t wanted;
+	int index = -1;
+
+	if (media_pf_task == NULL)
+		return MEDIA_PF_NOT_READY;
+
+	// Keep MEDIA_PF_LEAD_MS of playback ahead, plus the block being consumed
+	ahead = (uint32_t)(((uint64_t)rate_bps * MEDIA_PF_LEAD_MS) / 1000U);
+	wanted = (ahead + MEDIA_PF_BLOCK_SIZE - 1U) / MEDIA_PF_BLOCK_SIZE + 1U;
+	if (wanted < 2U)
+		wanted = 2U;
+	if (wanted > MEDIA_PF_MAX_SLOTS)
+		wanted = MEDIA_PF_MAX_SLOTS;
+
+	osMutexAcquire(media_pf_mutex, osWaitForever);
+
+	for (uint32_t i = 0; i < MEDIA_PF_MAX_STREAMS; i++)
+	{
+		if (media_pf_streams[i] == NULL)
+		{
+			index = (int)i;
+			break;
+		}
+	}
+	if (index < 0)
+	{
+		osMutexRelease(media_pf_mutex);
+		return MEDIA_PF_NO_RESOURCES;
+	}
+
+	s->nslots = 0;
+	while (s->nslots < wanted)
+	{
+		uint8_t *buf = block_pool_alloc(&media_pf_pool);
+
+		if (buf == NULL)
+			break;
+		s->slot[s->nslots].buf = buf;
+		s->slot[s->nslots].state = MEDIA_PF_SLOT_EMPTY;
+		s->nslots++;
+	}
+	if (s->nslots < 2U)
+	{
+		media_pf_release_blocks(s);
+		osMutexRelease(media_pf_mutex);
+		return MEDIA_PF_NO_RESOURCES;
+	}
+
+	s->rate_bps = rate_bps;
+	s->ahead_bytes = media_pf_min(ahead, (uint32_t)(s->nslots - 1U) * MEDIA_PF_BLOCK_SIZE);
+	s->read_pos = offset;
+	s->fill_pos = offset - (offset % MEDIA_PF_BLOCK_SIZE);
+	memset(&s->stats, 0, sizeof(s->stats));
+	s->in_use = 1;
+	media_pf_streams[index] = s;
+
+	osMutexRelease(media_pf_mutex);
+
+	// The task runs above the clients, so this fills the first window right away
+	media_pf_kick();
+	return MEDIA_PF_OK;
+}
+
+int media_prefetch_init(DMA_HandleTypeDef *hdma)
+{
+	if (media_pf_task != NULL)
+		return MEDIA_PF_OK;
+
+	// Stall time is measured with the cycle counter
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	media_pf_hdma = hdma;
+	if (media_pf_hdma != NULL)
+	{
+		media_pf_hdma->XferCpltCallback = media_pf_dma_cplt;
+		media_pf_hdma->XferErrorCallback = media_pf_dma_error;
+	}
+
+	media_pf_mutex = osMutexNew(&media_pf_mutex_attributes);
+	if (media_pf_mutex == NULL)
+		return MEDIA_PF_NO_RESOURCES;
+
+	media_pf_task = osThreadNew(media_pf_task_entry, NULL, &media_pf_task_attributes);
+	if (media_pf_task == NULL)
+		return MEDIA_PF_NO_RESOURCES;
+
+	return MEDIA_PF_OK;
+}
+
+int media_prefetch_open_mapped(media_prefetch_stream_t *stream, const char *name,
+                               const uint8_t *base, uint32_t length,
+                               uint32_t offset, uint32_t rate_bps)
+{
+	if (!stream || !base || length == 0 || offset >= length)
+		return MEDIA_PF_INVALID_PARAM;
+
+	memset(stream, 0, sizeof(*stream));
+	stream->name = name;
+	stream->src = MEDIA_PF_SRC_MAPPED;
+	stream->base = base;
+	stream->length = length;
+
+	return media_pf_open(stream, offset, rate_bps);
+}
+
+int media_prefetch_open_lfs(media_prefetch_stream_t *stream, const char *path,
+                            uint32_t offset, uint32_t rate_bps)
+{
+	size_t size = 0;
+	int err;
+
+	if (!stream || !path)
+		return MEDIA_PF_INVALID_PARAM;
+	if (media_pf_mutex == NULL)
+		return MEDIA_PF_NOT_READY;
+
+	memset(stream, 0, sizeof(*stream));
+	stream->name = path;
+	stream->src = MEDIA_PF_SRC_LFS;
+
+	osMutexAcquire(media_pf_mutex, osWaitForever);
+	err = lfs_open_file_ro(&stream->file, path, &size);
+	osMutexRelease(media_pf_mutex);
+	if (err < 0)
+		return MEDIA_PF_ERROR;
+
+	if (size == 0 || offset >= size)
+	{
+		media_prefetch_close(stream);
+		return MEDIA_PF_INVALID_PARAM;
+	}
+	stream->length = (uint32_t)size;
+
+	err = media_pf_open(stream, offset, rate_bps);
+	if (err != MEDIA_PF_OK)
+	{
+		osMutexAcquire(media_pf_mutex, osWaitForever);
+		lfs_close_file(&stream->file);
+		osMutexRelease(media_pf_mutex);
+	}
+	return err;
+}
+
+void media_prefetch_close(media_prefetch_stream_t *stream)
+{
+	if (!stream || media_pf_mutex == NULL)
+		return;
+
+	osMutexAcquire(media_pf_mutex, osWaitForever);
+	for (uint32_t i = 0; i < MEDIA_PF_MAX_STREAMS; i++)
+	{
+		if (media_pf_streams[i] == stream)
+		{
+			media_pf_streams[i] = NULL;
+		}
+	}
+	media_pf_release_blocks(stream);
+	if (stream->src == MEDIA_PF_SRC_LFS)
+	{
+		lfs_close_file(&stream->file);
+	}
+	stream->in_use = 0;
+	osMutexRelease(media_pf_mutex);
+}
+
+void media_prefetch_set_loop(media_prefetch_stream_t *stream, uint8_t enable)
+{
+	if (stream)
+	{
+		stream->loop = enable;
+		media_pf_kick();
+	}
+}
+
+int media_prefetch_read(media_prefetch_stream_t *stream, uint32_t offset,
+                        uint8_t *dst, uint32_t len)
+{
+	const uint8_t in_isr = (__get_IPSR() != 0U);
+	uint32_t done = 0;
+	uint8_t missed = 0;
+
+	if (!stream || !stream->in_use || !dst)
+		return MEDIA_PF_INVALID_PARAM;
+	if (offset >= stream->length)
+		return 0;
+	if (len > stream->length - offset)
+		len = stream->length - offset;
+
+	while (done < len)
+	{
+		uint32_t pos = offset + done;
+		uint32_t n;
+		media_pf_slot_t *slot;
+
+		// Publish progress first so the slot we copy from is never recycled
+		stream->read_pos = pos;
+
+		slot = media_pf_find_slot(stream, pos);
+		if (slot != NULL)
+		{
+			n = media_pf_min(slot->offset + slot->len - pos, len - done);
+			memcpy(dst + done, slot->buf + (pos - slot->offset), n);
+		}
+		else
+		{
+			uint32_t t0;
+			uint32_t stall;
+			int res;
+
+			n = media_pf_min(MEDIA_PF_BLOCK_SIZE - (pos % MEDIA_PF_BLOCK_SIZE), len - done);
+			missed = 1;
+
+			if (stream->src == MEDIA_PF_SRC_LFS && in_isr)
+			{
+				// littlefs cannot be entered from interrupt context
+				stream->stats.underruns++;
+				break;
+			}
+
+			t0 = media_pf_cycles();
+			if (stream->src == MEDIA_PF_SRC_LFS)
+			{
+				osMutexAcquire(media_pf_mutex, osWaitForever);
+				res = media_pf_fetch(stream, dst + done, pos, n, 0);
+				osMutexRelease(media_pf_mutex);
+			}
+			else
+			{
+				res = media_pf_fetch(stream, dst + done, pos, n, 0);
+			}
+			stall = media_pf_cycles() - t0;
+
+			stream->stats.stall_cycles += stall;
+			if (stall > stream->stats.stall_max_cycles)
+				stream->stats.stall_max_cycles = stall;
+
+			if (res != MEDIA_PF_OK)
+				break;
+		}
+		done += n;
+	}
+
+	if (missed)
+		stream->stats.misses++;
+	else
+		stream->stats.hits++;
+	stream->stats.bytes_read += done;
+
+	media_pf_kick();
+	return (int)done;
+}
+
+void media_prefetch_touch(const media_prefetch_stream_t *stream, uint32_t offset, uint32_t len)
+{
+	if (!stream || !stream->in_use || stream->src != MEDIA_PF_SRC_MAPPED)
+		return;
+	if (offset >= stream->length)
+		return;
+
+	media_pf_touch_lines(stream->base + offset, media_pf_min(len, stream->length - offset));
+}
+
+void media_prefetch_get_stats(const media_prefetch_stream_t *stream, media_pf_stats_t *stats)
+{
+	if (stream && stats)
+	{
+		*stats = stream->stats;
+	}
+}
+
+void media_prefetch_print_stats(void)
+{
+	const uint32_t cycles_per_us = SystemCoreClock / 1000000U;
+
+	for (uint32_t i = 0; i < MEDIA_PF_MAX_STREAMS; i++)
+	{
+		const media_prefetch_stream_t *s = media_pf_streams[i];
+		if (s == NULL)
+			continue;
+
+		uint32_t reads = s->stats.hits + s->stats.misses;
+		uint32_t hit_pct = reads ? (uint32_t)(((uint64_t)s->stats.hits * 100U) / reads) : 0U;
+
+		printf("[prefetch] %s: hit %lu%% (%lu/%lu) stall %lu us (max %lu us) underrun %lu ahead %lu B\r\n",
+		       s->name ? s->name : "?",
+		       (unsigned long)hit_pct,
+		       (unsigned long)s->stats.hits,
+		       (unsigned long)reads,
+		       (unsigned long)(s->stats.stall_cycles / cycles_per_us),
+		       (unsigned long)(s->stats.stall_max_cycles / cycles_per_us),
+		       (unsigned long)s->stats.underruns,
+		       (unsigned long)s->ahead_bytes);
+	}
+}
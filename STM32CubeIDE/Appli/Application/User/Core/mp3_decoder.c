@@ -1,7 +1,57 @@
 // mp3_decoder.c - Implementation
 #include "mp3_decoder.h"
+#include "main.h"
+#include <stdio.h>
 #include <string.h>
 
+volatile mp3_decoder_stats_t mp3_decoder_stats;
+
+/* Helper: Account the duration of one decoded frame */
+static void frame_decoded(uint32_t cycles)
+{
+    if (mp3_decoder_stats.frames == 0 || cycles < mp3_decoder_stats.cycles_min) {
+        mp3_decoder_stats.cycles_min = cycles;
+    }
+    if (cycles > mp3_decoder_stats.cycles_max) {
+        mp3_decoder_stats.cycles_max = cycles;
+    }
+    mp3_decoder_stats.cycles += cycles;
+    mp3_decoder_stats.frames++;
+}
+
+/* Helper: Pointer to the input at the current position and bytes available.
+ * With a prefetch source the data is staged through input_window, which is
+ * refilled once fewer than MP3_INPUT_WINDOW_REFILL bytes are left in it. */
+static const uint8_t* get_input(mp3_decoder_streaming_t *handle, size_t *available)
+{
+    size_t position = handle->mp3_data_position;
+    
+    if (handle->source == NULL) {
+        *available = handle->mp3_data_length - position;
+        return handle->mp3_data + position;
+    }
+    
+    size_t window_end = handle->window_start + handle->window_length;
+    if (position < handle->window_start || position >= window_end ||
+        (window_end - position < MP3_INPUT_WINDOW_REFILL && window_end < handle->mp3_data_length)) {
+        int n = media_prefetch_read(handle->source, (uint32_t)position,
+                                    handle->input_window, MP3_INPUT_WINDOW_SIZE);
+        handle->window_start = position;
+        handle->window_length = (n > 0) ? (size_t)n : 0;
+        window_end = position + handle->window_length;
+    }
+    
+    *available = window_end - position;
+    
+    /* A short window that is not the end of the stream is an underrun;
+       handing minimp3 a truncated frame would make it lose sync */
+    if (*available < MP3_INPUT_WINDOW_REFILL && window_end < handle->mp3_data_length) {
+        handle->window_length = 0;
+        *available = 0;
+    }
+    return handle->input_window + (position - handle->window_start);
+}
+
 /* Helper: Decode MP3 frames to fill chunk */
 static int decode_to_fill_chunk(mp3_decoder_streaming_t *handle, 
                                 int16_t *chunk_buffer, 
@@ -26,14 +76,25 @@ static int decode_to_fill_chunk(mp3_decoder_streaming_t *handle,
             }
         }
         
+        /* Source could not deliver in time (prefetch underrun) - output silence */
+        size_t available;
+        const uint8_t *input = get_input(handle, &available);
+        if (available == 0) {
+            memset(&chunk_buffer[samples_written], 0,
+                   (chunk_size - samples_written) * sizeof(int16_t));
+            return MP3_DEC_OK;
+        }
+        
         /* Decode one frame */
+        uint32_t t0 = DWT->CYCCNT;
         int samples = mp3dec_decode_frame(
             &handle->decoder,
-            handle->mp3_data + handle->mp3_data_position,
-            handle->mp3_data_length - handle->mp3_data_position,
+            input,
+            available,
             temp_pcm,
             &frame_info
         );
+        uint32_t cycles = DWT->CYCCNT - t0;
         
         if (samples == 0 || frame_info.frame_bytes == 0) {
             /* Skip invalid data */
@@ -41,6 +102,7 @@ static int decode_to_fill_chunk(mp3_decoder_streaming_t *handle,
             continue;
         }
         
+        frame_decoded(cycles);
         handle->mp3_data_position += frame_info.frame_bytes;
         handle->sample_rate = frame_info.hz;
         handle->channels = frame_info.channels;
@@ -105,13 +167,32 @@ int mp3_decoder_streaming_load(mp3_decoder_streaming_t *handle,
     handle->mp3_data_length = mp3_length;
     handle->mp3_data_position = 0;
     handle->total_samples_decoded = 0;
+    handle->source = NULL;
+    
+    return MP3_DEC_OK;
+}
+
+int mp3_decoder_streaming_load_stream(mp3_decoder_streaming_t *handle,
+                                      media_prefetch_stream_t *source)
+{
+    if (!handle || !source || source->length == 0) {
+        return MP3_DEC_INVALID_PARAM;
+    }
+    
+    handle->mp3_data = NULL;
+    handle->mp3_data_length = source->length;
+    handle->mp3_data_position = 0;
+    handle->total_samples_decoded = 0;
+    handle->source = source;
+    handle->window_start = 0;
+    handle->window_length = 0;
     
     return MP3_DEC_OK;
 }
 
 int16_t* mp3_decoder_streaming_start(mp3_decoder_streaming_t *handle)
 {
-    if (!handle || !handle->mp3_data) {
+    if (!handle || (!handle->mp3_data && !handle->source)) {
         return NULL;
     }
     
@@ -179,4 +260,35 @@ void mp3_decoder_streaming_set_loop(mp3_decoder_streaming_t *handle, uint8_t ena
     if (handle) {
         handle->loop_enabled = enable;
     }
-}
\ No newline at end of file
+}
+
+void mp3_decoder_stats_reset(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    mp3_decoder_stats.frames = 0;
+    mp3_decoder_stats.cycles = 0;
+    mp3_decoder_stats.cycles_min = 0;
+    mp3_decoder_stats.cycles_max = 0;
+    mp3_decoder_stats.start_tick = HAL_GetTick();
+    __set_PRIMASK(primask);
+}
+
+void mp3_decoder_stats_print(void)
+{
+    mp3_decoder_stats_t s;
+    uint32_t mhz = SystemCoreClock / 1000000U;
+    uint32_t primask = __get_PRIMASK();
+
+    /* The decoder runs in the audio task, which preempts this one */
+    __disable_irq();
+    memcpy(&s, (const void *)&mp3_decoder_stats, sizeof(s));
+    __set_PRIMASK(primask);
+
+    printf("\r\nmp3: %lu frames in %lu ms\r\n", s.frames, HAL_GetTick() - s.start_tick);
+    if (s.frames != 0) {
+        printf("cycles/frame %lu avg, %lu min, %lu max (%lu us max)\r\n",
+               (uint32_t)(s.cycles / s.frames), s.cycles_min, s.cycles_max, s.cycles_max / mhz);
+    }
+}
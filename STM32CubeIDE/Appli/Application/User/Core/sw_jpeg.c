@@ -0,0 +1,705 @@
+/*
+ * sw_jpeg.c
+ *
+ * Software baseline JPEG decoder, see sw_jpeg.h
+ */
+#include "sw_jpeg.h"
+#include <string.h>
+
+#define SW_JPEG_MAX_COMPONENTS      (3U)
+#define SW_JPEG_FAST_BITS           (9U)    /* Huffman codes decoded with one lookup */
+
+typedef struct
+{
+	uint8_t fast[1U << SW_JPEG_FAST_BITS];  /* Symbol index + 1, 0 for long codes */
+	uint8_t fast_len[1U << SW_JPEG_FAST_BITS];
+	uint8_t vals[256];
+	int32_t maxcode[18];            /* Largest code of each length, -1 when none */
+	int32_t delta[17];              /* vals index minus code of each length */
+} huff_t;
+
+typedef struct
+{
+	uint8_t id;
+	uint8_t h;
+	uint8_t v;
+	uint8_t tq;
+	uint8_t td;
+	uint8_t ta;
+	int32_t pred;                   /* DC predictor */
+} component_t;
+
+/* Decoder state, the module is not reentrant */
+static struct
+{
+	uint16_t quant[4][64];          /* Zigzag order, as in DQT */
+	huff_t dc[2];
+	huff_t ac[2];
+	component_t comp[SW_JPEG_MAX_COMPONENTS];
+	uint8_t ncomp;
+	uint8_t hmax;
+	uint8_t vmax;
+	uint16_t width;
+	uint16_t height;
+	uint16_t restart_interval;
+
+	/* Entropy coded data */
+	const uint8_t *pos;
+	const uint8_t *end;
+	uint32_t bits;
+	int32_t nbits;
+	uint8_t marker;                 /* Marker reached, no more data bytes */
+} jd;
+
+/* MCU samples, luma up to 16x16 then the two 8x8 chroma planes */
+static uint8_t mcu_y[4 * 64];
+static uint8_t mcu_cb[64];
+static uint8_t mcu_cr[64];
+
+/* Natural order of the zigzag index */
+static const uint8_t zigzag[64] =
+{
+	 0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+	12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+	35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+	58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+/* Standard Huffman tables (JPEG spec K.3), MJPEG frames usually omit DHT */
+static const uint8_t std_dc_bits[2][16] =
+{
+	{ 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 }
+};
+static const uint8_t std_dc_vals[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+static const uint8_t std_ac_bits[2][16] =
+{
+	{ 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7D },
+	{ 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 }
+};
+static const uint8_t std_ac_vals[2][162] =
+{
+	{
+		0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+		0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0,
+		0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28,
+		0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+		0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+		0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+		0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7,
+		0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5,
+		0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2,
+		0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8,
+		0xF9, 0xFA
+	},
+	{
+		0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+		0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0,
+		0x15, 0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A, 0x26,
+		0x27, 0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+		0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+		0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+		0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5,
+		0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3,
+		0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA,
+		0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8,
+		0xF9, 0xFA
+	}
+};
+
+static int huff_build(huff_t *h, const uint8_t bits[16], const uint8_t *vals)
+{
+	uint32_t code = 0;
+	uint32_t k = 0;
+
+	memset(h->fast, 0, sizeof(h->fast));
+	for (uint32_t len = 1; len <= 16; len++)
+	{
+		uint32_t count = bits[len - 1];
+
+		if (k + count > 256)
+			return SW_JPEG_ERROR;
+		h->delta[len] = (int32_t)k - (int32_t)code;
+		for (uint32_t i = 0; i < count; i++, k++, code++)
+		{
+			/* More codes than the length holds, would index past fast[] */
+			if (code >= (1U << len))
+				return SW_JPEG_ERROR;
+			h->vals[k] = vals[k];
+			if (len <= SW_JPEG_FAST_BITS)
+			{
+				/* Every lookup index starting with the code */
+				uint32_t first = code << (SW_JPEG_FAST_BITS - len);
+				uint32_t n = 1U << (SW_JPEG_FAST_BITS - len);
+
+				for (uint32_t j = 0; j < n; j++)
+				{
+					h->fast[first + j] = (uint8_t)(k + 1U);
+					h->fast_len[first + j] = (uint8_t)len;
+				}
+			}
+		}
+		h->maxcode[len] = count ? (int32_t)code - 1 : -1;
+		code <<= 1;
+	}
+	h->maxcode[17] = 0x7FFFFFFF;
+	return SW_JPEG_OK;
+}
+
+static void huff_defaults(void)
+{
+	for (uint32_t i = 0; i < 2; i++)
+	{
+		huff_build(&jd.dc[i], std_dc_bits[i], std_dc_vals);
+		huff_build(&jd.ac[i], std_ac_bits[i], std_ac_vals[i]);
+	}
+}
+
+/* Keep at least 25 bits in the buffer, zeros once a marker is reached */
+static void bits_fill(void)
+{
+	while (jd.nbits <= 24)
+	{
+		uint32_t b = 0;
+
+		if (!jd.marker && jd.pos < jd.end)
+		{
+			b = *jd.pos++;
+			if (b == 0xFF)
+			{
+				uint32_t next = (jd.pos < jd.end) ? *jd.pos : 0xD9;
+
+				if (next == 0x00)
+				{
+					jd.pos++;       /* Stuffed byte */
+				}
+				else
+				{
+					jd.marker = 1;  /* Left for the restart handling */
+					jd.pos--;
+					b = 0;
+				}
+			}
+		}
+		jd.bits |= b << (24 - jd.nbits);
+		jd.nbits += 8;
+	}
+}
+
+static int32_t huff_decode(const huff_t *h)
+{
+	uint32_t k, len;
+	int32_t code;
+
+	bits_fill();
+	k = h->fast[jd.bits >> (32 - SW_JPEG_FAST_BITS)];
+	if (k != 0)
+	{
+		len = h->fast_len[jd.bits >> (32 - SW_JPEG_FAST_BITS)];
+		jd.bits <<= len;
+		jd.nbits -= (int32_t)len;
+		return h->vals[k - 1];
+	}
+
+	/* Long code, one length at a time */
+	for (len = SW_JPEG_FAST_BITS + 1; len <= 16; len++)
+	{
+		code = (int32_t)(jd.bits >> (32 - len));
+		if (code <= h->maxcode[len])
+		{
+			jd.bits <<= len;
+			jd.nbits -= (int32_t)len;
+			return h->vals[(code + h->delta[len]) & 0xFF];
+		}
+	}
+	return -1;
+}
+
+/* Read n bits (1..16) as a signed coefficient */
+static int32_t receive_extend(uint32_t n)
+{
+	int32_t v;
+
+	bits_fill();
+	v = (int32_t)(jd.bits >> (32 - n));
+	jd.bits <<= n;
+	jd.nbits -= (int32_t)n;
+	if (v < (1 << (n - 1)))
+		v -= (1 << n) - 1;
+	return v;
+}
+
+static int decode_block(int32_t coef[64], component_t *c)
+{
+	const huff_t *ac = &jd.ac[c->ta];
+	const uint16_t *q = jd.quant[c->tq];
+	int32_t t, diff = 0;
+
+	memset(coef, 0, 64 * sizeof(int32_t));
+
+	t = huff_decode(&jd.dc[c->td]);
+	if (t < 0 || t > 16)
+		return SW_JPEG_ERROR;
+	if (t != 0)
+		diff = receive_extend((uint32_t)t);
+	/* Wraps on corrupted streams instead of overflowing */
+	c->pred = (int32_t)((uint32_t)c->pred + (uint32_t)diff);
+	coef[0] = (int32_t)((uint32_t)c->pred * q[0]);
+
+	for (uint32_t k = 1; k < 64; k++)
+	{
+		uint32_t r, s;
+
+		t = huff_decode(ac);
+		if (t < 0)
+			return SW_JPEG_ERROR;
+		r = (uint32_t)t >> 4;
+		s = (uint32_t)t & 15U;
+		if (s == 0)
+		{
+			if (r != 15)
+				break;      /* End of block */
+			k += 15;        /* Run of 16 zeros */
+			continue;
+		}
+		k += r;
+		if (k > 63)
+			return SW_JPEG_ERROR;
+		coef[zigzag[k]] = receive_extend(s) * q[k];
+	}
+	return SW_JPEG_OK;
+}
+
+static uint8_t clamp(int32_t v)
+{
+	if ((uint32_t)v > 255U)
+		return v < 0 ? 0 : 255;
+	return (uint8_t)v;
+}
+
+/*
+ * Integer IDCT, 12 bit constants (Loeffler, Ligtenberg, Moschytz). The
+ * butterflies run on uint32_t: corrupted coefficients wrap instead of
+ * overflowing, the results are converted back before the arithmetic shifts.
+ */
+#define FIX(x)      ((uint32_t)(int32_t)((x) * 4096.0f + 0.5f))
+#define IDCT_1D(s0, s1, s2, s3, s4, s5, s6, s7)                                  \
+	uint32_t t0, t1, t2, t3, p1, p2, p3, p4, p5, x0, x1, x2, x3;                \
+	p2 = (uint32_t)(s2); p3 = (uint32_t)(s6);                                   \
+	p1 = (p2 + p3) * FIX(0.5411961f);                                           \
+	t2 = p1 + p3 * FIX(-1.847759065f);                                          \
+	t3 = p1 + p2 * FIX(0.765366865f);                                           \
+	p2 = (uint32_t)(s0); p3 = (uint32_t)(s4);                                   \
+	t0 = (p2 + p3) << 12;                                                       \
+	t1 = (p2 - p3) << 12;                                                       \
+	x0 = t0 + t3; x3 = t0 - t3; x1 = t1 + t2; x2 = t1 - t2;                     \
+	t0 = (uint32_t)(s7); t1 = (uint32_t)(s5);                                   \
+	t2 = (uint32_t)(s3); t3 = (uint32_t)(s1);                                   \
+	p3 = t0 + t2; p4 = t1 + t3; p1 = t0 + t3; p2 = t1 + t2;                     \
+	p5 = (p3 + p4) * FIX(1.175875602f);                                         \
+	t0 = t0 * FIX(0.298631336f); t1 = t1 * FIX(2.053119869f);                   \
+	t2 = t2 * FIX(3.072711026f); t3 = t3 * FIX(1.501321110f);                   \
+	p1 = p5 + p1 * FIX(-0.899976223f); p2 = p5 + p2 * FIX(-2.562915447f);       \
+	p3 = p3 * FIX(-1.961570560f); p4 = p4 * FIX(-0.390180644f);                 \
+	t3 += p1 + p4; t2 += p2 + p3; t1 += p2 + p4; t0 += p1 + p3;
+
+static void idct_block(uint8_t *out, uint32_t stride, const int32_t *coef)
+{
+	int32_t tmp[64];
+	const int32_t *d = coef;
+	int32_t *v = tmp;
+
+	/* Columns, most blocks only have the DC coefficient in them */
+	for (uint32_t i = 0; i < 8; i++, d++, v++)
+	{
+		if ((d[8] | d[16] | d[24] | d[32] | d[40] | d[48] | d[56]) == 0)
+		{
+			int32_t dc = (int32_t)((uint32_t)d[0] << 2);
+
+			v[0] = v[8] = v[16] = v[24] = v[32] = v[40] = v[48] = v[56] = dc;
+		}
+		else
+		{
+			IDCT_1D(d[0], d[8], d[16], d[24], d[32], d[40], d[48], d[56])
+			x0 += 512; x1 += 512; x2 += 512; x3 += 512;
+			v[0]  = (int32_t)(x0 + t3) >> 10;
+			v[56] = (int32_t)(x0 - t3) >> 10;
+			v[8]  = (int32_t)(x1 + t2) >> 10;
+			v[48] = (int32_t)(x1 - t2) >> 10;
+			v[16] = (int32_t)(x2 + t1) >> 10;
+			v[40] = (int32_t)(x2 - t1) >> 10;
+			v[24] = (int32_t)(x3 + t0) >> 10;
+			v[32] = (int32_t)(x3 - t0) >> 10;
+		}
+	}
+
+	/* Rows, with the +128 level shift */
+	v = tmp;
+	for (uint32_t i = 0; i < 8; i++, v += 8, out += stride)
+	{
+		IDCT_1D(v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7])
+		x0 += 65536U + (128U << 17);
+		x1 += 65536U + (128U << 17);
+		x2 += 65536U + (128U << 17);
+		x3 += 65536U + (128U << 17);
+		out[0] = clamp((int32_t)(x0 + t3) >> 17);
+		out[7] = clamp((int32_t)(x0 - t3) >> 17);
+		out[1] = clamp((int32_t)(x1 + t2) >> 17);
+		out[6] = clamp((int32_t)(x1 - t2) >> 17);
+		out[2] = clamp((int32_t)(x2 + t1) >> 17);
+		out[5] = clamp((int32_t)(x2 - t1) >> 17);
+		out[3] = clamp((int32_t)(x3 + t0) >> 17);
+		out[4] = clamp((int32_t)(x3 - t0) >> 17);
+	}
+}
+
+/* Convert rows [y0, y1) and columns [x0, x1) of the decoded MCU */
+static void mcu_convert(uint32_t *dst, uint32_t stride, uint32_t x0, uint32_t x1, uint32_t y0, uint32_t y1)
+{
+	const uint32_t mcu_w = jd.hmax * 8U;
+	const uint32_t hs = (jd.hmax == 2) ? 1U : 0U;
+	const uint32_t vs = (jd.vmax == 2) ? 1U : 0U;
+
+	for (uint32_t y = y0; y < y1; y++)
+	{
+		const uint8_t *py = &mcu_y[y * mcu_w];
+		uint32_t *out = dst + y * stride;
+
+		if (jd.ncomp == 1)
+		{
+			for (uint32_t x = x0; x < x1; x++)
+				out[x] = 0xFF000000U | ((uint32_t)py[x] * 0x010101U);
+			continue;
+		}
+
+		const uint8_t *pcb = &mcu_cb[(y >> vs) * 8U];
+		const uint8_t *pcr = &mcu_cr[(y >> vs) * 8U];
+
+		/* JFIF full range, 16.16 fixed point */
+		for (uint32_t x = x0; x < x1; x++)
+		{
+			int32_t l = py[x];
+			int32_t cb = (int32_t)pcb[x >> hs] - 128;
+			int32_t cr = (int32_t)pcr[x >> hs] - 128;
+			int32_t r = l + ((91881 * cr + 32768) >> 16);
+			int32_t g = l - ((22554 * cb + 46802 * cr - 32768) >> 16);
+			int32_t b = l + ((116130 * cb + 32768) >> 16);
+
+			out[x] = 0xFF000000U | ((uint32_t)clamp(r) << 16) | ((uint32_t)clamp(g) << 8) | clamp(b);
+		}
+	}
+}
+
+static uint32_t get16(const uint8_t *p)
+{
+	return ((uint32_t)p[0] << 8) | p[1];
+}
+
+static int parse_dqt(const uint8_t *p, uint32_t len)
+{
+	while (len >= 65)
+	{
+		uint32_t pq = p[0] >> 4;
+		uint32_t tq = p[0] & 3U;
+
+		if (pq != 0)
+			return SW_JPEG_UNSUPPORTED;     /* 16 bit tables come with 12 bit samples */
+		for (uint32_t i = 0; i < 64; i++)
+			jd.quant[tq][i] = p[1 + i];
+		p += 65;
+		len -= 65;
+	}
+	return len == 0 ? SW_JPEG_OK : SW_JPEG_ERROR;
+}
+
+static int parse_dht(const uint8_t *p, uint32_t len)
+{
+	while (len >= 17)
+	{
+		uint32_t tc = p[0] >> 4;
+		uint32_t th = p[0] & 1U;
+		uint32_t count = 0;
+
+		for (uint32_t i = 0; i < 16; i++)
+			count += p[1 + i];
+		if (tc > 1 || 17 + count > len)
+			return SW_JPEG_ERROR;
+		if (huff_build(tc ? &jd.ac[th] : &jd.dc[th], p + 1, p + 17) != SW_JPEG_OK)
+			return SW_JPEG_ERROR;
+		p += 17 + count;
+		len -= 17 + count;
+	}
+	return len == 0 ? SW_JPEG_OK : SW_JPEG_ERROR;
+}
+
+static int parse_sof(const uint8_t *p, uint32_t len)
+{
+	if (len < 6 || p[0] != 8)
+		return SW_JPEG_UNSUPPORTED;
+
+	jd.height = (uint16_t)get16(p + 1);
+	jd.width = (uint16_t)get16(p + 3);
+	jd.ncomp = p[5];
+	if (jd.width == 0 || jd.height == 0 || (jd.ncomp != 1 && jd.ncomp != 3))
+		return SW_JPEG_UNSUPPORTED;
+	if (len < 6U + jd.ncomp * 3U)
+		return SW_JPEG_ERROR;
+
+	jd.hmax = 1;
+	jd.vmax = 1;
+	for (uint32_t i = 0; i < jd.ncomp; i++)
+	{
+		component_t *c = &jd.comp[i];
+
+		c->id = p[6 + i * 3];
+		c->h = p[7 + i * 3] >> 4;
+		c->v = p[7 + i * 3] & 15U;
+		c->tq = p[8 + i * 3] & 3U;
+		if (c->h == 0 || c->v == 0 || c->h > 2 || c->v > 2)
+			return SW_JPEG_UNSUPPORTED;
+		if (c->h > jd.hmax)
+			jd.hmax = c->h;
+		if (c->v > jd.vmax)
+			jd.vmax = c->v;
+	}
+
+	if (jd.ncomp == 1)
+	{
+		/* Non interleaved, one block per MCU whatever the factors say */
+		jd.comp[0].h = 1;
+		jd.comp[0].v = 1;
+		jd.hmax = 1;
+		jd.vmax = 1;
+	}
+	else if (jd.comp[1].h != 1 || jd.comp[1].v != 1 || jd.comp[2].h != 1 || jd.comp[2].v != 1
+			|| jd.comp[0].h != jd.hmax || jd.comp[0].v != jd.vmax)
+	{
+		return SW_JPEG_UNSUPPORTED;
+	}
+	return SW_JPEG_OK;
+}
+
+static int parse_sos(const uint8_t *p, uint32_t len)
+{
+	uint32_t n = (len != 0) ? p[0] : 0;
+
+	if (n != jd.ncomp || len < 4U + n * 2U)
+		return SW_JPEG_UNSUPPORTED;     /* One scan per component (progressive like) */
+
+	for (uint32_t i = 0; i < n; i++)
+	{
+		uint32_t id = p[1 + i * 2];
+		uint32_t j;
+
+		for (j = 0; j < jd.ncomp; j++)
+		{
+			if (jd.comp[j].id == id)
+				break;
+		}
+		if (j != i)
+			return SW_JPEG_UNSUPPORTED;
+		jd.comp[j].td = (p[2 + i * 2] >> 4) & 1U;
+		jd.comp[j].ta = p[2 + i * 2] & 1U;
+	}
+	return SW_JPEG_OK;
+}
+
+/*
+ * Walk the markers up to the first scan. Leaves jd.pos on the entropy coded
+ * data, returns SW_JPEG_OK when a scan was found.
+ */
+static int parse_headers(const uint8_t *data, uint32_t size, int stop_at_sof)
+{
+	const uint8_t *p = data;
+	const uint8_t *end = data + size;
+	int have_sof = 0;
+	int ret;
+
+	if (data == NULL || size < 4 || p[0] != 0xFF || p[1] != 0xD8)
+		return SW_JPEG_ERROR;
+	p += 2;
+
+	jd.restart_interval = 0;
+	huff_defaults();
+
+	while (p + 4 <= end)
+	{
+		uint32_t marker, len;
+
+		if (p[0] != 0xFF)
+			return SW_JPEG_ERROR;
+		marker = p[1];
+		if (marker == 0xFF)
+		{
+			p++;            /* Fill byte */
+			continue;
+		}
+		len = get16(p + 2);
+		if (len < 2 || p + 2 + len > end)
+			return SW_JPEG_ERROR;
+
+		switch (marker)
+		{
+		case 0xC0:          /* Baseline */
+		case 0xC1:          /* Extended sequential, Huffman */
+			ret = parse_sof(p + 4, len - 2);
+			if (ret != SW_JPEG_OK || stop_at_sof)
+				return ret;
+			have_sof = 1;
+			break;
+		case 0xC2: case 0xC3: case 0xC5: case 0xC6: case 0xC7:
+		case 0xC9: case 0xCA: case 0xCB: case 0xCD: case 0xCE: case 0xCF:
+			return SW_JPEG_UNSUPPORTED;     /* Progressive, lossless, arithmetic */
+		case 0xC4:
+			ret = parse_dht(p + 4, len - 2);
+			if (ret != SW_JPEG_OK)
+				return ret;
+			break;
+		case 0xDB:
+			ret = parse_dqt(p + 4, len - 2);
+			if (ret != SW_JPEG_OK)
+				return ret;
+			break;
+		case 0xDD:
+			if (len != 4)
+				return SW_JPEG_ERROR;
+			jd.restart_interval = (uint16_t)get16(p + 4);
+			break;
+		case 0xDA:
+			if (!have_sof)
+				return SW_JPEG_ERROR;
+			ret = parse_sos(p + 4, len - 2);
+			if (ret != SW_JPEG_OK)
+				return ret;
+			jd.pos = p + 2 + len;
+			jd.end = end;
+			return SW_JPEG_OK;
+		default:            /* APPn, COM, ... */
+			break;
+		}
+		p += 2 + len;
+	}
+	return SW_JPEG_ERROR;
+}
+
+/* Resynchronise on the RSTn marker at the end of a restart interval */
+static void restart(void)
+{
+	jd.bits = 0;
+	jd.nbits = 0;
+	jd.marker = 0;
+	if (jd.pos + 1 < jd.end && jd.pos[0] == 0xFF && jd.pos[1] >= 0xD0 && jd.pos[1] <= 0xD7)
+		jd.pos += 2;
+	for (uint32_t i = 0; i < jd.ncomp; i++)
+		jd.comp[i].pred = 0;
+}
+
+int sw_jpeg_info(const uint8_t *data, uint32_t size, sw_jpeg_info_t *info)
+{
+	int ret;
+
+	if (info == NULL)
+		return SW_JPEG_INVALID_PARAM;
+
+	ret = parse_headers(data, size, 1);
+	if (ret != SW_JPEG_OK)
+		return ret;
+
+	info->width = jd.width;
+	info->height = jd.height;
+	info->components = jd.ncomp;
+	info->h_samp = jd.hmax;
+	info->v_samp = jd.vmax;
+	return SW_JPEG_OK;
+}
+
+int sw_jpeg_decode(const uint8_t *data, uint32_t size, uint32_t *dst, uint32_t dst_stride,
+		uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+	int32_t coef[64];
+	uint32_t mcu_w, mcu_h, mcus_x, mcus_y, x_end, y_end, todo;
+	int ret;
+
+	if (dst == NULL || width == 0 || height == 0)
+		return SW_JPEG_INVALID_PARAM;
+
+	ret = parse_headers(data, size, 0);
+	if (ret != SW_JPEG_OK)
+		return ret;
+
+	x_end = (uint32_t)x + width;
+	y_end = (uint32_t)y + height;
+	if (x_end > jd.width)
+		x_end = jd.width;
+	if (y_end > jd.height)
+		y_end = jd.height;
+	if (x >= x_end || y >= y_end)
+		return SW_JPEG_OK;
+
+	mcu_w = jd.hmax * 8U;
+	mcu_h = jd.vmax * 8U;
+	mcus_x = (jd.width + mcu_w - 1) / mcu_w;
+	mcus_y = (y_end + mcu_h - 1) / mcu_h;   /* Rows below the clip are not decoded */
+
+	jd.bits = 0;
+	jd.nbits = 0;
+	jd.marker = 0;
+	for (uint32_t i = 0; i < jd.ncomp; i++)
+		jd.comp[i].pred = 0;
+	todo = jd.restart_interval;
+
+	for (uint32_t my = 0; my < mcus_y; my++)
+	{
+		const uint32_t py = my * mcu_h;
+		const int row_visible = (py + mcu_h > y);
+
+		for (uint32_t mx = 0; mx < mcus_x; mx++)
+		{
+			const uint32_t px = mx * mcu_w;
+			const int visible = row_visible && (px < x_end) && (px + mcu_w > x);
+
+			if (jd.restart_interval != 0)
+			{
+				if (todo == 0)
+				{
+					restart();
+					todo = jd.restart_interval;
+				}
+				todo--;
+			}
+
+			/* Entropy decode every block, the IDCT only for the clip */
+			for (uint32_t c = 0; c < jd.ncomp; c++)
+			{
+				component_t *comp = &jd.comp[c];
+
+				for (uint32_t by = 0; by < comp->v; by++)
+				{
+					for (uint32_t bx = 0; bx < comp->h; bx++)
+					{
+						if (decode_block(coef, comp) != SW_JPEG_OK)
+							return SW_JPEG_ERROR;
+						if (!visible)
+							continue;
+						if (c == 0)
+							idct_block(&mcu_y[by * 8U * mcu_w + bx * 8U], mcu_w, coef);
+						else
+							idct_block(c == 1 ? mcu_cb : mcu_cr, 8, coef);
+					}
+				}
+			}
+
+			if (visible)
+			{
+				uint32_t cx0 = (px < x) ? x - px : 0;
+				uint32_t cx1 = (px + mcu_w > x_end) ? x_end - px : mcu_w;
+				uint32_t cy0 = (py < y) ? y - py : 0;
+				uint32_t cy1 = (py + mcu_h > y_end) ? y_end - py : mcu_h;
+
+				mcu_convert(dst + py * dst_stride + px, dst_stride, cx0, cx1, cy0, cy1);
+			}
+		}
+	}
+	return SW_JPEG_OK;
+}
@@ -0,0 +1,204 @@
+/*
+ * swo_prof.c
+ *
+ * PC sampling profiler over ITM, see swo_prof.h
+ */
+#include "swo_prof.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TIM_COUNT_HZ                1000000U
+
+volatile swo_prof_stats_t swo_prof_stats;
+
+static TIM_HandleTypeDef htim7;
+static uint32_t period_us;              /* Mean sampling period */
+static uint32_t lfsr = 0xACE1U;         /* Dither of the period */
+static uint32_t name_countdown;         /* Samples until the slots are announced again */
+
+/* Task slots: TCB seen, bit n of announced set once its name was sent */
+static TaskHandle_t slot_task[SWO_PROF_TASKS];
+static uint32_t slot_count;
+static uint32_t announced;
+
+static inline int itm_ready(uint32_t port)
+{
+	return ITM->PORT[port].u32 != 0U;
+}
+
+/* Name record of a slot, abandoned (and retried later) when the FIFO fills */
+static void announce(uint32_t slot, TaskHandle_t task)
+{
+	const char *name = pcTaskGetName(task);
+
+	if (!itm_ready(SWO_PROF_PORT_NAME))
+		return;
+	ITM->PORT[SWO_PROF_PORT_NAME].u8 = (uint8_t)(0x80U | slot);
+	for (uint32_t i = 0; i < configMAX_TASK_NAME_LEN && name[i] != '\0'; i++)
+	{
+		if (!itm_ready(SWO_PROF_PORT_NAME))
+			return;
+		ITM->PORT[SWO_PROF_PORT_NAME].u8 = (uint8_t)(name[i] & 0x7F);
+	}
+	if (!itm_ready(SWO_PROF_PORT_NAME))
+		return;
+	ITM->PORT[SWO_PROF_PORT_NAME].u8 = 0;
+	announced |= 1U << slot;
+}
+
+/* Only reads the current TCB pointer and the name in it, no kernel call */
+static uint32_t task_context(void)
+{
+	TaskHandle_t task = xTaskGetCurrentTaskHandle();
+	uint32_t slot;
+
+	for (slot = 0; slot < slot_count; slot++)
+	{
+		if (slot_task[slot] == task)
+			break;
+	}
+	if (slot == slot_count)
+	{
+		if (slot_count == SWO_PROF_TASKS)
+			return SWO_PROF_CONTEXT_OTHER;
+		slot_task[slot] = task;
+		slot_count++;
+		swo_prof_stats.tasks = slot_count;
+	}
+	if ((announced & (1U << slot)) == 0U)
+		announce(slot, task);
+	return slot;
+}
+
+void swo_prof_sample(const uint32_t *frame, uint32_t exc_return)
+{
+	uint32_t context;
+	uint32_t next;
+
+	TIM7->SR = ~TIM_SR_UIF;
+
+	// Next period: mean +-1/16, from a 16 bit Galois LFSR
+	lfsr = (lfsr >> 1) ^ (-(lfsr & 1U) & 0xB400U);
+	next = period_us - period_us / 16U + (lfsr % (period_us / 8U + 1U));
+	TIM7->ARR = next - 1U;
+
+	if (--name_countdown == 0U)
+	{
+		name_countdown = swo_prof_stats.rate_hz;
+		announced = 0;
+	}
+
+	if ((exc_return & 0x4U) != 0U)
+	{
+		// Process stack: a task
+		context = task_context();
+	}
+	else if ((exc_return & 0x8U) == 0U)
+	{
+		// Main stack, handler mode: the exception number of the interrupted ISR
+		context = SWO_PROF_CONTEXT_ISR | (frame[7] & 0x1FFU);
+		swo_prof_stats.isr++;
+	}
+	else
+	{
+		// Main stack, thread mode: before the scheduler
+		context = SWO_PROF_CONTEXT_MAIN;
+	}
+
+	if (!itm_ready(SWO_PROF_PORT_CONTEXT) || !itm_ready(SWO_PROF_PORT_PC))
+	{
+		swo_prof_stats.dropped++;
+		return;
+	}
+	ITM->PORT[SWO_PROF_PORT_CONTEXT].u16 = (uint16_t)context;
+	while (!itm_ready(SWO_PROF_PORT_PC))
+	{
+	}
+	ITM->PORT[SWO_PROF_PORT_PC].u32 = frame[6];
+	swo_prof_stats.samples++;
+}
+
+int swo_prof_start(uint32_t rate_hz)
+{
+	RCC_ClkInitTypeDef clkconfig;
+	uint32_t latency;
+	uint32_t timclock;
+
+	if (rate_hz == 0U || rate_hz > SWO_PROF_RATE_MAX_HZ)
+		return SWO_PROF_INVALID_PARAM;
+	if ((CoreDebug->DEMCR & CoreDebug_DEMCR_TRCENA_Msk) == 0U || (ITM->TCR & ITM_TCR_ITMENA_Msk) == 0U)
+		return SWO_PROF_NO_ITM;
+
+	swo_prof_stop();
+
+	ITM->LAR = 0xC5ACCE55;
+	ITM->TER |= (1U << SWO_PROF_PORT_CONTEXT) | (1U << SWO_PROF_PORT_PC) | (1U << SWO_PROF_PORT_NAME);
+
+	// Timer clock as in HAL_InitTick (TIM6 and TIM7 are both on APB1)
+	__HAL_RCC_TIM7_CLK_ENABLE();
+	HAL_RCC_GetClockConfig(&clkconfig, &latency);
+	if (clkconfig.APB1CLKDivider == RCC_APB1_DIV1)
+		timclock = HAL_RCC_GetPCLK1Freq();
+	else if (clkconfig.APB1CLKDivider == RCC_APB1_DIV2 || __HAL_RCC_GET_TIMCLKPRESCALER() == RCC_TIMPRES_DISABLE)
+		timclock = 2U * HAL_RCC_GetPCLK1Freq();
+	else
+		timclock = 4U * HAL_RCC_GetPCLK1Freq();
+
+	period_us = TIM_COUNT_HZ / rate_hz;
+	swo_prof_stats.rate_hz = rate_hz;
+	name_countdown = rate_hz;
+	announced = 0;
+
+	htim7.Instance = TIM7;
+	htim7.Init.Prescaler = timclock / TIM_COUNT_HZ - 1U;
+	htim7.Init.Period = period_us - 1U;
+	htim7.Init.ClockDivision = 0;
+	htim7.Init.CounterMode = TIM_COUNTERMODE_UP;
+	htim7.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+	if (HAL_TIM_Base_Init(&htim7) != HAL_OK)
+		return SWO_PROF_ERROR;
+
+	HAL_NVIC_SetPriority(TIM7_IRQn, 0, 0);
+	HAL_NVIC_EnableIRQ(TIM7_IRQn);
+	if (HAL_TIM_Base_Start_IT(&htim7) != HAL_OK)
+		return SWO_PROF_ERROR;
+	return SWO_PROF_OK;
+}
+
+void swo_prof_stop(void)
+{
+	if (htim7.Instance == NULL)
+		return;
+	HAL_TIM_Base_Stop_IT(&htim7);
+	HAL_NVIC_DisableIRQ(TIM7_IRQn);
+	swo_prof_stats.rate_hz = 0;
+}
+
+void swo_prof_reset(void)
+{
+	uint32_t rate_hz = swo_prof_stats.rate_hz;
+	uint32_t tasks = swo_prof_stats.tasks;
+
+	HAL_NVIC_DisableIRQ(TIM7_IRQn);
+	memset((void *)&swo_prof_stats, 0, sizeof(swo_prof_stats));
+	swo_prof_stats.rate_hz = rate_hz;
+	swo_prof_stats.tasks = tasks;
+	swo_prof_stats.start_tick = HAL_GetTick();
+	if (rate_hz != 0U)
+		HAL_NVIC_EnableIRQ(TIM7_IRQn);
+}
+
+void swo_prof_print(void)
+{
+	swo_prof_stats_t s;
+
+	HAL_NVIC_DisableIRQ(TIM7_IRQn);
+	memcpy(&s, (const void *)&swo_prof_stats, sizeof(s));
+	if (s.rate_hz != 0U)
+		HAL_NVIC_EnableIRQ(TIM7_IRQn);
+
+	printf("\r\nswo prof: %lu Hz, %lu ms\r\n", s.rate_hz, HAL_GetTick() - s.start_tick);
+	printf("%lu samples, %lu in ISRs, %lu dropped, %lu tasks\r\n", s.samples, s.isr, s.dropped, s.tasks);
+}
@@ -0,0 +1,299 @@
+/*
+ * sys_mon.c
+ *
+ * System monitor task, see sys_mon.h
+ */
+#include "sys_mon.h"
+#include "idle_sleep.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "cmsis_os2.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SYS_MON_TASK_PRIORITY       (osPriorityAboveNormal)
+/* The text report waits on the SWO pin, below the GUI and the audio */
+#define SYS_MON_REPORT_PRIORITY     (osPriorityLow)
+#define SYS_MON_TASK_STACK_WORDS    512
+
+/* Tasks read from the kernel per period */
+#define SYS_MON_STATUS              24
+
+/* Default of tasks.c, not visible outside it */
+#ifndef configIDLE_TASK_NAME
+#define configIDLE_TASK_NAME        "IDLE"
+#endif
+
+volatile uint32_t sys_mon_switches[SYS_MON_SLOTS];
+volatile uint32_t sys_mon_isr_nesting;
+volatile uint32_t sys_mon_isr_start;
+volatile uint32_t sys_mon_isr_cycles;
+volatile uint32_t sys_mon_isr_count;
+
+static StaticTask_t mon_tcb;
+static StackType_t mon_stack[SYS_MON_TASK_STACK_WORDS];
+static osThreadId_t mon_task;
+
+static const osThreadAttr_t mon_task_attributes = {
+	.name = "sys_mon",
+	.cb_mem = &mon_tcb,
+	.cb_size = sizeof(mon_tcb),
+	.stack_mem = mon_stack,
+	.stack_size = sizeof(mon_stack),
+	.priority = (osPriority_t) SYS_MON_TASK_PRIORITY,
+};
+
+/* Kernel view and the counters at the start of the period, by slot */
+static TaskStatus_t status[SYS_MON_STATUS];
+static uint32_t slot_count = 1;         /* Slot 0 is shared by the tasks without one */
+static uint32_t last_runtime[SYS_MON_SLOTS];
+static uint32_t last_switches[SYS_MON_SLOTS];
+static uint32_t last_cycles;
+static uint32_t last_isr_cycles;
+static uint32_t last_isr_count;
+static uint32_t last_tick;
+
+/* Mailbox, odd sequence while the monitor writes it. The readers run below
+   the monitor task and retry until they copied an even, unchanged sequence */
+static volatile uint32_t sequence;
+static sys_mon_snapshot_t mailbox;
+
+static uint16_t permille(uint32_t part, uint32_t whole)
+{
+	if (whole == 0U)
+		return 0;
+	uint64_t p = (uint64_t)part * 1000U / whole;
+	return (uint16_t)(p > 1000U ? 1000U : p);
+}
+
+static uint32_t slot_of(TaskHandle_t task)
+{
+	uint32_t slot = (uint32_t)uxTaskGetTaskNumber(task);
+
+	if (slot == 0U && slot_count < SYS_MON_SLOTS)
+	{
+		slot = slot_count++;
+		vTaskSetTaskNumber(task, slot);
+	}
+	return slot;
+}
+
+/* Snapshot of the period since the previous call */
+static void sample(sys_mon_snapshot_t *s)
+{
+	UBaseType_t count = uxTaskGetSystemState(status, SYS_MON_STATUS, NULL);
+	uint32_t cycles = idle_sleep_cycles() - last_cycles;
+	uint32_t isr_cycles = sys_mon_isr_cycles;
+	uint32_t isr_count = sys_mon_isr_count;
+	uint32_t tick = HAL_GetTick();
+	uint32_t idle = 0;
+	uint32_t n = 0;
+
+	last_cycles += cycles;
+	memset(s, 0, sizeof(*s));
+	s->tick = tick;
+	s->period_ms = tick - last_tick;
+	s->isr_permille = permille(isr_cycles - last_isr_cycles, cycles);
+	s->isr_entries = isr_count - last_isr_count;
+	last_tick = tick;
+	last_isr_cycles = isr_cycles;
+	last_isr_count = isr_count;
+
+	// Slots in creation order, so that the GUI rows stay in place
+	for (UBaseType_t i = 1; i < count; i++)
+	{
+		TaskStatus_t t = status[i];
+		UBaseType_t j = i;
+
+		while (j > 0 && status[j - 1].xTaskNumber > t.xTaskNumber)
+		{
+			status[j] = status[j - 1];
+			j--;
+		}
+		status[j] = t;
+	}
+
+	for (UBaseType_t i = 0; i < count; i++)
+	{
+		uint32_t slot = slot_of(status[i].xHandle);
+		uint32_t runtime = status[i].ulRunTimeCounter - last_runtime[slot];
+		uint32_t switches = sys_mon_switches[slot] - last_switches[slot];
+
+		if (slot == 0U)
+		{
+			// Out of slots: no baseline to take a difference from
+			runtime = 0;
+			switches = 0;
+		}
+		last_runtime[slot] = status[i].ulRunTimeCounter;
+		if (strcmp(status[i].pcTaskName, configIDLE_TASK_NAME) == 0)
+			idle = runtime;
+		if (n < SYS_MON_TASKS)
+		{
+			sys_mon_task_t *m = &s->task[n++];
+
+			strncpy(m->name, status[i].pcTaskName, SYS_MON_NAME_LEN - 1);
+			m->cpu_permille = permille(runtime, cycles);
+			m->priority = (uint16_t)status[i].uxCurrentPriority;
+			m->switches = switches;
+			m->stack_free = status[i].usStackHighWaterMark * sizeof(StackType_t);
+		}
+	}
+	s->task_count = count;
+	s->cpu_permille = 1000U - permille(idle, cycles);
+
+	for (uint32_t slot = 0; slot < SYS_MON_SLOTS; slot++)
+	{
+		uint32_t switches = sys_mon_switches[slot];
+
+		s->switches += switches - last_switches[slot];
+		last_switches[slot] = switches;
+	}
+
+	for (uint32_t tag = 0; tag < TLSF_HEAP_TAGS; tag++)
+	{
+		s->heap_size[tag] = tlsf_heap_stats.arena[tag].size;
+		s->heap_used[tag] = tlsf_heap_stats.arena[tag].used;
+		s->heap_used_max[tag] = tlsf_heap_stats.arena[tag].used_max;
+	}
+}
+
+static void publish(const sys_mon_snapshot_t *s)
+{
+	sequence++;
+	__DMB();
+	memcpy(&mailbox, s, sizeof(mailbox));
+	__DMB();
+	sequence++;
+}
+
+static void put_printf(const char *text)
+{
+	printf("%s", text);
+}
+
+#if SYS_MON_ITM_PORT >= 0
+static int itm_enabled(void)
+{
+	return (CoreDebug->DEMCR & CoreDebug_DEMCR_TRCENA_Msk) != 0U
+			&& (ITM->TCR & ITM_TCR_ITMENA_Msk) != 0U
+			&& (ITM->TER & (1UL << SYS_MON_ITM_PORT)) != 0U;
+}
+
+static void put_itm(const char *text)
+{
+	for (; *text != '\0'; text++)
+	{
+		while (ITM->PORT[SYS_MON_ITM_PORT].u32 == 0U)
+		{
+		}
+		ITM->PORT[SYS_MON_ITM_PORT].u8 = (uint8_t)*text;
+	}
+}
+#endif
+
+static void report(const sys_mon_snapshot_t *s, void (*put)(const char *))
+{
+	static const char *const arena[TLSF_HEAP_TAGS] = { "internal", "psram" };
+	char line[96];
+	uint32_t n = s->task_count < SYS_MON_TASKS ? s->task_count : SYS_MON_TASKS;
+
+	snprintf(line, sizeof(line), "\r\nsys mon: %lu ms, cpu %u.%u%%, isr %u.%u%% (%lu), %lu switches\r\n",
+			s->period_ms, s->cpu_permille / 10U, s->cpu_permille % 10U,
+			s->isr_permille / 10U, s->isr_permille % 10U, s->isr_entries, s->switches);
+	put(line);
+	for (uint32_t tag = 0; tag < TLSF_HEAP_TAGS; tag++)
+	{
+		if (s->heap_size[tag] == 0U)
+			continue;
+		snprintf(line, sizeof(line), "heap %s: %lu of %lu used, max %lu\r\n",
+				arena[tag], s->heap_used[tag], s->heap_size[tag], s->heap_used_max[tag]);
+		put(line);
+	}
+	put("task              cpu%  prio  switches  stack free\r\n");
+	for (uint32_t i = 0; i < n; i++)
+	{
+		const sys_mon_task_t *t = &s->task[i];
+
+		snprintf(line, sizeof(line), "%-16s %3u.%u %5u %9lu %11lu\r\n", t->name,
+				t->cpu_permille / 10U, t->cpu_permille % 10U, t->priority, t->switches, t->stack_free);
+		put(line);
+	}
+	if (s->task_count > n)
+	{
+		snprintf(line, sizeof(line), "%lu more tasks\r\n", s->task_count - n);
+		put(line);
+	}
+}
+
+static void mon_task_entry(void *argument)
+{
+	static sys_mon_snapshot_t snapshot;
+	uint32_t wake;
+
+	(void)argument;
+
+	// Baseline of the counters, the first period is published a period later
+	sample(&snapshot);
+	wake = osKernelGetTickCount();
+	for (;;)
+	{
+		wake += pdMS_TO_TICKS(SYS_MON_PERIOD_MS);
+		osDelayUntil(wake);
+		sample(&snapshot);
+		publish(&snapshot);
+#if SYS_MON_ITM_PORT >= 0
+		if (itm_enabled())
+		{
+			osThreadSetPriority(mon_task, SYS_MON_REPORT_PRIORITY);
+			report(&snapshot, put_itm);
+			osThreadSetPriority(mon_task, SYS_MON_TASK_PRIORITY);
+		}
+#endif
+	}
+}
+
+void sys_mon_timer_init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	last_cycles = idle_sleep_cycles();
+}
+
+int sys_mon_init(void)
+{
+#if SYS_MON_PERIOD_MS > 0
+	mon_task = osThreadNew(mon_task_entry, NULL, &mon_task_attributes);
+	if (mon_task == NULL)
+		return SYS_MON_ERROR;
+#endif
+	return SYS_MON_OK;
+}
+
+int sys_mon_read(sys_mon_snapshot_t *snapshot)
+{
+	uint32_t seq;
+
+	do
+	{
+		seq = sequence;
+		__DMB();
+		memcpy(snapshot, &mailbox, sizeof(*snapshot));
+		__DMB();
+	} while ((seq & 1U) || seq != sequence);
+
+	return seq == 0U ? SYS_MON_NO_DATA : SYS_MON_OK;
+}
+
+void sys_mon_print(void)
+{
+	static sys_mon_snapshot_t snapshot;
+
+	if (sys_mon_read(&snapshot) != SYS_MON_OK)
+	{
+		printf("\r\nsys mon: no data\r\n");
+		return;
+	}
+	report(&snapshot, put_printf);
+}
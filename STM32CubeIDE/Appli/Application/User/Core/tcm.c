@@ -0,0 +1,31 @@
+/*
+ * tcm.c
+ *
+ * TCM usage report, see tcm.h
+ */
+#include "tcm.h"
+#include <stdio.h>
+
+/* Linker script symbols, only their addresses are meaningful */
+extern uint8_t _sitcm[];
+extern uint8_t _eitcm[];
+extern uint8_t _itcm_size[];
+extern uint8_t _sdtcm[];
+extern uint8_t _edtcm[];
+extern uint8_t _end[];                  /* Start of the heap and stack reservation */
+extern uint8_t _estack[];
+extern uint8_t _Min_Stack_Size[];
+
+void tcm_print(void)
+{
+	uint32_t itcm_used = (uint32_t)(_eitcm - _sitcm);
+	uint32_t itcm_size = (uint32_t)_itcm_size;
+	uint32_t dtcm_used = (uint32_t)(_edtcm - _sdtcm);
+	uint32_t stack = (uint32_t)_Min_Stack_Size;
+	uint32_t dtcm_free = (uint32_t)(_estack - _end) - stack;
+
+	printf("\r\ntcm:\r\n");
+	printf("ITCM: %lu bytes of code, %lu of %lu free\r\n", itcm_used, itcm_size - itcm_used, itcm_size);
+	printf("DTCM: %lu bytes of tables, %lu free below the %lu byte MSP stack\r\n",
+			dtcm_used, dtcm_free, stack);
+}
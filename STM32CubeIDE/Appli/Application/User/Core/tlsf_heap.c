@@ -0,0 +1,640 @@
+/*
+ * tlsf_heap.c
+ *
+ * Two-level segregated fit heap behind pvPortMalloc and malloc, see
+ * tlsf_heap.h
+ */
+#include "tlsf_heap.h"
+#include "main.h"
+#include "FreeRTOS.h"
+#include <errno.h>
+#if TLSF_HEAP_NEWLIB
+#include <reent.h>
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ALIGN_LOG2                  3
+#define ALIGN_SIZE                  (1U << ALIGN_LOG2)
+#define SL_LOG2                     4
+#define SL_COUNT                    (1U << SL_LOG2)
+#define FL_SHIFT                    (SL_LOG2 + ALIGN_LOG2)
+#define FL_MAX                      26      /* Blocks below 64 MB */
+#define FL_COUNT                    (FL_MAX - FL_SHIFT + 1)
+#define SMALL_BLOCK                 (1U << FL_SHIFT)
+
+#define BLOCK_FREE                  0x1U
+#define BLOCK_SIZE_MASK             (~(ALIGN_SIZE - 1U))
+
+/*
+ * Every block starts with an 8 byte header, the payload follows and the next
+ * block starts right after it. The free list links use the payload of the
+ * free blocks. The arena ends with a zero size block marked used, so the
+ * merge of the last block needs no bound check.
+ */
+typedef struct block
+{
+	struct block *prev_phys;        /* Previous block in memory, NULL for the first */
+	uint32_t size;                  /* Payload bytes | BLOCK_FREE */
+	struct block *next_free;        /* Free blocks only */
+	struct block *prev_free;
+} block_t;
+
+#define BLOCK_HEADER                offsetof(block_t, next_free)
+#define BLOCK_MIN                   (sizeof(block_t) - BLOCK_HEADER)
+
+typedef struct
+{
+	uint8_t *start;
+	uint8_t *end;
+	uint32_t fl_bitmap;
+	uint32_t sl_bitmap[FL_COUNT];
+	block_t *blocks[FL_COUNT][SL_COUNT];
+} arena_t;
+
+volatile tlsf_heap_stats_t tlsf_heap_stats;
+
+/* Internal arena, placed in DTCM by the FreeRtosHeapSection of the linker
+   script. Also the ucHeap of heap_4.c (configAPPLICATION_ALLOCATED_HEAP) */
+uint8_t ucHeap[configTOTAL_HEAP_SIZE] __attribute__((section(".bss.ucHeap"), aligned(8)));
+#if TLSF_HEAP_PSRAM_SIZE > 0
+static uint8_t psram_heap[TLSF_HEAP_PSRAM_SIZE] __attribute__((section("HeapPsramSection"), aligned(8)));
+#endif
+
+static arena_t arenas[TLSF_HEAP_TAGS];
+static uint8_t initialized;
+
+static inline uint32_t fls32(uint32_t v)
+{
+	return 31U - (uint32_t)__builtin_clz(v);
+}
+
+static inline uint32_t ffs32(uint32_t v)
+{
+	return (uint32_t)__builtin_ctz(v);
+}
+
+static inline uint32_t block_size(const block_t *b)
+{
+	return b->size & BLOCK_SIZE_MASK;
+}
+
+static inline int block_is_free(const block_t *b)
+{
+	return (b->size & BLOCK_FREE) != 0U;
+}
+
+static inline block_t *block_next(const block_t *b)
+{
+	return (block_t *)((uint8_t *)b + BLOCK_HEADER + block_size(b));
+}
+
+static inline void *block_ptr(const block_t *b)
+{
+	return (uint8_t *)b + BLOCK_HEADER;
+}
+
+static inline block_t *block_from_ptr(const void *ptr)
+{
+	return (block_t *)((uint8_t *)ptr - BLOCK_HEADER);
+}
+
+static void mapping_insert(uint32_t size, uint32_t *fl, uint32_t *sl)
+{
+	if (size < SMALL_BLOCK)
+	{
+		*fl = 0;
+		*sl = size / (SMALL_BLOCK / SL_COUNT);
+	}
+	else
+	{
+		uint32_t f = fls32(size);
+
+		*sl = (size >> (f - SL_LOG2)) ^ SL_COUNT;
+		*fl = f - (FL_SHIFT - 1U);
+	}
+}
+
+/* Class whose every block is large enough: round the size up to the next class */
+static void mapping_search(uint32_t size, uint32_t *fl, uint32_t *sl)
+{
+	if (size >= SMALL_BLOCK)
+		size += (1U << (fls32(size) - SL_LOG2)) - 1U;
+	mapping_insert(size, fl, sl);
+}
+
+static block_t *search_suitable(arena_t *a, uint32_t *fl, uint32_t *sl)
+{
+	uint32_t sl_map = a->sl_bitmap[*fl] & (~0U << *sl);
+
+	if (sl_map == 0U)
+	{
+		uint32_t fl_map = (*fl + 1U < 32U) ? (a->fl_bitmap & (~0U << (*fl + 1U))) : 0U;
+
+		if (fl_map == 0U)
+			return NULL;
+		*fl = ffs32(fl_map);
+		sl_map = a->sl_bitmap[*fl];
+	}
+	*sl = ffs32(sl_map);
+	return a->blocks[*fl][*sl];
+}
+
+static void remove_free(arena_t *a, block_t *b)
+{
+	uint32_t fl, sl;
+
+	mapping_insert(block_size(b), &fl, &sl);
+	if (b->prev_free != NULL)
+		b->prev_free->next_free = b->next_free;
+	else
+		a->blocks[fl][sl] = b->next_free;
+	if (b->next_free != NULL)
+		b->next_free->prev_free = b->prev_free;
+
+	if (a->blocks[fl][sl] == NULL)
+	{
+		a->sl_bitmap[fl] &= ~(1U << sl);
+		if (a->sl_bitmap[fl] == 0U)
+			a->fl_bitmap &= ~(1U << fl);
+	}
+}
+
+static void insert_free(arena_t *a, block_t *b)
+{
+	uint32_t fl, sl;
+
+	mapping_insert(block_size(b), &fl, &sl);
+	b->size |= BLOCK_FREE;
+	b->prev_free = NULL;
+	b->next_free = a->blocks[fl][sl];
+	if (b->next_free != NULL)
+		b->next_free->prev_free = b;
+	a->blocks[fl][sl] = b;
+	a->sl_bitmap[fl] |= 1U << sl;
+	a->fl_bitmap |= 1U << fl;
+}
+
+/* Cut the tail of a block past size bytes into a free block */
+static void split(arena_t *a, block_t *b, uint32_t size)
+{
+	uint32_t total = block_size(b);
+	block_t *rest;
+
+	if (total < size + BLOCK_HEADER + BLOCK_MIN)
+		return;
+
+	rest = (block_t *)((uint8_t *)block_ptr(b) + size);
+	rest->prev_phys = b;
+	rest->size = total - size - BLOCK_HEADER;
+	block_next(rest)->prev_phys = rest;
+	b->size = size | (b->size & BLOCK_FREE);
+	insert_free(a, rest);
+}
+
+/* Merge a block being freed with its free neighbours */
+static block_t *merge(arena_t *a, block_t *b)
+{
+	block_t *prev = b->prev_phys;
+	block_t *next = block_next(b);
+
+	if (block_is_free(next))
+	{
+		remove_free(a, next);
+		b->size = (block_size(b) + BLOCK_HEADER + block_size(next)) | (b->size & BLOCK_FREE);
+		block_next(b)->prev_phys = b;
+	}
+	if (prev != NULL && block_is_free(prev))
+	{
+		remove_free(a, prev);
+		prev->size = prev->size + BLOCK_HEADER + block_size(b);
+		block_next(prev)->prev_phys = prev;
+		b = prev;
+	}
+	return b;
+}
+
+static void arena_init(arena_t *a, uint8_t *mem, uint32_t bytes)
+{
+	block_t *b = (block_t *)mem;
+	block_t *sentinel;
+
+	memset(a, 0, sizeof(*a));
+	a->start = mem;
+	a->end = mem + bytes;
+
+	b->prev_phys = NULL;
+	b->size = (bytes - 2U * BLOCK_HEADER) & BLOCK_SIZE_MASK;
+	sentinel = block_next(b);
+	sentinel->prev_phys = b;
+	sentinel->size = 0;
+	insert_free(a, b);
+}
+
+static void heap_init(void)
+{
+	arena_init(&arenas[TLSF_HEAP_INTERNAL], ucHeap, sizeof(ucHeap));
+#if TLSF_HEAP_PSRAM_SIZE > 0
+	arena_init(&arenas[TLSF_HEAP_PSRAM], psram_heap, sizeof(psram_heap));
+#endif
+
+	/* Allocation times are measured with the cycle counter */
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	initialized = 1;
+	tlsf_heap_reset();
+}
+
+static arena_t *arena_of(const void *ptr, uint32_t *tag)
+{
+	for (uint32_t i = 0; i < TLSF_HEAP_TAGS; i++)
+	{
+		if ((const uint8_t *)ptr >= arenas[i].start && (const uint8_t *)ptr < arenas[i].end)
+		{
+			*tag = i;
+			return &arenas[i];
+		}
+	}
+	return NULL;
+}
+
+/* Called with the interrupts masked */
+static void *arena_alloc(uint32_t tag, size_t size)
+{
+	volatile tlsf_heap_arena_stats_t *s = &tlsf_heap_stats.arena[tag];
+	arena_t *a = &arenas[tag];
+	uint32_t start = DWT->CYCCNT;
+	uint32_t cycles, bucket;
+	uint32_t fl, sl;
+	block_t *b = NULL;
+
+	if (a->start != NULL && size != 0U && size < (1U << FL_MAX) / 2U)
+	{
+		size = (size + ALIGN_SIZE - 1U) & BLOCK_SIZE_MASK;
+		if (size < BLOCK_MIN)
+			size = BLOCK_MIN;
+
+		mapping_search(size, &fl, &sl);
+		b = (fl < FL_COUNT) ? search_suitable(a, &fl, &sl) : NULL;
+		if (b != NULL)
+		{
+			remove_free(a, b);
+			b->size &= ~BLOCK_FREE;
+			split(a, b, size);
+		}
+	}
+
+	if (b == NULL)
+	{
+		s->failures++;
+		return NULL;
+	}
+
+	s->allocs++;
+	s->used += block_size(b) + BLOCK_HEADER;
+	if (s->used > s->used_max)
+		s->used_max = s->used;
+
+	cycles = DWT->CYCCNT - start;
+	if (cycles > s->alloc_cycles_max)
+		s->alloc_cycles_max = cycles;
+	bucket = (cycles < 32U) ? 0U : fls32(cycles) - 4U;
+	if (bucket >= TLSF_HEAP_HIST_BUCKETS)
+		bucket = TLSF_HEAP_HIST_BUCKETS - 1U;
+	s->alloc_hist[bucket]++;
+
+	return block_ptr(b);
+}
+
+void *tlsf_heap_alloc(tlsf_heap_tag_t tag, size_t size)
+{
+	uint32_t primask;
+	void *ptr;
+
+	if ((uint32_t)tag >= TLSF_HEAP_TAGS)
+		return NULL;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	if (!initialized)
+		heap_init();
+	ptr = arena_alloc(tag, size);
+	__set_PRIMASK(primask);
+	return ptr;
+}
+
+void tlsf_heap_free(void *ptr)
+{
+	uint32_t primask;
+	uint32_t tag;
+	arena_t *a;
+	block_t *b;
+
+	if (ptr == NULL)
+		return;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	a = arena_of(ptr, &tag);
+	if (a != NULL)
+	{
+		b = block_from_ptr(ptr);
+		tlsf_heap_stats.arena[tag].frees++;
+		tlsf_heap_stats.arena[tag].used -= block_size(b) + BLOCK_HEADER;
+		insert_free(a, merge(a, b));
+	}
+	__set_PRIMASK(primask);
+}
+
+/* malloc placement: large requests in external RAM first */
+static void *lib_alloc(size_t size)
+{
+	tlsf_heap_tag_t first = (size >= TLSF_HEAP_PSRAM_THRESHOLD) ? TLSF_HEAP_PSRAM : TLSF_HEAP_INTERNAL;
+	void *ptr = tlsf_heap_alloc(first, size);
+
+	if (ptr == NULL)
+		ptr = tlsf_heap_alloc((tlsf_heap_tag_t)(first ^ 1U), size);
+	return ptr;
+}
+
+void *tlsf_heap_realloc(void *ptr, size_t size)
+{
+	uint32_t primask;
+	uint32_t tag;
+	uint32_t old;
+	void *p;
+
+	if (ptr == NULL)
+		return lib_alloc(size);
+	if (size == 0U)
+	{
+		tlsf_heap_free(ptr);
+		return NULL;
+	}
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	if (arena_of(ptr, &tag) == NULL)
+	{
+		__set_PRIMASK(primask);
+		return NULL;
+	}
+	old = block_size(block_from_ptr(ptr));
+	__set_PRIMASK(primask);
+
+	if (size <= old)
+		return ptr;
+
+	p = tlsf_heap_alloc((tlsf_heap_tag_t)tag, size);
+	if (p == NULL)
+		p = tlsf_heap_alloc((tlsf_heap_tag_t)(tag ^ 1U), size);
+	if (p != NULL)
+	{
+		memcpy(p, ptr, old);
+		tlsf_heap_free(ptr);
+	}
+	return p;
+}
+
+size_t tlsf_heap_free_size(tlsf_heap_tag_t tag, size_t *largest)
+{
+	uint32_t primask = __get_PRIMASK();
+	size_t size, max = 0;
+
+	__disable_irq();
+	if (!initialized)
+		heap_init();
+	size = tlsf_heap_stats.arena[tag].size - tlsf_heap_stats.arena[tag].used;
+	if (arenas[tag].fl_bitmap != 0U)
+	{
+		/* The largest block is in the highest non-empty class */
+		uint32_t fl = fls32(arenas[tag].fl_bitmap);
+		uint32_t sl = fls32(arenas[tag].sl_bitmap[fl]);
+
+		for (block_t *b = arenas[tag].blocks[fl][sl]; b != NULL; b = b->next_free)
+		{
+			if (block_size(b) > max)
+				max = block_size(b);
+		}
+	}
+	__set_PRIMASK(primask);
+
+	if (largest != NULL)
+		*largest = max;
+	return size;
+}
+
+/*
+ * ---- FreeRTOS heap, internal arena only ----
+ *
+ * heap_4.c stays in the project, CubeMX adds it back on every generation.
+ * The link redirects its API here with -Wl,--wrap (project settings), its
+ * own code is then unreferenced and removed with --gc-sections.
+ */
+
+static size_t min_ever_free = configTOTAL_HEAP_SIZE;
+
+void *__wrap_pvPortMalloc(size_t xWantedSize)
+{
+	void *ptr = tlsf_heap_alloc(TLSF_HEAP_INTERNAL, xWantedSize);
+	size_t free_size = tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].size - tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].used;
+
+	if (free_size < min_ever_free)
+		min_ever_free = free_size;
+#if (configUSE_MALLOC_FAILED_HOOK == 1)
+	if (ptr == NULL)
+	{
+		extern void vApplicationMallocFailedHook(void);
+		vApplicationMallocFailedHook();
+	}
+#endif
+	return ptr;
+}
+
+void __wrap_vPortFree(void *pv)
+{
+	tlsf_heap_free(pv);
+}
+
+size_t __wrap_xPortGetFreeHeapSize(void)
+{
+	return tlsf_heap_free_size(TLSF_HEAP_INTERNAL, NULL);
+}
+
+size_t __wrap_xPortGetMinimumEverFreeHeapSize(void)
+{
+	return min_ever_free;
+}
+
+void __wrap_vPortInitialiseBlocks(void)
+{
+}
+
+void *__wrap_pvPortCalloc(size_t xNum, size_t xSize)
+{
+	void *ptr = NULL;
+
+	if (xSize == 0U || xNum <= SIZE_MAX / xSize)
+	{
+		ptr = __wrap_pvPortMalloc(xNum * xSize);
+		if (ptr != NULL)
+			memset(ptr, 0, xNum * xSize);
+	}
+	return ptr;
+}
+
+void __wrap_vPortGetHeapStats(HeapStats_t *pxHeapStats)
+{
+	const arena_t *a = &arenas[TLSF_HEAP_INTERNAL];
+	size_t smallest = SIZE_MAX, largest = 0, blocks = 0;
+	uint32_t primask = __get_PRIMASK();
+
+	/* Walks the free lists, for diagnostics only */
+	__disable_irq();
+	for (uint32_t fl = 0; fl < FL_COUNT; fl++)
+	{
+		for (uint32_t sl = 0; sl < SL_COUNT; sl++)
+		{
+			for (const block_t *b = a->blocks[fl][sl]; b != NULL; b = b->next_free)
+			{
+				if (block_size(b) < smallest)
+					smallest = block_size(b);
+				if (block_size(b) > largest)
+					largest = block_size(b);
+				blocks++;
+			}
+		}
+	}
+	pxHeapStats->xAvailableHeapSpaceInBytes = tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].size
+			- tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].used;
+	pxHeapStats->xNumberOfSuccessfulAllocations = tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].allocs;
+	pxHeapStats->xNumberOfSuccessfulFrees = tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].frees;
+	__set_PRIMASK(primask);
+
+	pxHeapStats->xSizeOfLargestFreeBlockInBytes = largest;
+	pxHeapStats->xSizeOfSmallestFreeBlockInBytes = blocks ? smallest : 0U;
+	pxHeapStats->xNumberOfFreeBlocks = blocks;
+	pxHeapStats->xMinimumEverFreeBytesRemaining = min_ever_free;
+}
+
+#if TLSF_HEAP_NEWLIB
+/* ---- newlib heap, both arenas ---- */
+
+void *_malloc_r(struct _reent *r, size_t size)
+{
+	void *ptr = lib_alloc(size);
+
+	if (ptr == NULL)
+		r->_errno = ENOMEM;
+	return ptr;
+}
+
+void _free_r(struct _reent *r, void *ptr)
+{
+	(void)r;
+	tlsf_heap_free(ptr);
+}
+
+void *_calloc_r(struct _reent *r, size_t n, size_t size)
+{
+	size_t total = n * size;
+	void *ptr;
+
+	if (size != 0U && total / size != n)
+	{
+		r->_errno = ENOMEM;
+		return NULL;
+	}
+	ptr = _malloc_r(r, total);
+	if (ptr != NULL)
+		memset(ptr, 0, total);
+	return ptr;
+}
+
+void *_realloc_r(struct _reent *r, void *ptr, size_t size)
+{
+	void *p = tlsf_heap_realloc(ptr, size);
+
+	if (p == NULL && size != 0U)
+		r->_errno = ENOMEM;
+	return p;
+}
+
+void *malloc(size_t size)
+{
+	return _malloc_r(_REENT, size);
+}
+
+void free(void *ptr)
+{
+	tlsf_heap_free(ptr);
+}
+
+void *calloc(size_t n, size_t size)
+{
+	return _calloc_r(_REENT, n, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+	return _realloc_r(_REENT, ptr, size);
+}
+#endif /* TLSF_HEAP_NEWLIB */
+
+void tlsf_heap_reset(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	for (uint32_t i = 0; i < TLSF_HEAP_TAGS; i++)
+	{
+		volatile tlsf_heap_arena_stats_t *s = &tlsf_heap_stats.arena[i];
+		uint32_t used = s->used;
+
+		memset((void *)s, 0, sizeof(*s));
+		if (arenas[i].start != NULL)
+			s->size = (uint32_t)(arenas[i].end - arenas[i].start) - BLOCK_HEADER;
+		s->used = used;
+		s->used_max = used;
+	}
+	tlsf_heap_stats.start_tick = HAL_GetTick();
+	__set_PRIMASK(primask);
+}
+
+void tlsf_heap_print(void)
+{
+	static const char *const names[TLSF_HEAP_TAGS] = { "internal", "psram" };
+	tlsf_heap_stats_t s;
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	memcpy(&s, (const void *)&tlsf_heap_stats, sizeof(s));
+	__set_PRIMASK(primask);
+
+	printf("\r\nheap: %lu ms\r\n", HAL_GetTick() - s.start_tick);
+	for (uint32_t i = 0; i < TLSF_HEAP_TAGS; i++)
+	{
+		const tlsf_heap_arena_stats_t *a = &s.arena[i];
+		size_t largest;
+		size_t free_size;
+
+		if (a->size == 0U)
+			continue;
+
+		free_size = tlsf_heap_free_size((tlsf_heap_tag_t)i, &largest);
+		printf("%s: %lu/%lu bytes used, max %lu, %lu allocs, %lu frees, %lu failed, fragmentation %lu permille\r\n",
+				names[i], a->used, a->size, a->used_max, a->allocs, a->frees, a->failures,
+				free_size ? (uint32_t)(1000U - (uint64_t)largest * 1000U / free_size) : 0U);
+		printf("  alloc cycles max %lu:", a->alloc_cycles_max);
+		for (uint32_t b = 0; b < TLSF_HEAP_HIST_BUCKETS; b++)
+		{
+			if (a->alloc_hist[b] != 0U)
+				printf(" <%lu:%lu", 1UL << (b + 5U), a->alloc_hist[b]);
+		}
+		printf("\r\n");
+	}
+}
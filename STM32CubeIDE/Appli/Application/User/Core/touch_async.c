@@ -0,0 +1,339 @@
+/*
+ * touch_async.c
+ *
+ * Interrupt driven GT911 touch sampling, see touch_async.h
+ */
+#include "touch_async.h"
+#include <stdio.h>
+#include <string.h>
+
+#define GT911_STATUS_REG            0x814E
+#define GT911_POINT_REG             0x814F  /* Track id of the first point */
+#define GT911_POINT_SIZE            8
+#define GT911_STATUS_READY          0x80
+#define GT911_STATUS_COUNT          0x0F
+
+#define NO_POINT                    0xFF
+
+typedef enum
+{
+	CHAIN_IDLE = 0,
+	CHAIN_STATUS,
+	CHAIN_POINTS,
+	CHAIN_CLEAR
+} chain_t;
+
+volatile touch_async_stats_t touch_async_stats;
+
+static volatile chain_t chain;
+static volatile uint8_t pending;
+static uint8_t rx[TOUCH_ASYNC_MAX_POINTS * GT911_POINT_SIZE];
+static uint8_t status;
+static uint8_t zero;
+
+static i2c_bus_xfer_t status_xfer;
+static i2c_bus_xfer_t points_xfer;
+static i2c_bus_xfer_t clear_xfer;
+
+/* Mailbox, odd sequence while the bus task writes it */
+static volatile uint32_t sequence;
+static touch_sample_t mailbox;
+
+/* Filter state, only used by the reading task */
+static uint8_t primary_id = NO_POINT;
+static int16_t last_x;
+static int16_t last_y;
+static uint32_t pinch_start;
+
+static void publish(uint8_t count)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	sequence++;
+	__DMB();
+	mailbox.count = count;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		const uint8_t *p = &rx[i * GT911_POINT_SIZE];
+
+		mailbox.point[i].id = p[0];
+		mailbox.point[i].x = p[1] | (p[2] << 8);
+		mailbox.point[i].y = p[3] | (p[4] << 8);
+		mailbox.point[i].size = p[5] | (p[6] << 8);
+	}
+	mailbox.tick = HAL_GetTick();
+	__DMB();
+	sequence++;
+	__set_PRIMASK(primask);
+	touch_async_stats.samples++;
+}
+
+/* Called with the interrupts masked */
+static void chain_start(void)
+{
+	chain = CHAIN_STATUS;
+	if (i2c_bus_submit(&status_xfer) != I2C_BUS_OK)
+	{
+		touch_async_stats.errors++;
+		chain = CHAIN_IDLE;
+	}
+}
+
+static void chain_end(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	chain = CHAIN_IDLE;
+	if (pending)
+	{
+		pending = 0;
+		chain_start();
+	}
+	__set_PRIMASK(primask);
+}
+
+static void chain_next(i2c_bus_xfer_t *xfer, chain_t next)
+{
+	chain = next;
+	if (i2c_bus_submit(xfer) != I2C_BUS_OK)
+	{
+		touch_async_stats.errors++;
+		chain_end();
+	}
+}
+
+static void clear_done(i2c_bus_xfer_t *xfer, int result)
+{
+	(void)xfer;
+	if (result != I2C_BUS_OK)
+		touch_async_stats.errors++;
+	chain_end();
+}
+
+static void points_done(i2c_bus_xfer_t *xfer, int result)
+{
+	if (result != I2C_BUS_OK)
+		touch_async_stats.errors++;
+	else
+		publish(xfer->length / GT911_POINT_SIZE);
+	chain_next(&clear_xfer, CHAIN_CLEAR);
+}
+
+static void status_done(i2c_bus_xfer_t *xfer, int result)
+{
+	uint8_t count;
+
+	(void)xfer;
+	if (result != I2C_BUS_OK)
+	{
+		touch_async_stats.errors++;
+		chain_end();
+		return;
+	}
+	if (!(status & GT911_STATUS_READY))
+	{
+		/* Nothing new, no clear needed */
+		chain_end();
+		return;
+	}
+
+	count = status & GT911_STATUS_COUNT;
+	if (count > TOUCH_ASYNC_MAX_POINTS)
+		count = 0;
+	if (count == 0)
+	{
+		publish(0);
+		chain_next(&clear_xfer, CHAIN_CLEAR);
+		return;
+	}
+	points_xfer.length = count * GT911_POINT_SIZE;
+	chain_next(&points_xfer, CHAIN_POINTS);
+}
+
+static void xfer_setup(i2c_bus_xfer_t *xfer, uint8_t read, uint16_t reg, uint8_t *data,
+		uint16_t length, i2c_bus_done_t done)
+{
+	memset(xfer, 0, sizeof(*xfer));
+	xfer->client = I2C_BUS_CLIENT_TOUCH;
+	xfer->priority = I2C_BUS_PRIO_TOUCH;
+	xfer->read = read;
+	xfer->reg_size = I2C_MEMADD_SIZE_16BIT;
+	xfer->addr = TOUCH_ASYNC_I2C_ADDR;
+	xfer->reg = reg;
+	xfer->data = data;
+	xfer->length = length;
+	xfer->done = done;
+}
+
+int touch_async_init(void)
+{
+	uint32_t primask;
+
+	touch_async_reset();
+	xfer_setup(&status_xfer, 1, GT911_STATUS_REG, &status, 1, status_done);
+	xfer_setup(&points_xfer, 1, GT911_POINT_REG, rx, GT911_POINT_SIZE, points_done);
+	xfer_setup(&clear_xfer, 0, GT911_STATUS_REG, &zero, 1, clear_done);
+
+	/* A report may be waiting since the reset, its edge is gone */
+	primask = __get_PRIMASK();
+	__disable_irq();
+	if (chain == CHAIN_IDLE)
+		chain_start();
+	__set_PRIMASK(primask);
+
+	return (chain == CHAIN_IDLE) ? TOUCH_ASYNC_ERROR : TOUCH_ASYNC_OK;
+}
+
+void touch_async_irq(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	touch_async_stats.irqs++;
+	if (status_xfer.data == NULL)
+		return;
+
+	__disable_irq();
+	if (chain != CHAIN_IDLE)
+	{
+		pending = 1;
+		touch_async_stats.coalesced++;
+	}
+	else
+	{
+		chain_start();
+	}
+	__set_PRIMASK(primask);
+}
+
+uint32_t touch_async_read(touch_sample_t *sample)
+{
+	uint32_t seq;
+
+	do
+	{
+		seq = sequence;
+		__DMB();
+		memcpy(sample, &mailbox, sizeof(*sample));
+		__DMB();
+	} while ((seq & 1U) || seq != sequence);
+
+	return seq;
+}
+
+static uint32_t isqrt(uint32_t v)
+{
+	uint32_t r = 0;
+	uint32_t bit = 1UL << 30;
+
+	while (bit > v)
+		bit >>= 2;
+	while (bit != 0)
+	{
+		if (v >= r + bit)
+		{
+			v -= r + bit;
+			r = (r >> 1) + bit;
+		}
+		else
+		{
+			r >>= 1;
+		}
+		bit >>= 2;
+	}
+	return r;
+}
+
+void touch_async_state(touch_state_t *state)
+{
+	touch_sample_t s;
+	const touch_point_t *primary = NULL;
+
+	touch_async_read(&s);
+	if (HAL_GetTick() - s.tick > TOUCH_ASYNC_TIMEOUT_MS)
+		s.count = 0;
+
+	memset(state, 0, sizeof(*state));
+	state->fingers = s.count;
+
+	if (s.count == 0)
+	{
+		primary_id = NO_POINT;
+		pinch_start = 0;
+		return;
+	}
+
+	if (primary_id == NO_POINT)
+	{
+		/* First contact, no jitter filter */
+		primary_id = s.point[0].id;
+		last_x = s.point[0].x;
+		last_y = s.point[0].y;
+	}
+	for (uint32_t i = 0; i < s.count; i++)
+	{
+		if (s.point[i].id == primary_id)
+			primary = &s.point[i];
+	}
+	/* Primary lifted with other fingers down: released until all are up */
+	if (primary == NULL)
+		return;
+
+	state->pressed = 1;
+	if (s.count >= 2)
+	{
+		int32_t dx = (int32_t)s.point[1].x - s.point[0].x;
+		int32_t dy = (int32_t)s.point[1].y - s.point[0].y;
+		uint32_t dist = isqrt((uint32_t)(dx * dx + dy * dy));
+
+		if (pinch_start == 0)
+			pinch_start = dist ? dist : 1;
+		state->pinch_permille = (uint16_t)((dist * 1000U) / pinch_start);
+		state->pinch_x = (s.point[0].x + s.point[1].x) / 2;
+		state->pinch_y = (s.point[0].y + s.point[1].y) / 2;
+	}
+	else
+	{
+		int32_t dx = (int32_t)primary->x - last_x;
+		int32_t dy = (int32_t)primary->y - last_y;
+
+		pinch_start = 0;
+		if (dx > TOUCH_ASYNC_JITTER_PX || dx < -TOUCH_ASYNC_JITTER_PX
+				|| dy > TOUCH_ASYNC_JITTER_PX || dy < -TOUCH_ASYNC_JITTER_PX)
+		{
+			last_x = primary->x;
+			last_y = primary->y;
+		}
+	}
+	state->x = last_x;
+	state->y = last_y;
+}
+
+void touch_async_reset(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	memset((void *)&touch_async_stats, 0, sizeof(touch_async_stats));
+	touch_async_stats.start_tick = HAL_GetTick();
+	__set_PRIMASK(primask);
+}
+
+void touch_async_print(void)
+{
+	touch_async_stats_t s;
+	uint32_t primask = __get_PRIMASK();
+	uint32_t ms;
+
+	__disable_irq();
+	memcpy(&s, (const void *)&touch_async_stats, sizeof(s));
+	__set_PRIMASK(primask);
+
+	ms = HAL_GetTick() - s.start_tick;
+	if (s.irqs == 0 || ms == 0)
+		return;
+
+	printf("\r\ntouch: %lu irqs in %lu ms, %lu samples, %lu coalesced, %lu errors\r\n",
+			s.irqs, ms, s.samples, s.coalesced, s.errors);
+}
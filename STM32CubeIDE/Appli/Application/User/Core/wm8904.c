@@ -85,6 +85,12 @@ static uint32_t WM8904_CurrentDevices = WM8904_OUT_NONE;
 static int32_t WM8904_ReadRegWrap(void *handle, uint16_t Reg, uint8_t* Data, uint16_t Length);
 static int32_t WM8904_WriteRegWrap(void *handle, uint16_t Reg, uint8_t* Data, uint16_t Length);
 static void    WM8904_Delay(const WM8904_Object_t *pObj, uint32_t Delay);
+static uint8_t WM8904_IsVolatile(uint16_t Reg);
+static uint8_t WM8904_IsCached(const WM8904_Object_t *pObj, uint16_t Reg, uint16_t Value);
+static int32_t WM8904_Stage(WM8904_Object_t *pObj, uint16_t Reg, uint16_t Value, uint8_t Force);
+static int32_t WM8904_WriteCached(WM8904_Object_t *pObj, uint16_t Reg, uint16_t Value);
+static int32_t WM8904_ReadCached(WM8904_Object_t *pObj, uint16_t Reg, uint16_t *Value);
+static int32_t WM8904_Flush(WM8904_Object_t *pObj);
 /**
   * @}
   */
@@ -114,38 +120,39 @@ int32_t WM8904_Init(WM8904_Object_t *pObj, WM8904_Init_t *pInit)
   /*********/
 
   tmp = 0x0U; /* Reset registers */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_SW_RESET, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_SW_RESET, tmp);
 
   /**************/
   /* Clock rate */
   /**************/
 
   tmp = 0x0004U; /* CLK_SYS_ENA = 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_CLOCK_RATES2, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_CLOCK_RATES2, tmp);
 
   /**************************************/
   /* Reference voltages and master bias */
   /**************************************/
 
   tmp = 0x0018U; /* ISEL[1:0] = 10b, BIAS_EN = 0 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_BIAS_CONTROL0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_BIAS_CONTROL0, tmp);
 
   tmp = 0x0047U; /* VMID_BUF_ENA = 1, VMID_RES[1:0] = 11b, VMID_ENA = 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_VMID_CONTROL0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_VMID_CONTROL0, tmp);
+  ret += WM8904_Flush(pObj);
   WM8904_Delay(pObj, 100U);
 
   tmp = 0x0043U; /* VMID_BUF_ENA = 1, VMID_RES[1:0] = 01b, VMID_ENA = 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_VMID_CONTROL0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_VMID_CONTROL0, tmp);
 
   tmp = 0x0019U; /* ISEL[1:0] = 10b, BIAS_EN = 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_BIAS_CONTROL0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_BIAS_CONTROL0, tmp);
 
   /********************/
   /* Mic BIAS control */
   /********************/
 
   tmp = 0x0001U; /* MICBIAS_ENA = 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_MIC_BIAS_CONTROL0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_MIC_BIAS_CONTROL0, tmp);
 
   /**********************/
   /* Power management   */
@@ -163,17 +170,17 @@ int32_t WM8904_Init(WM8904_Object_t *pObj, WM8904_Init_t *pInit)
   {
     tmp = 0x0000U; /* INx_ENA = 0 */
   }
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_PWR_MANAGEMENT0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_PWR_MANAGEMENT0, tmp);
 
   tmp = 0x0003U; /* HPL_PGA_ENA = HPR_PGA_ENA = 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_PWR_MANAGEMENT2, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_PWR_MANAGEMENT2, tmp);
 
   /**************/
   /* Clock rate */
   /**************/
 
   tmp = 0x0006U; /* CLK_DSP_ENA = CLK_SYS_ENA = 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_CLOCK_RATES2, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_CLOCK_RATES2, tmp);
 
   /**************/
   /* DAC and ADC*/
@@ -191,24 +198,24 @@ int32_t WM8904_Init(WM8904_Object_t *pObj, WM8904_Init_t *pInit)
   {
     tmp = 0x000EU; /* ADCL_ENA = DACL_ENA = DACR_ENA = 1, ADCR_ENA = 0 */
   }
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_PWR_MANAGEMENT6, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_PWR_MANAGEMENT6, tmp);
 
   if (pInit->InputDevice == WM8904_IN_DIGITAL_MIC2)
   {
     tmp = 0x1800U; /* DMIC_ENA = 1, DMIC_SRC = IN1R/DMICDAT2 */
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_DIGITAL_MICROPHONE0, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_DIGITAL_MICROPHONE0, tmp);
 
     tmp = 0x0008U; /* GPIO1_PU = GPIO1_PD = 0, GPIO1_SEL = 8 (DMIC clock out) */
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_GPIO_CONTROL1, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_GPIO_CONTROL1, tmp);
 
     tmp = 0x81AFU; /* DRC_ENA = 1, DRC_DAC_PATH = ADC */
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_DRC0, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_DRC0, tmp);
 
     tmp = 0x32C1U; /* DRC_MINGAIN = 0dB, DRC_MAXGAIN = 18dB */
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_DRC1, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_DRC1, tmp);
 
     tmp = 0x002CU; /* DRC_HIGH_COMP = DRC_LO_COMP = 0 */
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_DRC2, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_DRC2, tmp);
 
     if (pInit->Frequency >= WM8904_FREQUENCY_32K)
     {
@@ -218,25 +225,25 @@ int32_t WM8904_Init(WM8904_Object_t *pObj, WM8904_Init_t *pInit)
     {
       tmp = 0x0001U; /* ADC_OSR128 = 1 (128xfs) */
     }
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_ADC0, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_ANALOG_ADC0, tmp);
   }
   else
   {
     tmp = 0x0000U; /* DMIC_ENA = 0 */
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_DIGITAL_MICROPHONE0, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_DIGITAL_MICROPHONE0, tmp);
 
     tmp = 0x0014U; /* GPIO1_PU = GPIO1_PD = 1, GPIO1_SEL = 4 (IRQ, default value) */
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_GPIO_CONTROL1, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_GPIO_CONTROL1, tmp);
 
     tmp = 0x01AFU; /* DRC_ENA = 0, DRC_DAC_PATH = ADC */
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_DRC0, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_DRC0, tmp);
 
     tmp = 0x0001U; /* ADC_OSR128 = 1 (128xfs) */
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_ADC0, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_ANALOG_ADC0, tmp);
   }
 
   tmp = 0x0648U; /* DAC_MUTERATE = DAC_UNMUTE_RAMP = DAC_OSR128 = DAC_MUTE = 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_DAC_DIGITAL1, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_DAC_DIGITAL1, tmp);
 
   if (pInit->InputDevice == WM8904_IN_LINE2)
   {
@@ -250,14 +257,14 @@ int32_t WM8904_Init(WM8904_Object_t *pObj, WM8904_Init_t *pInit)
   {
     tmp = 0x0010U; /* AIFADCL_SRC = 0 (Left), AIFADCR_SRC = 0 (Left) */
   }
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_AUDIO_INTERFACE0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_AUDIO_INTERFACE0, tmp);
 
   /**********************************************/
   /* Resolution, protocol, frequency and volume */
   /**********************************************/
 
   tmp = 0x0002U; /* Set resolution to 16B and protocol to I2S*/
-  ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_AUDIO_INTERFACE1, &tmp, 2U);
+  ret +=  WM8904_WriteCached(pObj, WM8904_AUDIO_INTERFACE1, tmp);
 
   ret += WM8904_SetFrequency(pObj, pInit->Frequency);
 
@@ -269,38 +276,38 @@ int32_t WM8904_Init(WM8904_Object_t *pObj, WM8904_Init_t *pInit)
   if (pInit->InputDevice == WM8904_IN_LINE2)
   {
     tmp = 0x01C0U; /* ADC_VU = 1, ADC_VOL = +0dB */
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ADC_DIGITAL_VOL_LEFT, &tmp, 2U);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ADC_DIGITAL_VOL_LEFT, tmp);
 
     tmp = 0x01C0U; /* ADC_VU = 1, ADC_VOL = +0dB */
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ADC_DIGITAL_VOL_RIGHT, &tmp, 2U);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ADC_DIGITAL_VOL_RIGHT, tmp);
 
     tmp = 0x0080U; /* LINMUTE = 1, LIN_VOL = -1.5dB */
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_LEFT_INPUT0, &tmp, 2U);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ANALOG_LEFT_INPUT0, tmp);
 
     tmp = 0x0080U; /* LINMUTE = 1, LIN_VOL = -1.5dB */
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_RIGHT_INPUT0, &tmp, 2U);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ANALOG_RIGHT_INPUT0, tmp);
 
     tmp = 0x0014U; /* INL_CM_ENA = 0, L_IP_SEL_N[1:0] = IN2L (01b) */
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_LEFT_INPUT1, &tmp, 2U);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ANALOG_LEFT_INPUT1, tmp);
 
     tmp = 0x0014U; /* INR_CM_ENA = 0, R_IP_SEL_N[1:0] = IN2R (01b) */
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_RIGHT_INPUT1, &tmp, 2U);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ANALOG_RIGHT_INPUT1, tmp);
   }
   else if (pInit->InputDevice == WM8904_IN_MIC1)
   {
     tmp = 0x01FFU; /* ADC_VU = 1, ADC_VOL = +17dB */
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ADC_DIGITAL_VOL_LEFT, &tmp, 2U);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ADC_DIGITAL_VOL_LEFT, tmp);
 
     tmp = 0x009AU; /* LINMUTE = 1, LIN_VOL = +14dB */
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_LEFT_INPUT0, &tmp, 2U);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ANALOG_LEFT_INPUT0, tmp);
 
     tmp = 0x0044U; /* INL_CM_ENA = 1, L_IP_SEL_N[1:0] = IN1L (00b) */
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_LEFT_INPUT1, &tmp, 2U);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ANALOG_LEFT_INPUT1, tmp);
   }
   else /* WM8904_IN_DIGITAL_MIC2 */
   {
     tmp = 0x0100U; /* ADC_VU = 1, ADC_VOL = Mute */
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ADC_DIGITAL_VOL_LEFT, &tmp, 2U);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ADC_DIGITAL_VOL_LEFT, tmp);
   }
 
   /***************/
@@ -308,35 +315,36 @@ int32_t WM8904_Init(WM8904_Object_t *pObj, WM8904_Init_t *pInit)
   /***************/
 
   tmp = 0x0001U; /* CP_ENA = 1  */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_CHARGE_PUMP0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_CHARGE_PUMP0, tmp);
 
   /**********************/
   /* Output signal path */
   /**********************/
 
   tmp = 0x0011U; /* HPL_ENA = HPR_ENA = 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_HP0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_ANALOG_HP0, tmp);
 
   tmp = 0x0033U; /* HPL_ENA_DLY = HPR_ENA_DLY = HPL_ENA = HPR_ENA = 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_HP0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_ANALOG_HP0, tmp);
 
   /************/
   /* DC Servo */
   /************/
 
   tmp = 0x0003U; /* Enable channels 0 and 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_DC_SERVO0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_DC_SERVO0, tmp);
 
   tmp = 0x0030U; /* Startup 0 and 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_DC_SERVO1, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_DC_SERVO1, tmp);
 
+  ret += WM8904_Flush(pObj);
   iter_count = 0;
   tmp = 0x0000U;
   while(((tmp & 0x0003U) != 0x0003U) && (iter_count < 30U)) /* Wait DC Servo start-up completion */
   {
     iter_count ++;
     WM8904_Delay(pObj, 10U);
-    ret += wm8904_read_reg(&pObj->Ctx, WM8904_DC_SERVO_READBACK0, &tmp, 2U);
+    ret += WM8904_ReadCached(pObj, WM8904_DC_SERVO_READBACK0, &tmp);
   }
 
   /**********************/
@@ -344,17 +352,18 @@ int32_t WM8904_Init(WM8904_Object_t *pObj, WM8904_Init_t *pInit)
   /**********************/
 
   tmp = 0x0077U; /* HPL_ENA_OUTP= HPL_ENA_OUTR = HPL_ENA_DLY = HPR_ENA_DLY = HPL_ENA = HPR_ENA = 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_HP0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_ANALOG_HP0, tmp);
 
   tmp = 0x00FFU; /* HPL_RMV_SHORT = HPR_RMV_SHORT = HPL_ENA_OUTP= HPL_ENA_OUTR = HPL_ENA_DLY = HPR_ENA_DLY = HPL_ENA = HPR_ENA = 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_HP0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_ANALOG_HP0, tmp);
 
   /***************/
   /* Charge pump */
   /***************/
 
   tmp = 0x01U; /* CP_DYN_PWR = 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_CLASS_W0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_CLASS_W0, tmp);
+  ret += WM8904_Flush(pObj);
 
   /* Store current devices */
   WM8904_CurrentDevices = (pInit->OutputDevice | pInit->InputDevice);
@@ -379,82 +388,84 @@ int32_t WM8904_DeInit(WM8904_Object_t *pObj)
   /**********************/
 
   tmp = 0x0077U; /* HPL_RMV_SHORT = HPR_RMV_SHORT = 0 */
-  ret = wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_HP0, &tmp, 2U);
+  ret = WM8904_WriteCached(pObj, WM8904_ANALOG_HP0, tmp);
 
   tmp = 0x0000U; /* HPL_ENA_OUTP= HPL_ENA_OUTR = HPL_ENA_DLY = HPR_ENA_DLY = HPL_ENA = HPR_ENA = 0 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_HP0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_ANALOG_HP0, tmp);
 
   /************/
   /* DC Servo */
   /************/
 
   tmp = 0x0000U; /* Disable channels 0 and 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_DC_SERVO0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_DC_SERVO0, tmp);
 
   /***************/
   /* Charge pump */
   /***************/
 
   tmp = 0x0000U; /* CP_ENA = 0  */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_CHARGE_PUMP0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_CHARGE_PUMP0, tmp);
 
   /*******/
   /* DAC */
   /*******/
 
   tmp = 0x0000U; /* ADCL_ENA = DACL_ENA = DACR_ENA = 0 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_PWR_MANAGEMENT6, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_PWR_MANAGEMENT6, tmp);
 
   /**************/
   /* Clock rate */
   /**************/
 
   tmp = 0x0004U; /* CLK_DSP_ENA = 0, CLK_SYS_ENA = 1 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_CLOCK_RATES2, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_CLOCK_RATES2, tmp);
 
   /**********************/
   /* Output signal path */
   /**********************/
 
   tmp = 0x0000U; /* HPL_PGA_ENA = HPR_PGA_ENA = 0 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_PWR_MANAGEMENT2, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_PWR_MANAGEMENT2, tmp);
 
   tmp = 0x0000U; /* INL_ENA = 0 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_PWR_MANAGEMENT0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_PWR_MANAGEMENT0, tmp);
 
   /********************/
   /* Mic BIAS control */
   /********************/
 
   tmp = 0x0000U; /* MICBIAS_ENA = 0 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_MIC_BIAS_CONTROL0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_MIC_BIAS_CONTROL0, tmp);
 
   /**************************************/
   /* Reference voltages and master bias */
   /**************************************/
 
   tmp = 0x0018U; /* ISEL[1:0] = 10b, BIAS_EN = 0 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_BIAS_CONTROL0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_BIAS_CONTROL0, tmp);
 
   tmp = 0x0042U; /* VMID_BUF_ENA = 1, VMID_RES[1:0] = 01b, VMID_ENA = 0 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_VMID_CONTROL0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_VMID_CONTROL0, tmp);
+  ret += WM8904_Flush(pObj);
   WM8904_Delay(pObj, 300U);
 
   tmp = 0x0042U; /* VMID_BUF_ENA = 1, VMID_RES[1:0] = 01b, VMID_ENA = 0 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_VMID_CONTROL0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_VMID_CONTROL0, tmp);
 
   tmp = 0x0000U; /* VMID_BUF_ENA = 0, VMID_RES[1:0] = 00b, VMID_ENA = 0 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_VMID_CONTROL0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_VMID_CONTROL0, tmp);
 
   tmp = 0x0018U; /* ISEL[1:0] = 10b,  BIAS_EN = 0 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_BIAS_CONTROL0, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_BIAS_CONTROL0, tmp);
 
   /**************/
   /* Clock rate */
   /**************/
 
   tmp = 0x0000U; /* CLK_SYS_ENA = 0 */
-  ret += wm8904_write_reg(&pObj->Ctx, WM8904_CLOCK_RATES2, &tmp, 2U);
+  ret += WM8904_WriteCached(pObj, WM8904_CLOCK_RATES2, tmp);
+  ret += WM8904_Flush(pObj);
 
   if (pObj->IsInitialized == 1U)
   {
@@ -479,7 +490,7 @@ int32_t WM8904_ReadID(WM8904_Object_t *pObj, uint32_t *Id)
   pObj->IO.Init();
 
   /* Get ID from component */
-  ret = wm8904_read_reg(&pObj->Ctx, WM8904_SW_RESET, &wm8904_id, 2U);
+  ret = WM8904_ReadCached(pObj, WM8904_SW_RESET, &wm8904_id);
 
   *Id = wm8904_id;
 
@@ -500,31 +511,33 @@ int32_t WM8904_Play(WM8904_Object_t *pObj)
   if ((WM8904_CurrentDevices & WM8904_OUT_HEADPHONE) == WM8904_OUT_HEADPHONE)
   {
     tmp = 0x0640U; /* DAC_MUTE= 0 */
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_DAC_DIGITAL1, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_DAC_DIGITAL1, tmp);
   }
 
 
   if ((WM8904_CurrentDevices & WM8904_IN_MIC1) == WM8904_IN_MIC1)
   {
     tmp = 0x001AU; /* LINMUTE = 0 */
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_LEFT_INPUT0, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_ANALOG_LEFT_INPUT0, tmp);
   }
 
   if ((WM8904_CurrentDevices & WM8904_IN_LINE2) == WM8904_IN_LINE2)
   {
     tmp = 0x0000U; /* LINMUTE = 0 */
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_LEFT_INPUT0, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_ANALOG_LEFT_INPUT0, tmp);
 
     tmp = 0x0000U; /* LINMUTE = 0 */
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_RIGHT_INPUT0, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_ANALOG_RIGHT_INPUT0, tmp);
   }
 
   if ((WM8904_CurrentDevices & WM8904_IN_DIGITAL_MIC2) == WM8904_IN_DIGITAL_MIC2)
   {
     tmp = 0x01F0U; /* ADC_VU = 1, ADC_VOL = +17,6dB */
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ADC_DIGITAL_VOL_LEFT, &tmp, 2U);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ADC_DIGITAL_VOL_LEFT, tmp);
   }
 
+  ret += WM8904_Flush(pObj);
+
   return ret;
 }
 
@@ -589,6 +602,7 @@ int32_t WM8904_Stop(WM8904_Object_t *pObj, uint32_t CodecPdwnMode)
 int32_t WM8904_SetVolume(WM8904_Object_t *pObj, uint32_t InputOutput, uint8_t Volume)
 {
   uint8_t  convertedvol;
+  uint8_t  update;
   int32_t  ret;
   uint16_t tmp;
 
@@ -599,11 +613,17 @@ int32_t WM8904_SetVolume(WM8904_Object_t *pObj, uint32_t InputOutput, uint8_t Vo
 
     tmp = (uint16_t) convertedvol;
 
+    /* The volume update bit of the right write latches both sides: both are
+       written when either changes, none when the codec already has them */
+    update = ((WM8904_IsCached(pObj, WM8904_ANALOG_OUTPUT1_LEFT, tmp) == 0U) ||
+              (WM8904_IsCached(pObj, WM8904_ANALOG_OUTPUT1_RIGHT, tmp | 0x80U) == 0U)) ? 1U : 0U;
+
     /* Left Headphone Volume */
-    ret = wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_OUTPUT1_LEFT, &tmp, 2U);
+    ret = WM8904_Stage(pObj, WM8904_ANALOG_OUTPUT1_LEFT, tmp, update);
     /* Right Headphone Volume */
     tmp |= 0x80U; /* Volume update */
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_OUTPUT1_RIGHT, &tmp, 2U);
+    ret += WM8904_Stage(pObj, WM8904_ANALOG_OUTPUT1_RIGHT, tmp, update);
+    ret += WM8904_Flush(pObj);
   }
   else /* Input volume */
   {
@@ -629,7 +649,7 @@ int32_t WM8904_GetVolume(WM8904_Object_t *pObj, uint32_t InputOutput, uint8_t *V
   if (InputOutput == VOLUME_OUTPUT)
   {
     /* Left Headphone Volume */
-    ret = wm8904_read_reg(&pObj->Ctx, WM8904_ANALOG_OUTPUT1_LEFT, &tmp, 2U);
+    ret = WM8904_ReadCached(pObj, WM8904_ANALOG_OUTPUT1_LEFT, &tmp);
     tmp &= 0x3FU;
 
     if (ret == WM8904_OK)
@@ -659,8 +679,8 @@ int32_t WM8904_SetMute(WM8904_Object_t *pObj, uint32_t Cmd)
 
   if ((WM8904_CurrentDevices & WM8904_OUT_HEADPHONE) == WM8904_OUT_HEADPHONE)
   {
-    /* Read DAC digital 1 */
-    ret += wm8904_read_reg(&pObj->Ctx, WM8904_DAC_DIGITAL1, &tmp, 2U);
+    /* Read DAC digital 1, from the shadow once written */
+    ret += WM8904_ReadCached(pObj, WM8904_DAC_DIGITAL1, &tmp);
 
     if(Cmd == WM8904_MUTE_ON)
     {
@@ -672,7 +692,7 @@ int32_t WM8904_SetMute(WM8904_Object_t *pObj, uint32_t Cmd)
       /* Unmute the the DAC Digital 1 */
       tmp &= ~(0x0008U);
     }
-    ret += wm8904_write_reg(&pObj->Ctx, WM8904_DAC_DIGITAL1, &tmp, 2U);
+    ret += WM8904_WriteCached(pObj, WM8904_DAC_DIGITAL1, tmp);
   }
 
   if ((WM8904_CurrentDevices & WM8904_IN_MIC1) == WM8904_IN_MIC1)
@@ -685,7 +705,7 @@ int32_t WM8904_SetMute(WM8904_Object_t *pObj, uint32_t Cmd)
     {
       tmp = 0x001AU; /* LINMUTE = 0 */
     }
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_LEFT_INPUT0, &tmp, 2U);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ANALOG_LEFT_INPUT0, tmp);
   }
 
   if ((WM8904_CurrentDevices & WM8904_IN_LINE2) == WM8904_IN_LINE2)
@@ -698,8 +718,8 @@ int32_t WM8904_SetMute(WM8904_Object_t *pObj, uint32_t Cmd)
     {
       tmp = 0x0000U; /* LINMUTE = 0 */
     }
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_LEFT_INPUT0, &tmp, 2U);
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ANALOG_RIGHT_INPUT0, &tmp, 2U);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ANALOG_LEFT_INPUT0, tmp);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ANALOG_RIGHT_INPUT0, tmp);
   }
 
   if ((WM8904_CurrentDevices & WM8904_IN_DIGITAL_MIC2) == WM8904_IN_DIGITAL_MIC2)
@@ -712,9 +732,11 @@ int32_t WM8904_SetMute(WM8904_Object_t *pObj, uint32_t Cmd)
     {
       tmp = 0x01F0U; /* ADC_VU = 1, ADC_VOL = +17,6dB */
     }
-    ret +=  wm8904_write_reg(&pObj->Ctx, WM8904_ADC_DIGITAL_VOL_RIGHT, &tmp, 2U);
+    ret +=  WM8904_WriteCached(pObj, WM8904_ADC_DIGITAL_VOL_RIGHT, tmp);
   }
 
+  ret += WM8904_Flush(pObj);
+
   return ret;
 }
 
@@ -762,7 +784,7 @@ int32_t WM8904_GetResolution(WM8904_Object_t *pObj, uint32_t *Resolution)
   int32_t  ret;
   uint16_t tmp;
 
-  ret = wm8904_read_reg(&pObj->Ctx, WM8904_AUDIO_INTERFACE1, &tmp, 2U);
+  ret = WM8904_ReadCached(pObj, WM8904_AUDIO_INTERFACE1, &tmp);
 
   switch((tmp >> 2U) & 0x0003U)
   {
@@ -811,7 +833,7 @@ int32_t WM8904_GetProtocol(WM8904_Object_t *pObj, uint32_t *Protocol)
   int32_t  ret;
   uint16_t tmp;
 
-  ret = wm8904_read_reg(&pObj->Ctx, WM8904_AUDIO_INTERFACE1, &tmp, 2U);
+  ret = WM8904_ReadCached(pObj, WM8904_AUDIO_INTERFACE1, &tmp);
 
   *Protocol = (((uint32_t) tmp) & 0x0003U);
 
@@ -834,39 +856,39 @@ int32_t WM8904_SetFrequency(WM8904_Object_t *pObj, uint32_t AudioFreq)
   case  WM8904_FREQUENCY_8K:
     /* Sample Rate = 8 (kHz), ratio=256 */
     tmp = 0x0C00U;
-    ret = wm8904_write_reg(&pObj->Ctx, WM8904_CLOCK_RATES1, &tmp, 2U);
+    ret = WM8904_WriteCached(pObj, WM8904_CLOCK_RATES1, tmp);
     break;
 
   case  WM8904_FREQUENCY_11K:
     /* Sample Rate = 11.025 (kHz), ratio=256 */
     tmp = 0x0C01U;
-    ret = wm8904_write_reg(&pObj->Ctx, WM8904_CLOCK_RATES1, &tmp, 2U);
+    ret = WM8904_WriteCached(pObj, WM8904_CLOCK_RATES1, tmp);
     break;
 
   case  WM8904_FREQUENCY_16K:
     /* Sample Rate = 16 (kHz), ratio=256 */
     tmp = 0x0C02U;
-    ret = wm8904_write_reg(&pObj->Ctx, WM8904_CLOCK_RATES1, &tmp, 2U);
+    ret = WM8904_WriteCached(pObj, WM8904_CLOCK_RATES1, tmp);
     break;
 
   case  WM8904_FREQUENCY_22K:
   case  WM8904_FREQUENCY_24K:
     /* Sample Rate = 22.050 (kHz) or 24 (kHz), ratio=256 */
     tmp = 0x0C03U;
-    ret = wm8904_write_reg(&pObj->Ctx, WM8904_CLOCK_RATES1, &tmp, 2U);
+    ret = WM8904_WriteCached(pObj, WM8904_CLOCK_RATES1, tmp);
     break;
 
   case  WM8904_FREQUENCY_32K:
     /* Sample Rate = 32 (kHz), ratio=256 */
     tmp = 0x0C04U;
-    ret = wm8904_write_reg(&pObj->Ctx, WM8904_CLOCK_RATES1, &tmp, 2U);
+    ret = WM8904_WriteCached(pObj, WM8904_CLOCK_RATES1, tmp);
     break;
 
   case  WM8904_FREQUENCY_44K:
   case  WM8904_FREQUENCY_48K:
     /* Sample Rate = 44.1 (kHz) or 48 (kHz), ratio=256 */
     tmp = 0x0C05U;
-    ret = wm8904_write_reg(&pObj->Ctx, WM8904_CLOCK_RATES1, &tmp, 2U);
+    ret = WM8904_WriteCached(pObj, WM8904_CLOCK_RATES1, tmp);
     break;
 
   default:
@@ -874,6 +896,8 @@ int32_t WM8904_SetFrequency(WM8904_Object_t *pObj, uint32_t AudioFreq)
     break;
   }
 
+  ret += WM8904_Flush(pObj);
+
   return ret;
 }
 
@@ -888,7 +912,7 @@ int32_t WM8904_GetFrequency(WM8904_Object_t *pObj, uint32_t *AudioFreq)
   int32_t  ret;
   uint16_t tmp;
 
-  ret = wm8904_read_reg(&pObj->Ctx, WM8904_CLOCK_RATES1, &tmp, 2U);
+  ret = WM8904_ReadCached(pObj, WM8904_CLOCK_RATES1, &tmp);
 
   switch(tmp & 0x0007U)
   {
@@ -933,7 +957,7 @@ int32_t WM8904_Reset(WM8904_Object_t *pObj)
 
   /* Reset Codec by writing in 0x0000 address register */
   tmp = 0x0U; /* Reset registers */
-  ret = wm8904_write_reg(&pObj->Ctx, WM8904_SW_RESET, &tmp, 2U);
+  ret = WM8904_WriteCached(pObj, WM8904_SW_RESET, tmp);
 
   return ret;
 }
@@ -959,11 +983,15 @@ int32_t WM8904_RegisterBusIO(WM8904_Object_t *pObj, const WM8904_IO_t *pIO)
     pObj->IO.WriteReg  = pIO->WriteReg;
     pObj->IO.ReadReg   = pIO->ReadReg;
     pObj->IO.GetTick   = pIO->GetTick;
+    pObj->IO.WriteBatch = pIO->WriteBatch;
 
     pObj->Ctx.ReadReg  = WM8904_ReadRegWrap;
     pObj->Ctx.WriteReg = WM8904_WriteRegWrap;
     pObj->Ctx.handle   = pObj;
 
+    WM8904_InvalidateCache(pObj);
+    pObj->Stats = (WM8904_Stats_t){ 0 };
+
     if(pObj->IO.Init != NULL)
     {
       ret = pObj->IO.Init();
@@ -976,6 +1004,45 @@ int32_t WM8904_RegisterBusIO(WM8904_Object_t *pObj, const WM8904_IO_t *pIO)
 
   return ret;
 }
+
+/**
+  * @brief Program a set of registers with one flush.
+  * @note  Registers already holding the value are skipped, the others are
+  *        written in the given order.
+  * @param pObj pointer to component object
+  * @param pRegs registers and values
+  * @param Count number of registers
+  * @retval Component status
+  */
+int32_t WM8904_ApplyProfile(WM8904_Object_t *pObj, const WM8904_Reg_t *pRegs, uint32_t Count)
+{
+  int32_t  ret = WM8904_OK;
+  uint32_t i;
+
+  for (i = 0U; i < Count; i++)
+  {
+    ret += WM8904_WriteCached(pObj, pRegs[i].Reg, pRegs[i].Value);
+  }
+  ret += WM8904_Flush(pObj);
+
+  return ret;
+}
+
+/**
+  * @brief Forget the shadow registers, the next accesses read the codec.
+  * @note  Call it when the codec was reset or written outside this driver.
+  * @param pObj pointer to component object
+  */
+void WM8904_InvalidateCache(WM8904_Object_t *pObj)
+{
+  uint32_t i;
+
+  for (i = 0U; i < (WM8904_REG_COUNT / 32U); i++)
+  {
+    pObj->ShadowValid[i] = 0U;
+  }
+  pObj->LogCount = 0U;
+}
 /**
   * @}
   */
@@ -999,6 +1066,182 @@ static void WM8904_Delay(const WM8904_Object_t *pObj, uint32_t Delay)
   }
 }
 
+/**
+  * @brief  Registers changed by the codec itself, never served from the shadow
+  * @param  Reg register address
+  * @retval 1 if volatile, 0 otherwise
+  */
+static uint8_t WM8904_IsVolatile(uint16_t Reg)
+{
+  return ((Reg >= WM8904_REG_COUNT) ||
+          (Reg == WM8904_SW_RESET) ||            /* Device ID on read */
+          (Reg == WM8904_DC_SERVO_READBACK0) ||
+          (Reg == WM8904_INTERRUPT_STATUS)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Check the shadow of a register
+  * @param  pObj  pointer to component object
+  * @param  Reg   register address
+  * @param  Value value to compare
+  * @retval 1 if the codec is known to hold Value, 0 otherwise
+  */
+static uint8_t WM8904_IsCached(const WM8904_Object_t *pObj, uint16_t Reg, uint16_t Value)
+{
+  if (WM8904_IsVolatile(Reg) != 0U)
+  {
+    return 0U;
+  }
+  if ((pObj->ShadowValid[Reg / 32U] & (1UL << (Reg % 32U))) == 0U)
+  {
+    return 0U;
+  }
+  return (pObj->Shadow[Reg] == Value) ? 1U : 0U;
+}
+
+/**
+  * @brief  Queue a register write for the next flush
+  * @note   A software reset is written at once and clears the shadow.
+  * @param  pObj  pointer to component object
+  * @param  Reg   register address
+  * @param  Value register value
+  * @param  Force 1 to write even when the codec already holds Value
+  * @retval error status
+  */
+static int32_t WM8904_Stage(WM8904_Object_t *pObj, uint16_t Reg, uint16_t Value, uint8_t Force)
+{
+  int32_t  ret = WM8904_OK;
+  uint8_t *record;
+
+  if (Reg == WM8904_SW_RESET)
+  {
+    ret = WM8904_Flush(pObj);
+    ret += wm8904_write_reg(&pObj->Ctx, Reg, &Value, 2U);
+    pObj->Stats.BusWrites++;
+    pObj->Stats.BusBytes += 3U;
+    WM8904_InvalidateCache(pObj);
+    return ret;
+  }
+
+  if ((Force == 0U) && (WM8904_IsCached(pObj, Reg, Value) != 0U))
+  {
+    pObj->Stats.SkippedWrites++;
+    return ret;
+  }
+
+  if (pObj->LogCount >= WM8904_LOG_SIZE)
+  {
+    ret = WM8904_Flush(pObj);
+  }
+
+  record = &pObj->Log[pObj->LogCount * 3U];
+  record[0] = (uint8_t)Reg;
+  record[1] = (uint8_t)(Value >> 8);
+  record[2] = (uint8_t)Value;
+  pObj->LogCount++;
+
+  if (WM8904_IsVolatile(Reg) == 0U)
+  {
+    pObj->Shadow[Reg] = Value;
+    pObj->ShadowValid[Reg / 32U] |= (1UL << (Reg % 32U));
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Queue a register write unless the codec already holds the value
+  * @param  pObj  pointer to component object
+  * @param  Reg   register address
+  * @param  Value register value
+  * @retval error status
+  */
+static int32_t WM8904_WriteCached(WM8904_Object_t *pObj, uint16_t Reg, uint16_t Value)
+{
+  return WM8904_Stage(pObj, Reg, Value, 0U);
+}
+
+/**
+  * @brief  Read a register from the shadow, or from the codec after a flush
+  * @param  pObj  pointer to component object
+  * @param  Reg   register address
+  * @param  Value register value
+  * @retval error status
+  */
+static int32_t WM8904_ReadCached(WM8904_Object_t *pObj, uint16_t Reg, uint16_t *Value)
+{
+  int32_t ret;
+
+  if ((WM8904_IsVolatile(Reg) == 0U) &&
+      ((pObj->ShadowValid[Reg / 32U] & (1UL << (Reg % 32U))) != 0U))
+  {
+    *Value = pObj->Shadow[Reg];
+    pObj->Stats.CachedReads++;
+    return WM8904_OK;
+  }
+
+  ret = WM8904_Flush(pObj);
+  ret += wm8904_read_reg(&pObj->Ctx, Reg, Value, 2U);
+  pObj->Stats.BusReads++;
+  pObj->Stats.BusBytes += 3U;
+
+  if ((ret == WM8904_OK) && (WM8904_IsVolatile(Reg) == 0U))
+  {
+    pObj->Shadow[Reg] = *Value;
+    pObj->ShadowValid[Reg / 32U] |= (1UL << (Reg % 32U));
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Send the queued register writes, in order, as one batch when the
+  *         bus supports it
+  * @param  pObj pointer to component object
+  * @retval error status
+  */
+static int32_t WM8904_Flush(WM8904_Object_t *pObj)
+{
+  int32_t  ret = WM8904_OK;
+  uint16_t count = pObj->LogCount;
+  uint16_t i;
+
+  if (count == 0U)
+  {
+    return ret;
+  }
+  pObj->LogCount = 0U;
+
+  if (pObj->IO.WriteBatch != NULL)
+  {
+    ret = pObj->IO.WriteBatch(pObj->IO.Address, pObj->Log, count);
+  }
+  else
+  {
+    for (i = 0U; i < count; i++)
+    {
+      /* Value bytes are MSB first, as wm8904_write_reg sends them */
+      ret += pObj->IO.WriteReg(pObj->IO.Address, pObj->Log[i * 3U], &pObj->Log[(i * 3U) + 1U], 2U);
+    }
+  }
+  pObj->Stats.Flushes++;
+  pObj->Stats.BusWrites += count;
+  pObj->Stats.BusBytes += count * 3U;
+
+  if (ret != WM8904_OK)
+  {
+    /* Unknown which writes reached the codec */
+    for (i = 0U; i < count; i++)
+    {
+      uint16_t reg = pObj->Log[i * 3U];
+
+      pObj->ShadowValid[reg / 32U] &= ~(1UL << (reg % 32U));
+    }
+  }
+
+  return ret;
+}
+
 /**
   * @brief  Function
   * @param  handle  Component object handle
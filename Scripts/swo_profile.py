@@ -0,0 +1,236 @@
+# swo_profile.py
+#
+# Host side of the PC sampling profiler (Appli/Core/Inc/swo_prof.h): decodes
+# an SWO capture and prints the CPU share per task or ISR, per module (object
+# file or library of the map) and per function.
+#
+# Input: the raw ITM byte stream of the SWO pin (TPIU formatter off), as
+# written to a file by the debugger's SWO capture. Besides the swo_prof
+# ports, DWT hardware PC sample packets are counted too when the debugger
+# enables them (no task information then).
+#
+# Usage:
+#   python swo_profile.py capture.swo Appli.elf [--map Appli.map] [--top 30]
+#       [--samples-out samples.txt]
+# samples.txt is the profile format of tcm_place.py.
+
+import argparse
+import bisect
+import collections
+import os
+import re
+import subprocess
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import tcm_place  # noqa: E402  map file parser
+
+CONTEXT_ISR = 0x8000
+CONTEXT_MAIN = 0x4000
+CONTEXT_OTHER = 0x7FFF
+CORE_EXCEPTIONS = {2: "NMI", 3: "HardFault", 4: "MemManage", 5: "BusFault", 6: "UsageFault",
+                   11: "SVCall", 12: "DebugMon", 14: "PendSV", 15: "SysTick"}
+
+
+def itm_packets(data):
+    """Yield (software, port or discriminator, size, value) for each source packet."""
+    i = 0
+    n = len(data)
+    prev = None
+    while i < n:
+        h = data[i]
+        i += 1
+        if h == 0x00 or h == 0x70 or (h == 0x80 and prev == 0x00):
+            # Sync (zeros then 0x80) or overflow
+            prev = h
+            continue
+        prev = h
+        if h & 0x03:
+            size = {1: 1, 2: 2, 3: 4}[h & 0x03]
+            if i + size > n:
+                break
+            value = int.from_bytes(data[i:i + size], "little")
+            i += size
+            yield (h & 0x04) == 0, h >> 3, size, value
+            continue
+        # Timestamp, extension and global timestamp packets: skip their continuation bytes
+        if h & 0x80:
+            while i < n and data[i] & 0x80:
+                i += 1
+            i += 1
+
+
+class Symbols:
+    def __init__(self, nm, objdump, elf):
+        out = subprocess.run([nm, "-n", "-S", "--defined-only", elf], capture_output=True,
+                             text=True, check=True).stdout
+        entries = []
+        for line in out.splitlines():
+            parts = line.split()
+            if len(parts) == 4 and parts[2] in "tTwW":
+                entries.append((int(parts[0], 16) & ~1, int(parts[1], 16), parts[3]))
+            elif len(parts) == 3 and parts[1] in "tTwW":
+                entries.append((int(parts[0], 16) & ~1, 0, parts[2]))
+        entries.sort()
+        # Assembler symbols have no size: up to the next symbol
+        for k, (addr, size, name) in enumerate(entries):
+            if size == 0 and k + 1 < len(entries):
+                entries[k] = (addr, entries[k + 1][0] - addr, name)
+        self.entries = entries
+        self.starts = [e[0] for e in entries]
+        self.vectors = self.read_vectors(objdump, elf)
+
+    @staticmethod
+    def read_vectors(objdump, elf):
+        try:
+            out = subprocess.run([objdump, "-s", "-j", ".isr_vector", elf], capture_output=True,
+                                 text=True, check=True).stdout
+        except (OSError, subprocess.CalledProcessError):
+            return []
+        words = []
+        for line in out.splitlines():
+            m = re.match(r"^ [0-9a-f]+ ((?:[0-9a-f]{8} ?){1,4})", line)
+            if m:
+                words += [int.from_bytes(bytes.fromhex(w), "little") for w in m.group(1).split()]
+        return words
+
+    def function(self, pc):
+        k = bisect.bisect_right(self.starts, pc & ~1) - 1
+        if k >= 0 and pc < self.entries[k][0] + max(self.entries[k][1], 2):
+            return self.entries[k][2]
+        return "0x%08x" % pc
+
+    def exception(self, number):
+        if number < len(self.vectors) and self.vectors[number]:
+            name = self.function(self.vectors[number] & ~1)
+            if not name.startswith("0x"):
+                return name
+        if number >= 16:
+            return "IRQ %d" % (number - 16)
+        return CORE_EXCEPTIONS.get(number, "exception %d" % number)
+
+
+class Modules:
+    def __init__(self, map_path):
+        _, _, sections = tcm_place.parse_map(map_path)
+        text = sorted((s for s in sections if s.name.startswith((".text", ".itcm_text"))),
+                      key=lambda s: s.addr)
+        self.text = text
+        self.starts = [s.addr for s in text]
+
+    def module(self, pc):
+        k = bisect.bisect_right(self.starts, pc & ~1) - 1
+        if k < 0 or pc >= self.text[k].addr + self.text[k].size:
+            return "?"
+        m = re.match(r"^(.*)\((.*)\)$", self.text[k].obj)
+        return os.path.basename(m.group(1) if m else self.text[k].obj)
+
+
+def print_table(title, counter, total, top, label=None):
+    print("\n%s" % title)
+    for key, count in counter.most_common(top):
+        print("  %5.1f%% %8d  %s" % (count * 100.0 / total, count, label(key) if label else key))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="SWO PC sample profile")
+    parser.add_argument("capture", help="raw ITM stream")
+    parser.add_argument("elf", help="ELF of the profiled build")
+    parser.add_argument("--map", help="map file, for the per module table")
+    parser.add_argument("--port", type=int, default=1,
+                        help="SWO_PROF_PORT_CONTEXT of the firmware (default 1)")
+    parser.add_argument("--nm", default="arm-none-eabi-nm")
+    parser.add_argument("--objdump", default="arm-none-eabi-objdump")
+    parser.add_argument("--top", type=int, default=30, help="functions listed (default 30)")
+    parser.add_argument("--by-context", action="store_true",
+                        help="also list the top functions of each task and ISR")
+    parser.add_argument("--samples-out", help="write the samples for tcm_place.py")
+    args = parser.parse_args()
+
+    with open(args.capture, "rb") as f:
+        data = f.read()
+    symbols = Symbols(args.nm, args.objdump, args.elf)
+    modules = Modules(args.map) if args.map else None
+
+    port_context, port_pc, port_name = args.port, args.port + 1, args.port + 2
+    names = {}
+    name_slot = None
+    name_chars = []
+    context = None
+    samples = []                        # (context, pc)
+    hardware = 0
+
+    for software, port, size, value in itm_packets(data):
+        if not software:
+            # DWT periodic PC sample: 4 byte PC, 1 byte when the core sleeps
+            if port == 2 and size == 4:
+                samples.append(("dwt", value))
+                hardware += 1
+            continue
+        if port == port_context:
+            context = value
+        elif port == port_pc:
+            samples.append((context, value))
+            context = None
+        elif port == port_name:
+            for k in range(size):
+                b = (value >> (8 * k)) & 0xFF
+                if b & 0x80:
+                    name_slot, name_chars = b & 0x7F, []
+                elif b == 0:
+                    if name_slot is not None:
+                        names[name_slot] = "".join(name_chars)
+                    name_slot = None
+                elif name_slot is not None:
+                    name_chars.append(chr(b))
+
+    if not samples:
+        sys.exit("error: no samples in %s (port %d)" % (args.capture, args.port))
+
+    def context_name(c):
+        if c is None:
+            return "(context lost)"
+        if c == "dwt":
+            return "(DWT sample)"
+        if c & CONTEXT_ISR:
+            return "ISR " + symbols.exception(c & 0x1FF)
+        if c == CONTEXT_MAIN:
+            return "main (no scheduler)"
+        if c == CONTEXT_OTHER:
+            return "(other tasks)"
+        return "task " + names.get(c, "#%d" % c)
+
+    total = len(samples)
+    by_context = collections.Counter()
+    by_function = collections.Counter()
+    by_module = collections.Counter()
+    by_pc = collections.Counter()
+    per_context = collections.defaultdict(collections.Counter)
+    for c, pc in samples:
+        fn = symbols.function(pc)
+        by_context[context_name(c)] += 1
+        by_function[fn] += 1
+        by_pc[pc & ~1] += 1
+        per_context[context_name(c)][fn] += 1
+        if modules:
+            by_module[modules.module(pc)] += 1
+
+    print("%d samples (%d DWT), %d task names" % (total, hardware, len(names)))
+    print_table("Tasks and ISRs", by_context, total, None)
+    if modules:
+        print_table("Modules", by_module, total, None)
+    print_table("Functions", by_function, total, args.top)
+    if args.by_context:
+        for c, counter in sorted(per_context.items(), key=lambda kv: -sum(kv[1].values())):
+            print_table(c, counter, sum(counter.values()), 5)
+
+    if args.samples_out:
+        with open(args.samples_out, "w") as f:
+            f.write("# %s, %d samples\n" % (os.path.basename(args.capture), total))
+            for pc, count in sorted(by_pc.items()):
+                f.write("0x%08x %d\n" % (pc, count))
+        print("\nwrote %s" % args.samples_out)
+
+
+if __name__ == "__main__":
+    main()
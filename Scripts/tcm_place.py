@@ -0,0 +1,326 @@
+# tcm_place.py
+#
+# Chooses the code and tables copied to ITCM and DTCM (see Appli/Core/Inc/tcm.h)
+# from a profile of a run, and writes them between the tcm_place markers of
+# the linker script.
+#
+# Inputs:
+# - the map file of the profiled build (STM32CubeIDE/Appli/Debug/*.map)
+# - a PC sample profile: one sample per line, "0x<pc>" or "0x<pc> <count>",
+#   or "<function> <count>" for a per function profile. Lines starting with
+#   # are ignored. Any PC sampler will do, e.g. a debugger halting the core
+#   periodically and logging $pc.
+#
+# Functions (input sections .text.<name>, after inlining) are taken by
+# samples per byte until the ITCM budget is used; then the .rodata/.data
+# sections they reference (found with objdump -r in the objects of the
+# build) by samples of their users per byte, until the DTCM budget is used.
+# The budgets are what the map leaves free in each memory, less a reserve
+# for linker veneers and alignment.
+#
+# Usage:
+#   python tcm_place.py Appli.map samples.txt [--ld ../STM32CubeIDE/Appli/...ld]
+#   then rebuild, run, and compare the mp3 cycles/frame and the tcm report.
+
+import argparse
+import bisect
+import os
+import re
+import subprocess
+import sys
+
+DEFAULT_LD = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                          "..", "STM32CubeIDE", "Appli", "STM32H7S7L8HXH_RAMxspi1_ROMxspi2.ld")
+
+# Run before the startup copies the TCM sections, must stay in flash
+NEVER_MOVE_OBJECTS = re.compile(r"(startup_|system_stm32)")
+
+HEX = r"0x[0-9a-fA-F]+"
+OUTPUT_RE = re.compile(r"^(\S+)\s+(" + HEX + r")\s+(" + HEX + r")")
+INPUT_FULL_RE = re.compile(r"^ (\.\S+|COMMON)\s+(" + HEX + r")\s+(" + HEX + r")\s+(\S.*)$")
+INPUT_NAME_RE = re.compile(r"^ (\.\S+|COMMON)\s*$")
+INPUT_TAIL_RE = re.compile(r"^\s+(" + HEX + r")\s+(" + HEX + r")\s+(\S.*)$")
+OUTPUT_TAIL_RE = re.compile(r"^\s+(" + HEX + r")\s+(" + HEX + r")\s*(load address.*)?$")
+MEMORY_RE = re.compile(r"^(\S+)\s+(" + HEX + r")\s+(" + HEX + r")")
+
+
+class Section:
+    def __init__(self, name, addr, size, obj, output):
+        self.name = name
+        self.addr = addr
+        self.size = size
+        self.obj = obj
+        self.output = output
+        self.samples = 0
+        self.weight = 0
+
+    def pattern(self):
+        # Archive members are written archive.a(member.o) in the map
+        m = re.match(r"^(.*)\((.*)\)$", self.obj)
+        if m:
+            return "*%s:%s" % (os.path.basename(m.group(1)), m.group(2))
+        return "*" + os.path.basename(self.obj)
+
+
+def parse_map(path):
+    memory = {}
+    outputs = {}
+    sections = []
+    output = None
+    in_memory = False
+    in_script = False
+    pending = None
+    pending_output = False
+
+    with open(path, errors="replace") as f:
+        for line in f:
+            line = line.rstrip("\n")
+            if line.startswith("Memory Configuration"):
+                in_memory = True
+                continue
+            if line.startswith("Linker script and memory map"):
+                in_memory = False
+                in_script = True
+                continue
+            if in_memory:
+                m = MEMORY_RE.match(line)
+                if m and m.group(1) != "Name":
+                    memory[m.group(1)] = (int(m.group(2), 16), int(m.group(3), 16))
+                continue
+            if not in_script:
+                continue
+
+            if pending_output:
+                pending_output = False
+                m = OUTPUT_TAIL_RE.match(line)
+                if m:
+                    outputs[output] = (int(m.group(1), 16), int(m.group(2), 16))
+                    continue
+
+            if pending is not None:
+                m = INPUT_TAIL_RE.match(line)
+                if m:
+                    sections.append(Section(pending, int(m.group(1), 16), int(m.group(2), 16),
+                                            m.group(3).strip(), output))
+                pending = None
+                continue
+
+            if line and not line[0].isspace():
+                m = OUTPUT_RE.match(line)
+                if m:
+                    output = m.group(1)
+                    outputs[output] = (int(m.group(2), 16), int(m.group(3), 16))
+                else:
+                    # Long names are alone on their line, address and size follow
+                    output = line.split()[0]
+                    pending_output = True
+                continue
+            m = INPUT_FULL_RE.match(line)
+            if m:
+                sections.append(Section(m.group(1), int(m.group(2), 16), int(m.group(3), 16),
+                                        m.group(4).strip(), output))
+                continue
+            m = INPUT_NAME_RE.match(line)
+            if m:
+                pending = m.group(1)
+
+    return memory, outputs, [s for s in sections if s.size > 0]
+
+
+def parse_samples(path, text_sections):
+    by_addr = sorted((s for s in text_sections if s.addr != 0 or s.output == ".itcm_text"),
+                     key=lambda s: s.addr)
+    starts = [s.addr for s in by_addr]
+    by_function = {}
+    for s in text_sections:
+        name = s.name[len(".text."):] if s.name.startswith(".text.") else s.name
+        by_function.setdefault(name.split(".")[0], []).append(s)
+
+    total = 0
+    unmatched = 0
+    with open(path) as f:
+        for line in f:
+            tokens = line.split()
+            if not tokens or tokens[0].startswith("#"):
+                continue
+            count = int(tokens[1]) if len(tokens) > 1 else 1
+            total += count
+            if tokens[0].lower().startswith("0x"):
+                pc = int(tokens[0], 16) & ~1
+                i = bisect.bisect_right(starts, pc) - 1
+                if i >= 0 and pc < by_addr[i].addr + by_addr[i].size:
+                    by_addr[i].samples += count
+                    continue
+            elif tokens[0] in by_function:
+                # Clones (.constprop, .isra) share the samples of their name
+                for s in by_function[tokens[0]]:
+                    s.samples += count // len(by_function[tokens[0]])
+                continue
+            unmatched += count
+    return total, unmatched
+
+
+def objdump(tool, args, obj):
+    try:
+        return subprocess.run([tool] + args + [obj], capture_output=True, text=True,
+                              check=True).stdout
+    except (OSError, subprocess.CalledProcessError) as e:
+        print("warning: %s %s failed: %s" % (tool, obj, e), file=sys.stderr)
+        return ""
+
+
+def data_references(tool, obj_path):
+    """Map each code section of an object to the data sections it relocates against."""
+    symbols = {}
+    for line in objdump(tool, ["-t"], obj_path).splitlines():
+        # 00000000 l     O .rodata.g_pow43	00000244 g_pow43
+        m = re.match(r"^[0-9a-f]+\s.{7}\s(\S+)\s+[0-9a-f]+\s+(\S+)$", line)
+        if m:
+            symbols[m.group(2)] = m.group(1)
+
+    refs = {}
+    current = None
+    for line in objdump(tool, ["-r"], obj_path).splitlines():
+        m = re.match(r"^RELOCATION RECORDS FOR \[(.*)\]:", line)
+        if m:
+            current = refs.setdefault(m.group(1), set())
+            continue
+        tokens = line.split()
+        if current is None or len(tokens) != 3 or not re.match(r"^[0-9a-f]+$", tokens[0]):
+            continue
+        target = re.split(r"[+-]0x", tokens[2])[0]
+        target = symbols.get(target, target)
+        if target.startswith((".rodata", ".data")) and ".cst" not in target and ".str" not in target:
+            current.add(target)
+    return refs
+
+
+def pick(candidates, budget, key):
+    chosen = []
+    used = 0
+    for s in sorted(candidates, key=key, reverse=True):
+        size = (s.size + 7) & ~7
+        if used + size <= budget:
+            chosen.append(s)
+            used += size
+    return chosen, used
+
+
+def ld_lines(chosen):
+    groups = {}
+    for s in chosen:
+        groups.setdefault(s.pattern(), []).append(s.name)
+    lines = []
+    for pattern in sorted(groups):
+        names = sorted(groups[pattern])
+        current = []
+        for name in names:
+            if current and len("    %s(%s)" % (pattern, " ".join(current + [name]))) > 100:
+                lines.append("    %s(%s)" % (pattern, " ".join(current)))
+                current = []
+            current.append(name)
+        lines.append("    %s(%s)" % (pattern, " ".join(current)))
+    return lines
+
+
+def rewrite_ld(path, region, lines):
+    with open(path) as f:
+        text = f.read().split("\n")
+    begin = "/* tcm_place %s begin */" % region
+    end = "/* tcm_place %s end */" % region
+    try:
+        b = next(i for i, l in enumerate(text) if l.strip() == begin)
+        e = next(i for i, l in enumerate(text) if l.strip() == end)
+    except StopIteration:
+        sys.exit("error: %s has no tcm_place %s markers" % (path, region))
+    text[b + 1:e] = lines
+    with open(path, "w", newline="") as f:
+        f.write("\n".join(text))
+
+
+def region_of(memory, name):
+    if name not in memory:
+        sys.exit("error: no %s region in the map" % name)
+    return memory[name]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Profile guided ITCM/DTCM placement")
+    parser.add_argument("map", help="map file of the profiled build")
+    parser.add_argument("samples", help="PC sample profile")
+    parser.add_argument("--ld", default=DEFAULT_LD, help="linker script to update")
+    parser.add_argument("--build-dir", help="directory of the objects (default: the map's)")
+    parser.add_argument("--objdump", default="arm-none-eabi-objdump")
+    parser.add_argument("--itcm-reserve", type=int, default=1024,
+                        help="bytes left for veneers and alignment (default 1024)")
+    parser.add_argument("--dtcm-reserve", type=int, default=256,
+                        help="bytes left free in DTCM (default 256)")
+    parser.add_argument("--min-share", type=float, default=0.2,
+                        help="ignore functions below this share of the samples, percent")
+    parser.add_argument("--dry-run", action="store_true", help="report only")
+    args = parser.parse_args()
+
+    build_dir = args.build_dir or os.path.dirname(os.path.abspath(args.map))
+    memory, outputs, sections = parse_map(args.map)
+    itcm_origin, itcm_length = region_of(memory, "ITCM")
+    dtcm_origin, dtcm_length = region_of(memory, "DTCM")
+
+    text = [s for s in sections if s.name.startswith((".text", ".itcm_text"))]
+    total, unmatched = parse_samples(args.samples, text)
+    if total == 0:
+        sys.exit("error: no samples in %s" % args.samples)
+
+    # Budgets: the regions less what is there by hand or by other sections
+    hand_itcm = sum(s.size for s in sections if s.name.startswith(".itcm_text"))
+    itcm_budget = itcm_length - hand_itcm - args.itcm_reserve
+    # Other DTCM users: pools, the heap and stack reservation, hand placed data
+    other_dtcm = sum(size for name, (addr, size) in outputs.items()
+                     if dtcm_origin <= addr < dtcm_origin + dtcm_length and name != ".dtcm_data")
+    other_dtcm += sum(s.size for s in sections if s.name.startswith(".dtcm_data"))
+    dtcm_budget = dtcm_length - other_dtcm - args.dtcm_reserve
+
+    code = [s for s in text
+            if s.name.startswith(".text") and s.samples * 100.0 / total >= args.min_share
+            and not NEVER_MOVE_OBJECTS.search(s.obj)]
+    code_chosen, code_used = pick(code, itcm_budget, lambda s: s.samples / s.size)
+
+    # Tables referenced by the sampled code, weighted by the samples of their users
+    data_by_key = {(s.obj, s.name): s for s in sections
+                   if s.name.startswith((".rodata", ".data", ".dtcm_data"))}
+    refs_cache = {}
+    for s in (s for s in text if s.samples > 0 and "(" not in s.obj):
+        if s.obj not in refs_cache:
+            refs_cache[s.obj] = data_references(args.objdump, os.path.join(build_dir, s.obj))
+        for target in refs_cache[s.obj].get(s.name, ()):
+            d = data_by_key.get((s.obj, target))
+            if d is not None:
+                d.weight += s.samples
+    data = [d for d in data_by_key.values() if d.weight > 0 and not d.name.startswith(".dtcm_data")]
+    data_chosen, data_used = pick(data, dtcm_budget, lambda s: s.weight / s.size)
+
+    covered = sum(s.samples for s in code_chosen)
+    print("%d samples, %d outside any function" % (total, unmatched))
+    print("ITCM: %d sections, %d bytes, %.1f%% of the samples; %d of %d bytes left"
+          % (len(code_chosen), code_used, covered * 100.0 / total,
+             itcm_budget + args.itcm_reserve - code_used, itcm_length))
+    for s in sorted(code_chosen, key=lambda s: -s.samples):
+        print("  %-40s %-24s %6d bytes %5.1f%%" % (s.name, os.path.basename(s.obj), s.size,
+                                                   s.samples * 100.0 / total))
+    skipped = [s for s in code if s not in code_chosen]
+    for s in skipped:
+        print("  (no room) %-29s %-24s %6d bytes %5.1f%%" % (s.name, os.path.basename(s.obj),
+                                                             s.size, s.samples * 100.0 / total))
+    print("DTCM: %d tables, %d bytes; %d bytes left" % (len(data_chosen), data_used,
+                                                        dtcm_budget + args.dtcm_reserve - data_used))
+    for s in sorted(data_chosen, key=lambda s: -s.weight):
+        print("  %-40s %-24s %6d bytes" % (s.name, os.path.basename(s.obj), s.size))
+
+    if args.dry_run:
+        return
+    rewrite_ld(args.ld, "ITCM", ld_lines(code_chosen))
+    rewrite_ld(args.ld, "DTCM", ld_lines(data_chosen))
+    print("updated %s" % os.path.normpath(args.ld))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,29 @@
+/*
+ * FreeRTOS.h
+ *
+ * Host stand-in of the kernel header: the configuration of the application
+ * and the heap types of portable.h.
+ */
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "FreeRTOSConfig.h"
+
+#ifndef configUSE_MALLOC_FAILED_HOOK
+#define configUSE_MALLOC_FAILED_HOOK 0
+#endif
+
+typedef struct xHeapStats
+{
+	size_t xAvailableHeapSpaceInBytes;
+	size_t xSizeOfLargestFreeBlockInBytes;
+	size_t xSizeOfSmallestFreeBlockInBytes;
+	size_t xNumberOfFreeBlocks;
+	size_t xMinimumEverFreeBytesRemaining;
+	size_t xNumberOfSuccessfulAllocations;
+	size_t xNumberOfSuccessfulFrees;
+} HeapStats_t;
+
+#endif /* INC_FREERTOS_H */
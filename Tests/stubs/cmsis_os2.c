@@ -0,0 +1,125 @@
+/*
+ * cmsis_os2.c
+ *
+ * Host threads and thread flags, see cmsis_os2.h
+ */
+#include "cmsis_os2.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+typedef struct
+{
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	uint32_t flags;
+	osThreadFunc_t func;
+	void *argument;
+} host_thread_t;
+
+static __thread host_thread_t *self;
+
+static host_thread_t *thread_create(void)
+{
+	host_thread_t *t = calloc(1, sizeof(*t));
+
+	if (t == NULL)
+		abort();
+	pthread_mutex_init(&t->lock, NULL);
+	pthread_cond_init(&t->cond, NULL);
+	return t;
+}
+
+static void *thread_entry(void *p)
+{
+	host_thread_t *t = p;
+
+	self = t;
+	t->func(t->argument);
+	return NULL;
+}
+
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr)
+{
+	host_thread_t *t = thread_create();
+
+	(void)attr;
+	t->func = func;
+	t->argument = argument;
+	if (pthread_create(&t->thread, NULL, thread_entry, t) != 0)
+	{
+		free(t);
+		return NULL;
+	}
+	pthread_detach(t->thread);
+	return t;
+}
+
+/* Threads not made by osThreadNew (main) get their flags on first use */
+osThreadId_t osThreadGetId(void)
+{
+	if (self == NULL)
+		self = thread_create();
+	return self;
+}
+
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags)
+{
+	host_thread_t *t = thread_id;
+	uint32_t now;
+
+	if (t == NULL)
+		return osFlagsErrorParameter;
+	pthread_mutex_lock(&t->lock);
+	t->flags |= flags;
+	now = t->flags;
+	pthread_cond_broadcast(&t->cond);
+	pthread_mutex_unlock(&t->lock);
+	return now;
+}
+
+uint32_t osThreadFlagsClear(uint32_t flags)
+{
+	host_thread_t *t = osThreadGetId();
+	uint32_t was;
+
+	pthread_mutex_lock(&t->lock);
+	was = t->flags;
+	t->flags &= ~flags;
+	pthread_mutex_unlock(&t->lock);
+	return was;
+}
+
+/* osFlagsWaitAny only, the flags are cleared */
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout)
+{
+	host_thread_t *t = osThreadGetId();
+	struct timespec deadline;
+	uint32_t got;
+	int err = 0;
+
+	(void)options;
+	clock_gettime(CLOCK_REALTIME, &deadline);
+	deadline.tv_sec += timeout / 1000U;
+	deadline.tv_nsec += (long)(timeout % 1000U) * 1000000L;
+	if (deadline.tv_nsec >= 1000000000L)
+	{
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000L;
+	}
+
+	pthread_mutex_lock(&t->lock);
+	while ((t->flags & flags) == 0 && err != ETIMEDOUT)
+	{
+		if (timeout == osWaitForever)
+			pthread_cond_wait(&t->cond, &t->lock);
+		else
+			err = pthread_cond_timedwait(&t->cond, &t->lock, &deadline);
+	}
+	got = t->flags & flags;
+	t->flags &= ~got;
+	pthread_mutex_unlock(&t->lock);
+	return (got != 0) ? got : osFlagsErrorTimeout;
+}
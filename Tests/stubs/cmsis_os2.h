@@ -0,0 +1,55 @@
+/*
+ * cmsis_os2.h
+ *
+ * Host stand-in of the CMSIS-RTOS2 calls the tested modules use, on
+ * POSIX threads (cmsis_os2.c). Timeouts are in milliseconds, the tick of
+ * the target.
+ */
+#ifndef CMSIS_OS2_H_
+#define CMSIS_OS2_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define osWaitForever               0xFFFFFFFFU
+#define osFlagsWaitAny              0x00000000U
+#define osFlagsError                0x80000000U
+#define osFlagsErrorTimeout         0xFFFFFFFEU
+#define osFlagsErrorParameter       0xFFFFFFFCU
+
+typedef enum
+{
+	osPriorityNormal = 24,
+	osPriorityAboveNormal = 32,
+	osPriorityHigh = 40,
+	osPriorityRealtime = 48
+} osPriority_t;
+
+typedef void (*osThreadFunc_t)(void *argument);
+typedef void *osThreadId_t;
+
+typedef struct
+{
+	const char *name;
+	uint32_t attr_bits;
+	void *cb_mem;
+	uint32_t cb_size;
+	void *stack_mem;
+	uint32_t stack_size;
+	osPriority_t priority;
+} osThreadAttr_t;
+
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr);
+osThreadId_t osThreadGetId(void);
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags);
+uint32_t osThreadFlagsClear(uint32_t flags);
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMSIS_OS2_H_ */
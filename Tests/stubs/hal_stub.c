@@ -0,0 +1,64 @@
+/*
+ * hal_stub.c
+ *
+ * Host CMSIS core and HAL, see stm32h7rsxx_hal.h
+ */
+#include "stm32h7rsxx_hal.h"
+#include <pthread.h>
+#include <time.h>
+
+DWT_Type host_dwt;
+CoreDebug_Type host_core_debug;
+uint32_t SystemCoreClock = 600000000U;
+
+static pthread_mutex_t irq_lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread uint32_t irq_masked;
+
+uint32_t __get_PRIMASK(void)
+{
+	return irq_masked;
+}
+
+void __disable_irq(void)
+{
+	if (!irq_masked)
+	{
+		pthread_mutex_lock(&irq_lock);
+		irq_masked = 1;
+	}
+}
+
+void __enable_irq(void)
+{
+	if (irq_masked)
+	{
+		irq_masked = 0;
+		pthread_mutex_unlock(&irq_lock);
+	}
+}
+
+void __set_PRIMASK(uint32_t primask)
+{
+	if (primask)
+		__disable_irq();
+	else
+		__enable_irq();
+}
+
+uint32_t HAL_GetTick(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)(ts.tv_sec * 1000U + ts.tv_nsec / 1000000U);
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t preempt, uint32_t sub)
+{
+	(void)irq, (void)preempt, (void)sub;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type irq)
+{
+	(void)irq;
+}
@@ -0,0 +1,97 @@
+/*
+ * i2c_mock.c
+ *
+ * Host I2C bus, see i2c_mock.h
+ */
+#include "i2c_mock.h"
+#include <string.h>
+
+i2c_mock_t i2c_mock;
+
+void i2c_mock_reset(void)
+{
+	memset(&i2c_mock, 0, sizeof(i2c_mock));
+}
+
+void i2c_mock_fail(uint32_t txn, i2c_mock_fault_t fault)
+{
+	i2c_mock.fault_txn = txn;
+	i2c_mock.fault = fault;
+}
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c)
+{
+	hi2c->inits++;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c)
+{
+	(void)hi2c;
+	i2c_mock.deinits++;
+	return HAL_OK;
+}
+
+static HAL_StatusTypeDef transfer(I2C_HandleTypeDef *hi2c, uint8_t read, uint16_t addr, uint16_t reg,
+		uint16_t reg_size, uint8_t *data, uint16_t length)
+{
+	const uint32_t n = i2c_mock.txns++;
+	const i2c_mock_fault_t fault = (i2c_mock.fault != I2C_MOCK_OK && n == i2c_mock.fault_txn) ?
+			i2c_mock.fault : I2C_MOCK_OK;
+
+	if (n < I2C_MOCK_LOG_SIZE)
+	{
+		i2c_mock_txn_t *t = &i2c_mock.log[n];
+
+		t->addr = addr;
+		t->reg = reg;
+		t->read = read;
+		t->length = length;
+	}
+	if (i2c_mock.on_txn != NULL)
+		i2c_mock.on_txn();
+
+	if (fault == I2C_MOCK_HAL_ERROR)
+		return HAL_ERROR;
+	if (fault == I2C_MOCK_HANG)
+		return HAL_OK;
+	if (fault == I2C_MOCK_NACK)
+	{
+		HAL_I2C_ErrorCallback(hi2c);
+		return HAL_OK;
+	}
+
+	for (uint32_t i = 0; i < length; i++)
+	{
+		uint16_t *r = &i2c_mock.regs[(reg + i / 2U) & 0xFFU];
+		const uint32_t shift = (i & 1U) ? 0U : 8U;
+
+		if (read)
+			data[i] = (uint8_t)(*r >> shift);
+		else
+			*r = (uint16_t)((*r & ~(0xFFU << shift)) | ((uint32_t)data[i] << shift));
+	}
+	if (n < I2C_MOCK_LOG_SIZE)
+		memcpy(i2c_mock.log[n].data, data, (length < I2C_MOCK_DATA_MAX) ? length : I2C_MOCK_DATA_MAX);
+
+	i2c_mock.bytes += reg_size + length;
+	host_dwt.CYCCNT += (1U + reg_size + length) * I2C_MOCK_CYCLES_PER_BYTE;
+
+	if (read)
+		HAL_I2C_MemRxCpltCallback(hi2c);
+	else
+		HAL_I2C_MemTxCpltCallback(hi2c);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *hi2c, uint16_t addr, uint16_t reg, uint16_t reg_size,
+		uint8_t *data, uint16_t length)
+{
+	return transfer(hi2c, 0, addr, reg, reg_size, data, length);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t addr, uint16_t reg, uint16_t reg_size,
+		uint8_t *data, uint16_t length)
+{
+	return transfer(hi2c, 1, addr, reg, reg_size, data, length);
+}
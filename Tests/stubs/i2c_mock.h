@@ -0,0 +1,74 @@
+/*
+ * i2c_mock.h
+ *
+ * Host I2C bus behind the HAL_I2C_Mem_*_IT calls: every device answers from
+ * one file of 16 bit registers with 8 bit addresses (the WM8904 layout),
+ * data MSB first and the register address incremented every two bytes.
+ * Each transaction is logged; one of them can be made to fail. Every byte
+ * advances the cycle counter by its time on the bus.
+ *
+ * The completion callbacks run from the calling thread before the HAL call
+ * returns, the interrupt of the target.
+ */
+#ifndef __I2C_MOCK_H
+#define __I2C_MOCK_H
+
+#include "stm32h7rsxx_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define I2C_MOCK_LOG_SIZE           256
+#define I2C_MOCK_DATA_MAX           32
+
+/* 400 kHz at 600 MHz, for the latencies: 9 clocks per byte */
+#define I2C_MOCK_CYCLES_PER_BYTE    (600U * 9U * 1000U / 400U)
+
+typedef enum
+{
+	I2C_MOCK_OK = 0,
+	I2C_MOCK_NACK,                  /* HAL_I2C_ErrorCallback */
+	I2C_MOCK_HAL_ERROR,             /* The HAL call fails */
+	I2C_MOCK_HANG                   /* No completion */
+} i2c_mock_fault_t;
+
+typedef struct
+{
+	uint16_t addr;
+	uint16_t reg;
+	uint8_t read;
+	uint16_t length;
+	uint8_t data[I2C_MOCK_DATA_MAX];  /* First bytes written or read */
+} i2c_mock_txn_t;
+
+typedef struct
+{
+	uint16_t regs[256];
+	i2c_mock_txn_t log[I2C_MOCK_LOG_SIZE];
+	uint32_t txns;                  /* Transactions started, past the log too */
+	uint32_t bytes;                 /* Register and data bytes on the bus */
+	uint32_t deinits;
+	uint32_t fault_txn;             /* Transaction index failing with fault */
+	i2c_mock_fault_t fault;
+	void (*on_txn)(void);           /* Called as a transaction starts, the bus
+	                                   busy: interrupts of the other clients */
+} i2c_mock_t;
+
+extern i2c_mock_t i2c_mock;
+
+/**
+ * @brief Clear the registers, the log and the fault
+ */
+void i2c_mock_reset(void);
+
+/**
+ * @brief Make transaction number txn (counted from the reset) fail
+ */
+void i2c_mock_fail(uint32_t txn, i2c_mock_fault_t fault);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __I2C_MOCK_H */
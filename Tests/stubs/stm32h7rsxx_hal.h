@@ -0,0 +1,101 @@
+/*
+ * stm32h7rsxx_hal.h
+ *
+ * Host stand-in of the HAL header included by main.h: the pieces of the
+ * CMSIS core and of the HAL the tested modules use, implemented in
+ * hal_stub.c and i2c_mock.c.
+ *
+ * PRIMASK is a process wide lock: masking the interrupts in one thread
+ * excludes the masked sections of the others, like on the single core.
+ */
+#ifndef STM32H7RSxx_HAL_H
+#define STM32H7RSxx_HAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+	HAL_OK = 0x00,
+	HAL_ERROR = 0x01,
+	HAL_BUSY = 0x02,
+	HAL_TIMEOUT = 0x03
+} HAL_StatusTypeDef;
+
+/* Pins named by main.h */
+#define GPIO_PIN_1                  (0x0002U)
+#define GPIO_PIN_2                  (0x0004U)
+#define GPIO_PIN_3                  (0x0008U)
+#define GPIO_PIN_4                  (0x0010U)
+#define GPIO_PIN_13                 (0x2000U)
+#define GPIO_PIN_15                 (0x8000U)
+
+typedef enum
+{
+	EXTI3_IRQn = 14,
+	EXTI13_IRQn = 24,
+	I2C1_EV_IRQn = 47,
+	I2C1_ER_IRQn = 48
+} IRQn_Type;
+
+/* CMSIS core */
+typedef struct
+{
+	volatile uint32_t CTRL;
+	volatile uint32_t CYCCNT;
+	volatile uint32_t LAR;
+} DWT_Type;
+
+typedef struct
+{
+	volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type host_dwt;
+extern CoreDebug_Type host_core_debug;
+
+#define DWT                         (&host_dwt)
+#define CoreDebug                   (&host_core_debug)
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t primask);
+void __disable_irq(void);
+void __enable_irq(void);
+
+extern uint32_t SystemCoreClock;
+
+/* HAL */
+uint32_t HAL_GetTick(void);
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t preempt, uint32_t sub);
+void HAL_NVIC_EnableIRQ(IRQn_Type irq);
+
+/* I2C, see i2c_mock.h */
+#define I2C_MEMADD_SIZE_8BIT        (0x00000001U)
+#define I2C_MEMADD_SIZE_16BIT       (0x00000002U)
+
+typedef struct
+{
+	uint32_t inits;                 /* HAL_I2C_Init calls */
+} I2C_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *hi2c, uint16_t addr, uint16_t reg, uint16_t reg_size,
+		uint8_t *data, uint16_t length);
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t addr, uint16_t reg, uint16_t reg_size,
+		uint8_t *data, uint16_t length);
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32H7RSxx_HAL_H */
@@ -0,0 +1,77 @@
+/*
+ * Types.hpp
+ *
+ * Host stand-in of the TouchGFX types the MJPEG decoders use: MIN, MAX and
+ * Rect, with the semantics of the framework.
+ */
+#ifndef TOUCHGFX_TYPES_HPP
+#define TOUCHGFX_TYPES_HPP
+
+#include <assert.h>
+#include <stdint.h>
+
+template <typename T>
+inline T MIN(T a, T b)
+{
+    return (a < b) ? a : b;
+}
+
+template <typename T>
+inline T MAX(T a, T b)
+{
+    return (a > b) ? a : b;
+}
+
+namespace touchgfx
+{
+class Rect
+{
+public:
+    Rect()
+        : x(0), y(0), width(0), height(0)
+    {
+    }
+
+    Rect(int16_t x, int16_t y, int16_t width, int16_t height)
+        : x(x), y(y), width(width), height(height)
+    {
+    }
+
+    int16_t right() const
+    {
+        return x + width;
+    }
+
+    int16_t bottom() const
+    {
+        return y + height;
+    }
+
+    bool isEmpty() const
+    {
+        return width <= 0 || height <= 0;
+    }
+
+    //Intersection, empty if the rectangles do not overlap
+    Rect operator&(const Rect& other) const
+    {
+        const int16_t left = MAX(x, other.x);
+        const int16_t top = MAX(y, other.y);
+        const int16_t r = MIN(right(), other.right());
+        const int16_t b = MIN(bottom(), other.bottom());
+
+        if (r <= left || b <= top)
+        {
+            return Rect();
+        }
+        return Rect(left, top, r - left, b - top);
+    }
+
+    int16_t x;
+    int16_t y;
+    int16_t width;
+    int16_t height;
+};
+} // namespace touchgfx
+
+#endif // TOUCHGFX_TYPES_HPP
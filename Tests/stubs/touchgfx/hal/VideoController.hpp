@@ -0,0 +1,35 @@
+/*
+ * VideoController.hpp
+ *
+ * Host stand-in of the video types of the TouchGFX framework the MJPEG
+ * decoders use.
+ */
+#ifndef TOUCHGFX_VIDEOCONTROLLER_HPP
+#define TOUCHGFX_VIDEOCONTROLLER_HPP
+
+#include <touchgfx/hal/Types.hpp>
+
+namespace touchgfx
+{
+struct VideoInformation
+{
+    uint32_t frame_width;
+    uint32_t frame_height;
+    uint32_t ms_between_frames;
+    uint32_t number_of_frames;
+};
+
+class VideoDataReader
+{
+public:
+    virtual ~VideoDataReader()
+    {
+    }
+
+    virtual uint32_t getDataLength() = 0;
+    virtual void seek(uint32_t position) = 0;
+    virtual bool readData(void* dst, uint32_t bytes) = 0;
+};
+} // namespace touchgfx
+
+#endif // TOUCHGFX_VIDEOCONTROLLER_HPP
@@ -0,0 +1,34 @@
+/*
+ * test.h
+ *
+ * Checks of the host tests: a failed CHECK prints its location and makes
+ * TEST_EXIT return 1, the other checks still run.
+ */
+#ifndef __TEST_H
+#define __TEST_H
+
+#include <stdio.h>
+
+static int test_failures;
+
+#define CHECK(cond) do { \
+		if (!(cond)) { \
+			printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+			test_failures++; \
+		} \
+	} while (0)
+
+#define CHECK_EQ(a, b) do { \
+		long long a_ = (long long)(a), b_ = (long long)(b); \
+		if (a_ != b_) { \
+			printf("%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n", __FILE__, __LINE__, #a, #b, a_, b_); \
+			test_failures++; \
+		} \
+	} while (0)
+
+#define TEST_EXIT() do { \
+		printf("%s: %s\n", __FILE__, test_failures ? "FAILED" : "passed"); \
+		return test_failures ? 1 : 0; \
+	} while (0)
+
+#endif /* __TEST_H */
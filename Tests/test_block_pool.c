@@ -0,0 +1,179 @@
+/*
+ * test_block_pool.c
+ *
+ * block_pool: exhaustion, double free, foreign pointers and the tagged
+ * free list under concurrent alloc/free from several threads.
+ */
+#include "block_pool.h"
+#include "test.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+
+#define TEST_BLOCKS                 4U
+#define TEST_SIZE                   64U
+
+BLOCK_POOL_DEFINE(test_pool, TEST_SIZE, TEST_BLOCKS, AXI, 1);
+
+#define STRESS_BLOCKS               8U
+#define STRESS_THREADS              4
+#define STRESS_LOOPS                200000
+
+BLOCK_POOL_DEFINE(stress_pool, TEST_SIZE, STRESS_BLOCKS, AXI, 1);
+
+/* Owner of each stress block, 0 while free */
+static volatile uint32_t owner[STRESS_BLOCKS];
+static volatile uint32_t stress_errors;
+
+static void test_exhaustion(void)
+{
+	void *block[TEST_BLOCKS];
+	void *again;
+
+	for (uint32_t i = 0; i < TEST_BLOCKS; i++)
+	{
+		block[i] = block_pool_alloc(&test_pool);
+		CHECK(block[i] != NULL);
+		CHECK(((uintptr_t)block[i] % BLOCK_POOL_CACHE_LINE) == 0U);
+		for (uint32_t j = 0; j < i; j++)
+			CHECK(block[i] != block[j]);
+		memset(block[i], 0xA5, TEST_SIZE);
+	}
+
+	CHECK(block_pool_alloc(&test_pool) == NULL);
+	CHECK(block_pool_alloc(&test_pool) == NULL);
+	CHECK_EQ(test_pool.failures, 2);
+	CHECK_EQ(test_pool.used, TEST_BLOCKS);
+	CHECK_EQ(test_pool.used_max, TEST_BLOCKS);
+
+	/* A freed block is the next one handed out */
+	CHECK_EQ(block_pool_free(&test_pool, block[2]), BLOCK_POOL_OK);
+	again = block_pool_alloc(&test_pool);
+	CHECK(again == block[2]);
+	CHECK(block_pool_alloc(&test_pool) == NULL);
+
+	for (uint32_t i = 0; i < TEST_BLOCKS; i++)
+		CHECK_EQ(block_pool_free(&test_pool, block[i]), BLOCK_POOL_OK);
+	CHECK_EQ(test_pool.used, 0);
+	CHECK_EQ(test_pool.allocs, TEST_BLOCKS + 1U);
+}
+
+static void test_double_free(void)
+{
+	void *a = block_pool_alloc(&test_pool);
+	void *b = block_pool_alloc(&test_pool);
+	void *block[TEST_BLOCKS];
+
+	CHECK(a != NULL && b != NULL);
+	CHECK_EQ(block_pool_free(&test_pool, a), BLOCK_POOL_OK);
+	CHECK_EQ(block_pool_free(&test_pool, a), BLOCK_POOL_NOT_ALLOCATED);
+	CHECK_EQ(test_pool.used, 1);
+
+	/* Never handed out at all */
+	CHECK_EQ(block_pool_free(&test_pool, test_pool.base + (TEST_BLOCKS - 1U) * test_pool.block_size),
+			BLOCK_POOL_NOT_ALLOCATED);
+
+	CHECK_EQ(block_pool_free(&test_pool, b), BLOCK_POOL_OK);
+	CHECK_EQ(block_pool_free(&test_pool, b), BLOCK_POOL_NOT_ALLOCATED);
+	CHECK_EQ(test_pool.used, 0);
+
+	/* The list is intact: every block once, then exhausted */
+	for (uint32_t i = 0; i < TEST_BLOCKS; i++)
+	{
+		block[i] = block_pool_alloc(&test_pool);
+		CHECK(block[i] != NULL);
+		for (uint32_t j = 0; j < i; j++)
+			CHECK(block[i] != block[j]);
+	}
+	CHECK(block_pool_alloc(&test_pool) == NULL);
+	for (uint32_t i = 0; i < TEST_BLOCKS; i++)
+		CHECK_EQ(block_pool_free(&test_pool, block[i]), BLOCK_POOL_OK);
+}
+
+static void test_invalid(void)
+{
+	static uint8_t other[TEST_SIZE];
+	uint8_t *block = block_pool_alloc(&test_pool);
+
+	CHECK_EQ(block_pool_free(&test_pool, NULL), BLOCK_POOL_OK);
+	CHECK_EQ(block_pool_free(&test_pool, other), BLOCK_POOL_INVALID_PARAM);
+	CHECK_EQ(block_pool_free(&test_pool, block + 8), BLOCK_POOL_INVALID_PARAM);
+	CHECK_EQ(block_pool_free(&test_pool, test_pool.base + TEST_BLOCKS * test_pool.block_size),
+			BLOCK_POOL_INVALID_PARAM);
+	CHECK_EQ(test_pool.used, 1);
+	CHECK_EQ(block_pool_free(&test_pool, block), BLOCK_POOL_OK);
+}
+
+static void *stress_thread(void *arg)
+{
+	uint32_t id = (uint32_t)(uintptr_t)arg;
+	uint8_t *held[2] = { NULL, NULL };
+
+	for (int i = 0; i < STRESS_LOOPS; i++)
+	{
+		uint32_t slot = (uint32_t)i & 1U;
+		uint8_t *block = held[slot];
+
+		if (block != NULL)
+		{
+			uint32_t index = (uint32_t)(block - stress_pool.base) / stress_pool.block_size;
+
+			__atomic_store_n(&owner[index], 0U, __ATOMIC_RELAXED);
+			if (block_pool_free(&stress_pool, block) != BLOCK_POOL_OK)
+				__atomic_add_fetch(&stress_errors, 1U, __ATOMIC_RELAXED);
+			held[slot] = NULL;
+			continue;
+		}
+
+		block = block_pool_alloc(&stress_pool);
+		if (block != NULL)
+		{
+			uint32_t index = (uint32_t)(block - stress_pool.base) / stress_pool.block_size;
+
+			/* Handed out twice if somebody else still owns it */
+			if (__atomic_exchange_n(&owner[index], id, __ATOMIC_RELAXED) != 0U)
+				__atomic_add_fetch(&stress_errors, 1U, __ATOMIC_RELAXED);
+			held[slot] = block;
+		}
+	}
+
+	for (uint32_t slot = 0; slot < 2U; slot++)
+	{
+		if (held[slot] != NULL)
+		{
+			uint32_t index = (uint32_t)(held[slot] - stress_pool.base) / stress_pool.block_size;
+
+			__atomic_store_n(&owner[index], 0U, __ATOMIC_RELAXED);
+			block_pool_free(&stress_pool, held[slot]);
+		}
+	}
+	return NULL;
+}
+
+static void test_concurrent(void)
+{
+	pthread_t thread[STRESS_THREADS];
+
+	for (int i = 0; i < STRESS_THREADS; i++)
+		pthread_create(&thread[i], NULL, stress_thread, (void *)(uintptr_t)(i + 1));
+	for (int i = 0; i < STRESS_THREADS; i++)
+		pthread_join(thread[i], NULL);
+
+	CHECK_EQ(stress_errors, 0);
+	CHECK_EQ(stress_pool.used, 0);
+	CHECK(stress_pool.used_max <= STRESS_BLOCKS);
+
+	/* Nothing lost or duplicated on the list */
+	for (uint32_t i = 0; i < STRESS_BLOCKS; i++)
+		CHECK(block_pool_alloc(&stress_pool) != NULL);
+	CHECK(block_pool_alloc(&stress_pool) == NULL);
+}
+
+int main(void)
+{
+	test_exhaustion();
+	test_double_free();
+	test_invalid();
+	test_concurrent();
+	TEST_EXIT();
+}
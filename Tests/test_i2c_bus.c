@@ -0,0 +1,274 @@
+/*
+ * test_i2c_bus.c
+ *
+ * i2c_bus against the host bus (stubs/i2c_mock.c): queue order, codec
+ * accesses and batches, failed, refused and stuck transfers, statistics,
+ * touch sampling replayed over a codec volume ramp.
+ */
+#include "i2c_bus.h"
+#include "i2c_mock.h"
+#include "test.h"
+#include <string.h>
+
+#define CODEC_ADDR                  0x34U
+#define TOUCH_ADDR                  0xBAU
+
+static I2C_HandleTypeDef hi2c;
+static uint8_t order[8];
+static volatile uint32_t completed;
+
+static void record_done(i2c_bus_xfer_t *xfer, int status)
+{
+	(void)status;
+	order[completed++] = (uint8_t)(uintptr_t)xfer->ctx;
+}
+
+static void setup(i2c_bus_xfer_t *x, uint8_t client, uint8_t priority, uint16_t reg, uint8_t *data, uint8_t tag)
+{
+	memset(x, 0, sizeof(*x));
+	x->client = client;
+	x->priority = priority;
+	x->reg_size = I2C_MEMADD_SIZE_8BIT;
+	x->addr = (client == I2C_BUS_CLIENT_TOUCH) ? TOUCH_ADDR : CODEC_ADDR;
+	x->reg = reg;
+	x->data = data;
+	x->length = 2;
+	x->done = record_done;
+	x->ctx = (void *)(uintptr_t)tag;
+}
+
+/* Queued before the bus task exists: run by priority, then in submission order */
+static void test_queue_order(void)
+{
+	static uint8_t data[5][2];
+	i2c_bus_xfer_t x[4], last;
+	uint8_t bad;
+
+	i2c_mock_reset();
+	setup(&x[0], I2C_BUS_CLIENT_CODEC, I2C_BUS_PRIO_CODEC, 0x10, data[0], 1);
+	setup(&x[1], I2C_BUS_CLIENT_TOUCH, I2C_BUS_PRIO_TOUCH, 0x20, data[1], 2);
+	setup(&x[2], I2C_BUS_CLIENT_CODEC, I2C_BUS_PRIO_CODEC, 0x11, data[2], 3);
+	setup(&x[3], I2C_BUS_CLIENT_TOUCH, I2C_BUS_PRIO_TOUCH, 0x21, data[3], 4);
+	for (uint32_t i = 0; i < 4; i++)
+		CHECK_EQ(i2c_bus_submit(&x[i]), I2C_BUS_OK);
+
+	/* Refused */
+	CHECK_EQ(i2c_bus_submit(&x[0]), I2C_BUS_BUSY);
+	CHECK_EQ(i2c_bus_submit(NULL), I2C_BUS_INVALID_PARAM);
+	setup(&last, I2C_BUS_CLIENT_CODEC, I2C_BUS_PRIO_CODEC, 0x12, NULL, 5);
+	CHECK_EQ(i2c_bus_submit(&last), I2C_BUS_INVALID_PARAM);
+	setup(&last, I2C_BUS_CLIENT_CODEC, I2C_BUS_PRIO_CODEC, 0x12, &bad, 5);
+	last.length = 0;
+	CHECK_EQ(i2c_bus_submit(&last), I2C_BUS_INVALID_PARAM);
+	CHECK_EQ(i2c_bus_stats.queue_max, 4);
+
+	CHECK_EQ(i2c_bus_init(&hi2c), I2C_BUS_OK);
+	CHECK_EQ(hi2c.inits, 0);
+
+	/* Lowest priority and queued last, returns once the others ran */
+	setup(&last, I2C_BUS_CLIENT_CODEC, I2C_BUS_PRIO_CODEC, 0x12, data[4], 5);
+	CHECK_EQ(i2c_bus_transfer(&last), I2C_BUS_OK);
+
+	CHECK_EQ(completed, 4);
+	CHECK_EQ(order[0], 2);
+	CHECK_EQ(order[1], 4);
+	CHECK_EQ(order[2], 1);
+	CHECK_EQ(order[3], 3);
+	CHECK_EQ(i2c_mock.txns, 5);
+	CHECK_EQ(i2c_mock.log[0].addr, TOUCH_ADDR);
+	CHECK_EQ(i2c_mock.log[0].reg, 0x20);
+	CHECK_EQ(i2c_mock.log[4].reg, 0x12);
+	for (uint32_t i = 0; i < 4; i++)
+		CHECK_EQ(x[i].busy, 0);
+}
+
+static void test_codec_access(void)
+{
+	uint8_t value[2] = { 0x12, 0x34 };
+	uint8_t back[4] = { 0 };
+
+	i2c_mock_reset();
+	i2c_bus_reset();
+	CHECK_EQ(i2c_bus_codec_write(CODEC_ADDR, 0x21, value, 2), 0);
+	CHECK_EQ(i2c_mock.regs[0x21], 0x1234);
+	i2c_mock.regs[0x22] = 0xBEEF;
+	CHECK_EQ(i2c_bus_codec_read(CODEC_ADDR, 0x21, back, 4), 0);
+	CHECK_EQ(back[0], 0x12);
+	CHECK_EQ(back[1], 0x34);
+	CHECK_EQ(back[2], 0xBE);
+	CHECK_EQ(back[3], 0xEF);
+
+	CHECK_EQ(i2c_mock.txns, 2);
+	CHECK_EQ(i2c_mock.log[1].read, 1);
+	CHECK_EQ(i2c_mock.bytes, 1 + 2 + 1 + 4);
+	CHECK_EQ(i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].transfers, 2);
+	CHECK_EQ(i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].errors, 0);
+	CHECK(i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].latency_cycles_max > 0);
+	CHECK_EQ(i2c_bus_stats.client[I2C_BUS_CLIENT_TOUCH].transfers, 0);
+}
+
+/* One queue entry, one I2C write per record in order */
+static void test_batch(void)
+{
+	static uint8_t records[] = { 0x10, 0x00, 0x01, 0x05, 0xAB, 0xCD, 0x10, 0x00, 0x02 };
+	i2c_bus_batch_t batch;
+
+	i2c_mock_reset();
+	i2c_bus_reset();
+	i2c_bus_batch_init(&batch, CODEC_ADDR);
+	CHECK_EQ(i2c_bus_batch_submit(&batch), I2C_BUS_OK);
+	CHECK_EQ(i2c_mock.txns, 0);
+
+	for (uint32_t i = 0; i < I2C_BUS_BATCH_MAX; i++)
+		CHECK_EQ(i2c_bus_batch_write(&batch, (uint8_t)(0x40 + i), (uint16_t)(0x100 * i + i)), I2C_BUS_OK);
+	CHECK_EQ(i2c_bus_batch_write(&batch, 0x7F, 0), I2C_BUS_NO_RESOURCES);
+	CHECK_EQ(i2c_bus_batch_submit(&batch), I2C_BUS_OK);
+	CHECK_EQ(batch.count, 0);
+
+	CHECK_EQ(i2c_mock.txns, I2C_BUS_BATCH_MAX);
+	for (uint32_t i = 0; i < I2C_BUS_BATCH_MAX; i++)
+	{
+		CHECK_EQ(i2c_mock.log[i].reg, 0x40 + i);
+		CHECK_EQ(i2c_mock.log[i].length, 2);
+		CHECK_EQ(i2c_mock.regs[0x40 + i], 0x100 * i + i);
+	}
+	CHECK_EQ(i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].transfers, 1);
+	CHECK_EQ(i2c_bus_stats.queue_max, 1);
+
+	/* WM8904_IO_t form, a register written twice keeps the last value */
+	i2c_mock_reset();
+	CHECK_EQ(i2c_bus_codec_batch(CODEC_ADDR, records, 3), 0);
+	CHECK_EQ(i2c_mock.txns, 3);
+	CHECK_EQ(i2c_mock.log[1].reg, 0x05);
+	CHECK_EQ(i2c_mock.regs[0x05], 0xABCD);
+	CHECK_EQ(i2c_mock.regs[0x10], 0x0002);
+	CHECK_EQ(i2c_bus_codec_batch(CODEC_ADDR, records, 0), 0);
+	CHECK_EQ(i2c_mock.txns, 3);
+}
+
+static void test_faults(void)
+{
+	i2c_bus_batch_t batch;
+	uint8_t value[2] = { 0, 1 };
+
+	/* A NACK stops the batch, the records after it are not sent */
+	i2c_mock_reset();
+	i2c_bus_reset();
+	i2c_mock_fail(1, I2C_MOCK_NACK);
+	i2c_bus_batch_init(&batch, CODEC_ADDR);
+	for (uint32_t i = 0; i < 3; i++)
+		i2c_bus_batch_write(&batch, (uint8_t)(0x50 + i), 0x1111);
+	CHECK_EQ(i2c_bus_batch_submit(&batch), I2C_BUS_ERROR);
+	CHECK_EQ(i2c_mock.txns, 2);
+	CHECK_EQ(i2c_mock.regs[0x50], 0x1111);
+	CHECK_EQ(i2c_mock.regs[0x51], 0);
+	CHECK_EQ(i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].errors, 1);
+
+	/* Refused by the HAL */
+	i2c_mock_reset();
+	i2c_mock_fail(0, I2C_MOCK_HAL_ERROR);
+	CHECK_EQ(i2c_bus_codec_write(CODEC_ADDR, 0x21, value, 2), -1);
+	CHECK_EQ(i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].errors, 2);
+
+	/* No completion: timeout and a fresh peripheral, the next transfer works */
+	i2c_mock_reset();
+	i2c_mock_fail(0, I2C_MOCK_HANG);
+	CHECK_EQ(i2c_bus_codec_write(CODEC_ADDR, 0x21, value, 2), -1);
+	CHECK_EQ(i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].timeouts, 1);
+	CHECK_EQ(i2c_mock.deinits, 1);
+	CHECK_EQ(hi2c.inits, 1);
+	CHECK_EQ(i2c_bus_codec_write(CODEC_ADDR, 0x21, value, 2), 0);
+	CHECK_EQ(i2c_mock.regs[0x21], 0x0001);
+	CHECK_EQ(i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].transfers, 4);
+
+	i2c_bus_print();
+}
+
+#define RAMP_STEPS                  64
+#define RAMP_REGS                   4       /* HPOUT1 and LINEOUT, left and right */
+#define TOUCH_PERIOD                (600U * 1000U)  /* 1 kHz, in cycles */
+
+/* Bus time of one 8 bit register write of 2 bytes, and of a GT911 status read */
+#define CODEC_RECORD_CYCLES         ((1U + 1U + 2U) * I2C_MOCK_CYCLES_PER_BYTE)
+#define TOUCH_READ_CYCLES           ((1U + 2U + 1U) * I2C_MOCK_CYCLES_PER_BYTE)
+
+static i2c_bus_xfer_t touch;
+static uint8_t touch_status;
+static uint32_t touch_due;
+static uint32_t touch_samples;
+
+static void touch_done(i2c_bus_xfer_t *xfer, int status)
+{
+	(void)xfer;
+	if (status == I2C_BUS_OK)
+		touch_samples++;
+}
+
+/* The sampling timer of the touch, fires while the codec has the bus */
+static void touch_timer(void)
+{
+	if ((int32_t)(DWT->CYCCNT - touch_due) < 0 || touch.busy)
+		return;
+	touch_due += TOUCH_PERIOD;
+	CHECK_EQ(i2c_bus_submit(&touch), I2C_BUS_OK);
+}
+
+/* Every record of a ramp step is a chance for a touch sample, none waits
+   behind the rest of the batch */
+static void test_touch_during_ramp(void)
+{
+	i2c_bus_batch_t batch;
+	uint32_t records = 0;
+
+	i2c_mock_reset();
+	i2c_bus_reset();
+	memset(&touch, 0, sizeof(touch));
+	touch.client = I2C_BUS_CLIENT_TOUCH;
+	touch.priority = I2C_BUS_PRIO_TOUCH;
+	touch.read = 1;
+	touch.reg_size = I2C_MEMADD_SIZE_16BIT;
+	touch.addr = TOUCH_ADDR;
+	touch.reg = 0x814E;
+	touch.data = &touch_status;
+	touch.length = 1;
+	touch.done = touch_done;
+	touch_due = DWT->CYCCNT;
+	touch_samples = 0;
+	i2c_mock.on_txn = touch_timer;
+
+	i2c_bus_batch_init(&batch, CODEC_ADDR);
+	for (uint32_t step = 0; step < RAMP_STEPS; step++)
+	{
+		for (uint32_t r = 0; r < RAMP_REGS; r++)
+			CHECK_EQ(i2c_bus_batch_write(&batch, (uint8_t)(0x39 + r), (uint16_t)(0x0100U | step)), I2C_BUS_OK);
+		CHECK_EQ(i2c_bus_batch_submit(&batch), I2C_BUS_OK);
+		records += RAMP_REGS;
+	}
+	i2c_mock.on_txn = NULL;
+
+	/* The touch read went between the records of the batches */
+	CHECK(touch_samples >= records * CODEC_RECORD_CYCLES / TOUCH_PERIOD);
+	CHECK_EQ(i2c_bus_stats.client[I2C_BUS_CLIENT_TOUCH].transfers, touch_samples);
+	CHECK_EQ(i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].transfers, RAMP_STEPS);
+	CHECK_EQ(i2c_mock.txns, records + touch_samples);
+	for (uint32_t r = 0; r < RAMP_REGS; r++)
+		CHECK_EQ(i2c_mock.regs[0x39 + r], 0x0100U | (RAMP_STEPS - 1));
+
+	/* Max wait of the touch: the codec record on the bus when it was due */
+	printf("touch max %lu cycles, codec max %lu cycles, record %u cycles\n",
+			(unsigned long)i2c_bus_stats.client[I2C_BUS_CLIENT_TOUCH].latency_cycles_max,
+			(unsigned long)i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].latency_cycles_max,
+			CODEC_RECORD_CYCLES);
+	CHECK(i2c_bus_stats.client[I2C_BUS_CLIENT_TOUCH].latency_cycles_max <= CODEC_RECORD_CYCLES + TOUCH_READ_CYCLES);
+	i2c_bus_print();
+}
+
+int main(void)
+{
+	test_queue_order();
+	test_codec_access();
+	test_batch();
+	test_faults();
+	test_touch_during_ramp();
+	TEST_EXIT();
+}
@@ -0,0 +1,594 @@
+/*
+ * test_mjpeg_decoder.cpp
+ *
+ * SoftwareMJPEGDecoder and the AVI parsing of AVIMJPEGDecoder on AVI clips
+ * built from the sw_jpeg reference frames, with audio chunks in between:
+ * the header, frame stepping and seeking with and without the frame index,
+ * decoding from memory and through a file-backed VideoDataReader, errors,
+ * and the frame rate of each clip.
+ *
+ * "make -C Tests bench" plays the clips given in CLIPS=... too, the rates
+ * are only meaningful there, built without the sanitizers.
+ */
+#include <SoftwareMJPEGDecoder.hpp>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+extern "C"
+{
+#include "sw_jpeg.h"
+#include "test.h"
+#include "test_sw_jpeg_data.h"
+}
+
+#ifndef BENCH_LOOPS
+#define BENCH_LOOPS                 20
+#endif
+
+#define CLIP_SIZE_MAX               (256U * 1024U)
+#define AVI_BUFFER_SIZE             (16U * 1024U)
+#define BENCH_FRAMES                30U
+#define SENTINEL                    0x12345678U
+
+/* Video area of the board, the rates are scaled to it */
+#define VIDEO_WIDTH                 800U
+#define VIDEO_HEIGHT                480U
+
+/* Cache maintenance of the target, nothing to do on the host */
+extern "C" void dcache_maint_mark(const void *addr, uint32_t size)
+{
+}
+
+typedef struct
+{
+	const uint8_t *data;
+	uint32_t length;
+} frame_t;
+
+static const frame_t ref_frames[] = {
+	{ ref_420, sizeof(ref_420) },
+	{ ref_444, sizeof(ref_444) },
+	{ ref_gray, sizeof(ref_gray) },
+};
+#define REF_FRAMES                  (sizeof(ref_frames) / sizeof(ref_frames[0]))
+
+static uint8_t clip[CLIP_SIZE_MAX];
+static uint8_t avi_buffer[AVI_BUFFER_SIZE];
+static uint32_t expected[REF_FRAMES][REF_WIDTH * REF_HEIGHT];
+static uint32_t out[BENCH_WIDTH * BENCH_HEIGHT];
+
+/*
+ * AVI clip writer
+ */
+static uint32_t pos;
+
+static void put32(uint32_t v)
+{
+	for (uint32_t i = 0; i < 4; i++)
+		clip[pos++] = (uint8_t)(v >> (8 * i));
+}
+
+static void put16(uint16_t v)
+{
+	clip[pos++] = (uint8_t)v;
+	clip[pos++] = (uint8_t)(v >> 8);
+}
+
+static void fourcc(const char *id)
+{
+	memcpy(&clip[pos], id, 4);
+	pos += 4;
+}
+
+/* Chunk header with the size patched by end(), returns the size field */
+static uint32_t begin(const char *id)
+{
+	fourcc(id);
+	put32(0);
+	return pos - 4;
+}
+
+static void end(uint32_t size_at)
+{
+	const uint32_t size = pos - size_at - 4;
+
+	clip[size_at + 0] = (uint8_t)size;
+	clip[size_at + 1] = (uint8_t)(size >> 8);
+	clip[size_at + 2] = (uint8_t)(size >> 16);
+	clip[size_at + 3] = (uint8_t)(size >> 24);
+	if (pos & 1U)
+		clip[pos++] = 0;            /* pad to a word, not counted */
+}
+
+/*
+ * An MJPEG clip of count frames, 40 ms each, cycling through frames[], as
+ * written by common muxers: hdrl with the main and the stream header, a JUNK
+ * chunk, movi with an audio chunk of odd size after every video chunk, then
+ * idx1 unless without_index. Returns the file length.
+ */
+static uint32_t build_clip(const frame_t *frames, uint32_t kinds, uint32_t count, uint32_t width, uint32_t height,
+		int without_index)
+{
+	uint32_t chunks[2 * BENCH_FRAMES][3];   /* offset from 'movi', size, video */
+	uint32_t n = 0;
+	uint32_t riff, hdrl, strl, movi, movi_at, idx1, at;
+
+	memset(clip, 0, sizeof(clip));
+	pos = 0;
+	riff = begin("RIFF");
+	fourcc("AVI ");
+
+	hdrl = begin("LIST");
+	fourcc("hdrl");
+	at = begin("avih");
+	put32(40000);                   /* dwMicroSecPerFrame */
+	put32(0);
+	put32(0);
+	put32(0x10);                    /* AVIF_HASINDEX */
+	put32(count);                   /* dwTotalFrames */
+	put32(0);
+	put32(2);                       /* dwStreams */
+	put32(AVI_BUFFER_SIZE);
+	put32(width);
+	put32(height);
+	for (uint32_t i = 0; i < 4; i++)
+		put32(0);
+	end(at);
+	strl = begin("LIST");
+	fourcc("strl");
+	at = begin("strh");
+	fourcc("vids");
+	fourcc("MJPG");
+	for (uint32_t i = 0; i < 3; i++)
+		put32(0);
+	put32(1);                       /* dwScale */
+	put32(25);                      /* dwRate */
+	put32(0);
+	put32(count);                   /* dwLength */
+	for (uint32_t i = 0; i < 3; i++)
+		put32(0);
+	put16(0);
+	put16(0);
+	put16((uint16_t)width);
+	put16((uint16_t)height);
+	end(at);
+	end(strl);
+	end(hdrl);
+
+	/* Skipped by the search for movi */
+	at = begin("JUNK");
+	for (uint32_t i = 0; i < 10; i++)
+		put32(0);
+	end(at);
+
+	movi = begin("LIST");
+	movi_at = pos;
+	fourcc("movi");
+	for (uint32_t f = 0; f < count; f++)
+	{
+		const frame_t *frame = &frames[f % kinds];
+
+		chunks[n][0] = pos - movi_at;
+		chunks[n][1] = frame->length;
+		chunks[n++][2] = 1;
+		at = begin("00dc");
+		memcpy(&clip[pos], frame->data, frame->length);
+		pos += frame->length;
+		end(at);
+
+		chunks[n][0] = pos - movi_at;
+		chunks[n][1] = 3 + 2 * f;
+		chunks[n++][2] = 0;
+		at = begin("01wb");
+		for (uint32_t i = 0; i < 3 + 2 * f; i++)
+			clip[pos++] = 0x80;
+		end(at);
+	}
+	end(movi);
+
+	if (!without_index)
+	{
+		idx1 = begin("idx1");
+		for (uint32_t i = 0; i < n; i++)
+		{
+			fourcc(chunks[i][2] ? "00dc" : "01wb");
+			put32(chunks[i][2] ? 0x10 : 0);  /* AVIIF_KEYFRAME */
+			put32(chunks[i][0]);
+			put32(chunks[i][1]);
+		}
+		end(idx1);
+	}
+	end(riff);
+	return pos;
+}
+
+/*
+ * VideoDataReader on a file, as the board reads the clips from storage
+ */
+class FileReader : public touchgfx::VideoDataReader
+{
+public:
+	FileReader()
+		: file(0), length(0), reads(0)
+	{
+	}
+
+	~FileReader()
+	{
+		close();
+	}
+
+	bool open(const char *path)
+	{
+		close();
+		file = fopen(path, "rb");
+		if (file == 0)
+			return false;
+		fseek(file, 0, SEEK_END);
+		length = (uint32_t)ftell(file);
+		fseek(file, 0, SEEK_SET);
+		reads = 0;
+		return true;
+	}
+
+	/* The clip in memory written to path, then opened */
+	bool write(const char *path, uint32_t size)
+	{
+		FILE *f = fopen(path, "wb");
+
+		if (f == 0)
+			return false;
+		fwrite(clip, 1, size, f);
+		fclose(f);
+		return open(path);
+	}
+
+	void close()
+	{
+		if (file != 0)
+			fclose(file);
+		file = 0;
+	}
+
+	virtual uint32_t getDataLength()
+	{
+		return length;
+	}
+
+	virtual void seek(uint32_t position)
+	{
+		fseek(file, position, SEEK_SET);
+	}
+
+	virtual bool readData(void *dst, uint32_t bytes)
+	{
+		reads++;
+		return fread(dst, 1, bytes, file) == bytes;
+	}
+
+	FILE *file;
+	uint32_t length;
+	uint32_t reads;
+};
+
+static FileReader reader;
+static char clip_path[256];
+
+static void fill(uint32_t *buf, uint32_t pixels)
+{
+	for (uint32_t i = 0; i < pixels; i++)
+		buf[i] = SENTINEL;
+}
+
+/* The whole frame decoded equals the reference frame decoded alone */
+static int is_frame(const uint32_t *img, uint32_t ref)
+{
+	return memcmp(img, expected[ref], sizeof(expected[ref])) == 0;
+}
+
+static int decode_current(SoftwareMJPEGDecoder &decoder, uint32_t ref)
+{
+	fill(out, REF_WIDTH * REF_HEIGHT);
+	if (!decoder.decodeFrame(touchgfx::Rect(0, 0, REF_WIDTH, REF_HEIGHT), (uint8_t *)out, REF_WIDTH))
+		return 0;
+	return is_frame(out, ref);
+}
+
+/* The reference clip from memory, or through the reader and the AVI buffer */
+static void attach(SoftwareMJPEGDecoder &decoder, int through_reader, uint32_t length)
+{
+	if (through_reader)
+	{
+		CHECK(reader.write(clip_path, length));
+		decoder.setAVIFileBuffer(avi_buffer, sizeof(avi_buffer));
+		decoder.setVideoData(reader);
+	}
+	else
+		decoder.setVideoData(clip, length);
+}
+
+static void test_header(void)
+{
+	const uint32_t length = build_clip(ref_frames, REF_FRAMES, REF_FRAMES, REF_WIDTH, REF_HEIGHT, 0);
+
+	for (int through_reader = 0; through_reader < 2; through_reader++)
+	{
+		SoftwareMJPEGDecoder decoder;
+		touchgfx::VideoInformation info;
+
+		CHECK(!decoder.hasVideo());
+		attach(decoder, through_reader, length);
+		CHECK(decoder.hasVideo());
+		CHECK_EQ(decoder.getLastError(), MJPEGDecoder::AVI_NO_ERROR);
+		decoder.getVideoInfo(&info);
+		CHECK_EQ(info.frame_width, REF_WIDTH);
+		CHECK_EQ(info.frame_height, REF_HEIGHT);
+		CHECK_EQ(info.ms_between_frames, 40);
+		CHECK_EQ(info.number_of_frames, REF_FRAMES);
+		CHECK_EQ(decoder.getNumberOfFrames(), REF_FRAMES);
+		CHECK_EQ(decoder.getCurrentFrameNumber(), 1);
+		CHECK(decode_current(decoder, 0));
+	}
+}
+
+/* gotoNextFrame skips the audio chunks and wraps after the last frame */
+static void test_walk(void)
+{
+	const uint32_t length = build_clip(ref_frames, REF_FRAMES, REF_FRAMES, REF_WIDTH, REF_HEIGHT, 0);
+	uint32_t index[REF_FRAMES + 1];
+
+	/* No table, part of the frames in it, all of them */
+	for (uint32_t entries = 0; entries <= REF_FRAMES + 1; entries += 2)
+	{
+		for (int through_reader = 0; through_reader < 2; through_reader++)
+		{
+			SoftwareMJPEGDecoder decoder;
+
+			decoder.setFrameIndexBuffer(entries ? index : 0, entries);
+			attach(decoder, through_reader, length);
+			CHECK_EQ(decoder.getIndexedFrames(), MIN(entries, (uint32_t)REF_FRAMES));
+
+			for (uint32_t loop = 0; loop < 2; loop++)
+			{
+				for (uint32_t f = 1; f < REF_FRAMES; f++)
+				{
+					CHECK(decoder.gotoNextFrame());
+					CHECK_EQ(decoder.getCurrentFrameNumber(), f + 1);
+					CHECK(decode_current(decoder, f));
+				}
+				CHECK(!decoder.gotoNextFrame());
+				CHECK_EQ(decoder.getCurrentFrameNumber(), 1);
+				CHECK(decode_current(decoder, 0));
+			}
+			CHECK_EQ(decoder.getLastError(), MJPEGDecoder::AVI_NO_ERROR);
+		}
+	}
+}
+
+/* gotoFrame finds the video frames in idx1, past the table too */
+static void test_goto(void)
+{
+	const uint32_t length = build_clip(ref_frames, REF_FRAMES, REF_FRAMES, REF_WIDTH, REF_HEIGHT, 0);
+	static const uint32_t seeks[][2] = { { 3, 3 }, { 2, 2 }, { 1, 1 }, { 0, 1 }, { 99, 3 }, { 2, 2 } };
+	uint32_t index[REF_FRAMES];
+
+	for (uint32_t entries = 0; entries <= REF_FRAMES; entries++)
+	{
+		for (int through_reader = 0; through_reader < 2; through_reader++)
+		{
+			SoftwareMJPEGDecoder decoder;
+
+			decoder.setFrameIndexBuffer(entries ? index : 0, entries);
+			attach(decoder, through_reader, length);
+			for (uint32_t i = 0; i < sizeof(seeks) / sizeof(seeks[0]); i++)
+			{
+				decoder.gotoFrame(seeks[i][0]);
+				CHECK_EQ(decoder.getCurrentFrameNumber(), seeks[i][1]);
+				CHECK(decode_current(decoder, seeks[i][1] - 1));
+			}
+
+			/* Playback goes on from the frame sought */
+			decoder.gotoFrame(2);
+			CHECK(decoder.gotoNextFrame());
+			CHECK(decode_current(decoder, 2));
+		}
+	}
+}
+
+/* decodeNextFrame plays the clip through the reader, areas are clipped */
+static void test_decode(void)
+{
+	const uint32_t length = build_clip(ref_frames, REF_FRAMES, REF_FRAMES, REF_WIDTH, REF_HEIGHT, 0);
+	const uint32_t x = 5, y = 17, w = 20, h = 30;
+	SoftwareMJPEGDecoder decoder;
+	uint32_t decoded = 0;
+
+	attach(decoder, 1, length);
+
+	/* Audio chunks return true without decoding */
+	for (uint32_t chunk = 0; chunk < 2 * REF_FRAMES; chunk++)
+	{
+		const uint32_t before = decoder.getDecodeStats().frames;
+		const bool more = decoder.decodeNextFrame((uint8_t *)out, REF_WIDTH, REF_HEIGHT, REF_WIDTH * 4);
+
+		if (decoder.getDecodeStats().frames != before)
+		{
+			CHECK(is_frame(out, decoded));
+			decoded++;
+		}
+		CHECK_EQ(more, chunk + 1 < 2 * REF_FRAMES);
+		if (decoded < REF_FRAMES)
+			fill(out, REF_WIDTH * REF_HEIGHT);
+	}
+	CHECK_EQ(decoded, REF_FRAMES);
+	CHECK_EQ(decoder.getCurrentFrameNumber(), 1);
+	CHECK_EQ(decoder.getDecodeStats().errors, 0);
+
+	/* Only the area is written, at its place in the buffer */
+	fill(out, REF_WIDTH * REF_HEIGHT);
+	decoder.gotoFrame(2);
+	CHECK(decoder.decodeFrame(touchgfx::Rect(x, y, w, h), (uint8_t *)out, REF_WIDTH));
+	for (uint32_t py = 0; py < REF_HEIGHT; py++)
+	{
+		for (uint32_t px = 0; px < REF_WIDTH; px++)
+		{
+			const uint32_t i = py * REF_WIDTH + px;
+			const int inside = px >= x && px < x + w && py >= y && py < y + h;
+
+			if (inside ? out[i] != expected[1][i] : out[i] != SENTINEL)
+			{
+				CHECK_EQ(out[i], inside ? expected[1][i] : SENTINEL);
+				py = REF_HEIGHT;
+				break;
+			}
+		}
+	}
+
+	/* Outside the frame */
+	CHECK(!decoder.decodeFrame(touchgfx::Rect(REF_WIDTH, 0, 10, 10), (uint8_t *)out, REF_WIDTH));
+}
+
+static void test_errors(void)
+{
+	uint32_t length;
+
+	/* No idx1 */
+	{
+		SoftwareMJPEGDecoder decoder;
+
+		length = build_clip(ref_frames, REF_FRAMES, REF_FRAMES, REF_WIDTH, REF_HEIGHT, 1);
+		decoder.setVideoData(clip, length);
+		CHECK_EQ(decoder.getLastError(), MJPEGDecoder::AVI_ERROR_IDX1_NOT_FOUND);
+		attach(decoder, 1, length);
+		CHECK_EQ(decoder.getLastError(), MJPEGDecoder::AVI_ERROR_IDX1_NOT_FOUND);
+	}
+
+	/* A frame larger than the AVI buffer is skipped, playback goes on */
+	{
+		SoftwareMJPEGDecoder decoder;
+
+		length = build_clip(ref_frames, REF_FRAMES, REF_FRAMES, REF_WIDTH, REF_HEIGHT, 0);
+		CHECK(reader.write(clip_path, length));
+		decoder.setAVIFileBuffer(avi_buffer, sizeof(ref_444));
+		decoder.setVideoData(reader);
+		CHECK_EQ(decoder.getLastError(), MJPEGDecoder::AVI_NO_ERROR);
+		CHECK(decoder.decodeNextFrame((uint8_t *)out, REF_WIDTH, REF_HEIGHT, REF_WIDTH * 4));
+		CHECK_EQ(decoder.getLastError(), MJPEGDecoder::AVI_ERROR_FILE_BUFFER_TO_SMALL);
+		CHECK_EQ(decoder.getDecodeStats().frames, 0);
+		CHECK_EQ(decoder.getCurrentFrameNumber(), 2);
+		fill(out, REF_WIDTH * REF_HEIGHT);
+		CHECK(decoder.decodeNextFrame((uint8_t *)out, REF_WIDTH, REF_HEIGHT, REF_WIDTH * 4));
+		CHECK(decoder.decodeNextFrame((uint8_t *)out, REF_WIDTH, REF_HEIGHT, REF_WIDTH * 4));
+		CHECK_EQ(decoder.getDecodeStats().frames, 1);
+		CHECK(is_frame(out, 1));
+	}
+
+	/* Not a JPEG: counted, nothing written */
+	{
+		SoftwareMJPEGDecoder decoder;
+		static const uint8_t garbage[64] = { 0xFF, 0xD8, 0x00 };
+		const frame_t bad = { garbage, sizeof(garbage) };
+
+		length = build_clip(&bad, 1, 1, REF_WIDTH, REF_HEIGHT, 0);
+		decoder.setVideoData(clip, length);
+		fill(out, REF_WIDTH * REF_HEIGHT);
+		CHECK(!decoder.decodeFrame(touchgfx::Rect(0, 0, REF_WIDTH, REF_HEIGHT), (uint8_t *)out, REF_WIDTH));
+		CHECK_EQ(decoder.getDecodeStats().errors, 1);
+	}
+}
+
+static double seconds(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Play a clip loops times through the reader, decodeNextFrame as the video
+   widget does */
+static void rate(const char *name, uint8_t *buffer, uint32_t avi_size, uint32_t loops)
+{
+	SoftwareMJPEGDecoder decoder;
+	touchgfx::VideoInformation info;
+	uint8_t *avi = (uint8_t *)malloc(avi_size);
+	double start, elapsed;
+	uint32_t frames;
+
+	CHECK(avi != 0);
+	if (avi == 0)
+		return;
+	decoder.setAVIFileBuffer(avi, avi_size);
+	decoder.setVideoData(reader);
+	decoder.getVideoInfo(&info);
+	CHECK_EQ(decoder.getLastError(), MJPEGDecoder::AVI_NO_ERROR);
+	if (decoder.getLastError() != MJPEGDecoder::AVI_NO_ERROR || info.frame_width == 0 || info.frame_height == 0)
+	{
+		free(avi);
+		return;
+	}
+
+	start = seconds();
+	for (uint32_t loop = 0; loop < loops; loop++)
+	{
+		while (decoder.decodeNextFrame(buffer, (uint16_t)info.frame_width, (uint16_t)info.frame_height,
+				info.frame_width * 4))
+			;
+	}
+	elapsed = seconds() - start;
+	frames = decoder.getDecodeStats().frames;
+
+	CHECK_EQ(decoder.getDecodeStats().errors, 0);
+	CHECK(frames > 0);
+	if (frames > 0)
+		printf("%s: %lu frames %lux%lu, %.1f us per frame, %.0f fps (%.0f fps at %ux%u)\n",
+				name, (unsigned long)(frames / loops), (unsigned long)info.frame_width,
+				(unsigned long)info.frame_height, elapsed * 1e6 / frames, frames / elapsed,
+				frames / elapsed * info.frame_width * info.frame_height / (VIDEO_WIDTH * VIDEO_HEIGHT),
+				VIDEO_WIDTH, VIDEO_HEIGHT);
+	free(avi);
+}
+
+/* The frame of the sw_jpeg rate in a clip, then the clips given, played once */
+static void test_rate(int clips, char **paths)
+{
+	static const frame_t bench = { bench_420, sizeof(bench_420) };
+	const uint32_t length = build_clip(&bench, 1, BENCH_FRAMES, BENCH_WIDTH, BENCH_HEIGHT, 0);
+
+	CHECK(reader.write(clip_path, length));
+	rate("bench_420 clip", (uint8_t *)out, AVI_BUFFER_SIZE, BENCH_LOOPS);
+
+	for (int i = 0; i < clips; i++)
+	{
+		uint8_t *buffer = (uint8_t *)malloc(VIDEO_WIDTH * VIDEO_HEIGHT * 4);
+
+		CHECK(buffer != 0);
+		CHECK(reader.open(paths[i]));
+		if (buffer != 0 && reader.file != 0)
+			rate(paths[i], buffer, 128U * 1024U, 1);
+		free(buffer);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	const char *tmp = getenv("TMPDIR");
+
+	snprintf(clip_path, sizeof(clip_path), "%s/test_mjpeg_decoder_%d.avi", tmp ? tmp : "/tmp", (int)getpid());
+	for (uint32_t i = 0; i < REF_FRAMES; i++)
+		CHECK_EQ(sw_jpeg_decode(ref_frames[i].data, ref_frames[i].length, expected[i], REF_WIDTH,
+				0, 0, REF_WIDTH, REF_HEIGHT), SW_JPEG_OK);
+
+	test_header();
+	test_walk();
+	test_goto();
+	test_decode();
+	test_errors();
+	test_rate(argc - 1, argv + 1);
+
+	reader.close();
+	remove(clip_path);
+	TEST_EXIT();
+}
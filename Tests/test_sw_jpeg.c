@@ -0,0 +1,246 @@
+/*
+ * test_sw_jpeg.c
+ *
+ * sw_jpeg: reference streams against libjpeg, clipped decodes, corrupted
+ * Huffman tables and entropy data, and the decode rate of an MJPEG frame.
+ *
+ * The rate is only meaningful from "make -C Tests bench", built without the
+ * sanitizers.
+ */
+#include "sw_jpeg.h"
+#include "test.h"
+#include "test_sw_jpeg_data.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef BENCH_LOOPS
+#define BENCH_LOOPS                 20
+#endif
+
+#define SENTINEL                    0x12345678U
+
+/* Video area of the board, the rates are scaled to it */
+#define VIDEO_WIDTH                 800U
+#define VIDEO_HEIGHT                480U
+
+static uint32_t out[BENCH_WIDTH * BENCH_HEIGHT];
+static uint32_t full[BENCH_WIDTH * BENCH_HEIGHT];
+
+static void fill(uint32_t *buf, uint32_t pixels)
+{
+	for (uint32_t i = 0; i < pixels; i++)
+		buf[i] = SENTINEL;
+}
+
+/* Mean and largest channel difference against libjpeg, bpp 3 or 1 */
+static void compare(const uint32_t *img, const uint8_t *ref, uint32_t bpp, double *mean, uint32_t *max)
+{
+	uint64_t sum = 0;
+
+	*max = 0;
+	for (uint32_t i = 0; i < REF_WIDTH * REF_HEIGHT; i++)
+	{
+		CHECK_EQ(img[i] >> 24, 0xFF);
+		for (uint32_t c = 0; c < 3; c++)
+		{
+			int32_t v = (int32_t)((img[i] >> (16 - 8 * c)) & 0xFFU);
+			int32_t r = ref[i * bpp + (bpp == 3 ? c : 0)];
+			uint32_t d = (uint32_t)abs(v - r);
+
+			sum += d;
+			if (d > *max)
+				*max = d;
+		}
+	}
+	*mean = (double)sum / (REF_WIDTH * REF_HEIGHT * 3);
+}
+
+static void test_info(void)
+{
+	sw_jpeg_info_t info;
+
+	CHECK_EQ(sw_jpeg_info(ref_420, sizeof(ref_420), &info), SW_JPEG_OK);
+	CHECK_EQ(info.width, REF_WIDTH);
+	CHECK_EQ(info.height, REF_HEIGHT);
+	CHECK_EQ(info.components, 3);
+	CHECK_EQ(info.h_samp, 2);
+	CHECK_EQ(info.v_samp, 2);
+
+	CHECK_EQ(sw_jpeg_info(ref_444, sizeof(ref_444), &info), SW_JPEG_OK);
+	CHECK_EQ(info.h_samp, 1);
+	CHECK_EQ(info.v_samp, 1);
+
+	CHECK_EQ(sw_jpeg_info(ref_gray, sizeof(ref_gray), &info), SW_JPEG_OK);
+	CHECK_EQ(info.components, 1);
+
+	CHECK_EQ(sw_jpeg_info(ref_420, sizeof(ref_420), NULL), SW_JPEG_INVALID_PARAM);
+	CHECK_EQ(sw_jpeg_info(ref_420 + 1, sizeof(ref_420) - 1, &info), SW_JPEG_ERROR);
+}
+
+static void test_reference(void)
+{
+	double mean;
+	uint32_t max;
+
+	/* Chroma is replicated where libjpeg interpolates it, hence the 4:2:0 margin */
+	fill(out, REF_WIDTH * REF_HEIGHT);
+	CHECK_EQ(sw_jpeg_decode(ref_420, sizeof(ref_420), out, REF_WIDTH, 0, 0, REF_WIDTH, REF_HEIGHT), SW_JPEG_OK);
+	compare(out, ref_420_rgb, 3, &mean, &max);
+	CHECK(mean < 2.5);
+	CHECK(max <= 8);
+
+	fill(out, REF_WIDTH * REF_HEIGHT);
+	CHECK_EQ(sw_jpeg_decode(ref_444, sizeof(ref_444), out, REF_WIDTH, 0, 0, REF_WIDTH, REF_HEIGHT), SW_JPEG_OK);
+	compare(out, ref_444_rgb, 3, &mean, &max);
+	CHECK(mean < 0.5);
+	CHECK(max <= 2);
+
+	fill(out, REF_WIDTH * REF_HEIGHT);
+	CHECK_EQ(sw_jpeg_decode(ref_gray, sizeof(ref_gray), out, REF_WIDTH, 0, 0, REF_WIDTH, REF_HEIGHT), SW_JPEG_OK);
+	compare(out, ref_gray_y, 1, &mean, &max);
+	CHECK(mean < 0.1);
+	CHECK(max <= 1);
+}
+
+static void test_clip(void)
+{
+	const uint16_t x = 21, y = 13, w = 70, h = 37;
+
+	fill(full, BENCH_WIDTH * BENCH_HEIGHT);
+	CHECK_EQ(sw_jpeg_decode(bench_420, sizeof(bench_420), full, BENCH_WIDTH, 0, 0, BENCH_WIDTH, BENCH_HEIGHT),
+			SW_JPEG_OK);
+
+	/* Same pixels inside the area, nothing written outside */
+	fill(out, BENCH_WIDTH * BENCH_HEIGHT);
+	CHECK_EQ(sw_jpeg_decode(bench_420, sizeof(bench_420), out, BENCH_WIDTH, x, y, w, h), SW_JPEG_OK);
+	for (uint32_t py = 0; py < BENCH_HEIGHT; py++)
+	{
+		for (uint32_t px = 0; px < BENCH_WIDTH; px++)
+		{
+			const uint32_t i = py * BENCH_WIDTH + px;
+			const int inside = px >= x && px < x + w && py >= y && py < y + h;
+
+			CHECK_EQ(out[i], inside ? full[i] : SENTINEL);
+		}
+	}
+
+	/* Clipped to the image */
+	fill(out, REF_WIDTH * REF_HEIGHT);
+	CHECK_EQ(sw_jpeg_decode(ref_444, sizeof(ref_444), out, REF_WIDTH, 40, 30, 100, 100), SW_JPEG_OK);
+	CHECK(out[29 * REF_WIDTH + 44] == SENTINEL);
+	CHECK(out[30 * REF_WIDTH + 40] != SENTINEL);
+	CHECK(out[REF_HEIGHT * REF_WIDTH - 1] != SENTINEL);
+
+	CHECK_EQ(sw_jpeg_decode(ref_444, sizeof(ref_444), NULL, REF_WIDTH, 0, 0, 1, 1), SW_JPEG_INVALID_PARAM);
+	CHECK_EQ(sw_jpeg_decode(ref_444, sizeof(ref_444), out, REF_WIDTH, 0, 0, 0, 1), SW_JPEG_INVALID_PARAM);
+}
+
+static void test_bad_huffman(void)
+{
+	/* Three codes of length 1 */
+	static const uint8_t three_of_one[] =
+	{
+		0xFF, 0xD8, 0xFF, 0xC4, 0x00, 0x16, 0x00,
+		3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0x00, 0x01, 0x02,
+	};
+	/* Lengths 1 full, then a code of length 9 one past the fast table */
+	static const uint8_t past_fast[] =
+	{
+		0xFF, 0xD8, 0xFF, 0xC4, 0x00, 0x16, 0x10,
+		2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+		0x00, 0x01, 0x02,
+	};
+	/* Sixteen codes of length 4 then one of length 16 */
+	static const uint8_t past_long[] =
+	{
+		0xFF, 0xD8, 0xFF, 0xC4, 0x00, 0x24, 0x01,
+		0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+	};
+	sw_jpeg_info_t info;
+
+	CHECK_EQ(sw_jpeg_decode(three_of_one, sizeof(three_of_one), out, 1, 0, 0, 1, 1), SW_JPEG_ERROR);
+	CHECK_EQ(sw_jpeg_decode(past_fast, sizeof(past_fast), out, 1, 0, 0, 1, 1), SW_JPEG_ERROR);
+	CHECK_EQ(sw_jpeg_info(past_long, sizeof(past_long), &info), SW_JPEG_ERROR);
+
+	/* The next stream is decoded with sane tables again */
+	fill(out, REF_WIDTH * REF_HEIGHT);
+	CHECK_EQ(sw_jpeg_decode(ref_444, sizeof(ref_444), out, REF_WIDTH, 0, 0, REF_WIDTH, REF_HEIGHT), SW_JPEG_OK);
+	CHECK(out[0] != SENTINEL);
+}
+
+/*
+ * Random damage to the streams: whatever the result, no access outside the
+ * stream and the destination and no overflow (the sanitizers abort on them).
+ */
+static void test_corrupted(void)
+{
+	static uint8_t damaged[sizeof(bench_420)];
+	uint32_t seed = 1;
+	uint32_t errors = 0;
+
+	for (uint32_t n = 0; n < 400; n++)
+	{
+		const uint8_t *src = (n & 1U) ? ref_420 : bench_420;
+		const uint32_t size = (n & 1U) ? sizeof(ref_420) : sizeof(bench_420);
+		uint32_t len = size;
+
+		memcpy(damaged, src, size);
+		for (uint32_t i = 0; i < 1U + n % 8U; i++)
+		{
+			seed = seed * 1103515245U + 12345U;
+			damaged[(seed >> 8) % size] ^= (uint8_t)(1U << ((seed >> 4) & 7U));
+		}
+		if ((n % 5U) == 0)
+			len = size / 2U + (seed >> 16) % (size / 2U);  /* Truncated too */
+
+		if (sw_jpeg_decode(damaged, len, out, BENCH_WIDTH, 0, 0, BENCH_WIDTH, BENCH_HEIGHT) != SW_JPEG_OK)
+			errors++;
+	}
+	CHECK(errors > 0);
+}
+
+static double seconds(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Host decode rate of a full frame and of a quarter of it */
+static void test_rate(void)
+{
+	const double scale = (double)(BENCH_WIDTH * BENCH_HEIGHT) / (VIDEO_WIDTH * VIDEO_HEIGHT);
+	double start, whole, quarter;
+	int ret = SW_JPEG_OK;
+
+	start = seconds();
+	for (int i = 0; i < BENCH_LOOPS; i++)
+		ret |= sw_jpeg_decode(bench_420, sizeof(bench_420), out, BENCH_WIDTH, 0, 0, BENCH_WIDTH, BENCH_HEIGHT);
+	whole = (seconds() - start) / BENCH_LOOPS;
+
+	start = seconds();
+	for (int i = 0; i < BENCH_LOOPS; i++)
+		ret |= sw_jpeg_decode(bench_420, sizeof(bench_420), out, BENCH_WIDTH, 0, 0, BENCH_WIDTH / 2, BENCH_HEIGHT / 2);
+	quarter = (seconds() - start) / BENCH_LOOPS;
+
+	CHECK_EQ(ret, SW_JPEG_OK);
+	printf("%ux%u 4:2:0 frame: %.1f us, %.0f fps (%.0f fps at %ux%u)\n",
+			BENCH_WIDTH, BENCH_HEIGHT, whole * 1e6, 1.0 / whole, scale / whole, VIDEO_WIDTH, VIDEO_HEIGHT);
+	printf("top left quarter: %.1f us, %.0f fps (%.0f fps at %ux%u)\n",
+			quarter * 1e6, 1.0 / quarter, scale / quarter, VIDEO_WIDTH, VIDEO_HEIGHT);
+}
+
+int main(void)
+{
+	test_info();
+	test_reference();
+	test_clip();
+	test_bad_huffman();
+	test_corrupted();
+	test_rate();
+	TEST_EXIT();
+}
@@ -0,0 +1,1115 @@
+/*
+ * test_sw_jpeg_data.h
+ *
+ * Reference JPEG streams of test_sw_jpeg, encoded by libjpeg (Pillow) from a
+ * blurred synthetic scene with smooth chroma, and the pixels libjpeg decodes
+ * them to.
+ */
+#ifndef __TEST_SW_JPEG_DATA_H
+#define __TEST_SW_JPEG_DATA_H
+
+#include <stdint.h>
+
+#define REF_WIDTH                   45U
+#define REF_HEIGHT                  37U
+
+#define BENCH_WIDTH                 160U
+#define BENCH_HEIGHT                96U
+
+/* 45x37, 4:2:0, restart interval of 2 MCUs */
+static const uint8_t ref_420[1021] =
+{
+	0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+	0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03,
+	0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0A, 0x07,
+	0x07, 0x06, 0x08, 0x0C, 0x0A, 0x0C, 0x0C, 0x0B, 0x0A, 0x0B, 0x0B, 0x0D, 0x0E, 0x12, 0x10, 0x0D,
+	0x0E, 0x11, 0x0E, 0x0B, 0x0B, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0C, 0x0F,
+	0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x03, 0x04,
+	0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0D, 0x0B, 0x0D, 0x14, 0x14, 0x14, 0x14,
+	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xFF, 0xC0,
+	0x00, 0x11, 0x08, 0x00, 0x25, 0x00, 0x2D, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+	0x01, 0xFF, 0xC4, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+	0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+	0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7D, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+	0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xA1, 0x08, 0x23,
+	0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17,
+	0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A,
+	0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+	0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A,
+	0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+	0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+	0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5,
+	0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1,
+	0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xC4, 0x00, 0x1F, 0x01, 0x00, 0x03,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x11, 0x00,
+	0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+	0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+	0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0, 0x15,
+	0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A, 0x26, 0x27,
+	0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+	0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+	0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+	0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6,
+	0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4,
+	0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE2,
+	0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9,
+	0xFA, 0xFF, 0xDD, 0x00, 0x04, 0x00, 0x02, 0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11,
+	0x03, 0x11, 0x00, 0x3F, 0x00, 0xF9, 0xBF, 0x50, 0x5F, 0x09, 0x5C, 0x7C, 0x3A, 0x82, 0xD2, 0xD6,
+	0xDB, 0x6E, 0xA4, 0x3A, 0x90, 0x39, 0xCD, 0x71, 0x3A, 0x6F, 0x86, 0x8F, 0x18, 0x53, 0x5D, 0x9E,
+	0x9D, 0xE1, 0x7C, 0x11, 0xF2, 0xFE, 0x95, 0xD3, 0xE9, 0xFE, 0x19, 0xC6, 0x3E, 0x4A, 0xFE, 0x96,
+	0x78, 0xB8, 0xD3, 0x47, 0xCF, 0xE5, 0xD9, 0xCC, 0x65, 0x25, 0xA9, 0xC6, 0xE9, 0xFE, 0x1B, 0x3C,
+	0x7C, 0xB5, 0xBF, 0x6D, 0xA4, 0x9B, 0x45, 0xDC, 0x50, 0xFE, 0x55, 0xDB, 0x58, 0xF8, 0x6B, 0xA7,
+	0xCB, 0xFA, 0x56, 0xED, 0xB7, 0x86, 0x16, 0x45, 0xC3, 0x26, 0x47, 0xD2, 0xBE, 0x5F, 0x30, 0xCD,
+	0xE1, 0x14, 0xF5, 0x3F, 0x5E, 0xCA, 0xF1, 0xCA, 0xAD, 0xB5, 0x3F, 0xFF, 0xD0, 0xF1, 0x1D, 0x3E,
+	0xD2, 0x4B, 0x99, 0xC2, 0xAA, 0x92, 0x2B, 0xA9, 0x87, 0x40, 0x3B, 0x07, 0x06, 0xBB, 0x2D, 0x3F,
+	0xC2, 0x91, 0xC2, 0xD9, 0x48, 0x80, 0x3F, 0x4A, 0xDD, 0x87, 0xC3, 0x9F, 0x27, 0xDD, 0xFD, 0x2B,
+	0xDB, 0xC7, 0x67, 0x91, 0x53, 0xDC, 0xFE, 0xAB, 0xCA, 0x31, 0x4A, 0x14, 0xCF, 0x3D, 0xB0, 0xF0,
+	0xCE, 0x3F, 0x82, 0xBA, 0x3B, 0x1F, 0x0E, 0x74, 0xF9, 0x2B, 0xB4, 0xB2, 0xF0, 0xE7, 0x23, 0xE4,
+	0xAD, 0xEB, 0x3F, 0x0E, 0xF3, 0xF7, 0x6B, 0xDF, 0xC7, 0x67, 0x7C, 0x91, 0x7A, 0x9F, 0xE5, 0xB6,
+	0x53, 0x9C, 0xB7, 0x25, 0xA9, 0xFF, 0xD1, 0xB3, 0x67, 0xE1, 0xDE, 0x9F, 0x2D, 0x6D, 0xDA, 0xE8,
+	0x01, 0x46, 0x4A, 0xE0, 0x0E, 0xF5, 0xDA, 0xD9, 0xF8, 0x7B, 0xA7, 0xCB, 0x56, 0x35, 0x7F, 0x09,
+	0x5C, 0xDE, 0xE9, 0x33, 0x47, 0x68, 0x76, 0x4C, 0x47, 0x06, 0xBC, 0x5C, 0xC7, 0x88, 0x2E, 0xDA,
+	0xB9, 0xE4, 0x70, 0xEE, 0x6A, 0xA4, 0xD5, 0xD9, 0xCD, 0x69, 0xDA, 0x3C, 0x53, 0xB6, 0x23, 0x2A,
+	0xE4, 0x75, 0x02, 0xB7, 0xE0, 0xF0, 0xE6, 0x50, 0x7C, 0x9F, 0xA5, 0x63, 0x7C, 0x32, 0xF8, 0x6F,
+	0xE2, 0x0B, 0x0D, 0x69, 0xE5, 0xBD, 0x66, 0x58, 0x33, 0xC8, 0x27, 0x39, 0xAF, 0x70, 0xB7, 0xF0,
+	0xCF, 0xEE, 0xC6, 0x57, 0xF4, 0xAF, 0xCB, 0x73, 0x1C, 0xEA, 0xF3, 0xD1, 0x9F, 0xBE, 0x60, 0xB3,
+	0x45, 0x1A, 0x6A, 0xCC, 0xFF, 0xD2, 0xF6, 0x7B, 0x4D, 0x36, 0x11, 0xDA, 0xB7, 0xAD, 0x34, 0xB8,
+	0x70, 0x0E, 0x3B, 0x51, 0x45, 0x79, 0x59, 0x9C, 0xA5, 0xCA, 0xF5, 0x3F, 0x87, 0xF2, 0x89, 0x3E,
+	0x64, 0x6C, 0xD9, 0xE9, 0xD1, 0x70, 0x71, 0x5B, 0xD6, 0x5A, 0x6C, 0x3C, 0x71, 0x45, 0x15, 0xF8,
+	0xCE, 0x65, 0x39, 0x73, 0x3D, 0x4F, 0xE8, 0x6E, 0x1E, 0x94, 0xB4, 0xD4, 0xFF, 0xD3, 0xFB, 0x7B,
+	0x4F, 0xD2, 0xE1, 0xE0, 0xE2, 0xBA, 0x2B, 0x7D, 0x2E, 0x11, 0x18, 0xE2, 0x8A, 0x2B, 0xF9, 0x0B,
+	0x17, 0x39, 0x39, 0x6E, 0x7B, 0xB8, 0x29, 0xCB, 0x91, 0x6A, 0x7F, 0xFF, 0xD9,
+};
+
+/* ref_420 decoded by libjpeg, RGB */
+static const uint8_t ref_420_rgb[4995] =
+{
+	0x16, 0x0D, 0x84, 0x22, 0x17, 0x8F, 0x34, 0x26, 0xA1, 0x40, 0x30, 0xAC, 0x3F, 0x2A, 0xAB, 0x31,
+	0x1C, 0x9D, 0x28, 0x0E, 0x93, 0x25, 0x0B, 0x90, 0x28, 0x09, 0x93, 0x2A, 0x09, 0x94, 0x30, 0x0B,
+	0x97, 0x35, 0x0C, 0x99, 0x3C, 0x0A, 0x9D, 0x41, 0x0B, 0x9F, 0x47, 0x0C, 0xA2, 0x4B, 0x0C, 0xA3,
+	0x51, 0x0C, 0xA7, 0x55, 0x0B, 0xA6, 0x58, 0x0D, 0xA6, 0x5D, 0x0E, 0xA5, 0x62, 0x0F, 0xA5, 0x65,
+	0x10, 0xA3, 0x69, 0x11, 0xA5, 0x6C, 0x13, 0xA3, 0x71, 0x15, 0xA6, 0x73, 0x16, 0xA3, 0x75, 0x17,
+	0xA3, 0x7B, 0x19, 0xA2, 0x81, 0x1C, 0xA0, 0x87, 0x1E, 0x9F, 0x8B, 0x20, 0xA1, 0x8F, 0x21, 0x9E,
+	0x94, 0x22, 0x9B, 0x98, 0x23, 0x98, 0x9D, 0x21, 0x99, 0xA1, 0x20, 0x96, 0xA7, 0x1E, 0x90, 0xAD,
+	0x1D, 0x8E, 0xB5, 0x1B, 0x8B, 0xBC, 0x1A, 0x89, 0xC1, 0x19, 0x86, 0xC7, 0x1A, 0x85, 0xCE, 0x1A,
+	0x87, 0xD1, 0x1A, 0x86, 0xD3, 0x19, 0x86, 0x25, 0x1D, 0x94, 0x37, 0x2E, 0xA5, 0x4E, 0x43, 0xBD,
+	0x5D, 0x4D, 0xCA, 0x57, 0x44, 0xC4, 0x44, 0x2F, 0xB0, 0x31, 0x1A, 0x9E, 0x29, 0x0F, 0x94, 0x28,
+	0x0C, 0x94, 0x2B, 0x0C, 0x96, 0x30, 0x0E, 0x99, 0x37, 0x0E, 0x9B, 0x3D, 0x0D, 0x9F, 0x42, 0x0E,
+	0xA1, 0x46, 0x0E, 0xA3, 0x4B, 0x0F, 0xA5, 0x52, 0x10, 0xA8, 0x56, 0x0F, 0xA9, 0x5B, 0x10, 0xA8,
+	0x5E, 0x12, 0xA8, 0x62, 0x12, 0xA5, 0x67, 0x13, 0xA6, 0x6C, 0x14, 0xA6, 0x6F, 0x16, 0xA6, 0x72,
+	0x19, 0xA7, 0x75, 0x1A, 0xA5, 0x78, 0x1A, 0xA4, 0x7D, 0x1D, 0xA3, 0x84, 0x1F, 0xA3, 0x88, 0x22,
+	0xA1, 0x8D, 0x23, 0xA1, 0x92, 0x24, 0x9F, 0x94, 0x22, 0x9B, 0x97, 0x22, 0x97, 0x9C, 0x21, 0x96,
+	0xA0, 0x1F, 0x93, 0xA6, 0x1E, 0x8D, 0xAD, 0x1D, 0x8C, 0xB5, 0x1B, 0x89, 0xBD, 0x1B, 0x88, 0xC2,
+	0x1B, 0x85, 0xC8, 0x1B, 0x86, 0xCF, 0x1B, 0x86, 0xD1, 0x1C, 0x85, 0xD4, 0x1A, 0x85, 0x34, 0x2F,
+	0xA7, 0x4C, 0x47, 0xBF, 0x6A, 0x62, 0xDC, 0x77, 0x6B, 0xE7, 0x6F, 0x60, 0xDF, 0x57, 0x46, 0xC6,
+	0x3D, 0x29, 0xAC, 0x2C, 0x17, 0x9A, 0x29, 0x12, 0x98, 0x2E, 0x12, 0x9A, 0x33, 0x12, 0x9D, 0x38,
+	0x13, 0x9F, 0x3E, 0x13, 0xA1, 0x44, 0x13, 0xA3, 0x49, 0x13, 0xA5, 0x4D, 0x13, 0xA6, 0x55, 0x15,
+	0xAA, 0x57, 0x15, 0xAA, 0x5C, 0x16, 0xAA, 0x61, 0x17, 0xAA, 0x65, 0x17, 0xA8, 0x68, 0x19, 0xA8,
+	0x6D, 0x1A, 0xA6, 0x6F, 0x1B, 0xA5, 0x73, 0x1D, 0xA6, 0x75, 0x1D, 0xA5, 0x7A, 0x1E, 0xA5, 0x7D,
+	0x20, 0xA2, 0x85, 0x22, 0xA1, 0x88, 0x24, 0xA0, 0x8D, 0x25, 0xA0, 0x91, 0x25, 0x9C, 0x94, 0x23,
+	0x97, 0x97, 0x22, 0x94, 0x9B, 0x20, 0x92, 0x9F, 0x1F, 0x8E, 0xA6, 0x1E, 0x8C, 0xAD, 0x1E, 0x8A,
+	0xB6, 0x1F, 0x88, 0xBE, 0x1F, 0x86, 0xC5, 0x1F, 0x85, 0xCB, 0x1F, 0x85, 0xD0, 0x20, 0x85, 0xD4,
+	0x1F, 0x86, 0xD7, 0x1E, 0x84, 0x3A, 0x39, 0xB0, 0x54, 0x53, 0xCA, 0x73, 0x6F, 0xE8, 0x7F, 0x79,
+	0xF3, 0x77, 0x6D, 0xEA, 0x5F, 0x53, 0xD1, 0x44, 0x35, 0xB6, 0x32, 0x21, 0xA3, 0x2D, 0x19, 0x9E,
+	0x30, 0x19, 0x9F, 0x35, 0x19, 0xA1, 0x3A, 0x1A, 0xA3, 0x40, 0x19, 0xA6, 0x45, 0x18, 0xA6, 0x4A,
+	0x19, 0xA9, 0x4F, 0x1A, 0xAA, 0x55, 0x19, 0xAC, 0x59, 0x1B, 0xAC, 0x5D, 0x1C, 0xAC, 0x62, 0x1D,
+	0xAB, 0x66, 0x1D, 0xAA, 0x6B, 0x1E, 0xA8, 0x6E, 0x20, 0xA8, 0x72, 0x20, 0xA8, 0x75, 0x22, 0xA8,
+	0x78, 0x23, 0xA5, 0x7C, 0x23, 0xA5, 0x7F, 0x24, 0xA3, 0x84, 0x26, 0xA0, 0x89, 0x27, 0x9E, 0x8C,
+	0x27, 0x9D, 0x90, 0x28, 0x9B, 0x94, 0x26, 0x96, 0x98, 0x24, 0x91, 0x9B, 0x21, 0x8E, 0x9F, 0x20,
+	0x8B, 0xA6, 0x1F, 0x88, 0xAE, 0x20, 0x86, 0xB7, 0x21, 0x85, 0xC0, 0x21, 0x85, 0xCA, 0x24, 0x86,
+	0xCF, 0x24, 0x84, 0xD4, 0x24, 0x86, 0xD7, 0x25, 0x85, 0xD9, 0x24, 0x85, 0x33, 0x38, 0xAD, 0x4D,
+	0x50, 0xC5, 0x69, 0x69, 0xE1, 0x73, 0x72, 0xEA, 0x6D, 0x67, 0xE3, 0x5A, 0x51, 0xCE, 0x42, 0x37,
+	0xB7, 0x32, 0x26, 0xA6, 0x2E, 0x1F, 0xA0, 0x32, 0x1E, 0xA1, 0x36, 0x1F, 0xA3, 0x3B, 0x20, 0xA5,
+	0x41, 0x1F, 0xA9, 0x45, 0x1F, 0xA8, 0x4B, 0x1E, 0xAC, 0x50, 0x1F, 0xAC, 0x55, 0x20, 0xAC, 0x5A,
+	0x21, 0xAC, 0x5F, 0x22, 0xAD, 0x61, 0x23, 0xAC, 0x67, 0x23, 0xAA, 0x6C, 0x25, 0xA9, 0x6F, 0x26,
+	0xA9, 0x73, 0x26, 0xA8, 0x77, 0x28, 0xA8, 0x79, 0x29, 0xA6, 0x7E, 0x2A, 0xA6, 0x82, 0x2A, 0xA4,
+	0x85, 0x2A, 0x9F, 0x89, 0x2B, 0x9D, 0x8C, 0x2A, 0x9B, 0x8F, 0x29, 0x97, 0x94, 0x27, 0x92, 0x98,
+	0x25, 0x8C, 0x9A, 0x23, 0x89, 0x9E, 0x21, 0x85, 0xA4, 0x20, 0x83, 0xAD, 0x21, 0x81, 0xB8, 0x24,
+	0x82, 0xC0, 0x25, 0x81, 0xCC, 0x29, 0x84, 0xD2, 0x29, 0x84, 0xD7, 0x2A, 0x84, 0xDB, 0x2A, 0x84,
+	0xDC, 0x29, 0x84, 0x26, 0x30, 0xA3, 0x37, 0x41, 0xB4, 0x4E, 0x55, 0xCA, 0x58, 0x5D, 0xD3, 0x55,
+	0x55, 0xCF, 0x46, 0x44, 0xBF, 0x36, 0x32, 0xAD, 0x2B, 0x25, 0xA1, 0x2E, 0x23, 0xA3, 0x32, 0x23,
+	0xA2, 0x37, 0x23, 0xA6, 0x3B, 0x24, 0xA6, 0x42, 0x24, 0xA8, 0x46, 0x25, 0xAA, 0x4D, 0x25, 0xAC,
+	0x51, 0x25, 0xAE, 0x57, 0x27, 0xAF, 0x5B, 0x27, 0xAF, 0x5E, 0x29, 0xAF, 0x63, 0x2A, 0xAD, 0x68,
+	0x29, 0xAB, 0x6D, 0x2A, 0xAB, 0x71, 0x2C, 0xAB, 0x75, 0x2D, 0xAA, 0x78, 0x2C, 0xA8, 0x7B, 0x2D,
+	0xA5, 0x7E, 0x2D, 0xA5, 0x82, 0x2D, 0xA2, 0x86, 0x2C, 0x9D, 0x87, 0x2B, 0x98, 0x89, 0x29, 0x95,
+	0x8D, 0x28, 0x90, 0x93, 0x27, 0x8C, 0x97, 0x25, 0x87, 0x9A, 0x24, 0x85, 0x9E, 0x22, 0x80, 0xA5,
+	0x22, 0x7F, 0xAE, 0x25, 0x7F, 0xBB, 0x28, 0x81, 0xC2, 0x2A, 0x7F, 0xCD, 0x2D, 0x83, 0xD4, 0x2E,
+	0x82, 0xD8, 0x2F, 0x82, 0xDC, 0x2F, 0x81, 0xDE, 0x2E, 0x83, 0x1A, 0x2A, 0x9B, 0x22, 0x32, 0xA3,
+	0x32, 0x3D, 0xB0, 0x3A, 0x44, 0xB7, 0x3A, 0x3F, 0xB5, 0x33, 0x35, 0xAC, 0x2C, 0x2C, 0xA4, 0x29,
+	0x28, 0xA0, 0x2F, 0x29, 0xA5, 0x33, 0x2B, 0xA5, 0x37, 0x2B, 0xA9, 0x3E, 0x2B, 0xA9, 0x44, 0x2B,
+	0xAB, 0x49, 0x2B, 0xAD, 0x50, 0x2C, 0xB0, 0x54, 0x2C, 0xB0, 0x58, 0x2D, 0xB0, 0x5D, 0x2E, 0xB0,
+	0x61, 0x30, 0xB0, 0x65, 0x31, 0xAF, 0x6B, 0x30, 0xAE, 0x6F, 0x31, 0xAC, 0x74, 0x32, 0xAD, 0x78,
+	0x33, 0xAA, 0x7B, 0x32, 0xA8, 0x7D, 0x32, 0xA8, 0x81, 0x32, 0xA5, 0x84, 0x32, 0xA1, 0x88, 0x31,
+	0x9C, 0x89, 0x2E, 0x97, 0x8A, 0x2B, 0x91, 0x8B, 0x29, 0x8C, 0x92, 0x29, 0x88, 0x96, 0x27, 0x83,
+	0x9A, 0x27, 0x82, 0x9F, 0x27, 0x80, 0xA9, 0x29, 0x80, 0xB2, 0x2D, 0x80, 0xBE, 0x2F, 0x81, 0xC6,
+	0x32, 0x80, 0xD0, 0x33, 0x82, 0xD6, 0x34, 0x80, 0xDB, 0x35, 0x81, 0xDD, 0x35, 0x80, 0xDF, 0x34,
+	0x82, 0x15, 0x2B, 0x9A, 0x17, 0x2D, 0x9A, 0x1F, 0x31, 0xA1, 0x26, 0x36, 0xA7, 0x29, 0x34, 0xA7,
+	0x26, 0x30, 0xA3, 0x28, 0x2F, 0xA3, 0x2C, 0x31, 0xA6, 0x2F, 0x30, 0xA6, 0x34, 0x30, 0xA8, 0x39,
+	0x31, 0xAA, 0x3D, 0x32, 0xAC, 0x46, 0x32, 0xAD, 0x4B, 0x33, 0xAF, 0x51, 0x32, 0xB1, 0x56, 0x33,
+	0xB1, 0x5A, 0x33, 0xB0, 0x5D, 0x33, 0xAF, 0x61, 0x35, 0xB0, 0x66, 0x36, 0xAE, 0x6B, 0x35, 0xAD,
+	0x70, 0x37, 0xAC, 0x74, 0x37, 0xAC, 0x79, 0x39, 0xAB, 0x80, 0x3A, 0xAC, 0x83, 0x39, 0xAA, 0x87,
+	0x39, 0xA7, 0x8A, 0x39, 0xA2, 0x8D, 0x36, 0x9E, 0x8E, 0x34, 0x98, 0x8D, 0x32, 0x92, 0x8F, 0x2E,
+	0x8B, 0x94, 0x2C, 0x85, 0x97, 0x2B, 0x81, 0x9C, 0x2A, 0x7F, 0xA2, 0x2D, 0x7E, 0xAC, 0x2E, 0x7F,
+	0xB6, 0x33, 0x7F, 0xC3, 0x36, 0x82, 0xCB, 0x39, 0x80, 0xD3, 0x39, 0x81, 0xD6, 0x39, 0x7E, 0xDB,
+	0x3A, 0x7E, 0xDF, 0x3A, 0x7E, 0xE0, 0x39, 0x7E, 0x13, 0x2F, 0x9A, 0x14, 0x31, 0x99, 0x19, 0x31,
+	0x9D, 0x1C, 0x32, 0x9F, 0x21, 0x33, 0xA1, 0x25, 0x35, 0xA4, 0x2A, 0x36, 0xA6, 0x2D, 0x37, 0xA8,
+	0x32, 0x38, 0xAA, 0x35, 0x38, 0xAB, 0x3B, 0x38, 0xAB, 0x40, 0x39, 0xAD, 0x47, 0x38, 0xAD, 0x4C,
+	0x39, 0xAF, 0x51, 0x3A, 0xAF, 0x55, 0x39, 0xB0, 0x5B, 0x39, 0xB1, 0x5F, 0x39, 0xB0, 0x63, 0x3A,
+	0xB0, 0x68, 0x3C, 0xAF, 0x6D, 0x3B, 0xAE, 0x72, 0x3C, 0xAC, 0x76, 0x3C, 0xAC, 0x7B, 0x3D, 0xAA,
+	0x81, 0x3D, 0xAA, 0x85, 0x3E, 0xA8, 0x89, 0x3E, 0xA5, 0x8C, 0x3E, 0xA3, 0x91, 0x3D, 0x9F, 0x92,
+	0x3B, 0x99, 0x93, 0x39, 0x93, 0x95, 0x35, 0x8E, 0x9A, 0x34, 0x87, 0x9C, 0x34, 0x83, 0xA3, 0x34,
+	0x81, 0xA9, 0x36, 0x81, 0xB2, 0x38, 0x81, 0xBB, 0x3C, 0x81, 0xC7, 0x3E, 0x82, 0xCF, 0x40, 0x80,
+	0xD4, 0x3F, 0x7F, 0xD9, 0x3F, 0x7D, 0xDD, 0x3F, 0x7C, 0xE0, 0x40, 0x7C, 0xE3, 0x41, 0x7D, 0x12,
+	0x38, 0x9D, 0x15, 0x38, 0x9C, 0x18, 0x39, 0xA0, 0x1D, 0x3A, 0xA2, 0x20, 0x3B, 0xA4, 0x25, 0x3C,
+	0xA6, 0x2B, 0x3D, 0xA9, 0x2D, 0x3E, 0xA8, 0x31, 0x3D, 0xA9, 0x34, 0x3F, 0xAB, 0x3B, 0x3F, 0xAB,
+	0x41, 0x3F, 0xAC, 0x47, 0x3F, 0xAE, 0x4B, 0x3F, 0xAD, 0x52, 0x40, 0xB0, 0x56, 0x40, 0xAF, 0x5C,
+	0x41, 0xB2, 0x61, 0x40, 0xB1, 0x66, 0x42, 0xB0, 0x69, 0x42, 0xAF, 0x6F, 0x41, 0xAD, 0x73, 0x42,
+	0xAB, 0x7A, 0x43, 0xAB, 0x7D, 0x43, 0xA9, 0x82, 0x44, 0xA9, 0x87, 0x43, 0xA6, 0x8C, 0x45, 0xA5,
+	0x91, 0x44, 0xA2, 0x95, 0x45, 0x9E, 0x98, 0x42, 0x99, 0x9A, 0x41, 0x95, 0x9C, 0x3F, 0x8F, 0xA2,
+	0x40, 0x8B, 0xA6, 0x41, 0x87, 0xAB, 0x40, 0x86, 0xB0, 0x41, 0x85, 0xBA, 0x43, 0x85, 0xC2, 0x46,
+	0x84, 0xCB, 0x47, 0x83, 0xD3, 0x48, 0x81, 0xD6, 0x45, 0x7C, 0xDA, 0x45, 0x7C, 0xDF, 0x46, 0x7C,
+	0xE1, 0x47, 0x7B, 0xE4, 0x47, 0x7C, 0x12, 0x3E, 0x9F, 0x13, 0x3F, 0x9E, 0x16, 0x40, 0xA2, 0x1B,
+	0x41, 0xA4, 0x1F, 0x41, 0xA5, 0x23, 0x43, 0xA6, 0x28, 0x44, 0xA8, 0x2C, 0x45, 0xAA, 0x30, 0x46,
+	0xAB, 0x35, 0x47, 0xAD, 0x3B, 0x47, 0xAD, 0x40, 0x48, 0xAD, 0x47, 0x46, 0xAE, 0x4C, 0x47, 0xAE,
+	0x52, 0x47, 0xB0, 0x57, 0x48, 0xB1, 0x5C, 0x47, 0xB0, 0x60, 0x47, 0xAF, 0x64, 0x48, 0xAE, 0x6B,
+	0x48, 0xAE, 0x70, 0x48, 0xAB, 0x74, 0x48, 0xA9, 0x7A, 0x48, 0xA9, 0x7F, 0x49, 0xA7, 0x85, 0x4A,
+	0xA8, 0x89, 0x4A, 0xA5, 0x8E, 0x49, 0xA2, 0x94, 0x4A, 0x9F, 0x98, 0x4B, 0x9B, 0x9D, 0x4A, 0x98,
+	0xA0, 0x4A, 0x95, 0xA4, 0x49, 0x8F, 0xAA, 0x4B, 0x8D, 0xAE, 0x4B, 0x8B, 0xB3, 0x4B, 0x8A, 0xB7,
+	0x4B, 0x85, 0xBF, 0x4C, 0x85, 0xC6, 0x4D, 0x82, 0xCD, 0x4D, 0x80, 0xD3, 0x4D, 0x7F, 0xD8, 0x4C,
+	0x7B, 0xDD, 0x4B, 0x78, 0xDF, 0x4C, 0x78, 0xE2, 0x4D, 0x77, 0xE4, 0x4D, 0x78, 0x10, 0x46, 0xA0,
+	0x13, 0x46, 0xA1, 0x16, 0x47, 0xA3, 0x1A, 0x49, 0xA5, 0x1E, 0x49, 0xA7, 0x23, 0x4A, 0xA9, 0x27,
+	0x4B, 0xAB, 0x2B, 0x4C, 0xAB, 0x31, 0x4E, 0xAC, 0x34, 0x4E, 0xAB, 0x3A, 0x4E, 0xAD, 0x40, 0x4F,
+	0xAE, 0x48, 0x4E, 0xAE, 0x4B, 0x4E, 0xAD, 0x50, 0x4E, 0xAF, 0x56, 0x4F, 0xAF, 0x5C, 0x4E, 0xAF,
+	0x5F, 0x4E, 0xAC, 0x66, 0x4E, 0xAC, 0x69, 0x4F, 0xAA, 0x70, 0x4F, 0xA8, 0x75, 0x4F, 0xA6, 0x7A,
+	0x50, 0xA6, 0x7F, 0x4F, 0xA3, 0x85, 0x4F, 0xA3, 0x89, 0x50, 0xA1, 0x8F, 0x4E, 0x9E, 0x94, 0x50,
+	0x9B, 0x9A, 0x51, 0x9A, 0x9F, 0x52, 0x96, 0xA4, 0x52, 0x94, 0xA7, 0x51, 0x8E, 0xAE, 0x53, 0x8E,
+	0xB1, 0x53, 0x88, 0xB6, 0x52, 0x88, 0xBA, 0x52, 0x85, 0xC2, 0x52, 0x82, 0xC7, 0x52, 0x7F, 0xCE,
+	0x51, 0x7B, 0xD3, 0x50, 0x78, 0xD9, 0x51, 0x77, 0xDD, 0x51, 0x74, 0xE1, 0x51, 0x74, 0xE3, 0x53,
+	0x74, 0xE5, 0x54, 0x75, 0x11, 0x4F, 0xA4, 0x13, 0x4F, 0xA5, 0x17, 0x50, 0xA7, 0x1B, 0x51, 0xA9,
+	0x1E, 0x51, 0xAA, 0x23, 0x52, 0xAA, 0x28, 0x54, 0xAD, 0x2B, 0x54, 0xAC, 0x2F, 0x54, 0xAC, 0x33,
+	0x55, 0xAC, 0x3A, 0x55, 0xAE, 0x3D, 0x55, 0xAD, 0x45, 0x55, 0xAD, 0x4B, 0x55, 0xAE, 0x50, 0x55,
+	0xB0, 0x54, 0x56, 0xAD, 0x5C, 0x56, 0xAE, 0x60, 0x56, 0xAC, 0x66, 0x57, 0xAC, 0x6B, 0x58, 0xAA,
+	0x70, 0x57, 0xA8, 0x77, 0x58, 0xA6, 0x7C, 0x57, 0xA4, 0x82, 0x58, 0xA2, 0x88, 0x58, 0xA2, 0x8B,
+	0x57, 0x9F, 0x92, 0x56, 0x9C, 0x96, 0x58, 0x99, 0x9D, 0x58, 0x97, 0xA3, 0x59, 0x94, 0xA7, 0x5A,
+	0x92, 0xAC, 0x59, 0x8D, 0xB1, 0x59, 0x8B, 0xB5, 0x5A, 0x86, 0xBA, 0x59, 0x86, 0xBE, 0x59, 0x83,
+	0xC5, 0x58, 0x7F, 0xCB, 0x59, 0x7D, 0xCF, 0x58, 0x78, 0xD4, 0x57, 0x75, 0xDB, 0x59, 0x75, 0xDF,
+	0x59, 0x72, 0xE4, 0x5A, 0x73, 0xE6, 0x5B, 0x72, 0xE9, 0x5B, 0x73, 0x11, 0x55, 0xA6, 0x12, 0x56,
+	0xA7, 0x16, 0x57, 0xA9, 0x1A, 0x58, 0xAB, 0x1E, 0x58, 0xAC, 0x22, 0x59, 0xAC, 0x28, 0x5A, 0xAF,
+	0x2B, 0x5B, 0xAF, 0x2F, 0x5C, 0xAF, 0x33, 0x5C, 0xAE, 0x39, 0x5C, 0xAE, 0x3E, 0x5D, 0xAF, 0x45,
+	0x5B, 0xAE, 0x4B, 0x5C, 0xAE, 0x50, 0x5C, 0xB0, 0x54, 0x5C, 0xAD, 0x5C, 0x5D, 0xAD, 0x61, 0x5D,
+	0xAA, 0x66, 0x5E, 0xAB, 0x6A, 0x5E, 0xA8, 0x72, 0x5E, 0xA6, 0x77, 0x5D, 0xA4, 0x7D, 0x5E, 0xA2,
+	0x82, 0x5D, 0xA0, 0x88, 0x5E, 0xA0, 0x8C, 0x5E, 0x9E, 0x93, 0x5D, 0x9B, 0x98, 0x5D, 0x97, 0x9E,
+	0x5D, 0x93, 0xA2, 0x5E, 0x8F, 0xA7, 0x5F, 0x8F, 0xAB, 0x5E, 0x8A, 0xB3, 0x5E, 0x87, 0xB8, 0x5E,
+	0x84, 0xBC, 0x5E, 0x83, 0xBF, 0x5E, 0x7F, 0xC7, 0x5E, 0x7D, 0xCC, 0x5E, 0x79, 0xD2, 0x5D, 0x77,
+	0xD7, 0x5D, 0x72, 0xDE, 0x5F, 0x74, 0xE2, 0x5F, 0x71, 0xE6, 0x5F, 0x6E, 0xE8, 0x60, 0x6E, 0xE9,
+	0x61, 0x6F, 0x10, 0x5C, 0xA8, 0x11, 0x5D, 0xA9, 0x16, 0x5D, 0xAB, 0x19, 0x5E, 0xAC, 0x1D, 0x5E,
+	0xAE, 0x22, 0x5F, 0xAF, 0x27, 0x60, 0xB1, 0x2A, 0x61, 0xB1, 0x30, 0x63, 0xB2, 0x34, 0x63, 0xB1,
+	0x3A, 0x63, 0xB2, 0x40, 0x64, 0xB2, 0x47, 0x62, 0xB1, 0x4C, 0x63, 0xB1, 0x51, 0x64, 0xB3, 0x56,
+	0x63, 0xB1, 0x5C, 0x62, 0xAC, 0x60, 0x63, 0xA8, 0x66, 0x63, 0xA8, 0x6B, 0x64, 0xA7, 0x72, 0x63,
+	0xA4, 0x78, 0x64, 0xA3, 0x7D, 0x63, 0xA0, 0x83, 0x64, 0x9F, 0x89, 0x63, 0x9E, 0x8C, 0x63, 0x9B,
+	0x93, 0x62, 0x99, 0x99, 0x63, 0x95, 0x9F, 0x64, 0x92, 0xA5, 0x64, 0x8E, 0xA8, 0x64, 0x8D, 0xAD,
+	0x63, 0x88, 0xB5, 0x63, 0x87, 0xB9, 0x62, 0x82, 0xBD, 0x62, 0x81, 0xC3, 0x63, 0x7F, 0xC9, 0x62,
+	0x7D, 0xCF, 0x63, 0x7A, 0xD6, 0x62, 0x75, 0xDB, 0x62, 0x71, 0xE0, 0x63, 0x71, 0xE3, 0x64, 0x6F,
+	0xE7, 0x63, 0x6E, 0xEB, 0x65, 0x6E, 0xEB, 0x65, 0x6E, 0x10, 0x64, 0xAC, 0x12, 0x64, 0xAD, 0x15,
+	0x65, 0xAE, 0x19, 0x65, 0xB0, 0x1E, 0x66, 0xB0, 0x23, 0x67, 0xB0, 0x26, 0x68, 0xB2, 0x2A, 0x68,
+	0xB1, 0x2F, 0x69, 0xB2, 0x34, 0x6A, 0xB2, 0x3A, 0x6A, 0xB2, 0x3F, 0x69, 0xB1, 0x47, 0x69, 0xB1,
+	0x4B, 0x69, 0xB1, 0x4F, 0x6A, 0xB1, 0x56, 0x6A, 0xAF, 0x5D, 0x6B, 0xAC, 0x62, 0x6A, 0xA8, 0x67,
+	0x6B, 0xA8, 0x6C, 0x6B, 0xA5, 0x73, 0x6B, 0xA4, 0x78, 0x6B, 0xA1, 0x7F, 0x6B, 0xA0, 0x85, 0x6A,
+	0x9D, 0x88, 0x6A, 0x9C, 0x8E, 0x6A, 0x9A, 0x94, 0x6B, 0x97, 0x9B, 0x6B, 0x95, 0xA1, 0x6A, 0x91,
+	0xA7, 0x6B, 0x8D, 0xAA, 0x6B, 0x8A, 0xB0, 0x69, 0x87, 0xB9, 0x6B, 0x85, 0xBD, 0x69, 0x81, 0xC0,
+	0x68, 0x80, 0xC6, 0x69, 0x7E, 0xCB, 0x68, 0x7A, 0xD2, 0x69, 0x77, 0xD9, 0x6A, 0x73, 0xDD, 0x6A,
+	0x71, 0xE2, 0x69, 0x6E, 0xE5, 0x6A, 0x6C, 0xE8, 0x6A, 0x6B, 0xEC, 0x6C, 0x6B, 0xED, 0x6D, 0x6C,
+	0x0E, 0x6B, 0xAE, 0x10, 0x6C, 0xAF, 0x13, 0x6C, 0xAE, 0x18, 0x6D, 0xB0, 0x1E, 0x6F, 0xB1, 0x22,
+	0x70, 0xB2, 0x26, 0x6F, 0xB3, 0x2A, 0x6F, 0xB2, 0x30, 0x71, 0xB3, 0x35, 0x72, 0xB3, 0x3A, 0x71,
+	0xB2, 0x3F, 0x72, 0xB1, 0x45, 0x71, 0xB0, 0x4B, 0x71, 0xAF, 0x50, 0x73, 0xAD, 0x55, 0x72, 0xAA,
+	0x5D, 0x72, 0xA9, 0x62, 0x72, 0xA6, 0x67, 0x73, 0xA5, 0x6C, 0x72, 0xA2, 0x71, 0x72, 0xA0, 0x78,
+	0x72, 0x9E, 0x7D, 0x72, 0x9C, 0x82, 0x72, 0x99, 0x8A, 0x71, 0x98, 0x8F, 0x71, 0x95, 0x95, 0x72,
+	0x93, 0x9C, 0x70, 0x91, 0xA1, 0x6F, 0x8C, 0xA7, 0x6F, 0x8A, 0xAC, 0x70, 0x89, 0xB2, 0x71, 0x85,
+	0xB8, 0x6F, 0x80, 0xBD, 0x6F, 0x7D, 0xC2, 0x6E, 0x7D, 0xC6, 0x6E, 0x7A, 0xCE, 0x6F, 0x77, 0xD4,
+	0x6F, 0x73, 0xD9, 0x6F, 0x6F, 0xDE, 0x6E, 0x6C, 0xE1, 0x70, 0x68, 0xE5, 0x70, 0x67, 0xE8, 0x72,
+	0x66, 0xEB, 0x73, 0x65, 0xEC, 0x72, 0x65, 0x0E, 0x72, 0xAE, 0x0E, 0x72, 0xAE, 0x13, 0x73, 0xAF,
+	0x17, 0x74, 0xAF, 0x1C, 0x75, 0xAF, 0x21, 0x75, 0xB1, 0x26, 0x76, 0xB1, 0x2A, 0x76, 0xB2, 0x30,
+	0x78, 0xB3, 0x33, 0x78, 0xB3, 0x3A, 0x78, 0xB3, 0x3D, 0x78, 0xB0, 0x45, 0x78, 0xAF, 0x4A, 0x78,
+	0xAC, 0x4F, 0x79, 0xAB, 0x54, 0x78, 0xA8, 0x5C, 0x78, 0xA7, 0x61, 0x78, 0xA4, 0x67, 0x78, 0xA3,
+	0x6B, 0x79, 0xA0, 0x70, 0x78, 0x9D, 0x77, 0x77, 0x9B, 0x7D, 0x77, 0x99, 0x82, 0x77, 0x97, 0x8A,
+	0x77, 0x95, 0x8F, 0x76, 0x93, 0x97, 0x76, 0x91, 0x9C, 0x76, 0x8D, 0xA2, 0x75, 0x8A, 0xA9, 0x74,
+	0x88, 0xAD, 0x74, 0x85, 0xB3, 0x75, 0x82, 0xBC, 0x76, 0x81, 0xC0, 0x75, 0x7C, 0xC4, 0x75, 0x7B,
+	0xC9, 0x74, 0x77, 0xCF, 0x73, 0x74, 0xD6, 0x74, 0x71, 0xDC, 0x75, 0x6E, 0xE0, 0x75, 0x6B, 0xE5,
+	0x77, 0x68, 0xE7, 0x78, 0x65, 0xEA, 0x7A, 0x66, 0xEB, 0x7B, 0x65, 0xEE, 0x7A, 0x63, 0x0F, 0x7A,
+	0xB0, 0x10, 0x79, 0xB0, 0x15, 0x7A, 0xB0, 0x18, 0x7C, 0xB0, 0x1D, 0x7D, 0xB0, 0x22, 0x7D, 0xB2,
+	0x27, 0x7E, 0xB3, 0x2B, 0x7E, 0xB4, 0x30, 0x80, 0xB5, 0x34, 0x80, 0xB2, 0x3A, 0x80, 0xB3, 0x40,
+	0x80, 0xB0, 0x46, 0x7E, 0xAD, 0x4B, 0x80, 0xAC, 0x51, 0x80, 0xAA, 0x56, 0x80, 0xA8, 0x5D, 0x7F,
+	0xA5, 0x62, 0x7E, 0xA3, 0x67, 0x7F, 0xA1, 0x6C, 0x7F, 0x9F, 0x71, 0x7F, 0x9C, 0x79, 0x7E, 0x9B,
+	0x7E, 0x7E, 0x98, 0x83, 0x7E, 0x95, 0x8B, 0x7D, 0x94, 0x91, 0x7E, 0x92, 0x98, 0x7D, 0x90, 0x9F,
+	0x7D, 0x8E, 0xA6, 0x7B, 0x8C, 0xAA, 0x7A, 0x86, 0xAF, 0x79, 0x86, 0xB5, 0x79, 0x81, 0xBC, 0x7B,
+	0x81, 0xC1, 0x7B, 0x7D, 0xC6, 0x7A, 0x7C, 0xCB, 0x7A, 0x77, 0xD2, 0x79, 0x75, 0xD7, 0x79, 0x71,
+	0xDD, 0x7B, 0x6E, 0xE2, 0x7D, 0x6B, 0xE5, 0x7C, 0x67, 0xE7, 0x7D, 0x65, 0xEB, 0x7F, 0x65, 0xEC,
+	0x80, 0x64, 0xEF, 0x80, 0x64, 0x0E, 0x81, 0xB0, 0x11, 0x81, 0xAF, 0x15, 0x81, 0xAF, 0x18, 0x83,
+	0xAF, 0x1D, 0x84, 0xB1, 0x22, 0x84, 0xB1, 0x26, 0x85, 0xB3, 0x2A, 0x85, 0xB2, 0x2F, 0x86, 0xB3,
+	0x35, 0x86, 0xB3, 0x39, 0x86, 0xB0, 0x3F, 0x87, 0xAF, 0x46, 0x86, 0xAC, 0x4C, 0x86, 0xAB, 0x51,
+	0x87, 0xA9, 0x56, 0x87, 0xA7, 0x5D, 0x86, 0xA4, 0x63, 0x85, 0xA1, 0x68, 0x86, 0xA0, 0x6C, 0x86,
+	0x9D, 0x73, 0x85, 0x99, 0x78, 0x85, 0x96, 0x7F, 0x84, 0x97, 0x85, 0x84, 0x94, 0x8C, 0x84, 0x93,
+	0x93, 0x83, 0x90, 0x98, 0x82, 0x8E, 0xA0, 0x82, 0x8C, 0xA6, 0x81, 0x89, 0xAE, 0x81, 0x86, 0xB3,
+	0x80, 0x85, 0xB7, 0x7F, 0x82, 0xBC, 0x7F, 0x7E, 0xC3, 0x7F, 0x7C, 0xC9, 0x80, 0x7A, 0xCD, 0x7E,
+	0x77, 0xD2, 0x7E, 0x73, 0xD7, 0x7E, 0x6E, 0xDF, 0x80, 0x6C, 0xE4, 0x82, 0x69, 0xE5, 0x82, 0x65,
+	0xE8, 0x84, 0x64, 0xEB, 0x84, 0x63, 0xED, 0x86, 0x63, 0xEE, 0x86, 0x61, 0x0E, 0x88, 0xAF, 0x0E,
+	0x88, 0xAF, 0x13, 0x89, 0xAF, 0x18, 0x8A, 0xAF, 0x1D, 0x8B, 0xAE, 0x21, 0x8C, 0xAE, 0x25, 0x8C,
+	0xAF, 0x29, 0x8B, 0xAE, 0x2E, 0x8C, 0xB0, 0x33, 0x8D, 0xB0, 0x38, 0x8C, 0xAE, 0x3E, 0x8D, 0xAC,
+	0x45, 0x8C, 0xAA, 0x4B, 0x8C, 0xA8, 0x50, 0x8E, 0xA7, 0x55, 0x8D, 0xA4, 0x5D, 0x8D, 0xA1, 0x63,
+	0x8C, 0x9E, 0x67, 0x8C, 0x9C, 0x6D, 0x8D, 0x9A, 0x74, 0x8C, 0x98, 0x79, 0x8B, 0x95, 0x81, 0x8B,
+	0x94, 0x86, 0x8B, 0x91, 0x8D, 0x8A, 0x91, 0x92, 0x89, 0x8E, 0x9A, 0x87, 0x8B, 0xA0, 0x86, 0x87,
+	0xA8, 0x86, 0x85, 0xAE, 0x86, 0x84, 0xB4, 0x87, 0x84, 0xB8, 0x86, 0x7F, 0xBE, 0x85, 0x7C, 0xC4,
+	0x86, 0x7B, 0xCA, 0x86, 0x79, 0xCF, 0x86, 0x77, 0xD3, 0x85, 0x71, 0xD9, 0x85, 0x6D, 0xDE, 0x84,
+	0x69, 0xE3, 0x86, 0x65, 0xE6, 0x88, 0x64, 0xE8, 0x8B, 0x62, 0xEC, 0x8C, 0x62, 0xEE, 0x8D, 0x60,
+	0xEF, 0x8F, 0x5F, 0x0E, 0x8F, 0xAF, 0x0F, 0x90, 0xAF, 0x13, 0x90, 0xAE, 0x16, 0x92, 0xAE, 0x1C,
+	0x92, 0xAC, 0x20, 0x94, 0xAD, 0x25, 0x93, 0xAE, 0x27, 0x93, 0xAD, 0x2E, 0x93, 0xAF, 0x31, 0x93,
+	0xAC, 0x38, 0x94, 0xAB, 0x3E, 0x95, 0xA9, 0x45, 0x93, 0xA7, 0x4B, 0x94, 0xA5, 0x4F, 0x94, 0xA3,
+	0x55, 0x95, 0xA1, 0x5B, 0x94, 0x9D, 0x63, 0x94, 0x9B, 0x67, 0x94, 0x99, 0x6C, 0x94, 0x96, 0x74,
+	0x93, 0x95, 0x79, 0x93, 0x92, 0x7F, 0x92, 0x90, 0x87, 0x92, 0x8E, 0x8D, 0x92, 0x8E, 0x92, 0x8F,
+	0x8A, 0x9A, 0x8D, 0x87, 0xA0, 0x8C, 0x85, 0xA8, 0x8C, 0x81, 0xB0, 0x8C, 0x80, 0xB5, 0x8B, 0x7F,
+	0xBA, 0x8A, 0x7C, 0xC1, 0x8C, 0x7C, 0xC5, 0x8A, 0x78, 0xCA, 0x8C, 0x77, 0xCF, 0x8B, 0x74, 0xD7,
+	0x8B, 0x71, 0xDB, 0x8C, 0x6D, 0xE0, 0x8C, 0x68, 0xE1, 0x8C, 0x63, 0xE7, 0x8E, 0x62, 0xE8, 0x90,
+	0x60, 0xEC, 0x92, 0x5E, 0xED, 0x93, 0x5E, 0xEF, 0x94, 0x5D, 0x0F, 0x97, 0xAF, 0x10, 0x98, 0xAE,
+	0x14, 0x98, 0xAD, 0x17, 0x9A, 0xAE, 0x1D, 0x9A, 0xAE, 0x21, 0x9C, 0xAE, 0x26, 0x9B, 0xAD, 0x28,
+	0x9B, 0xAD, 0x2E, 0x9C, 0xAD, 0x32, 0x9C, 0xAC, 0x38, 0x9C, 0xAB, 0x3E, 0x9C, 0xA8, 0x45, 0x9C,
+	0xA5, 0x4B, 0x9B, 0xA2, 0x4F, 0x9D, 0xA1, 0x55, 0x9C, 0x9E, 0x5C, 0x9C, 0x9C, 0x63, 0x9B, 0x9A,
+	0x67, 0x9B, 0x97, 0x6D, 0x9C, 0x96, 0x73, 0x9B, 0x92, 0x7A, 0x9A, 0x8F, 0x82, 0x9A, 0x8D, 0x87,
+	0x99, 0x8B, 0x8D, 0x98, 0x8A, 0x94, 0x96, 0x88, 0x9B, 0x94, 0x84, 0xA3, 0x93, 0x83, 0xAC, 0x92,
+	0x81, 0xB1, 0x92, 0x7E, 0xB4, 0x8F, 0x7C, 0xB7, 0x8D, 0x77, 0xBD, 0x8B, 0x74, 0xC1, 0x89, 0x70,
+	0xC4, 0x88, 0x6C, 0xCB, 0x8A, 0x6C, 0xD4, 0x8D, 0x6D, 0xDC, 0x90, 0x6C, 0xE2, 0x93, 0x68, 0xE5,
+	0x95, 0x64, 0xE7, 0x94, 0x60, 0xE9, 0x97, 0x5F, 0xEB, 0x99, 0x5D, 0xEC, 0x9B, 0x5C, 0xEE, 0x9A,
+	0x5A, 0x0F, 0x9E, 0xAE, 0x0F, 0x9E, 0xAC, 0x13, 0x9F, 0xAE, 0x18, 0xA0, 0xAC, 0x1C, 0xA0, 0xAC,
+	0x21, 0xA1, 0xAC, 0x26, 0xA2, 0xAC, 0x28, 0xA1, 0xAA, 0x2D, 0xA2, 0xAB, 0x32, 0xA3, 0xAB, 0x37,
+	0xA2, 0xA8, 0x3D, 0xA3, 0xA7, 0x44, 0xA2, 0xA2, 0x4A, 0xA3, 0x9F, 0x51, 0xA3, 0x9F, 0x56, 0xA3,
+	0x9B, 0x5B, 0xA1, 0x97, 0x62, 0xA1, 0x96, 0x67, 0xA1, 0x93, 0x6D, 0xA2, 0x92, 0x74, 0xA1, 0x8D,
+	0x7A, 0xA0, 0x8B, 0x7F, 0x9F, 0x88, 0x87, 0x9F, 0x87, 0x8E, 0x9D, 0x86, 0x93, 0x9B, 0x83, 0x9C,
+	0x9A, 0x81, 0xA4, 0x9A, 0x7F, 0xAD, 0x99, 0x7E, 0xB0, 0x96, 0x7B, 0xB4, 0x92, 0x76, 0xB6, 0x8F,
+	0x72, 0xB4, 0x87, 0x68, 0xB6, 0x83, 0x64, 0xBA, 0x82, 0x61, 0xC2, 0x86, 0x61, 0xD0, 0x8C, 0x65,
+	0xDB, 0x94, 0x68, 0xE2, 0x99, 0x66, 0xE5, 0x9A, 0x61, 0xEA, 0x9B, 0x60, 0xEB, 0x9D, 0x5D, 0xED,
+	0x9F, 0x5D, 0xEF, 0xA2, 0x5C, 0xF0, 0xA2, 0x5A, 0x0F, 0xA6, 0xAF, 0x10, 0xA7, 0xAE, 0x14, 0xA7,
+	0xAF, 0x18, 0xA7, 0xAD, 0x1C, 0xA7, 0xAC, 0x21, 0xA8, 0xAC, 0x25, 0xA9, 0xAD, 0x29, 0xA9, 0xAC,
+	0x2F, 0xAB, 0xAB, 0x34, 0xAA, 0xAA, 0x39, 0xAA, 0xA8, 0x3F, 0xAA, 0xA4, 0x46, 0xAA, 0xA2, 0x4A,
+	0xAA, 0x9E, 0x50, 0xAA, 0x9E, 0x56, 0xAA, 0x9A, 0x5E, 0xA8, 0x97, 0x64, 0xA9, 0x96, 0x69, 0xA8,
+	0x93, 0x6F, 0xA9, 0x90, 0x74, 0xA9, 0x8B, 0x7B, 0xA8, 0x89, 0x82, 0xA7, 0x86, 0x89, 0xA7, 0x85,
+	0x90, 0xA5, 0x84, 0x96, 0xA4, 0x81, 0x9D, 0xA1, 0x80, 0xA6, 0xA0, 0x7E, 0xAD, 0x9F, 0x7C, 0xAF,
+	0x9B, 0x78, 0xAC, 0x90, 0x6B, 0xA8, 0x86, 0x61, 0xA6, 0x7C, 0x56, 0xA4, 0x74, 0x4E, 0xA6, 0x72,
+	0x4A, 0xB0, 0x7A, 0x4E, 0xC4, 0x86, 0x57, 0xD4, 0x92, 0x5E, 0xE1, 0x9C, 0x63, 0xE6, 0xA0, 0x62,
+	0xEB, 0xA1, 0x60, 0xED, 0xA5, 0x5D, 0xEF, 0xA7, 0x5D, 0xF0, 0xA8, 0x5C, 0xF2, 0xA9, 0x5C, 0x0E,
+	0xAC, 0xAF, 0x0F, 0xAD, 0xAE, 0x13, 0xAD, 0xAD, 0x18, 0xAE, 0xAD, 0x1C, 0xAE, 0xAB, 0x20, 0xAF,
+	0xAB, 0x27, 0xAF, 0xAB, 0x2A, 0xAF, 0xAA, 0x2F, 0xB1, 0xA9, 0x33, 0xB1, 0xA6, 0x38, 0xB0, 0xA4,
+	0x3D, 0xB0, 0xA1, 0x45, 0xB0, 0xA0, 0x4A, 0xB0, 0x9B, 0x51, 0xB0, 0x9A, 0x56, 0xB0, 0x97, 0x5C,
+	0xAF, 0x93, 0x63, 0xAE, 0x90, 0x68, 0xAF, 0x8F, 0x6D, 0xAF, 0x8B, 0x74, 0xAE, 0x88, 0x7B, 0xAE,
+	0x85, 0x82, 0xAD, 0x82, 0x88, 0xAC, 0x80, 0x90, 0xAB, 0x80, 0x96, 0xA9, 0x7C, 0x9E, 0xA7, 0x7C,
+	0xA6, 0xA5, 0x79, 0xAB, 0xA2, 0x77, 0xA9, 0x9B, 0x6E, 0xA2, 0x8D, 0x60, 0x9C, 0x80, 0x51, 0x94,
+	0x6F, 0x42, 0x94, 0x6A, 0x3A, 0x96, 0x68, 0x37, 0xA1, 0x6F, 0x3C, 0xB4, 0x7B, 0x44, 0xC8, 0x8C,
+	0x50, 0xDA, 0x9A, 0x5A, 0xE5, 0xA5, 0x5E, 0xEB, 0xA9, 0x5F, 0xEE, 0xAB, 0x5D, 0xF0, 0xAD, 0x5C,
+	0xF2, 0xB0, 0x5C, 0xF3, 0xAF, 0x5A, 0x0F, 0xB4, 0xAE, 0x11, 0xB4, 0xAF, 0x15, 0xB5, 0xAD, 0x18,
+	0xB5, 0xAC, 0x1C, 0xB6, 0xAA, 0x20, 0xB6, 0xAA, 0x26, 0xB7, 0xAA, 0x2B, 0xB7, 0xAA, 0x2F, 0xB8,
+	0xA8, 0x34, 0xB7, 0xA5, 0x39, 0xB7, 0xA2, 0x3F, 0xB7, 0x9E, 0x46, 0xB6, 0x9D, 0x4A, 0xB7, 0x9A,
+	0x50, 0xB8, 0x97, 0x56, 0xB7, 0x94, 0x5C, 0xB6, 0x90, 0x64, 0xB6, 0x8E, 0x68, 0xB6, 0x8C, 0x6D,
+	0xB6, 0x88, 0x73, 0xB5, 0x85, 0x7B, 0xB5, 0x82, 0x82, 0xB4, 0x7F, 0x89, 0xB4, 0x7E, 0x90, 0xB3,
+	0x7D, 0x98, 0xB1, 0x7A, 0x9E, 0xAF, 0x79, 0xA6, 0xAD, 0x79, 0xAA, 0xA8, 0x75, 0xA6, 0x9C, 0x67,
+	0x99, 0x89, 0x55, 0x8E, 0x79, 0x42, 0x89, 0x6B, 0x35, 0x8A, 0x67, 0x2F, 0x8D, 0x64, 0x2C, 0x95,
+	0x69, 0x2C, 0xA7, 0x74, 0x33, 0xBD, 0x87, 0x41, 0xD4, 0x9A, 0x51, 0xE4, 0xA9, 0x5B, 0xEB, 0xAE,
+	0x5D, 0xED, 0xB1, 0x5B, 0xEF, 0xB4, 0x5A, 0xF1, 0xB6, 0x5A, 0xF3, 0xB6, 0x5B, 0x0F, 0xB9, 0xAE,
+	0x11, 0xBB, 0xAE, 0x15, 0xBC, 0xAB, 0x17, 0xBC, 0xAB, 0x1D, 0xBC, 0xA8, 0x21, 0xBD, 0xA8, 0x26,
+	0xBE, 0xA9, 0x2A, 0xBE, 0xA6, 0x2F, 0xBF, 0xA6, 0x34, 0xBE, 0xA4, 0x39, 0xBE, 0xA1, 0x3E, 0xBE,
+	0x9D, 0x46, 0xBE, 0x9B, 0x4B, 0xBE, 0x97, 0x51, 0xBE, 0x95, 0x57, 0xBE, 0x91, 0x5D, 0xBD, 0x8F,
+	0x63, 0xBD, 0x8A, 0x69, 0xBD, 0x89, 0x6E, 0xBD, 0x86, 0x75, 0xBC, 0x82, 0x7B, 0xBD, 0x7F, 0x83,
+	0xBB, 0x7C, 0x88, 0xBB, 0x79, 0x91, 0xB9, 0x7A, 0x97, 0xB7, 0x78, 0x9E, 0xB6, 0x78, 0xA6, 0xB4,
+	0x76, 0xAA, 0xB0, 0x72, 0xA5, 0xA4, 0x64, 0x97, 0x8F, 0x50, 0x8B, 0x7D, 0x3C, 0x8A, 0x72, 0x32,
+	0x8A, 0x6D, 0x2B, 0x8B, 0x6A, 0x27, 0x94, 0x6D, 0x28, 0xA5, 0x79, 0x30, 0xBC, 0x8D, 0x3F, 0xD5,
+	0xA0, 0x50, 0xE6, 0xB0, 0x5A, 0xEB, 0xB5, 0x5B, 0xED, 0xB8, 0x5A, 0xF0, 0xBA, 0x58, 0xF2, 0xBC,
+	0x58, 0xF3, 0xBD, 0x59, 0x0F, 0xC0, 0xAC, 0x10, 0xC2, 0xAC, 0x14, 0xC2, 0xA9, 0x16, 0xC2, 0xA8,
+	0x1B, 0xC2, 0xA6, 0x20, 0xC3, 0xA6, 0x25, 0xC4, 0xA4, 0x29, 0xC4, 0xA4, 0x2F, 0xC6, 0xA5, 0x33,
+	0xC5, 0xA1, 0x39, 0xC3, 0x9F, 0x3F, 0xC3, 0x9B, 0x46, 0xC3, 0x97, 0x4B, 0xC5, 0x94, 0x50, 0xC5,
+	0x91, 0x55, 0xC5, 0x8D, 0x5C, 0xC3, 0x8B, 0x62, 0xC4, 0x89, 0x68, 0xC4, 0x85, 0x6E, 0xC4, 0x83,
+	0x74, 0xC4, 0x7F, 0x7A, 0xC3, 0x7C, 0x82, 0xC2, 0x78, 0x88, 0xC2, 0x76, 0x90, 0xC0, 0x76, 0x96,
+	0xBE, 0x75, 0x9D, 0xBD, 0x74, 0xA6, 0xBC, 0x73, 0xAB, 0xB8, 0x70, 0xA9, 0xAF, 0x67, 0x9E, 0x9E,
+	0x56, 0x95, 0x8F, 0x45, 0x8D, 0x7D, 0x32, 0x8D, 0x77, 0x2B, 0x8F, 0x75, 0x28, 0x99, 0x7C, 0x2C,
+	0xAF, 0x8B, 0x37, 0xC5, 0x9D, 0x45, 0xDC, 0xAF, 0x54, 0xE9, 0xBB, 0x5D, 0xEB, 0xBD, 0x5B, 0xED,
+	0xC0, 0x59, 0xF2, 0xC3, 0x5B, 0xF3, 0xC4, 0x5A, 0xF4, 0xC5, 0x5B, 0x0E, 0xC6, 0xAA, 0x10, 0xC7,
+	0xA9, 0x14, 0xC9, 0xAA, 0x17, 0xC9, 0xA7, 0x1B, 0xC9, 0xA6, 0x20, 0xCA, 0xA5, 0x26, 0xCA, 0xA5,
+	0x2A, 0xCB, 0xA2, 0x30, 0xCC, 0xA4, 0x34, 0xCB, 0xA0, 0x39, 0xCB, 0x9E, 0x40, 0xCA, 0x99, 0x46,
+	0xCB, 0x96, 0x4C, 0xCC, 0x93, 0x51, 0xCB, 0x90, 0x57, 0xCB, 0x8C, 0x5D, 0xCA, 0x89, 0x63, 0xCA,
+	0x85, 0x69, 0xCA, 0x83, 0x6E, 0xCA, 0x7F, 0x73, 0xCA, 0x7C, 0x7B, 0xCA, 0x79, 0x81, 0xC9, 0x77,
+	0x88, 0xC8, 0x74, 0x90, 0xC7, 0x74, 0x96, 0xC5, 0x74, 0x9E, 0xC4, 0x71, 0xA6, 0xC3, 0x71, 0xAE,
+	0xC1, 0x70, 0xAF, 0xBC, 0x6C, 0xAA, 0xB1, 0x61, 0xA7, 0xA6, 0x54, 0x9D, 0x95, 0x42, 0x9E, 0x8F,
+	0x3A, 0xA0, 0x8E, 0x38, 0xAD, 0x95, 0x3D, 0xC0, 0xA3, 0x47, 0xD2, 0xAF, 0x51, 0xE2, 0xBC, 0x59,
+	0xEA, 0xC3, 0x5C, 0xEE, 0xC5, 0x5B, 0xEF, 0xC7, 0x58, 0xF2, 0xCA, 0x5B, 0xF3, 0xCB, 0x5A, 0xF5,
+	0xCC, 0x5A, 0x10, 0xCE, 0xAC, 0x12, 0xCE, 0xAB, 0x15, 0xCF, 0xAA, 0x1A, 0xD0, 0xA8, 0x1F, 0xCF,
+	0xA8, 0x23, 0xD0, 0xA5, 0x27, 0xD0, 0xA5, 0x2C, 0xD2, 0xA4, 0x32, 0xD2, 0xA4, 0x35, 0xD1, 0xA1,
+	0x3A, 0xD1, 0x9C, 0x42, 0xD1, 0x9B, 0x47, 0xD1, 0x96, 0x4D, 0xD2, 0x93, 0x53, 0xD1, 0x91, 0x58,
+	0xD1, 0x8C, 0x5E, 0xD0, 0x8A, 0x64, 0xD0, 0x85, 0x6A, 0xD0, 0x84, 0x6F, 0xD0, 0x7F, 0x74, 0xD0,
+	0x7B, 0x7C, 0xD0, 0x78, 0x83, 0xCF, 0x75, 0x89, 0xCE, 0x75, 0x90, 0xCC, 0x72, 0x97, 0xCC, 0x72,
+	0x9F, 0xCA, 0x71, 0xA7, 0xC9, 0x72, 0xAF, 0xC9, 0x72, 0xB5, 0xC7, 0x71, 0xB5, 0xC1, 0x6B, 0xB5,
+	0xBB, 0x63, 0xB5, 0xB4, 0x58, 0xB6, 0xB0, 0x52, 0xBB, 0xAE, 0x50, 0xC5, 0xB2, 0x53, 0xD2, 0xBA,
+	0x58, 0xDD, 0xC1, 0x5D, 0xE6, 0xC7, 0x5D, 0xEB, 0xC9, 0x5D, 0xEF, 0xCB, 0x5B, 0xF0, 0xCD, 0x59,
+	0xF2, 0xCF, 0x5B, 0xF4, 0xD1, 0x5B, 0xF5, 0xD1, 0x59, 0x10, 0xD3, 0xAB, 0x14, 0xD4, 0xAB, 0x16,
+	0xD5, 0xAA, 0x1A, 0xD5, 0xA8, 0x1F, 0xD4, 0xA7, 0x24, 0xD6, 0xA6, 0x29, 0xD7, 0xA6, 0x2C, 0xD7,
+	0xA3, 0x33, 0xD7, 0xA2, 0x35, 0xD7, 0x9E, 0x3B, 0xD6, 0x9C, 0x40, 0xD6, 0x97, 0x47, 0xD6, 0x94,
+	0x4E, 0xD7, 0x91, 0x53, 0xD7, 0x8E, 0x58, 0xD7, 0x8A, 0x5F, 0xD5, 0x87, 0x64, 0xD5, 0x83, 0x6A,
+	0xD6, 0x81, 0x6F, 0xD6, 0x7D, 0x76, 0xD5, 0x79, 0x7C, 0xD6, 0x76, 0x83, 0xD5, 0x73, 0x89, 0xD3,
+	0x70, 0x90, 0xD2, 0x70, 0x97, 0xD0, 0x6F, 0xA0, 0xCF, 0x6F, 0xA6, 0xCE, 0x6D, 0xAF, 0xCF, 0x6E,
+	0xB5, 0xCF, 0x6E, 0xB9, 0xCD, 0x6C, 0xBA, 0xC8, 0x66, 0xC3, 0xC8, 0x64, 0xC5, 0xC3, 0x5E, 0xC8,
+	0xC3, 0x5D, 0xD2, 0xC7, 0x5E, 0xDB, 0xCA, 0x60, 0xE2, 0xCD, 0x60, 0xE7, 0xD0, 0x60, 0xEC, 0xD1,
+	0x5E, 0xEF, 0xD2, 0x5C, 0xF1, 0xD5, 0x5A, 0xF3, 0xD7, 0x5A, 0xF5, 0xD8, 0x5A, 0xF6, 0xD9, 0x5B,
+	0x12, 0xDA, 0xAB, 0x14, 0xD9, 0xAB, 0x17, 0xDB, 0xAB, 0x1B, 0xDB, 0xA8, 0x20, 0xDD, 0xA7, 0x24,
+	0xDD, 0xA4, 0x28, 0xDE, 0xA5, 0x2B, 0xDD, 0xA1, 0x31, 0xDE, 0x9F, 0x38, 0xDE, 0x9E, 0x3D, 0xDE,
+	0x9B, 0x41, 0xDD, 0x96, 0x48, 0xDC, 0x92, 0x4D, 0xDE, 0x8F, 0x53, 0xDE, 0x8D, 0x58, 0xDE, 0x89,
+	0x62, 0xDE, 0x86, 0x66, 0xDD, 0x83, 0x6B, 0xDC, 0x80, 0x71, 0xDC, 0x7C, 0x77, 0xDB, 0x78, 0x7F,
+	0xDC, 0x74, 0x86, 0xDB, 0x73, 0x8E, 0xDB, 0x71, 0x92, 0xD9, 0x6F, 0x99, 0xD8, 0x6D, 0xA0, 0xD8,
+	0x6D, 0xA7, 0xD7, 0x6A, 0xAE, 0xD5, 0x68, 0xB5, 0xD5, 0x68, 0xBA, 0xD6, 0x68, 0xBF, 0xD5, 0x68,
+	0xC8, 0xD4, 0x66, 0xCD, 0xD4, 0x64, 0xD1, 0xD4, 0x63, 0xD6, 0xD3, 0x62, 0xDB, 0xD4, 0x60, 0xE1,
+	0xD5, 0x5F, 0xE7, 0xD7, 0x5E, 0xEB, 0xD9, 0x5D, 0xED, 0xDA, 0x5A, 0xEF, 0xDA, 0x5A, 0xF2, 0xDE,
+	0x5B, 0xF6, 0xDF, 0x5B, 0xF7, 0xDF, 0x5B, 0x14, 0xDE, 0xAC, 0x15, 0xE0, 0xAB, 0x19, 0xDF, 0xAA,
+	0x1D, 0xE0, 0xA8, 0x21, 0xE1, 0xA6, 0x26, 0xE2, 0xA5, 0x2A, 0xE2, 0xA4, 0x2D, 0xE1, 0xA0, 0x33,
+	0xE2, 0x9F, 0x38, 0xE3, 0x9D, 0x3E, 0xE4, 0x9C, 0x42, 0xE3, 0x97, 0x48, 0xE1, 0x91, 0x4F, 0xE3,
+	0x8F, 0x55, 0xE3, 0x8D, 0x59, 0xE2, 0x88, 0x61, 0xE2, 0x85, 0x68, 0xE1, 0x80, 0x6D, 0xE1, 0x7E,
+	0x72, 0xE1, 0x7B, 0x79, 0xE0, 0x77, 0x7F, 0xE1, 0x74, 0x87, 0xE0, 0x72, 0x8E, 0xE1, 0x6F, 0x94,
+	0xDE, 0x6D, 0x99, 0xDE, 0x6A, 0xA1, 0xDD, 0x6B, 0xA7, 0xDC, 0x68, 0xAF, 0xDC, 0x67, 0xB4, 0xDB,
+	0x66, 0xBA, 0xDB, 0x66, 0xBF, 0xDB, 0x64, 0xC7, 0xDA, 0x64, 0xCC, 0xD9, 0x63, 0xD1, 0xD9, 0x62,
+	0xD6, 0xDA, 0x61, 0xDB, 0xD9, 0x5E, 0xE1, 0xDC, 0x5E, 0xE6, 0xDD, 0x5C, 0xEB, 0xDE, 0x5B, 0xED,
+	0xDF, 0x5A, 0xF1, 0xE1, 0x5A, 0xF3, 0xE3, 0x5A, 0xF6, 0xE4, 0x5A, 0xF8, 0xE5, 0x5B, 0x18, 0xE4,
+	0xAF, 0x19, 0xE4, 0xAD, 0x1E, 0xE5, 0xAC, 0x20, 0xE6, 0xAB, 0x25, 0xE7, 0xAA, 0x29, 0xE7, 0xA7,
+	0x2E, 0xE6, 0xA6, 0x32, 0xE7, 0xA4, 0x37, 0xE8, 0xA2, 0x3D, 0xE9, 0xA1, 0x43, 0xE9, 0x9D, 0x47,
+	0xE8, 0x98, 0x4D, 0xE6, 0x93, 0x53, 0xE9, 0x92, 0x58, 0xE8, 0x90, 0x5C, 0xE7, 0x8A, 0x64, 0xE8,
+	0x85, 0x6A, 0xE7, 0x83, 0x6E, 0xE7, 0x80, 0x74, 0xE8, 0x7D, 0x7B, 0xE7, 0x78, 0x82, 0xE6, 0x74,
+	0x89, 0xE6, 0x73, 0x8E, 0xE5, 0x70, 0x96, 0xE5, 0x70, 0x9D, 0xE4, 0x6E, 0xA4, 0xE3, 0x6E, 0xAB,
+	0xE2, 0x6B, 0xB1, 0xE1, 0x69, 0xB8, 0xE1, 0x67, 0xBD, 0xE1, 0x67, 0xC3, 0xE1, 0x67, 0xCA, 0xDF,
+	0x66, 0xD0, 0xE0, 0x64, 0xD5, 0xDF, 0x64, 0xDA, 0xE0, 0x64, 0xE0, 0xE1, 0x62, 0xE5, 0xE2, 0x61,
+	0xEA, 0xE3, 0x5F, 0xED, 0xE3, 0x5D, 0xEF, 0xE6, 0x5D, 0xF3, 0xE8, 0x5B, 0xF6, 0xE9, 0x5C, 0xFA,
+	0xEB, 0x5C, 0xFA, 0xEB, 0x5C, 0x1C, 0xE9, 0xB0, 0x1C, 0xE9, 0xAE, 0x1F, 0xE9, 0xAD, 0x24, 0xEA,
+	0xAC, 0x28, 0xEB, 0xA9, 0x2D, 0xEC, 0xA7, 0x32, 0xEB, 0xA7, 0x36, 0xEB, 0xA4, 0x3B, 0xEC, 0xA4,
+	0x3F, 0xEE, 0xA3, 0x46, 0xEE, 0xA0, 0x4A, 0xED, 0x9A, 0x50, 0xED, 0x96, 0x57, 0xED, 0x93, 0x5C,
+	0xED, 0x90, 0x60, 0xEC, 0x8B, 0x65, 0xEC, 0x86, 0x6A, 0xEC, 0x82, 0x71, 0xEC, 0x81, 0x76, 0xEC,
+	0x7E, 0x7D, 0xEB, 0x7A, 0x83, 0xEC, 0x76, 0x89, 0xEB, 0x74, 0x91, 0xEB, 0x70, 0x99, 0xEA, 0x71,
+	0x9E, 0xEA, 0x6E, 0xA4, 0xE8, 0x6D, 0xAC, 0xE8, 0x6C, 0xB3, 0xE7, 0x69, 0xB9, 0xE7, 0x6A, 0xBE,
+	0xE6, 0x69, 0xC3, 0xE6, 0x66, 0xCB, 0xE5, 0x66, 0xD1, 0xE6, 0x67, 0xD6, 0xE5, 0x66, 0xDB, 0xE6,
+	0x64, 0xE1, 0xE7, 0x63, 0xE6, 0xE8, 0x61, 0xEC, 0xE8, 0x60, 0xEF, 0xE9, 0x5D, 0xF2, 0xEB, 0x5D,
+	0xF5, 0xED, 0x5E, 0xF9, 0xEE, 0x5E, 0xFB, 0xF1, 0x5E, 0xFC, 0xF0, 0x5E, 0x1C, 0xEC, 0xB0, 0x1E,
+	0xEC, 0xAE, 0x21, 0xEC, 0xAD, 0x25, 0xED, 0xAC, 0x29, 0xEE, 0xA9, 0x2D, 0xEF, 0xA8, 0x33, 0xEE,
+	0xA7, 0x35, 0xED, 0xA3, 0x3B, 0xEF, 0xA5, 0x41, 0xF0, 0xA1, 0x48, 0xF1, 0x9E, 0x4C, 0xF0, 0x99,
+	0x52, 0xEF, 0x94, 0x57, 0xF1, 0x93, 0x5C, 0xF0, 0x90, 0x61, 0xEF, 0x8B, 0x66, 0xEF, 0x87, 0x6B,
+	0xEF, 0x82, 0x71, 0xEF, 0x81, 0x75, 0xF0, 0x7C, 0x7C, 0xEF, 0x78, 0x82, 0xEE, 0x74, 0x8A, 0xEE,
+	0x72, 0x8F, 0xEE, 0x70, 0x97, 0xED, 0x70, 0x9E, 0xED, 0x6E, 0xA5, 0xEB, 0x6E, 0xAD, 0xEB, 0x6C,
+	0xB3, 0xEA, 0x6A, 0xB8, 0xEA, 0x67, 0xBF, 0xEA, 0x67, 0xC4, 0xE9, 0x66, 0xCB, 0xE9, 0x67, 0xD2,
+	0xE9, 0x65, 0xD6, 0xEA, 0x65, 0xDB, 0xEB, 0x66, 0xE0, 0xEA, 0x63, 0xE7, 0xEB, 0x62, 0xEB, 0xEC,
+	0x60, 0xEE, 0xED, 0x5D, 0xF2, 0xF0, 0x5F, 0xF5, 0xF1, 0x5C, 0xF9, 0xF3, 0x5D, 0xFA, 0xF5, 0x5D,
+	0xFC, 0xF5, 0x5E,
+};
+
+/* 45x37, 4:4:4, no DHT (standard tables, as in AVI MJPEG) */
+static const uint8_t ref_444[752] =
+{
+	0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+	0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03,
+	0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0A, 0x07,
+	0x07, 0x06, 0x08, 0x0C, 0x0A, 0x0C, 0x0C, 0x0B, 0x0A, 0x0B, 0x0B, 0x0D, 0x0E, 0x12, 0x10, 0x0D,
+	0x0E, 0x11, 0x0E, 0x0B, 0x0B, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0C, 0x0F,
+	0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x03, 0x04,
+	0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0D, 0x0B, 0x0D, 0x14, 0x14, 0x14, 0x14,
+	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xFF, 0xC0,
+	0x00, 0x11, 0x08, 0x00, 0x25, 0x00, 0x2D, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+	0x01, 0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xF9,
+	0xBF, 0x50, 0x5F, 0x09, 0x5C, 0x7C, 0x3A, 0x82, 0xD2, 0xD6, 0xDB, 0x6E, 0xA4, 0x3A, 0x90, 0x39,
+	0xCD, 0x7F, 0x4F, 0xC6, 0x56, 0x3C, 0xBA, 0x58, 0xA5, 0x73, 0x89, 0xD3, 0x7C, 0x34, 0x78, 0xC2,
+	0x9A, 0xDB, 0xDA, 0x24, 0x7D, 0x1E, 0x17, 0x12, 0x99, 0xD4, 0x69, 0xFE, 0x1B, 0x3C, 0x7C, 0xB5,
+	0xC7, 0x56, 0xBA, 0x3E, 0xBB, 0x0D, 0x5D, 0x3B, 0x1B, 0xF6, 0xDA, 0x49, 0xB4, 0x5D, 0xC5, 0x0F,
+	0xE5, 0x5F, 0x3D, 0x89, 0xC4, 0xA3, 0xE9, 0x30, 0xF3, 0xBB, 0x34, 0x74, 0xFB, 0x49, 0x2E, 0x67,
+	0x0A, 0xAA, 0x48, 0xAF, 0x93, 0xC4, 0xE2, 0x91, 0xF6, 0xF9, 0x7C, 0xAD, 0x63, 0xA9, 0x87, 0x40,
+	0x3B, 0x07, 0x06, 0xBE, 0x7E, 0x78, 0xB5, 0x73, 0xEF, 0xA8, 0x54, 0x5C, 0x87, 0x98, 0xE9, 0xDE,
+	0x17, 0xC1, 0x1F, 0x2F, 0xE9, 0x5F, 0xB1, 0x3A, 0xD6, 0x3F, 0xCD, 0x5A, 0x19, 0x86, 0xBB, 0x9D,
+	0x3E, 0x9F, 0xE1, 0x9C, 0x63, 0xE4, 0xAE, 0x5A, 0x98, 0xA4, 0x8F, 0xAC, 0xC1, 0xE3, 0xB6, 0xD4,
+	0xE8, 0xEC, 0x7C, 0x35, 0xD3, 0xE5, 0xFD, 0x2B, 0xC4, 0xC4, 0x63, 0xAD, 0xD4, 0xFB, 0x9C, 0x1E,
+	0x2E, 0xF6, 0xD4, 0xDD, 0xB6, 0xF0, 0xC2, 0xC8, 0xB8, 0x64, 0xC8, 0xFA, 0x57, 0xCA, 0x62, 0xB1,
+	0xFB, 0xEA, 0x7D, 0xC6, 0x0E, 0xB5, 0xEC, 0x6C, 0xE9, 0xFE, 0x14, 0x8E, 0x16, 0xCA, 0x44, 0x01,
+	0xFA, 0x57, 0xC6, 0xE2, 0xF3, 0x0F, 0x33, 0xEF, 0xB0, 0x35, 0x6D, 0x63, 0x76, 0x1F, 0x0E, 0x7C,
+	0x9F, 0x77, 0xF4, 0xAF, 0x9A, 0x9E, 0x63, 0xAE, 0xE7, 0xD8, 0x52, 0xC4, 0x5A, 0x27, 0x9E, 0xD8,
+	0x78, 0x67, 0x1F, 0xC1, 0x5F, 0xD0, 0x13, 0xC5, 0xD9, 0x6E, 0x7F, 0x95, 0xD8, 0x7C, 0x76, 0xBB,
+	0x9D, 0x1D, 0x8F, 0x87, 0x3A, 0x7C, 0x95, 0xE2, 0x62, 0x31, 0xD6, 0xEA, 0x7D, 0x9E, 0x0B, 0x1B,
+	0xB6, 0xA6, 0xF5, 0x9F, 0x87, 0x7A, 0x7C, 0xB5, 0xF2, 0xB8, 0xAC, 0xC7, 0xCC, 0xFD, 0x0B, 0x2F,
+	0xC5, 0xDE, 0xDA, 0x9B, 0x76, 0xBA, 0x00, 0x51, 0x92, 0xB8, 0x03, 0xBD, 0x7C, 0xA6, 0x27, 0x1F,
+	0x7E, 0xA7, 0xE9, 0xB9, 0x76, 0x22, 0xF6, 0x36, 0x34, 0xED, 0x1E, 0x29, 0xDB, 0x11, 0x95, 0x72,
+	0x3A, 0x81, 0x5F, 0x1F, 0x8C, 0xC6, 0xEF, 0xA9, 0xFA, 0x26, 0x12, 0xBD, 0x92, 0x37, 0xE0, 0xF0,
+	0xE6, 0x50, 0x7C, 0x9F, 0xA5, 0x7C, 0xAD, 0x4C, 0x73, 0xE6, 0xDC, 0xFA, 0x28, 0xE2, 0xAC, 0x8E,
+	0x0E, 0xCB, 0xC3, 0x9C, 0x8F, 0x92, 0xBF, 0xA4, 0x6B, 0x63, 0x74, 0xDC, 0xFF, 0x00, 0x27, 0x30,
+	0xF8, 0xBD, 0x4D, 0xEB, 0x3F, 0x0E, 0xF3, 0xF7, 0x6B, 0xE6, 0x31, 0x78, 0xEB, 0x75, 0x3E, 0xD7,
+	0x03, 0x8B, 0xD8, 0xDC, 0xB3, 0xF0, 0xF7, 0x4F, 0x96, 0xBE, 0x2F, 0x15, 0x98, 0x3E, 0xE7, 0xE8,
+	0xD9, 0x76, 0x2F, 0x62, 0xC6, 0xAF, 0xE1, 0x2B, 0x9B, 0xDD, 0x26, 0x68, 0xED, 0x0E, 0xC9, 0x88,
+	0xE0, 0xD7, 0xCD, 0x56, 0xCC, 0x3C, 0xCF, 0xD5, 0x72, 0xDC, 0x5E, 0xDA, 0x98, 0x1F, 0x0C, 0xBE,
+	0x1B, 0xF8, 0x82, 0xC3, 0x5A, 0x79, 0x6F, 0x59, 0x96, 0x0C, 0xF2, 0x09, 0xCE, 0x6B, 0xE6, 0xB1,
+	0x58, 0xEB, 0xF5, 0x3F, 0x46, 0xC2, 0xE3, 0x34, 0x5A, 0x9E, 0xE1, 0x6F, 0xE1, 0x9F, 0xDD, 0x8C,
+	0xAF, 0xE9, 0x5F, 0x31, 0x53, 0x19, 0xEF, 0x1E, 0xD2, 0xC6, 0x69, 0xB9, 0xE6, 0x96, 0x9A, 0x6C,
+	0x23, 0xB5, 0x7F, 0x51, 0x56, 0xA8, 0xEC, 0x7F, 0x95, 0x78, 0x79, 0xBB, 0x9B, 0xD6, 0x9A, 0x5C,
+	0x38, 0x07, 0x1D, 0xAB, 0xE4, 0xB1, 0x95, 0x25, 0xA9, 0xF6, 0xD8, 0x19, 0xBD, 0x0D, 0x9B, 0x3D,
+	0x3A, 0x2E, 0x0E, 0x2B, 0xE1, 0x71, 0x75, 0x64, 0x7E, 0x8B, 0x97, 0xCD, 0xE8, 0x6F, 0x59, 0x69,
+	0xB0, 0xF1, 0xC5, 0x7C, 0xAD, 0x7A, 0xD2, 0x3F, 0x4E, 0xCB, 0xEA, 0x4B, 0x43, 0xA2, 0xD3, 0xF4,
+	0xB8, 0x78, 0x38, 0xAF, 0x9F, 0xC4, 0x56, 0x93, 0x3F, 0x41, 0xC2, 0x55, 0x95, 0x91, 0xD1, 0x5B,
+	0xE9, 0x70, 0x88, 0xC7, 0x15, 0xE2, 0x4E, 0xA4, 0xAE, 0x7B, 0xD1, 0xA9, 0x2B, 0x1F, 0xFF, 0xD9,
+};
+
+/* ref_444 decoded by libjpeg, RGB */
+static const uint8_t ref_444_rgb[4995] =
+{
+	0x17, 0x0C, 0x86, 0x22, 0x17, 0x91, 0x32, 0x26, 0xA2, 0x3F, 0x30, 0xAF, 0x3C, 0x2B, 0xAB, 0x31,
+	0x1C, 0x9F, 0x28, 0x0E, 0x95, 0x26, 0x0A, 0x92, 0x29, 0x09, 0x92, 0x2B, 0x09, 0x93, 0x31, 0x0B,
+	0x96, 0x36, 0x0B, 0x99, 0x3B, 0x0B, 0x9B, 0x40, 0x0C, 0x9D, 0x45, 0x0D, 0xA2, 0x48, 0x0D, 0xA3,
+	0x4E, 0x0D, 0xA5, 0x53, 0x0D, 0xA4, 0x58, 0x0D, 0xA5, 0x5D, 0x0E, 0xA5, 0x5F, 0x11, 0xA5, 0x61,
+	0x12, 0xA3, 0x67, 0x12, 0xA3, 0x6E, 0x12, 0xA5, 0x72, 0x14, 0xA6, 0x73, 0x16, 0xA5, 0x75, 0x17,
+	0xA3, 0x7A, 0x1A, 0xA2, 0x80, 0x1C, 0xA0, 0x85, 0x1F, 0x9F, 0x8B, 0x21, 0x9F, 0x8E, 0x21, 0x9E,
+	0x91, 0x24, 0x9B, 0x96, 0x23, 0x9A, 0x9E, 0x21, 0x97, 0xA4, 0x1F, 0x94, 0xA8, 0x1E, 0x8E, 0xAF,
+	0x1D, 0x8C, 0xB5, 0x1B, 0x89, 0xBC, 0x1A, 0x89, 0xC1, 0x19, 0x86, 0xC6, 0x1A, 0x86, 0xCC, 0x1B,
+	0x87, 0xD3, 0x19, 0x86, 0xD6, 0x18, 0x84, 0x26, 0x1C, 0x96, 0x37, 0x2D, 0xA7, 0x4E, 0x42, 0xBE,
+	0x5C, 0x4D, 0xCA, 0x55, 0x44, 0xC4, 0x44, 0x2F, 0xB2, 0x31, 0x1A, 0xA0, 0x29, 0x0F, 0x96, 0x2A,
+	0x0B, 0x94, 0x2C, 0x0C, 0x95, 0x32, 0x0D, 0x98, 0x37, 0x0E, 0x9B, 0x3D, 0x0D, 0x9D, 0x42, 0x0E,
+	0x9F, 0x46, 0x0E, 0xA3, 0x4A, 0x0F, 0xA5, 0x51, 0x10, 0xA8, 0x55, 0x10, 0xA7, 0x5B, 0x10, 0xA8,
+	0x5E, 0x12, 0xA8, 0x61, 0x13, 0xA5, 0x64, 0x15, 0xA6, 0x6A, 0x15, 0xA6, 0x6F, 0x15, 0xA8, 0x74,
+	0x18, 0xA7, 0x75, 0x1A, 0xA6, 0x77, 0x1A, 0xA6, 0x7B, 0x1E, 0xA3, 0x81, 0x20, 0xA3, 0x87, 0x23,
+	0xA1, 0x8C, 0x24, 0xA1, 0x91, 0x24, 0xA1, 0x91, 0x24, 0x99, 0x95, 0x22, 0x97, 0x9D, 0x20, 0x96,
+	0xA3, 0x1E, 0x91, 0xA7, 0x1D, 0x8D, 0xAD, 0x1E, 0x8A, 0xB5, 0x1B, 0x89, 0xBC, 0x1C, 0x8A, 0xC2,
+	0x1A, 0x87, 0xC7, 0x1B, 0x87, 0xCF, 0x1B, 0x86, 0xD4, 0x1A, 0x85, 0xD7, 0x19, 0x83, 0x36, 0x2E,
+	0xA5, 0x4E, 0x46, 0xBF, 0x6A, 0x62, 0xDB, 0x76, 0x6C, 0xE7, 0x6F, 0x60, 0xDF, 0x57, 0x46, 0xC8,
+	0x3E, 0x29, 0xAC, 0x2D, 0x16, 0x9A, 0x2C, 0x10, 0x98, 0x30, 0x11, 0x9A, 0x34, 0x12, 0x9C, 0x39,
+	0x12, 0x9F, 0x3F, 0x12, 0xA1, 0x44, 0x13, 0xA3, 0x49, 0x13, 0xA5, 0x4B, 0x14, 0xA6, 0x54, 0x15,
+	0xAA, 0x57, 0x15, 0xAA, 0x5E, 0x16, 0xAA, 0x62, 0x16, 0xAA, 0x63, 0x18, 0xA9, 0x68, 0x19, 0xAA,
+	0x6D, 0x1A, 0xAA, 0x72, 0x19, 0xA9, 0x74, 0x1C, 0xA7, 0x77, 0x1C, 0xA7, 0x79, 0x1F, 0xA5, 0x7D,
+	0x20, 0xA4, 0x83, 0x22, 0xA3, 0x88, 0x24, 0xA0, 0x8D, 0x25, 0xA0, 0x8F, 0x25, 0x9F, 0x91, 0x24,
+	0x97, 0x95, 0x23, 0x95, 0x9C, 0x20, 0x92, 0xA1, 0x1E, 0x8E, 0xA6, 0x1E, 0x8C, 0xAD, 0x1E, 0x88,
+	0xB6, 0x1F, 0x88, 0xBE, 0x1E, 0x8A, 0xC5, 0x1E, 0x87, 0xCA, 0x1F, 0x87, 0xD0, 0x1F, 0x87, 0xD7,
+	0x1E, 0x86, 0xDA, 0x1D, 0x84, 0x3C, 0x39, 0xAE, 0x56, 0x52, 0xCA, 0x73, 0x6F, 0xE7, 0x7F, 0x79,
+	0xF3, 0x77, 0x6D, 0xE8, 0x5F, 0x53, 0xD1, 0x45, 0x34, 0xB4, 0x34, 0x21, 0xA1, 0x2F, 0x18, 0x9E,
+	0x32, 0x18, 0x9F, 0x37, 0x18, 0xA1, 0x3B, 0x19, 0xA3, 0x42, 0x19, 0xA5, 0x47, 0x18, 0xA6, 0x4A,
+	0x19, 0xA8, 0x4E, 0x1A, 0xAA, 0x54, 0x1A, 0xAC, 0x5A, 0x1A, 0xAC, 0x60, 0x1B, 0xAC, 0x64, 0x1C,
+	0xAC, 0x66, 0x1D, 0xAA, 0x6B, 0x1E, 0xAA, 0x70, 0x1F, 0xAA, 0x75, 0x1E, 0xAB, 0x77, 0x21, 0xA8,
+	0x79, 0x22, 0xA7, 0x7A, 0x23, 0xA6, 0x7F, 0x24, 0xA3, 0x84, 0x26, 0xA2, 0x89, 0x27, 0xA0, 0x8E,
+	0x27, 0x9D, 0x90, 0x27, 0x9D, 0x93, 0x27, 0x96, 0x96, 0x24, 0x93, 0x9B, 0x21, 0x8E, 0xA1, 0x1F,
+	0x8B, 0xA6, 0x1F, 0x86, 0xAD, 0x20, 0x86, 0xB7, 0x21, 0x85, 0xBE, 0x22, 0x87, 0xC9, 0x25, 0x88,
+	0xCD, 0x24, 0x87, 0xD4, 0x24, 0x87, 0xD9, 0x24, 0x85, 0xDC, 0x22, 0x85, 0x35, 0x38, 0xAB, 0x4D,
+	0x50, 0xC3, 0x69, 0x6A, 0xE0, 0x72, 0x73, 0xE9, 0x6C, 0x68, 0xE1, 0x5A, 0x52, 0xCC, 0x42, 0x38,
+	0xB3, 0x32, 0x26, 0xA4, 0x2F, 0x1E, 0xA0, 0x32, 0x1E, 0xA1, 0x36, 0x1F, 0xA3, 0x3D, 0x1F, 0xA5,
+	0x43, 0x1F, 0xA7, 0x47, 0x1E, 0xA8, 0x4B, 0x1F, 0xAA, 0x4F, 0x20, 0xAC, 0x55, 0x20, 0xAC, 0x5B,
+	0x20, 0xAC, 0x61, 0x21, 0xAD, 0x64, 0x21, 0xAC, 0x67, 0x23, 0xAC, 0x6C, 0x24, 0xAA, 0x72, 0x24,
+	0xAB, 0x76, 0x24, 0xAC, 0x79, 0x26, 0xA8, 0x7A, 0x28, 0xA8, 0x7E, 0x2A, 0xA6, 0x82, 0x2A, 0xA4,
+	0x85, 0x2A, 0x9F, 0x8B, 0x2A, 0x9D, 0x8D, 0x29, 0x99, 0x90, 0x28, 0x97, 0x92, 0x29, 0x90, 0x96,
+	0x25, 0x8D, 0x9B, 0x22, 0x89, 0x9F, 0x21, 0x85, 0xA4, 0x20, 0x83, 0xAC, 0x22, 0x81, 0xB8, 0x24,
+	0x84, 0xBF, 0x25, 0x85, 0xCA, 0x29, 0x86, 0xCF, 0x2A, 0x86, 0xD7, 0x2A, 0x86, 0xDC, 0x29, 0x84,
+	0xDF, 0x28, 0x84, 0x26, 0x30, 0xA1, 0x37, 0x41, 0xB2, 0x4E, 0x55, 0xC7, 0x57, 0x5E, 0xD2, 0x54,
+	0x57, 0xCC, 0x46, 0x45, 0xBC, 0x36, 0x32, 0xAB, 0x2B, 0x25, 0x9F, 0x2E, 0x24, 0xA1, 0x30, 0x24,
+	0xA2, 0x35, 0x24, 0xA4, 0x3B, 0x24, 0xA6, 0x42, 0x24, 0xA8, 0x48, 0x24, 0xA8, 0x4D, 0x25, 0xAA,
+	0x50, 0x26, 0xAC, 0x56, 0x28, 0xAC, 0x5B, 0x27, 0xAD, 0x61, 0x28, 0xAD, 0x66, 0x28, 0xAD, 0x68,
+	0x29, 0xAB, 0x6D, 0x2A, 0xAB, 0x73, 0x2B, 0xAB, 0x7A, 0x2A, 0xAD, 0x7B, 0x2B, 0xA6, 0x7C, 0x2C,
+	0xA5, 0x7E, 0x2D, 0xA3, 0x82, 0x2E, 0xA0, 0x86, 0x2C, 0x9D, 0x88, 0x2B, 0x96, 0x8B, 0x28, 0x94,
+	0x8D, 0x28, 0x92, 0x91, 0x29, 0x8A, 0x95, 0x25, 0x87, 0x9B, 0x23, 0x84, 0x9F, 0x22, 0x80, 0xA4,
+	0x23, 0x7F, 0xAE, 0x25, 0x7D, 0xB9, 0x29, 0x81, 0xC0, 0x2A, 0x83, 0xCC, 0x2E, 0x82, 0xD1, 0x2F,
+	0x84, 0xD7, 0x30, 0x82, 0xDE, 0x2E, 0x81, 0xDF, 0x2E, 0x7F, 0x1C, 0x29, 0x99, 0x24, 0x31, 0xA1,
+	0x31, 0x3E, 0xAE, 0x39, 0x45, 0xB5, 0x37, 0x41, 0xB4, 0x31, 0x36, 0xAB, 0x2C, 0x2D, 0xA3, 0x29,
+	0x28, 0x9F, 0x2E, 0x2A, 0xA3, 0x31, 0x2B, 0xA5, 0x37, 0x2B, 0xA7, 0x3C, 0x2C, 0xA8, 0x44, 0x2B,
+	0xAA, 0x49, 0x2C, 0xAC, 0x50, 0x2D, 0xAD, 0x52, 0x2D, 0xAE, 0x57, 0x2F, 0xAC, 0x5D, 0x2E, 0xAE,
+	0x63, 0x2F, 0xAE, 0x68, 0x30, 0xAF, 0x6B, 0x31, 0xAC, 0x6F, 0x31, 0xAC, 0x76, 0x32, 0xAD, 0x7B,
+	0x31, 0xAC, 0x7E, 0x30, 0xA7, 0x80, 0x31, 0xA6, 0x82, 0x32, 0xA3, 0x85, 0x31, 0xA0, 0x88, 0x31,
+	0x9A, 0x8A, 0x2D, 0x95, 0x8B, 0x2B, 0x8F, 0x8D, 0x29, 0x8C, 0x91, 0x2A, 0x86, 0x95, 0x28, 0x85,
+	0x9D, 0x26, 0x82, 0xA2, 0x25, 0x80, 0xA9, 0x29, 0x7E, 0xB2, 0x2D, 0x80, 0xBD, 0x2F, 0x81, 0xC5,
+	0x32, 0x83, 0xCD, 0x35, 0x82, 0xD2, 0x35, 0x82, 0xDA, 0x35, 0x82, 0xDF, 0x34, 0x80, 0xE2, 0x33,
+	0x7E, 0x18, 0x2A, 0x98, 0x1A, 0x2C, 0x9A, 0x1F, 0x31, 0x9F, 0x26, 0x36, 0xA5, 0x29, 0x35, 0xA5,
+	0x26, 0x30, 0xA1, 0x29, 0x2E, 0xA3, 0x2E, 0x31, 0xA6, 0x30, 0x2F, 0xA6, 0x34, 0x30, 0xA8, 0x39,
+	0x31, 0xAA, 0x3F, 0x31, 0xAA, 0x46, 0x32, 0xAD, 0x4C, 0x32, 0xAF, 0x51, 0x33, 0xAF, 0x54, 0x34,
+	0xB1, 0x5A, 0x34, 0xAE, 0x5D, 0x33, 0xAF, 0x65, 0x33, 0xB0, 0x6A, 0x34, 0xAE, 0x6C, 0x35, 0xAD,
+	0x71, 0x36, 0xAE, 0x77, 0x36, 0xAE, 0x7D, 0x36, 0xAE, 0x85, 0x38, 0xAA, 0x85, 0x38, 0xA8, 0x87,
+	0x39, 0xA6, 0x8A, 0x39, 0xA2, 0x8D, 0x36, 0x9E, 0x8F, 0x33, 0x96, 0x90, 0x30, 0x92, 0x91, 0x2D,
+	0x8F, 0x93, 0x2C, 0x85, 0x97, 0x2A, 0x83, 0x9E, 0x29, 0x81, 0xA5, 0x2B, 0x80, 0xAD, 0x2D, 0x80,
+	0xB7, 0x32, 0x81, 0xC3, 0x36, 0x84, 0xCB, 0x38, 0x88, 0xD0, 0x3A, 0x82, 0xD5, 0x39, 0x82, 0xDB,
+	0x39, 0x82, 0xE0, 0x39, 0x81, 0xE3, 0x37, 0x7F, 0x13, 0x30, 0x98, 0x14, 0x31, 0x99, 0x17, 0x32,
+	0x9B, 0x1B, 0x33, 0x9D, 0x1F, 0x34, 0x9F, 0x25, 0x35, 0xA4, 0x2A, 0x36, 0xA6, 0x2F, 0x36, 0xA8,
+	0x2F, 0x39, 0xA8, 0x35, 0x38, 0xA9, 0x3C, 0x37, 0xAB, 0x41, 0x38, 0xAB, 0x46, 0x39, 0xAB, 0x4B,
+	0x3A, 0xAD, 0x52, 0x39, 0xAE, 0x57, 0x38, 0xAF, 0x5B, 0x39, 0xB2, 0x5F, 0x39, 0xB2, 0x66, 0x38,
+	0xB2, 0x6B, 0x3A, 0xB0, 0x6D, 0x3B, 0xAE, 0x72, 0x3C, 0xAE, 0x77, 0x3B, 0xAD, 0x7E, 0x3B, 0xAE,
+	0x7E, 0x3F, 0xAA, 0x83, 0x3E, 0xA8, 0x89, 0x3F, 0xA2, 0x8C, 0x3F, 0x9F, 0x8E, 0x3E, 0x9D, 0x90,
+	0x3C, 0x9A, 0x92, 0x3A, 0x91, 0x94, 0x36, 0x8C, 0x97, 0x35, 0x88, 0x9B, 0x34, 0x85, 0xA4, 0x33,
+	0x83, 0xAB, 0x35, 0x81, 0xB2, 0x39, 0x80, 0xBD, 0x3B, 0x81, 0xC7, 0x3F, 0x81, 0xCF, 0x40, 0x82,
+	0xD2, 0x40, 0x7F, 0xD6, 0x40, 0x7F, 0xDA, 0x40, 0x7E, 0xE0, 0x40, 0x7C, 0xE4, 0x40, 0x7D, 0x14,
+	0x37, 0x9D, 0x15, 0x38, 0x9E, 0x18, 0x39, 0xA0, 0x1B, 0x3B, 0xA2, 0x20, 0x3B, 0xA4, 0x25, 0x3C,
+	0xA6, 0x2B, 0x3D, 0xA9, 0x2D, 0x3E, 0xAA, 0x2E, 0x3F, 0xAB, 0x34, 0x3E, 0xAD, 0x3C, 0x3E, 0xAD,
+	0x41, 0x3F, 0xAD, 0x46, 0x3F, 0xAF, 0x49, 0x3F, 0xAF, 0x52, 0x40, 0xB0, 0x57, 0x3F, 0xB1, 0x5C,
+	0x41, 0xB2, 0x5F, 0x41, 0xB1, 0x67, 0x41, 0xB2, 0x6B, 0x41, 0xAF, 0x6D, 0x42, 0xAD, 0x72, 0x43,
+	0xAD, 0x7A, 0x43, 0xAB, 0x7D, 0x42, 0xAC, 0x81, 0x45, 0xA9, 0x86, 0x44, 0xA5, 0x8C, 0x45, 0xA1,
+	0x90, 0x46, 0x9F, 0x94, 0x45, 0x9E, 0x96, 0x44, 0x99, 0x99, 0x42, 0x93, 0x9C, 0x40, 0x8D, 0xA1,
+	0x41, 0x8B, 0xA6, 0x40, 0x8A, 0xAD, 0x3F, 0x88, 0xB3, 0x40, 0x85, 0xBB, 0x43, 0x83, 0xC3, 0x45,
+	0x82, 0xCC, 0x46, 0x81, 0xD3, 0x48, 0x83, 0xD5, 0x46, 0x7C, 0xD9, 0x46, 0x7C, 0xDF, 0x46, 0x7C,
+	0xE3, 0x46, 0x7B, 0xE7, 0x46, 0x7A, 0x11, 0x3F, 0x9F, 0x12, 0x40, 0xA0, 0x15, 0x41, 0xA2, 0x18,
+	0x42, 0xA4, 0x1C, 0x42, 0xA5, 0x23, 0x43, 0xA8, 0x28, 0x44, 0xA8, 0x2C, 0x45, 0xAA, 0x2E, 0x47,
+	0xAE, 0x34, 0x47, 0xB0, 0x3B, 0x46, 0xB0, 0x40, 0x47, 0xB1, 0x44, 0x47, 0xB0, 0x49, 0x47, 0xB2,
+	0x50, 0x47, 0xB2, 0x57, 0x47, 0xB4, 0x59, 0x48, 0xAE, 0x5E, 0x47, 0xAF, 0x64, 0x48, 0xAE, 0x69,
+	0x49, 0xAC, 0x6D, 0x49, 0xA9, 0x71, 0x4A, 0xA7, 0x77, 0x4A, 0xA7, 0x7D, 0x4A, 0xA7, 0x83, 0x4B,
+	0xA6, 0x87, 0x4B, 0xA1, 0x8E, 0x4A, 0x9D, 0x93, 0x4C, 0x9C, 0x95, 0x4C, 0x9B, 0x9A, 0x4C, 0x98,
+	0x9E, 0x4B, 0x93, 0xA3, 0x4A, 0x8E, 0xA8, 0x4C, 0x8D, 0xAE, 0x4B, 0x8C, 0xB4, 0x4A, 0x8A, 0xBA,
+	0x4A, 0x85, 0xC1, 0x4C, 0x83, 0xC7, 0x4D, 0x80, 0xCF, 0x4C, 0x7E, 0xD5, 0x4D, 0x7F, 0xD8, 0x4C,
+	0x79, 0xDB, 0x4C, 0x78, 0xDF, 0x4C, 0x78, 0xE4, 0x4C, 0x75, 0xE7, 0x4C, 0x76, 0x10, 0x45, 0xA1,
+	0x11, 0x46, 0xA2, 0x15, 0x48, 0xA3, 0x18, 0x49, 0xA5, 0x1D, 0x4A, 0xA7, 0x22, 0x4A, 0xA9, 0x27,
+	0x4B, 0xAB, 0x2A, 0x4C, 0xAD, 0x2E, 0x4F, 0xB0, 0x34, 0x4D, 0xB1, 0x3B, 0x4D, 0xB1, 0x40, 0x4E,
+	0xB1, 0x45, 0x4F, 0xB1, 0x49, 0x4F, 0xB1, 0x50, 0x4E, 0xB1, 0x56, 0x4E, 0xB3, 0x5A, 0x4F, 0xAF,
+	0x5E, 0x4F, 0xAE, 0x66, 0x4E, 0xAC, 0x69, 0x4E, 0xAB, 0x6E, 0x50, 0xA8, 0x72, 0x50, 0xA6, 0x7A,
+	0x50, 0xA6, 0x7D, 0x50, 0xA5, 0x84, 0x50, 0xA3, 0x89, 0x50, 0x9F, 0x8E, 0x50, 0x9B, 0x93, 0x51,
+	0x99, 0x98, 0x52, 0x9A, 0x9C, 0x53, 0x98, 0xA3, 0x52, 0x94, 0xA7, 0x51, 0x8E, 0xAD, 0x54, 0x8C,
+	0xB1, 0x52, 0x8A, 0xB8, 0x51, 0x88, 0xBD, 0x51, 0x83, 0xC2, 0x52, 0x80, 0xC7, 0x52, 0x7C, 0xCE,
+	0x51, 0x79, 0xD4, 0x50, 0x78, 0xD8, 0x52, 0x75, 0xDC, 0x52, 0x74, 0xDF, 0x52, 0x74, 0xE6, 0x52,
+	0x74, 0xE8, 0x53, 0x73, 0x12, 0x4E, 0xA4, 0x13, 0x4F, 0xA5, 0x17, 0x50, 0xA7, 0x1A, 0x52, 0xA9,
+	0x1E, 0x52, 0xA8, 0x24, 0x52, 0xAA, 0x2A, 0x53, 0xAD, 0x2C, 0x53, 0xAE, 0x2F, 0x54, 0xAF, 0x35,
+	0x54, 0xAF, 0x3C, 0x53, 0xB1, 0x40, 0x53, 0xB1, 0x45, 0x54, 0xAF, 0x4A, 0x55, 0xAF, 0x51, 0x55,
+	0xB0, 0x57, 0x53, 0xB1, 0x5C, 0x56, 0xB0, 0x62, 0x55, 0xAF, 0x68, 0x55, 0xAF, 0x6E, 0x56, 0xAC,
+	0x72, 0x56, 0xAA, 0x77, 0x58, 0xA8, 0x7D, 0x56, 0xA5, 0x83, 0x56, 0xA7, 0x87, 0x59, 0xA4, 0x8B,
+	0x57, 0xA1, 0x90, 0x57, 0x9B, 0x96, 0x58, 0x9B, 0x9A, 0x59, 0x9B, 0xA0, 0x5A, 0x99, 0xA5, 0x5A,
+	0x93, 0xAA, 0x59, 0x91, 0xB0, 0x59, 0x8C, 0xB5, 0x59, 0x8C, 0xBB, 0x57, 0x89, 0xC1, 0x57, 0x85,
+	0xC5, 0x58, 0x81, 0xCB, 0x59, 0x7D, 0xD0, 0x57, 0x7A, 0xD6, 0x56, 0x79, 0xDB, 0x59, 0x75, 0xDE,
+	0x59, 0x74, 0xE3, 0x5A, 0x74, 0xE8, 0x5A, 0x74, 0xEA, 0x5A, 0x73, 0x12, 0x55, 0xA6, 0x13, 0x56,
+	0xA7, 0x16, 0x57, 0xA9, 0x1A, 0x59, 0xA9, 0x1E, 0x58, 0xAA, 0x22, 0x59, 0xAB, 0x28, 0x5B, 0xAE,
+	0x2B, 0x5B, 0xAF, 0x2F, 0x5C, 0xAF, 0x35, 0x5B, 0xB0, 0x3C, 0x5A, 0xB0, 0x41, 0x5B, 0xB0, 0x45,
+	0x5B, 0xAE, 0x4A, 0x5C, 0xAE, 0x51, 0x5C, 0xAE, 0x56, 0x5B, 0xAF, 0x5C, 0x5D, 0xB0, 0x61, 0x5C,
+	0xB0, 0x69, 0x5C, 0xAE, 0x6E, 0x5B, 0xAC, 0x73, 0x5D, 0xA8, 0x77, 0x5D, 0xA6, 0x7E, 0x5D, 0xA4,
+	0x84, 0x5C, 0xA3, 0x87, 0x5E, 0xA2, 0x8C, 0x5E, 0x9E, 0x93, 0x5D, 0x99, 0x97, 0x5D, 0x97, 0x9B,
+	0x5E, 0x97, 0xA1, 0x5D, 0x96, 0xA7, 0x5F, 0x91, 0xAB, 0x5D, 0x8D, 0xB1, 0x5E, 0x88, 0xB6, 0x5E,
+	0x88, 0xBD, 0x5C, 0x85, 0xC2, 0x5C, 0x81, 0xC7, 0x5E, 0x7D, 0xCB, 0x5F, 0x79, 0xD2, 0x5D, 0x77,
+	0xD7, 0x5D, 0x76, 0xDD, 0x60, 0x72, 0xDF, 0x60, 0x73, 0xE3, 0x60, 0x70, 0xE8, 0x5F, 0x6F, 0xEA,
+	0x60, 0x6F, 0x0F, 0x5D, 0xA8, 0x11, 0x5D, 0xA9, 0x13, 0x5F, 0xAB, 0x17, 0x5F, 0xAB, 0x1C, 0x60,
+	0xAB, 0x21, 0x60, 0xAD, 0x26, 0x61, 0xAD, 0x29, 0x62, 0xAF, 0x2F, 0x64, 0xB0, 0x34, 0x64, 0xB0,
+	0x3C, 0x63, 0xB0, 0x40, 0x64, 0xB0, 0x44, 0x64, 0xAF, 0x49, 0x65, 0xAE, 0x51, 0x65, 0xAE, 0x56,
+	0x64, 0xAF, 0x5B, 0x63, 0xAC, 0x60, 0x62, 0xAC, 0x68, 0x62, 0xAA, 0x6D, 0x63, 0xA8, 0x70, 0x64,
+	0xA4, 0x77, 0x65, 0xA3, 0x7D, 0x63, 0xA0, 0x83, 0x64, 0xA0, 0x87, 0x64, 0x9E, 0x8C, 0x64, 0x99,
+	0x93, 0x63, 0x95, 0x99, 0x63, 0x94, 0x9E, 0x64, 0x94, 0xA2, 0x65, 0x91, 0xA8, 0x64, 0x8D, 0xAD,
+	0x63, 0x88, 0xB4, 0x65, 0x85, 0xB8, 0x63, 0x84, 0xBF, 0x62, 0x81, 0xC5, 0x62, 0x7E, 0xC9, 0x63,
+	0x79, 0xCE, 0x65, 0x76, 0xD4, 0x64, 0x74, 0xD9, 0x63, 0x73, 0xDE, 0x65, 0x6E, 0xE1, 0x65, 0x6D,
+	0xE4, 0x65, 0x6C, 0xE9, 0x66, 0x6C, 0xEB, 0x66, 0x6B, 0x10, 0x64, 0xAD, 0x11, 0x65, 0xAD, 0x13,
+	0x65, 0xAE, 0x17, 0x67, 0xAE, 0x1B, 0x68, 0xB0, 0x22, 0x68, 0xB0, 0x26, 0x68, 0xB2, 0x29, 0x69,
+	0xB1, 0x2E, 0x6A, 0xB0, 0x34, 0x6A, 0xB2, 0x3B, 0x6A, 0xB2, 0x3F, 0x6A, 0xAF, 0x44, 0x6B, 0xB0,
+	0x48, 0x6B, 0xAF, 0x4F, 0x6A, 0xAF, 0x56, 0x6A, 0xAF, 0x5C, 0x6B, 0xAC, 0x61, 0x6A, 0xAB, 0x69,
+	0x6A, 0xAA, 0x6C, 0x6B, 0xA7, 0x71, 0x6C, 0xA4, 0x76, 0x6C, 0xA1, 0x7E, 0x6C, 0xA0, 0x83, 0x6B,
+	0x9F, 0x8B, 0x69, 0x9C, 0x90, 0x69, 0x98, 0x98, 0x69, 0x95, 0x9D, 0x6A, 0x93, 0xA1, 0x6A, 0x92,
+	0xA7, 0x6B, 0x91, 0xAC, 0x69, 0x8C, 0xB2, 0x69, 0x87, 0xB9, 0x6B, 0x85, 0xBD, 0x69, 0x83, 0xC3,
+	0x67, 0x7E, 0xC7, 0x68, 0x7C, 0xCB, 0x69, 0x78, 0xD2, 0x6A, 0x75, 0xD8, 0x6A, 0x73, 0xDD, 0x6A,
+	0x71, 0xE1, 0x6B, 0x6B, 0xE3, 0x6B, 0x6C, 0xE7, 0x6B, 0x69, 0xEC, 0x6C, 0x69, 0xEE, 0x6D, 0x68,
+	0x0F, 0x6B, 0xAC, 0x10, 0x6C, 0xAD, 0x13, 0x6C, 0xB0, 0x16, 0x6D, 0xB2, 0x1E, 0x6E, 0xB3, 0x22,
+	0x6F, 0xB3, 0x26, 0x6F, 0xB3, 0x2A, 0x6F, 0xB4, 0x2E, 0x72, 0xB3, 0x35, 0x72, 0xB3, 0x3B, 0x70,
+	0xB2, 0x41, 0x71, 0xB1, 0x45, 0x71, 0xB0, 0x4A, 0x72, 0xAF, 0x52, 0x72, 0xAF, 0x57, 0x71, 0xAE,
+	0x5C, 0x72, 0xAC, 0x61, 0x71, 0xAC, 0x68, 0x71, 0xAA, 0x6E, 0x71, 0xA6, 0x71, 0x72, 0xA2, 0x78,
+	0x72, 0xA0, 0x7E, 0x71, 0x9D, 0x85, 0x6F, 0x9D, 0x88, 0x72, 0x99, 0x8F, 0x71, 0x97, 0x96, 0x70,
+	0x95, 0x9C, 0x70, 0x93, 0xA0, 0x6F, 0x8D, 0xA6, 0x70, 0x8A, 0xAE, 0x70, 0x89, 0xB5, 0x6F, 0x89,
+	0xB8, 0x6E, 0x85, 0xBD, 0x6E, 0x81, 0xC4, 0x6E, 0x7B, 0xC9, 0x6D, 0x78, 0xCE, 0x6F, 0x77, 0xD3,
+	0x70, 0x75, 0xD8, 0x70, 0x6F, 0xDB, 0x70, 0x6A, 0xE1, 0x70, 0x6C, 0xE3, 0x70, 0x6B, 0xE7, 0x72,
+	0x69, 0xEB, 0x72, 0x67, 0xEB, 0x73, 0x65, 0x0E, 0x73, 0xAB, 0x0F, 0x72, 0xAD, 0x13, 0x73, 0xAF,
+	0x16, 0x74, 0xB1, 0x1B, 0x75, 0xB1, 0x21, 0x75, 0xB1, 0x26, 0x76, 0xB1, 0x2A, 0x76, 0xB2, 0x2E,
+	0x79, 0xB2, 0x33, 0x78, 0xB1, 0x3B, 0x78, 0xB1, 0x40, 0x77, 0xAF, 0x45, 0x78, 0xAD, 0x49, 0x78,
+	0xAC, 0x50, 0x78, 0xAB, 0x56, 0x77, 0xAC, 0x5A, 0x79, 0xA8, 0x60, 0x78, 0xA8, 0x67, 0x78, 0xA6,
+	0x6C, 0x77, 0xA4, 0x70, 0x78, 0x9F, 0x77, 0x77, 0x9D, 0x7E, 0x76, 0x9B, 0x84, 0x76, 0x9A, 0x8A,
+	0x77, 0x95, 0x90, 0x75, 0x94, 0x98, 0x75, 0x93, 0x9D, 0x75, 0x90, 0xA2, 0x75, 0x8C, 0xA8, 0x75,
+	0x88, 0xB0, 0x73, 0x85, 0xB6, 0x73, 0x85, 0xBC, 0x75, 0x85, 0xC0, 0x74, 0x80, 0xC8, 0x73, 0x7A,
+	0xCD, 0x72, 0x77, 0xCF, 0x73, 0x74, 0xD4, 0x75, 0x73, 0xDB, 0x76, 0x6E, 0xE0, 0x76, 0x69, 0xE5,
+	0x76, 0x6B, 0xE7, 0x77, 0x69, 0xEA, 0x79, 0x67, 0xEE, 0x79, 0x65, 0xEE, 0x7A, 0x63, 0x0D, 0x7C,
+	0xAA, 0x0F, 0x7B, 0xAA, 0x12, 0x7C, 0xAE, 0x15, 0x7E, 0xAE, 0x1A, 0x7E, 0xB0, 0x20, 0x7E, 0xB1,
+	0x25, 0x7F, 0xB1, 0x29, 0x7F, 0xB0, 0x2F, 0x81, 0xB0, 0x34, 0x80, 0xB1, 0x3A, 0x81, 0xAF, 0x40,
+	0x80, 0xAC, 0x43, 0x81, 0xAA, 0x48, 0x82, 0xAA, 0x50, 0x81, 0xA9, 0x55, 0x81, 0xA8, 0x59, 0x81,
+	0xA5, 0x5E, 0x80, 0xA5, 0x66, 0x80, 0xA3, 0x6C, 0x7F, 0x9F, 0x70, 0x80, 0x9A, 0x76, 0x80, 0x99,
+	0x7D, 0x7F, 0x96, 0x83, 0x7E, 0x95, 0x8C, 0x7D, 0x92, 0x93, 0x7D, 0x92, 0x99, 0x7C, 0x90, 0xA1,
+	0x7C, 0x8D, 0xA6, 0x7C, 0x8A, 0xAA, 0x7B, 0x85, 0xB1, 0x79, 0x82, 0xB7, 0x78, 0x81, 0xBD, 0x7A,
+	0x81, 0xC2, 0x7A, 0x7D, 0xCA, 0x79, 0x76, 0xCE, 0x79, 0x74, 0xD2, 0x79, 0x71, 0xD6, 0x7A, 0x6F,
+	0xDD, 0x7C, 0x6B, 0xE2, 0x7D, 0x69, 0xE5, 0x7C, 0x66, 0xE7, 0x7D, 0x63, 0xEB, 0x7F, 0x62, 0xEE,
+	0x80, 0x5F, 0xEF, 0x81, 0x5E, 0x0E, 0x82, 0xAB, 0x0F, 0x82, 0xAE, 0x12, 0x83, 0xAF, 0x15, 0x84,
+	0xAF, 0x1B, 0x84, 0xB1, 0x20, 0x85, 0xB1, 0x25, 0x86, 0xB0, 0x29, 0x86, 0xB1, 0x2E, 0x87, 0xAF,
+	0x34, 0x87, 0xAF, 0x3B, 0x86, 0xAE, 0x3F, 0x87, 0xAD, 0x43, 0x88, 0xA9, 0x49, 0x88, 0xA9, 0x51,
+	0x88, 0xA7, 0x56, 0x87, 0xA7, 0x5A, 0x88, 0xA2, 0x5F, 0x87, 0xA1, 0x67, 0x87, 0xA0, 0x6C, 0x86,
+	0x9D, 0x71, 0x86, 0x99, 0x76, 0x86, 0x95, 0x7F, 0x85, 0x93, 0x85, 0x84, 0x92, 0x8C, 0x84, 0x8F,
+	0x93, 0x83, 0x8E, 0x99, 0x82, 0x8C, 0xA1, 0x82, 0x8A, 0xA6, 0x81, 0x88, 0xAC, 0x82, 0x84, 0xB4,
+	0x80, 0x82, 0xB9, 0x7E, 0x80, 0xBE, 0x7E, 0x7E, 0xC4, 0x7F, 0x7A, 0xCC, 0x7F, 0x77, 0xD0, 0x7E,
+	0x72, 0xD2, 0x7F, 0x71, 0xD6, 0x7F, 0x6C, 0xDC, 0x82, 0x6A, 0xE2, 0x83, 0x67, 0xE5, 0x82, 0x63,
+	0xE8, 0x84, 0x62, 0xEB, 0x85, 0x5F, 0xEE, 0x87, 0x5E, 0xF0, 0x86, 0x5C, 0x0E, 0x88, 0xAD, 0x10,
+	0x87, 0xAF, 0x13, 0x89, 0xB1, 0x16, 0x8A, 0xB1, 0x1B, 0x8B, 0xB1, 0x21, 0x8B, 0xB2, 0x25, 0x8B,
+	0xB1, 0x29, 0x8B, 0xB0, 0x2E, 0x8C, 0xAE, 0x34, 0x8D, 0xAF, 0x3B, 0x8B, 0xAE, 0x41, 0x8C, 0xAC,
+	0x43, 0x8D, 0xA8, 0x4A, 0x8D, 0xA7, 0x51, 0x8D, 0xA7, 0x56, 0x8C, 0xA6, 0x5B, 0x8E, 0xA1, 0x60,
+	0x8D, 0xA0, 0x68, 0x8B, 0x9E, 0x6F, 0x8C, 0x9C, 0x74, 0x8C, 0x98, 0x79, 0x8C, 0x93, 0x82, 0x8B,
+	0x92, 0x87, 0x8A, 0x91, 0x8D, 0x8B, 0x90, 0x92, 0x89, 0x8E, 0x9A, 0x87, 0x8B, 0x9F, 0x86, 0x89,
+	0xA5, 0x87, 0x85, 0xAD, 0x87, 0x84, 0xB6, 0x86, 0x82, 0xBA, 0x85, 0x81, 0xBF, 0x84, 0x7E, 0xC5,
+	0x85, 0x7B, 0xCD, 0x85, 0x77, 0xD2, 0x85, 0x73, 0xD3, 0x85, 0x71, 0xD7, 0x85, 0x6F, 0xDB, 0x86,
+	0x69, 0xE0, 0x87, 0x65, 0xE6, 0x88, 0x62, 0xEA, 0x8A, 0x62, 0xED, 0x8C, 0x61, 0xEE, 0x8E, 0x5E,
+	0xF0, 0x8E, 0x5D, 0x0F, 0x8E, 0xAF, 0x10, 0x8F, 0xB0, 0x13, 0x8F, 0xB1, 0x16, 0x91, 0xB2, 0x1C,
+	0x91, 0xB2, 0x21, 0x92, 0xB2, 0x25, 0x92, 0xAF, 0x29, 0x92, 0xAF, 0x2E, 0x93, 0xAF, 0x33, 0x92,
+	0xAE, 0x3B, 0x92, 0xAD, 0x41, 0x93, 0xAB, 0x45, 0x93, 0xA7, 0x49, 0x95, 0xA5, 0x50, 0x93, 0xA3,
+	0x56, 0x94, 0xA3, 0x5A, 0x94, 0x9F, 0x62, 0x94, 0x9F, 0x68, 0x93, 0x9C, 0x6F, 0x92, 0x98, 0x75,
+	0x93, 0x95, 0x7A, 0x92, 0x92, 0x82, 0x90, 0x90, 0x88, 0x91, 0x90, 0x8D, 0x92, 0x8C, 0x92, 0x8F,
+	0x8A, 0x98, 0x8D, 0x87, 0x9F, 0x8C, 0x85, 0xA5, 0x8D, 0x83, 0xAD, 0x8D, 0x82, 0xB5, 0x8B, 0x7F,
+	0xBB, 0x89, 0x80, 0xC3, 0x8A, 0x7F, 0xC7, 0x89, 0x7A, 0xCE, 0x8A, 0x75, 0xD2, 0x8A, 0x72, 0xD6,
+	0x8C, 0x71, 0xD9, 0x8C, 0x6E, 0xDD, 0x8D, 0x68, 0xE0, 0x8D, 0x63, 0xE7, 0x8E, 0x62, 0xE8, 0x90,
+	0x62, 0xEC, 0x92, 0x5E, 0xEE, 0x93, 0x5E, 0xEF, 0x94, 0x5B, 0x0F, 0x97, 0xAF, 0x10, 0x98, 0xB0,
+	0x12, 0x99, 0xAF, 0x16, 0x9A, 0xB1, 0x1C, 0x9A, 0xB1, 0x21, 0x9B, 0xB0, 0x24, 0x9B, 0xAF, 0x28,
+	0x9B, 0xAE, 0x2E, 0x9C, 0xAD, 0x34, 0x9B, 0xAC, 0x3A, 0x9B, 0xAB, 0x3F, 0x9B, 0xA8, 0x44, 0x9D,
+	0xA5, 0x49, 0x9C, 0xA2, 0x4F, 0x9D, 0xA1, 0x55, 0x9C, 0xA0, 0x5B, 0x9D, 0x9B, 0x60, 0x9C, 0x9A,
+	0x68, 0x9A, 0x97, 0x6E, 0x9B, 0x94, 0x73, 0x9B, 0x92, 0x7A, 0x9A, 0x8D, 0x83, 0x99, 0x8C, 0x88,
+	0x98, 0x8B, 0x8D, 0x98, 0x88, 0x94, 0x96, 0x88, 0x9B, 0x94, 0x84, 0xA3, 0x93, 0x83, 0xA9, 0x94,
+	0x81, 0xAF, 0x93, 0x7E, 0xB5, 0x8F, 0x7C, 0xB9, 0x8C, 0x79, 0xBD, 0x8A, 0x75, 0xC2, 0x88, 0x70,
+	0xC7, 0x88, 0x69, 0xCE, 0x89, 0x68, 0xD4, 0x8E, 0x6C, 0xDA, 0x92, 0x6A, 0xDF, 0x95, 0x68, 0xE5,
+	0x95, 0x64, 0xE7, 0x94, 0x60, 0xEB, 0x96, 0x5F, 0xED, 0x99, 0x5D, 0xEF, 0x9A, 0x5A, 0xEF, 0x9A,
+	0x59, 0x0D, 0x9F, 0xAE, 0x0F, 0x9E, 0xAE, 0x12, 0x9F, 0xB0, 0x15, 0xA1, 0xB0, 0x1B, 0xA0, 0xAF,
+	0x1F, 0xA1, 0xAE, 0x24, 0xA2, 0xAE, 0x27, 0xA1, 0xAC, 0x2D, 0xA2, 0xAB, 0x33, 0xA2, 0xAB, 0x39,
+	0xA2, 0xA8, 0x3F, 0xA2, 0xA7, 0x43, 0xA3, 0xA2, 0x49, 0xA3, 0xA1, 0x4F, 0xA4, 0x9F, 0x54, 0xA3,
+	0x9E, 0x59, 0xA2, 0x97, 0x5F, 0xA3, 0x98, 0x67, 0xA1, 0x95, 0x6E, 0xA1, 0x92, 0x74, 0xA1, 0x8D,
+	0x79, 0xA0, 0x8B, 0x81, 0x9E, 0x88, 0x88, 0x9E, 0x89, 0x8F, 0x9D, 0x84, 0x95, 0x9A, 0x83, 0x9E,
+	0x99, 0x83, 0xA5, 0x99, 0x81, 0xAB, 0x9A, 0x80, 0xB0, 0x96, 0x7B, 0xB5, 0x92, 0x76, 0xB9, 0x8D,
+	0x74, 0xB7, 0x85, 0x6A, 0xB9, 0x82, 0x63, 0xBF, 0x81, 0x5C, 0xC6, 0x85, 0x5D, 0xD0, 0x8D, 0x63,
+	0xD9, 0x95, 0x66, 0xE2, 0x99, 0x66, 0xE6, 0x99, 0x61, 0xEB, 0x9B, 0x60, 0xED, 0x9B, 0x5F, 0xEF,
+	0x9E, 0x5D, 0xF3, 0xA0, 0x5C, 0xF3, 0xA1, 0x58, 0x0E, 0xA6, 0xB1, 0x0F, 0xA7, 0xB2, 0x11, 0xA8,
+	0xB1, 0x15, 0xA8, 0xB0, 0x19, 0xA8, 0xB0, 0x1F, 0xA8, 0xAE, 0x24, 0xAA, 0xAD, 0x26, 0xAA, 0xAC,
+	0x2E, 0xAC, 0xA9, 0x33, 0xAB, 0xA9, 0x39, 0xAA, 0xA6, 0x3F, 0xAA, 0xA4, 0x43, 0xAB, 0xA0, 0x49,
+	0xAB, 0x9E, 0x50, 0xAB, 0x9C, 0x56, 0xAA, 0x9B, 0x59, 0xAB, 0x95, 0x60, 0xAB, 0x96, 0x68, 0xA9,
+	0x93, 0x6E, 0xAA, 0x91, 0x73, 0xAA, 0x8D, 0x7A, 0xA9, 0x89, 0x82, 0xA7, 0x86, 0x88, 0xA7, 0x87,
+	0x91, 0xA5, 0x82, 0x98, 0xA3, 0x81, 0x9F, 0xA0, 0x80, 0xA5, 0xA1, 0x7E, 0xAC, 0x9F, 0x7D, 0xAF,
+	0x9B, 0x78, 0xAC, 0x8F, 0x6D, 0xA9, 0x85, 0x63, 0xA7, 0x7B, 0x56, 0xA5, 0x73, 0x4E, 0xAA, 0x70,
+	0x4A, 0xB5, 0x78, 0x4C, 0xC4, 0x86, 0x55, 0xD4, 0x93, 0x5D, 0xE1, 0x9C, 0x63, 0xE7, 0x9F, 0x65,
+	0xEB, 0xA2, 0x5D, 0xEE, 0xA4, 0x5D, 0xF2, 0xA6, 0x5B, 0xF3, 0xA7, 0x59, 0xF5, 0xA8, 0x58, 0x10,
+	0xAB, 0xAF, 0x11, 0xAC, 0xB0, 0x13, 0xAD, 0xAF, 0x18, 0xAE, 0xAF, 0x1C, 0xAE, 0xAE, 0x20, 0xAF,
+	0xAD, 0x27, 0xAF, 0xAB, 0x29, 0xB0, 0xAA, 0x2E, 0xB2, 0xA7, 0x34, 0xB0, 0xA6, 0x3B, 0xAF, 0xA4,
+	0x3F, 0xAF, 0xA1, 0x45, 0xB0, 0x9E, 0x49, 0xB0, 0x9B, 0x51, 0xB0, 0x9A, 0x57, 0xAF, 0x99, 0x5B,
+	0xB0, 0x91, 0x60, 0xAF, 0x90, 0x69, 0xAE, 0x8F, 0x6E, 0xAE, 0x8C, 0x74, 0xAE, 0x88, 0x7B, 0xAD,
+	0x87, 0x82, 0xAC, 0x84, 0x88, 0xAB, 0x83, 0x90, 0xAB, 0x80, 0x96, 0xA8, 0x7E, 0x9E, 0xA6, 0x7D,
+	0xA4, 0xA5, 0x7B, 0xA8, 0xA3, 0x79, 0xA8, 0x9B, 0x6F, 0xA3, 0x8C, 0x62, 0x9C, 0x7F, 0x55, 0x94,
+	0x6F, 0x42, 0x94, 0x69, 0x3C, 0x99, 0x66, 0x37, 0xA3, 0x6E, 0x3A, 0xB3, 0x7C, 0x43, 0xC7, 0x8D,
+	0x4E, 0xD8, 0x9B, 0x5A, 0xE7, 0xA3, 0x62, 0xEB, 0xA9, 0x5F, 0xEE, 0xAA, 0x5F, 0xF1, 0xAC, 0x5E,
+	0xF5, 0xAE, 0x5C, 0xF5, 0xAF, 0x5A, 0x12, 0xB3, 0xAD, 0x13, 0xB4, 0xAE, 0x15, 0xB4, 0xAF, 0x19,
+	0xB4, 0xAC, 0x1E, 0xB5, 0xAC, 0x22, 0xB6, 0xAA, 0x26, 0xB7, 0xA8, 0x2B, 0xB8, 0xA8, 0x2F, 0xB8,
+	0xA6, 0x34, 0xB7, 0xA5, 0x3B, 0xB6, 0xA2, 0x40, 0xB6, 0x9E, 0x45, 0xB8, 0x9B, 0x4A, 0xB7, 0x98,
+	0x52, 0xB7, 0x97, 0x57, 0xB6, 0x94, 0x5B, 0xB8, 0x8C, 0x62, 0xB7, 0x8D, 0x69, 0xB6, 0x8A, 0x70,
+	0xB5, 0x88, 0x75, 0xB5, 0x83, 0x7C, 0xB5, 0x82, 0x83, 0xB3, 0x7F, 0x8B, 0xB3, 0x7F, 0x90, 0xB3,
+	0x7B, 0x96, 0xB1, 0x7A, 0x9D, 0xB0, 0x79, 0xA4, 0xAE, 0x79, 0xA6, 0xAB, 0x73, 0xA1, 0x9E, 0x67,
+	0x97, 0x8A, 0x53, 0x8E, 0x79, 0x44, 0x87, 0x6D, 0x34, 0x8A, 0x67, 0x2F, 0x8E, 0x64, 0x2A, 0x96,
+	0x68, 0x2A, 0xA5, 0x76, 0x32, 0xB9, 0x89, 0x3F, 0xD1, 0x9C, 0x50, 0xE3, 0xAA, 0x5D, 0xE9, 0xAE,
+	0x5E, 0xEB, 0xB1, 0x5D, 0xEF, 0xB3, 0x5B, 0xF2, 0xB5, 0x5A, 0xF3, 0xB6, 0x59, 0x11, 0xB9, 0xAC,
+	0x13, 0xBB, 0xAC, 0x15, 0xBB, 0xAD, 0x19, 0xBB, 0xAC, 0x1D, 0xBC, 0xAA, 0x21, 0xBD, 0xA8, 0x28,
+	0xBD, 0xA7, 0x2A, 0xBE, 0xA6, 0x2F, 0xBF, 0xA4, 0x35, 0xBE, 0xA4, 0x3C, 0xBD, 0xA1, 0x40, 0xBD,
+	0x9D, 0x46, 0xBE, 0x9A, 0x4A, 0xBF, 0x95, 0x51, 0xBE, 0x94, 0x58, 0xBD, 0x93, 0x5C, 0xBE, 0x8B,
+	0x61, 0xBD, 0x8A, 0x6A, 0xBD, 0x89, 0x6F, 0xBC, 0x84, 0x75, 0xBC, 0x80, 0x7C, 0xBC, 0x7F, 0x83,
+	0xBB, 0x7C, 0x89, 0xB9, 0x7B, 0x91, 0xB9, 0x7A, 0x95, 0xB8, 0x78, 0x9E, 0xB6, 0x78, 0xA5, 0xB5,
+	0x76, 0xA7, 0xB1, 0x72, 0xA3, 0xA5, 0x64, 0x97, 0x8F, 0x50, 0x8C, 0x7C, 0x3E, 0x88, 0x73, 0x32,
+	0x89, 0x6E, 0x2B, 0x8C, 0x69, 0x25, 0x94, 0x6E, 0x27, 0xA2, 0x7B, 0x2E, 0xB9, 0x8F, 0x3D, 0xD1,
+	0xA3, 0x4E, 0xE4, 0xB0, 0x5C, 0xE9, 0xB6, 0x5D, 0xED, 0xB8, 0x5C, 0xF0, 0xBA, 0x5A, 0xF3, 0xBC,
+	0x58, 0xF4, 0xBD, 0x58, 0x10, 0xC0, 0xAC, 0x11, 0xC1, 0xAD, 0x14, 0xC1, 0xAD, 0x18, 0xC1, 0xAC,
+	0x1B, 0xC1, 0xA9, 0x20, 0xC3, 0xA8, 0x26, 0xC3, 0xA6, 0x29, 0xC4, 0xA5, 0x2F, 0xC6, 0xA5, 0x34,
+	0xC4, 0xA3, 0x3B, 0xC2, 0xA1, 0x3F, 0xC3, 0x9C, 0x45, 0xC4, 0x99, 0x4A, 0xC5, 0x96, 0x50, 0xC4,
+	0x93, 0x57, 0xC3, 0x92, 0x5B, 0xC4, 0x89, 0x61, 0xC5, 0x89, 0x69, 0xC3, 0x86, 0x6F, 0xC4, 0x83,
+	0x74, 0xC3, 0x81, 0x7B, 0xC2, 0x7C, 0x82, 0xC1, 0x7A, 0x89, 0xC1, 0x7A, 0x93, 0xBE, 0x77, 0x98,
+	0xBD, 0x77, 0xA0, 0xBB, 0x76, 0xA7, 0xBB, 0x76, 0xAB, 0xB8, 0x72, 0xA9, 0xAF, 0x69, 0xA1, 0x9D,
+	0x56, 0x97, 0x8D, 0x48, 0x8E, 0x7C, 0x34, 0x8E, 0x76, 0x2E, 0x93, 0x73, 0x2A, 0x9E, 0x7A, 0x2E,
+	0xAF, 0x8A, 0x39, 0xC3, 0x9E, 0x46, 0xDB, 0xAF, 0x58, 0xE9, 0xBA, 0x62, 0xED, 0xBC, 0x5D, 0xEF,
+	0xBF, 0x5B, 0xF3, 0xC2, 0x5B, 0xF6, 0xC3, 0x58, 0xF7, 0xC4, 0x57, 0x0F, 0xC6, 0xAA, 0x10, 0xC7,
+	0xAB, 0x14, 0xC8, 0xAB, 0x17, 0xC8, 0xAB, 0x1B, 0xC8, 0xAA, 0x21, 0xC9, 0xA8, 0x26, 0xCA, 0xA7,
+	0x29, 0xCB, 0xA6, 0x30, 0xCC, 0xA5, 0x34, 0xCA, 0xA4, 0x3B, 0xCA, 0x9F, 0x40, 0xC9, 0x9B, 0x45,
+	0xCB, 0x98, 0x4B, 0xCC, 0x94, 0x51, 0xCB, 0x92, 0x57, 0xCA, 0x8F, 0x5A, 0xCC, 0x87, 0x60, 0xCB,
+	0x87, 0x69, 0xCA, 0x85, 0x6E, 0xCA, 0x81, 0x73, 0xC9, 0x7E, 0x7B, 0xCA, 0x7B, 0x83, 0xC8, 0x78,
+	0x88, 0xC7, 0x78, 0x94, 0xC5, 0x76, 0x99, 0xC4, 0x75, 0xA1, 0xC1, 0x75, 0xA9, 0xC1, 0x73, 0xAE,
+	0xC1, 0x72, 0xB0, 0xBB, 0x6C, 0xAE, 0xAF, 0x61, 0xAA, 0xA4, 0x56, 0x9F, 0x94, 0x44, 0x9F, 0x8E,
+	0x3E, 0xA5, 0x8C, 0x3A, 0xB1, 0x92, 0x3F, 0xC1, 0xA2, 0x48, 0xD1, 0xB0, 0x53, 0xE0, 0xBC, 0x5C,
+	0xEC, 0xC1, 0x62, 0xEE, 0xC5, 0x5B, 0xF0, 0xC6, 0x5A, 0xF4, 0xC9, 0x59, 0xF7, 0xCA, 0x57, 0xF8,
+	0xCB, 0x56, 0x11, 0xCE, 0xA8, 0x12, 0xCF, 0xA9, 0x15, 0xCF, 0xAA, 0x1A, 0xD0, 0xAA, 0x1D, 0xD0,
+	0xA8, 0x21, 0xD0, 0xA5, 0x27, 0xD1, 0xA4, 0x2B, 0xD2, 0xA4, 0x30, 0xD4, 0xA2, 0x35, 0xD1, 0xA1,
+	0x3C, 0xD0, 0x9E, 0x41, 0xD2, 0x99, 0x46, 0xD2, 0x95, 0x4B, 0xD3, 0x91, 0x51, 0xD2, 0x8F, 0x58,
+	0xD1, 0x8C, 0x5C, 0xD2, 0x84, 0x61, 0xD2, 0x84, 0x6A, 0xD1, 0x82, 0x6F, 0xD0, 0x7F, 0x74, 0xD0,
+	0x7B, 0x7C, 0xD0, 0x78, 0x83, 0xCF, 0x75, 0x89, 0xCE, 0x75, 0x91, 0xCC, 0x70, 0x99, 0xCB, 0x72,
+	0x9F, 0xCA, 0x71, 0xA7, 0xCA, 0x70, 0xAF, 0xC9, 0x6E, 0xB4, 0xC9, 0x6E, 0xB7, 0xC1, 0x68, 0xB7,
+	0xBA, 0x61, 0xB7, 0xB3, 0x58, 0xB8, 0xAF, 0x54, 0xBD, 0xAC, 0x50, 0xC6, 0xB2, 0x53, 0xD1, 0xBB,
+	0x56, 0xDA, 0xC3, 0x5B, 0xE4, 0xC8, 0x5D, 0xEA, 0xC9, 0x5E, 0xED, 0xCC, 0x5B, 0xEE, 0xCD, 0x5A,
+	0xF2, 0xCF, 0x59, 0xF5, 0xD1, 0x57, 0xF5, 0xD1, 0x56, 0x13, 0xD2, 0xA6, 0x15, 0xD4, 0xA8, 0x17,
+	0xD5, 0xA9, 0x1B, 0xD4, 0xA8, 0x1F, 0xD5, 0xA5, 0x24, 0xD6, 0xA4, 0x2A, 0xD7, 0xA2, 0x2C, 0xD7,
+	0xA2, 0x31, 0xD8, 0xA0, 0x35, 0xD7, 0x9E, 0x3C, 0xD6, 0x9A, 0x41, 0xD6, 0x96, 0x46, 0xD7, 0x92,
+	0x4C, 0xD8, 0x8F, 0x53, 0xD7, 0x8B, 0x58, 0xD7, 0x8A, 0x5D, 0xD7, 0x82, 0x62, 0xD6, 0x81, 0x6C,
+	0xD5, 0x80, 0x71, 0xD5, 0x7D, 0x76, 0xD5, 0x79, 0x7E, 0xD5, 0x77, 0x84, 0xD4, 0x75, 0x8B, 0xD2,
+	0x74, 0x90, 0xD2, 0x6E, 0x97, 0xD1, 0x6D, 0xA0, 0xD0, 0x6D, 0xA6, 0xCE, 0x6D, 0xAD, 0xD0, 0x6C,
+	0xB5, 0xCF, 0x6A, 0xBB, 0xCD, 0x69, 0xBD, 0xC7, 0x66, 0xC3, 0xC8, 0x62, 0xC5, 0xC3, 0x5E, 0xCB,
+	0xC2, 0x5D, 0xD3, 0xC6, 0x5E, 0xD9, 0xCB, 0x5E, 0xDF, 0xCF, 0x5E, 0xE6, 0xD1, 0x5E, 0xEB, 0xD2,
+	0x5E, 0xED, 0xD2, 0x5D, 0xF1, 0xD4, 0x5C, 0xF3, 0xD7, 0x5A, 0xF5, 0xD8, 0x58, 0xF6, 0xD9, 0x57,
+	0x14, 0xDA, 0xA7, 0x14, 0xDA, 0xA7, 0x17, 0xDB, 0xA9, 0x1B, 0xDB, 0xA8, 0x20, 0xDD, 0xA7, 0x24,
+	0xDD, 0xA4, 0x2A, 0xDD, 0xA3, 0x2B, 0xDD, 0xA1, 0x31, 0xDD, 0xA1, 0x38, 0xDE, 0x9E, 0x3E, 0xDE,
+	0x98, 0x42, 0xDC, 0x94, 0x46, 0xDC, 0x92, 0x4D, 0xDE, 0x91, 0x54, 0xDD, 0x8B, 0x59, 0xDD, 0x87,
+	0x5F, 0xE0, 0x84, 0x65, 0xDE, 0x81, 0x6B, 0xDD, 0x7E, 0x71, 0xDD, 0x7A, 0x76, 0xDC, 0x76, 0x7C,
+	0xDD, 0x74, 0x85, 0xDC, 0x73, 0x8B, 0xDD, 0x71, 0x94, 0xD9, 0x6E, 0x99, 0xD8, 0x6D, 0xA2, 0xD7,
+	0x6D, 0xA7, 0xD7, 0x6A, 0xAC, 0xD6, 0x68, 0xB2, 0xD7, 0x66, 0xBB, 0xD5, 0x67, 0xC1, 0xD5, 0x66,
+	0xC7, 0xD5, 0x66, 0xCC, 0xD4, 0x65, 0xD3, 0xD3, 0x65, 0xD8, 0xD2, 0x60, 0xDB, 0xD4, 0x5F, 0xE0,
+	0xD6, 0x5B, 0xE6, 0xD8, 0x5B, 0xEC, 0xD8, 0x5B, 0xED, 0xDA, 0x59, 0xEF, 0xDA, 0x5A, 0xF4, 0xDD,
+	0x59, 0xF7, 0xDF, 0x59, 0xF7, 0xDF, 0x57, 0x15, 0xDE, 0xAA, 0x16, 0xDF, 0xA9, 0x19, 0xDF, 0xAA,
+	0x1D, 0xDF, 0xAA, 0x21, 0xE1, 0xA8, 0x28, 0xE1, 0xA7, 0x2B, 0xE1, 0xA4, 0x2D, 0xE1, 0xA2, 0x33,
+	0xE2, 0xA1, 0x39, 0xE2, 0x9D, 0x41, 0xE3, 0x9A, 0x45, 0xE2, 0x95, 0x48, 0xE0, 0x93, 0x4F, 0xE2,
+	0x92, 0x57, 0xE3, 0x8D, 0x5B, 0xE1, 0x88, 0x60, 0xE3, 0x83, 0x66, 0xE2, 0x82, 0x6D, 0xE1, 0x80,
+	0x74, 0xE0, 0x7B, 0x77, 0xE0, 0x77, 0x7F, 0xE1, 0x74, 0x87, 0xE0, 0x72, 0x8D, 0xE1, 0x72, 0x95,
+	0xDD, 0x6D, 0x9A, 0xDD, 0x6C, 0xA2, 0xDC, 0x6C, 0xA9, 0xDB, 0x6A, 0xAD, 0xDC, 0x68, 0xB4, 0xDB,
+	0x68, 0xBC, 0xDB, 0x66, 0xC1, 0xDA, 0x65, 0xC7, 0xDA, 0x67, 0xCE, 0xD8, 0x67, 0xD4, 0xD7, 0x64,
+	0xD9, 0xD8, 0x62, 0xDB, 0xD9, 0x5E, 0xE1, 0xDC, 0x5E, 0xE7, 0xDC, 0x5C, 0xEC, 0xDD, 0x5C, 0xED,
+	0xDF, 0x5A, 0xF1, 0xE1, 0x5A, 0xF4, 0xE2, 0x5A, 0xF7, 0xE4, 0x5A, 0xFA, 0xE4, 0x5A, 0x19, 0xE4,
+	0xAC, 0x19, 0xE4, 0xAC, 0x1C, 0xE6, 0xAC, 0x20, 0xE6, 0xAB, 0x25, 0xE7, 0xAB, 0x29, 0xE7, 0xA9,
+	0x2E, 0xE6, 0xA6, 0x30, 0xE7, 0xA5, 0x37, 0xE8, 0xA2, 0x3D, 0xE9, 0x9F, 0x44, 0xE9, 0x9C, 0x49,
+	0xE8, 0x96, 0x4B, 0xE7, 0x94, 0x53, 0xE9, 0x92, 0x59, 0xE8, 0x8E, 0x5D, 0xE7, 0x88, 0x62, 0xE9,
+	0x83, 0x67, 0xE8, 0x83, 0x6F, 0xE6, 0x7E, 0x76, 0xE7, 0x7D, 0x7B, 0xE7, 0x78, 0x80, 0xE7, 0x74,
+	0x89, 0xE6, 0x73, 0x8E, 0xE5, 0x72, 0x96, 0xE5, 0x6E, 0x9D, 0xE4, 0x6E, 0xA4, 0xE3, 0x6E, 0xAB,
+	0xE2, 0x6B, 0xAF, 0xE2, 0x69, 0xB6, 0xE2, 0x67, 0xBD, 0xE1, 0x67, 0xC3, 0xE1, 0x67, 0xC8, 0xE0,
+	0x66, 0xCE, 0xE0, 0x66, 0xD5, 0xDF, 0x64, 0xDB, 0xE0, 0x62, 0xDF, 0xE2, 0x61, 0xE3, 0xE3, 0x5D,
+	0xE8, 0xE4, 0x5E, 0xED, 0xE3, 0x5D, 0xEF, 0xE6, 0x5B, 0xF3, 0xE8, 0x5B, 0xF6, 0xE9, 0x5C, 0xFA,
+	0xEB, 0x5C, 0xFB, 0xEB, 0x5A, 0x1A, 0xEA, 0xAE, 0x1C, 0xEA, 0xAC, 0x1E, 0xEA, 0xAD, 0x21, 0xEC,
+	0xAD, 0x27, 0xEB, 0xAB, 0x2B, 0xEC, 0xA9, 0x2F, 0xED, 0xA7, 0x33, 0xED, 0xA6, 0x38, 0xEE, 0xA3,
+	0x3F, 0xEE, 0x9F, 0x47, 0xEE, 0x9C, 0x4A, 0xEE, 0x97, 0x4F, 0xED, 0x96, 0x54, 0xEF, 0x93, 0x5A,
+	0xEE, 0x8E, 0x60, 0xEC, 0x89, 0x64, 0xED, 0x83, 0x69, 0xED, 0x80, 0x72, 0xEC, 0x7F, 0x77, 0xEC,
+	0x7A, 0x7D, 0xEC, 0x76, 0x83, 0xEC, 0x75, 0x89, 0xEB, 0x70, 0x91, 0xEB, 0x70, 0x97, 0xEC, 0x6D,
+	0x9E, 0xEA, 0x6C, 0xA4, 0xE9, 0x6C, 0xAC, 0xE9, 0x6A, 0xB0, 0xE9, 0x68, 0xB7, 0xE8, 0x68, 0xBE,
+	0xE7, 0x65, 0xC3, 0xE6, 0x64, 0xC9, 0xE7, 0x65, 0xD0, 0xE7, 0x65, 0xD6, 0xE5, 0x64, 0xDC, 0xE6,
+	0x61, 0xE0, 0xE8, 0x5F, 0xE5, 0xE9, 0x5E, 0xE9, 0xEB, 0x5C, 0xEF, 0xE9, 0x5D, 0xF1, 0xEC, 0x5C,
+	0xF4, 0xEE, 0x5C, 0xF7, 0xEF, 0x5C, 0xFB, 0xF1, 0x5C, 0xFC, 0xF1, 0x5B, 0x1C, 0xED, 0xAC, 0x1C,
+	0xED, 0xAC, 0x1F, 0xED, 0xAD, 0x22, 0xEF, 0xAE, 0x27, 0xEE, 0xAB, 0x2C, 0xEF, 0xA9, 0x30, 0xF0,
+	0xA7, 0x33, 0xEF, 0xA5, 0x3A, 0xF0, 0xA3, 0x40, 0xF1, 0xA0, 0x48, 0xF2, 0x9C, 0x4C, 0xF0, 0x97,
+	0x50, 0xF0, 0x96, 0x56, 0xF1, 0x93, 0x5C, 0xF0, 0x8E, 0x61, 0xEF, 0x89, 0x64, 0xF1, 0x81, 0x6A,
+	0xF0, 0x81, 0x73, 0xEF, 0x7F, 0x78, 0xEF, 0x7B, 0x7D, 0xEF, 0x76, 0x82, 0xEF, 0x72, 0x8B, 0xEE,
+	0x70, 0x91, 0xED, 0x70, 0x97, 0xEE, 0x6C, 0x9E, 0xED, 0x6D, 0xA5, 0xEC, 0x6A, 0xAB, 0xEC, 0x6A,
+	0xB0, 0xEC, 0x68, 0xB7, 0xEB, 0x65, 0xBF, 0xEA, 0x65, 0xC4, 0xE9, 0x65, 0xC9, 0xEB, 0x63, 0xD0,
+	0xEA, 0x63, 0xD8, 0xEA, 0x64, 0xDD, 0xEB, 0x62, 0xE0, 0xEB, 0x60, 0xE4, 0xED, 0x5E, 0xEA, 0xEE,
+	0x5C, 0xEE, 0xEE, 0x5C, 0xF2, 0xF0, 0x5D, 0xF5, 0xF1, 0x5C, 0xF9, 0xF3, 0x5D, 0xFB, 0xF4, 0x5B,
+	0xFE, 0xF5, 0x5C,
+};
+
+/* 45x37, grayscale */
+static const uint8_t ref_gray[585] =
+{
+	0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+	0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03,
+	0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0A, 0x07,
+	0x07, 0x06, 0x08, 0x0C, 0x0A, 0x0C, 0x0C, 0x0B, 0x0A, 0x0B, 0x0B, 0x0D, 0x0E, 0x12, 0x10, 0x0D,
+	0x0E, 0x11, 0x0E, 0x0B, 0x0B, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0C, 0x0F,
+	0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xFF, 0xC0, 0x00, 0x0B, 0x08, 0x00, 0x25,
+	0x00, 0x2D, 0x01, 0x01, 0x11, 0x00, 0xFF, 0xC4, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+	0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x10, 0x00, 0x02, 0x01, 0x03,
+	0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7D, 0x01, 0x02, 0x03, 0x00,
+	0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32,
+	0x81, 0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0, 0x24, 0x33, 0x62, 0x72,
+	0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x34, 0x35,
+	0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55,
+	0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75,
+	0x76, 0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94,
+	0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2,
+	0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9,
+	0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6,
+	0xE7, 0xE8, 0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xDA,
+	0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3F, 0x00, 0xF9, 0xBF, 0x50, 0x5F, 0x09, 0x5C, 0x7C, 0x3A,
+	0x82, 0xD2, 0xD6, 0xDB, 0x6E, 0xA4, 0x3A, 0x90, 0x39, 0xCD, 0x71, 0x3A, 0x6F, 0x86, 0x8F, 0x18,
+	0x53, 0x5D, 0x46, 0x9F, 0xE1, 0xB3, 0xC7, 0xCB, 0x5B, 0xF6, 0xDA, 0x49, 0xB4, 0x5D, 0xC5, 0x0F,
+	0xE5, 0x5A, 0x3A, 0x7D, 0xA4, 0x97, 0x33, 0x85, 0x55, 0x24, 0x57, 0x53, 0x0E, 0x80, 0x76, 0x0E,
+	0x0D, 0x79, 0x8E, 0x9D, 0xE1, 0x7C, 0x11, 0xF2, 0xFE, 0x95, 0xD3, 0xE9, 0xFE, 0x19, 0xC6, 0x3E,
+	0x4A, 0xE8, 0xEC, 0x7C, 0x35, 0xD3, 0xE5, 0xFD, 0x2B, 0x76, 0xDB, 0xC3, 0x0B, 0x22, 0xE1, 0x93,
+	0x23, 0xE9, 0x5B, 0x3A, 0x7F, 0x85, 0x23, 0x85, 0xB2, 0x91, 0x00, 0x7E, 0x95, 0xBB, 0x0F, 0x87,
+	0x3E, 0x4F, 0xBB, 0xFA, 0x57, 0x9E, 0xD8, 0x78, 0x67, 0x1F, 0xC1, 0x5D, 0x1D, 0x8F, 0x87, 0x3A,
+	0x7C, 0x95, 0xBD, 0x67, 0xE1, 0xDE, 0x9F, 0x2D, 0x6D, 0xDA, 0xE8, 0x01, 0x46, 0x4A, 0xE0, 0x0E,
+	0xF5, 0xB1, 0xA7, 0x68, 0xF1, 0x4E, 0xD8, 0x8C, 0xAB, 0x91, 0xD4, 0x0A, 0xDF, 0x83, 0xC3, 0x99,
+	0x41, 0xF2, 0x7E, 0x95, 0xC1, 0xD9, 0x78, 0x73, 0x91, 0xF2, 0x56, 0xF5, 0x9F, 0x87, 0x79, 0xFB,
+	0xB5, 0xB9, 0x67, 0xE1, 0xEE, 0x9F, 0x2D, 0x58, 0xD5, 0xFC, 0x25, 0x73, 0x7B, 0xA4, 0xCD, 0x1D,
+	0xA1, 0xD9, 0x31, 0x1C, 0x1A, 0xC0, 0xF8, 0x65, 0xF0, 0xDF, 0xC4, 0x16, 0x1A, 0xD3, 0xCB, 0x7A,
+	0xCC, 0xB0, 0x67, 0x90, 0x4E, 0x73, 0x5E, 0xE1, 0x6F, 0xE1, 0x9F, 0xDD, 0x8C, 0xAF, 0xE9, 0x5E,
+	0x69, 0x69, 0xA6, 0xC2, 0x3B, 0x56, 0xF5, 0xA6, 0x97, 0x0E, 0x01, 0xC7, 0x6A, 0xD9, 0xB3, 0xD3,
+	0xA2, 0xE0, 0xE2, 0xB7, 0xAC, 0xB4, 0xD8, 0x78, 0xE2, 0xBA, 0x2D, 0x3F, 0x4B, 0x87, 0x83, 0x8A,
+	0xE8, 0xAD, 0xF4, 0xB8, 0x44, 0x63, 0x8A, 0xFF, 0xD9,
+};
+
+/* ref_gray decoded by libjpeg */
+static const uint8_t ref_gray_y[1665] =
+{
+	0x1D, 0x28, 0x38, 0x43, 0x3F, 0x31, 0x25, 0x22, 0x22, 0x23, 0x26, 0x28, 0x2A, 0x2C, 0x2F, 0x30,
+	0x32, 0x33, 0x35, 0x37, 0x39, 0x3A, 0x3C, 0x3E, 0x41, 0x42, 0x43, 0x46, 0x49, 0x4C, 0x4F, 0x50,
+	0x52, 0x53, 0x54, 0x54, 0x54, 0x55, 0x56, 0x57, 0x58, 0x5A, 0x5C, 0x5D, 0x5D, 0x2D, 0x3E, 0x54,
+	0x60, 0x58, 0x44, 0x30, 0x26, 0x24, 0x25, 0x28, 0x2A, 0x2C, 0x2E, 0x30, 0x32, 0x35, 0x36, 0x38,
+	0x3A, 0x3B, 0x3D, 0x3F, 0x41, 0x44, 0x45, 0x46, 0x49, 0x4C, 0x4F, 0x51, 0x53, 0x52, 0x52, 0x53,
+	0x53, 0x53, 0x55, 0x56, 0x58, 0x59, 0x5B, 0x5D, 0x5E, 0x5E, 0x3E, 0x56, 0x72, 0x7D, 0x73, 0x5A,
+	0x3E, 0x2C, 0x28, 0x2A, 0x2C, 0x2E, 0x30, 0x32, 0x34, 0x35, 0x39, 0x3A, 0x3C, 0x3E, 0x3F, 0x41,
+	0x43, 0x44, 0x46, 0x47, 0x49, 0x4B, 0x4E, 0x50, 0x52, 0x53, 0x52, 0x52, 0x52, 0x52, 0x53, 0x55,
+	0x58, 0x5A, 0x5C, 0x5E, 0x60, 0x61, 0x61, 0x47, 0x61, 0x7E, 0x89, 0x7E, 0x65, 0x48, 0x35, 0x2E,
+	0x2F, 0x31, 0x33, 0x35, 0x36, 0x38, 0x3A, 0x3C, 0x3E, 0x40, 0x42, 0x43, 0x45, 0x47, 0x48, 0x4A,
+	0x4B, 0x4C, 0x4E, 0x50, 0x52, 0x53, 0x54, 0x54, 0x53, 0x52, 0x52, 0x53, 0x56, 0x59, 0x5C, 0x61,
+	0x62, 0x64, 0x65, 0x65, 0x44, 0x5C, 0x77, 0x80, 0x77, 0x62, 0x49, 0x38, 0x32, 0x33, 0x35, 0x37,
+	0x39, 0x3A, 0x3C, 0x3E, 0x40, 0x42, 0x44, 0x45, 0x47, 0x49, 0x4B, 0x4C, 0x4E, 0x4F, 0x51, 0x52,
+	0x53, 0x54, 0x54, 0x54, 0x54, 0x53, 0x52, 0x52, 0x53, 0x56, 0x5B, 0x5E, 0x64, 0x66, 0x68, 0x69,
+	0x69, 0x3A, 0x4B, 0x60, 0x69, 0x63, 0x53, 0x41, 0x35, 0x35, 0x36, 0x38, 0x3A, 0x3C, 0x3E, 0x40,
+	0x42, 0x45, 0x46, 0x48, 0x4A, 0x4B, 0x4D, 0x4F, 0x51, 0x51, 0x52, 0x53, 0x54, 0x54, 0x53, 0x52,
+	0x52, 0x53, 0x52, 0x52, 0x52, 0x54, 0x58, 0x5E, 0x61, 0x67, 0x69, 0x6B, 0x6C, 0x6C, 0x32, 0x3A,
+	0x47, 0x4E, 0x4B, 0x42, 0x3A, 0x36, 0x39, 0x3B, 0x3D, 0x3F, 0x41, 0x43, 0x46, 0x47, 0x49, 0x4B,
+	0x4D, 0x4F, 0x50, 0x52, 0x54, 0x55, 0x55, 0x56, 0x57, 0x57, 0x57, 0x55, 0x53, 0x52, 0x53, 0x53,
+	0x54, 0x55, 0x59, 0x5E, 0x63, 0x67, 0x6B, 0x6D, 0x6F, 0x70, 0x70, 0x31, 0x33, 0x38, 0x3E, 0x3E,
+	0x3A, 0x3A, 0x3D, 0x3D, 0x3F, 0x41, 0x43, 0x46, 0x48, 0x4A, 0x4C, 0x4D, 0x4E, 0x50, 0x52, 0x53,
+	0x55, 0x57, 0x59, 0x5C, 0x5C, 0x5D, 0x5D, 0x5C, 0x5A, 0x58, 0x56, 0x55, 0x55, 0x56, 0x59, 0x5D,
+	0x63, 0x69, 0x6D, 0x6F, 0x70, 0x72, 0x73, 0x73, 0x33, 0x34, 0x36, 0x38, 0x3A, 0x3D, 0x3F, 0x41,
+	0x43, 0x44, 0x46, 0x48, 0x4A, 0x4C, 0x4E, 0x4F, 0x51, 0x52, 0x54, 0x56, 0x57, 0x59, 0x5A, 0x5C,
+	0x5E, 0x5F, 0x60, 0x61, 0x61, 0x60, 0x5E, 0x5C, 0x5C, 0x5C, 0x5E, 0x61, 0x65, 0x6A, 0x6F, 0x72,
+	0x73, 0x74, 0x75, 0x77, 0x78, 0x38, 0x39, 0x3B, 0x3D, 0x3F, 0x41, 0x44, 0x45, 0x46, 0x48, 0x4A,
+	0x4C, 0x4E, 0x4F, 0x52, 0x53, 0x56, 0x57, 0x59, 0x5A, 0x5B, 0x5D, 0x5F, 0x60, 0x62, 0x63, 0x65,
+	0x66, 0x67, 0x66, 0x65, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6E, 0x72, 0x75, 0x78, 0x77, 0x78, 0x7A,
+	0x7B, 0x7C, 0x3C, 0x3D, 0x3F, 0x41, 0x42, 0x45, 0x47, 0x49, 0x4B, 0x4D, 0x4F, 0x51, 0x52, 0x54,
+	0x56, 0x58, 0x59, 0x5A, 0x5C, 0x5E, 0x5F, 0x60, 0x62, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C,
+	0x6C, 0x6C, 0x6F, 0x70, 0x71, 0x72, 0x75, 0x77, 0x79, 0x7B, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x40,
+	0x41, 0x43, 0x45, 0x47, 0x49, 0x4B, 0x4D, 0x50, 0x51, 0x53, 0x55, 0x57, 0x58, 0x5A, 0x5C, 0x5D,
+	0x5E, 0x60, 0x61, 0x63, 0x64, 0x66, 0x67, 0x69, 0x6A, 0x6B, 0x6D, 0x6F, 0x71, 0x72, 0x72, 0x75,
+	0x75, 0x76, 0x77, 0x79, 0x7A, 0x7B, 0x7C, 0x7E, 0x7F, 0x80, 0x82, 0x83, 0x46, 0x47, 0x49, 0x4B,
+	0x4C, 0x4E, 0x51, 0x52, 0x53, 0x55, 0x57, 0x58, 0x5A, 0x5C, 0x5E, 0x5F, 0x62, 0x63, 0x65, 0x67,
+	0x68, 0x6A, 0x6B, 0x6D, 0x6F, 0x6F, 0x70, 0x72, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C,
+	0x7D, 0x7F, 0x7F, 0x80, 0x83, 0x84, 0x86, 0x87, 0x88, 0x4A, 0x4B, 0x4D, 0x4F, 0x50, 0x52, 0x55,
+	0x56, 0x58, 0x59, 0x5B, 0x5D, 0x5E, 0x60, 0x62, 0x63, 0x66, 0x67, 0x69, 0x6A, 0x6C, 0x6D, 0x6F,
+	0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x78, 0x7A, 0x7A, 0x7C, 0x7D, 0x7E, 0x7F, 0x81, 0x82, 0x83,
+	0x84, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x4E, 0x4F, 0x51, 0x52, 0x54, 0x56, 0x58, 0x5A, 0x5D, 0x5E,
+	0x60, 0x62, 0x63, 0x65, 0x67, 0x68, 0x69, 0x6A, 0x6C, 0x6E, 0x6F, 0x71, 0x72, 0x74, 0x75, 0x76,
+	0x77, 0x79, 0x7B, 0x7C, 0x7D, 0x7D, 0x80, 0x80, 0x81, 0x83, 0x84, 0x86, 0x87, 0x88, 0x8A, 0x8B,
+	0x8C, 0x8E, 0x8E, 0x53, 0x54, 0x55, 0x57, 0x59, 0x5B, 0x5D, 0x5E, 0x60, 0x62, 0x64, 0x65, 0x67,
+	0x68, 0x6A, 0x6C, 0x6E, 0x6F, 0x71, 0x72, 0x74, 0x75, 0x77, 0x78, 0x79, 0x7A, 0x7C, 0x7E, 0x7F,
+	0x81, 0x81, 0x82, 0x85, 0x85, 0x85, 0x87, 0x88, 0x8A, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x92, 0x93,
+	0x57, 0x58, 0x59, 0x5B, 0x5E, 0x60, 0x61, 0x62, 0x65, 0x67, 0x68, 0x6A, 0x6B, 0x6D, 0x6F, 0x70,
+	0x72, 0x73, 0x75, 0x76, 0x77, 0x79, 0x7A, 0x7B, 0x7D, 0x7E, 0x80, 0x81, 0x81, 0x83, 0x85, 0x87,
+	0x87, 0x88, 0x89, 0x8A, 0x8C, 0x8E, 0x8F, 0x8F, 0x91, 0x92, 0x94, 0x95, 0x95, 0x5B, 0x5B, 0x5D,
+	0x5F, 0x61, 0x63, 0x65, 0x66, 0x69, 0x6A, 0x6C, 0x6D, 0x6F, 0x70, 0x72, 0x73, 0x75, 0x76, 0x78,
+	0x79, 0x7A, 0x7B, 0x7D, 0x7E, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x89, 0x8C, 0x8C, 0x8D,
+	0x8E, 0x8F, 0x91, 0x93, 0x94, 0x96, 0x97, 0x99, 0x9A, 0x9A, 0x60, 0x60, 0x62, 0x64, 0x66, 0x68,
+	0x6A, 0x6B, 0x6E, 0x6F, 0x71, 0x72, 0x73, 0x75, 0x77, 0x78, 0x79, 0x7A, 0x7C, 0x7D, 0x7E, 0x80,
+	0x81, 0x82, 0x84, 0x86, 0x87, 0x89, 0x8A, 0x8A, 0x8B, 0x8C, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94,
+	0x97, 0x99, 0x99, 0x9A, 0x9C, 0x9D, 0x9E, 0x64, 0x65, 0x66, 0x68, 0x6A, 0x6C, 0x6E, 0x6F, 0x71,
+	0x73, 0x74, 0x76, 0x77, 0x79, 0x7B, 0x7C, 0x7D, 0x7E, 0x80, 0x81, 0x82, 0x83, 0x85, 0x86, 0x88,
+	0x89, 0x8A, 0x8C, 0x8D, 0x8F, 0x90, 0x90, 0x91, 0x93, 0x95, 0x95, 0x96, 0x97, 0x9A, 0x9C, 0x9C,
+	0x9E, 0x9F, 0xA1, 0xA1, 0x68, 0x68, 0x6A, 0x6C, 0x6E, 0x70, 0x71, 0x72, 0x74, 0x76, 0x77, 0x79,
+	0x7A, 0x7C, 0x7E, 0x7F, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x89, 0x8A, 0x8C, 0x8C, 0x8D, 0x8E,
+	0x90, 0x92, 0x94, 0x94, 0x95, 0x97, 0x99, 0x9A, 0x9A, 0x9B, 0x9C, 0x9E, 0xA0, 0xA2, 0xA4, 0xA5,
+	0xA6, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x74, 0x75, 0x76, 0x78, 0x79, 0x7B, 0x7D, 0x7E, 0x80, 0x81,
+	0x83, 0x84, 0x86, 0x87, 0x88, 0x8A, 0x8B, 0x8C, 0x8E, 0x90, 0x8F, 0x90, 0x91, 0x93, 0x95, 0x96,
+	0x97, 0x9A, 0x9A, 0x9C, 0x9D, 0x9F, 0xA0, 0xA1, 0xA1, 0xA4, 0xA5, 0xA7, 0xA8, 0xA9, 0x71, 0x72,
+	0x73, 0x75, 0x77, 0x79, 0x7A, 0x7B, 0x7D, 0x7E, 0x80, 0x81, 0x83, 0x84, 0x86, 0x87, 0x89, 0x8A,
+	0x8B, 0x8D, 0x8E, 0x8F, 0x91, 0x92, 0x93, 0x94, 0x94, 0x96, 0x98, 0x99, 0x98, 0x97, 0x97, 0x97,
+	0x97, 0x9A, 0x9F, 0xA3, 0xA6, 0xA7, 0xA7, 0xA9, 0xAB, 0xAC, 0xAC, 0x75, 0x75, 0x77, 0x79, 0x7A,
+	0x7C, 0x7E, 0x7E, 0x80, 0x82, 0x83, 0x85, 0x86, 0x88, 0x8A, 0x8B, 0x8B, 0x8D, 0x8E, 0x90, 0x91,
+	0x92, 0x93, 0x95, 0x96, 0x96, 0x98, 0x9A, 0x9C, 0x9B, 0x99, 0x97, 0x91, 0x8F, 0x8F, 0x94, 0x9C,
+	0xA4, 0xA9, 0xAA, 0xAC, 0xAD, 0xAF, 0xB1, 0xB1, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x80, 0x82, 0x83,
+	0x86, 0x87, 0x88, 0x89, 0x8B, 0x8C, 0x8E, 0x8F, 0x90, 0x92, 0x93, 0x95, 0x96, 0x97, 0x98, 0x9A,
+	0x9B, 0x9C, 0x9C, 0x9E, 0x9F, 0x9D, 0x94, 0x8C, 0x84, 0x7E, 0x7D, 0x85, 0x93, 0xA0, 0xAA, 0xAE,
+	0xB0, 0xB2, 0xB4, 0xB5, 0xB6, 0x7D, 0x7E, 0x7F, 0x81, 0x82, 0x84, 0x86, 0x87, 0x89, 0x8A, 0x8B,
+	0x8C, 0x8E, 0x8F, 0x91, 0x92, 0x93, 0x94, 0x96, 0x97, 0x98, 0x9A, 0x9B, 0x9C, 0x9E, 0x9E, 0x9F,
+	0xA0, 0xA0, 0x9A, 0x8E, 0x83, 0x75, 0x71, 0x70, 0x78, 0x86, 0x97, 0xA6, 0xB0, 0xB4, 0xB6, 0xB8,
+	0xBA, 0xBA, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x8A, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x92, 0x93,
+	0x95, 0x96, 0x97, 0x99, 0x9A, 0x9B, 0x9C, 0x9E, 0x9F, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA3, 0x99,
+	0x88, 0x79, 0x6E, 0x6B, 0x6A, 0x6F, 0x7C, 0x8F, 0xA3, 0xB2, 0xB7, 0xB9, 0xBB, 0xBD, 0xBE, 0x85,
+	0x87, 0x88, 0x89, 0x8A, 0x8C, 0x8E, 0x8F, 0x91, 0x92, 0x93, 0x94, 0x96, 0x97, 0x99, 0x9A, 0x9B,
+	0x9C, 0x9E, 0x9F, 0xA0, 0xA2, 0xA3, 0xA4, 0xA6, 0xA6, 0xA8, 0xA9, 0xA7, 0x9D, 0x8A, 0x7A, 0x72,
+	0x6E, 0x6C, 0x71, 0x7E, 0x92, 0xA7, 0xB6, 0xBB, 0xBD, 0xBF, 0xC1, 0xC2, 0x89, 0x8A, 0x8B, 0x8C,
+	0x8D, 0x8F, 0x91, 0x92, 0x95, 0x95, 0x96, 0x97, 0x99, 0x9B, 0x9C, 0x9D, 0x9E, 0xA0, 0xA1, 0xA3,
+	0xA4, 0xA5, 0xA6, 0xA8, 0xA9, 0xAA, 0xAB, 0xAD, 0xAC, 0xA5, 0x96, 0x88, 0x79, 0x75, 0x74, 0x7C,
+	0x8C, 0x9F, 0xB2, 0xBE, 0xC0, 0xC2, 0xC5, 0xC6, 0xC7, 0x8C, 0x8D, 0x8F, 0x90, 0x91, 0x93, 0x95,
+	0x96, 0x99, 0x99, 0x9A, 0x9B, 0x9D, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA5, 0xA6, 0xA7, 0xA9, 0xAA,
+	0xAB, 0xAD, 0xAE, 0xAF, 0xB1, 0xB2, 0xAF, 0xA6, 0x9D, 0x8E, 0x8A, 0x8A, 0x92, 0xA1, 0xAF, 0xBC,
+	0xC3, 0xC5, 0xC6, 0xC9, 0xCA, 0xCB, 0x91, 0x92, 0x93, 0x95, 0x96, 0x97, 0x99, 0x9B, 0x9D, 0x9D,
+	0x9E, 0xA0, 0xA1, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA9, 0xAA, 0xAB, 0xAD, 0xAE, 0xAF, 0xB0, 0xB2,
+	0xB3, 0xB5, 0xB7, 0xB8, 0xB4, 0xAF, 0xAA, 0xA7, 0xA7, 0xAD, 0xB6, 0xBE, 0xC4, 0xC7, 0xC9, 0xCA,
+	0xCC, 0xCE, 0xCE, 0x94, 0x96, 0x97, 0x98, 0x99, 0x9B, 0x9D, 0x9E, 0xA0, 0xA0, 0xA1, 0xA2, 0xA4,
+	0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAC, 0xAD, 0xAE, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA,
+	0xBC, 0xBC, 0xB9, 0xBB, 0xB8, 0xB9, 0xBE, 0xC3, 0xC7, 0xCA, 0xCC, 0xCD, 0xCF, 0xD1, 0xD2, 0xD3,
+	0x99, 0x99, 0x9B, 0x9C, 0x9E, 0x9F, 0xA1, 0xA1, 0xA3, 0xA5, 0xA6, 0xA6, 0xA7, 0xAA, 0xAB, 0xAC,
+	0xAF, 0xAF, 0xB0, 0xB1, 0xB2, 0xB4, 0xB6, 0xB8, 0xB8, 0xB9, 0xBB, 0xBC, 0xBD, 0xBF, 0xC1, 0xC2,
+	0xC4, 0xC5, 0xC6, 0xC7, 0xC9, 0xCB, 0xCE, 0xD0, 0xD1, 0xD2, 0xD5, 0xD7, 0xD7, 0x9C, 0x9D, 0x9E,
+	0x9F, 0xA1, 0xA3, 0xA4, 0xA4, 0xA6, 0xA8, 0xAA, 0xAA, 0xAA, 0xAD, 0xAF, 0xAF, 0xB1, 0xB2, 0xB3,
+	0xB4, 0xB5, 0xB7, 0xB9, 0xBB, 0xBB, 0xBC, 0xBE, 0xBF, 0xC1, 0xC2, 0xC4, 0xC5, 0xC7, 0xC8, 0xC9,
+	0xCB, 0xCC, 0xCF, 0xD1, 0xD3, 0xD4, 0xD6, 0xD8, 0xDA, 0xDB, 0xA1, 0xA1, 0xA3, 0xA4, 0xA6, 0xA7,
+	0xA8, 0xA9, 0xAB, 0xAD, 0xAF, 0xAF, 0xAF, 0xB2, 0xB3, 0xB3, 0xB5, 0xB6, 0xB7, 0xB9, 0xBA, 0xBB,
+	0xBD, 0xBE, 0xC0, 0xC1, 0xC3, 0xC4, 0xC5, 0xC7, 0xC8, 0xCA, 0xCB, 0xCD, 0xCE, 0xD0, 0xD2, 0xD4,
+	0xD6, 0xD7, 0xD9, 0xDB, 0xDD, 0xDF, 0xDF, 0xA5, 0xA5, 0xA6, 0xA8, 0xA9, 0xAB, 0xAC, 0xAD, 0xAF,
+	0xB1, 0xB3, 0xB3, 0xB4, 0xB6, 0xB7, 0xB7, 0xB8, 0xB9, 0xBB, 0xBC, 0xBD, 0xBF, 0xC0, 0xC2, 0xC4,
+	0xC5, 0xC6, 0xC8, 0xC9, 0xCB, 0xCC, 0xCD, 0xCF, 0xD1, 0xD2, 0xD4, 0xD6, 0xD8, 0xDA, 0xDB, 0xDD,
+	0xDF, 0xE1, 0xE3, 0xE3, 0xA7, 0xA7, 0xA8, 0xAA, 0xAB, 0xAD, 0xAE, 0xAE, 0xB1, 0xB3, 0xB5, 0xB5,
+	0xB6, 0xB8, 0xB9, 0xB9, 0xBA, 0xBB, 0xBD, 0xBE, 0xBF, 0xC0, 0xC2, 0xC3, 0xC5, 0xC7, 0xC8, 0xCA,
+	0xCB, 0xCC, 0xCE, 0xCF, 0xD1, 0xD3, 0xD5, 0xD7, 0xD8, 0xDA, 0xDC, 0xDD, 0xE0, 0xE1, 0xE4, 0xE5,
+	0xE6,
+};
+
+/* 160x96, 4:2:0, no DHT, a typical MJPEG frame */
+static const uint8_t bench_420[2906] =
+{
+	0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+	0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x05, 0x03, 0x04, 0x04, 0x04, 0x03, 0x05,
+	0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x0C, 0x08, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0B,
+	0x0B, 0x09, 0x0C, 0x11, 0x0F, 0x12, 0x12, 0x11, 0x0F, 0x11, 0x11, 0x13, 0x16, 0x1C, 0x17, 0x13,
+	0x14, 0x1A, 0x15, 0x11, 0x11, 0x18, 0x21, 0x18, 0x1A, 0x1D, 0x1D, 0x1F, 0x1F, 0x1F, 0x13, 0x17,
+	0x22, 0x24, 0x22, 0x1E, 0x24, 0x1C, 0x1E, 0x1F, 0x1E, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x05, 0x05,
+	0x05, 0x07, 0x06, 0x07, 0x0E, 0x08, 0x08, 0x0E, 0x1E, 0x14, 0x11, 0x14, 0x1E, 0x1E, 0x1E, 0x1E,
+	0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+	0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+	0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0xFF, 0xC0,
+	0x00, 0x11, 0x08, 0x00, 0x60, 0x00, 0xA0, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+	0x01, 0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xF9,
+	0x62, 0x3B, 0x7F, 0x6A, 0xB5, 0x15, 0xBF, 0xB5, 0x5E, 0x8A, 0xDB, 0xDA, 0xB5, 0xB4, 0x7D, 0x1E,
+	0x7B, 0xEB, 0x98, 0xE2, 0x8A, 0x26, 0x3B, 0x98, 0x02, 0x40, 0xAF, 0xDA, 0x71, 0x38, 0xB8, 0xD1,
+	0x89, 0xF3, 0x35, 0x31, 0xAA, 0x2A, 0xE5, 0xAD, 0x3F, 0xC2, 0x4F, 0x3F, 0x87, 0x24, 0xD4, 0xB3,
+	0x86, 0x5E, 0x40, 0xF6, 0xAA, 0x3A, 0x36, 0x91, 0xF6, 0x87, 0xDF, 0x20, 0xC2, 0x03, 0x5E, 0xCF,
+	0x06, 0x92, 0x96, 0x5E, 0x1D, 0x36, 0x4C, 0xBC, 0x08, 0xF9, 0xFC, 0xAB, 0x81, 0x82, 0x05, 0x83,
+	0x72, 0x2F, 0x03, 0x71, 0xAF, 0x9A, 0xAF, 0x9B, 0xA9, 0x3B, 0x23, 0xD2, 0xCA, 0x71, 0x4A, 0xAC,
+	0x8C, 0x3D, 0x5B, 0x45, 0x45, 0x8B, 0xCC, 0x80, 0x74, 0xEA, 0x2B, 0x08, 0xC3, 0x83, 0x82, 0x2B,
+	0xBC, 0x95, 0x77, 0x46, 0xCB, 0xEA, 0x2B, 0x96, 0xB9, 0x83, 0x6C, 0xEE, 0x31, 0xDE, 0xBC, 0xEA,
+	0xB9, 0x92, 0xB6, 0xA7, 0xD7, 0xAA, 0xB1, 0x82, 0xD4, 0xCC, 0x11, 0x7B, 0x53, 0xD6, 0x1F, 0x6A,
+	0xBC, 0xB0, 0xFB, 0x54, 0xD0, 0xDB, 0x33, 0xB8, 0x50, 0x32, 0x49, 0xC0, 0xAF, 0x1E, 0xB6, 0x36,
+	0x33, 0x7B, 0x9D, 0x54, 0x31, 0xD0, 0xEE, 0x67, 0xA4, 0x1E, 0xD5, 0x62, 0x3B, 0x73, 0xE9, 0x5E,
+	0x93, 0xE1, 0x9F, 0x87, 0x33, 0x5E, 0x40, 0x97, 0x17, 0x6F, 0xE5, 0xA3, 0x73, 0x8A, 0xDC, 0xD5,
+	0x3E, 0x1E, 0x5A, 0x5B, 0xE9, 0xD2, 0x3D, 0xA6, 0xE7, 0x98, 0x0E, 0x01, 0xAD, 0x30, 0xF6, 0x93,
+	0x3A, 0xA7, 0x98, 0xC5, 0x47, 0x73, 0xC9, 0x61, 0xB5, 0xF5, 0xAB, 0x09, 0x10, 0x15, 0x6A, 0xEE,
+	0xD6, 0x6B, 0x59, 0x9A, 0x39, 0xA3, 0x64, 0x60, 0x71, 0xC8, 0xA8, 0x6B, 0xE8, 0xB0, 0xF0, 0x49,
+	0x1E, 0x2D, 0x7C, 0xC5, 0xB7, 0xA0, 0x0E, 0x3A, 0x55, 0x8B, 0x4B, 0x8F, 0x26, 0x50, 0xCC, 0xBB,
+	0xC0, 0xEC, 0x6A, 0xBD, 0x15, 0xD9, 0xCE, 0xA2, 0x72, 0x2C, 0x7C, 0xAE, 0x75, 0x1A, 0x5E, 0xB7,
+	0xA5, 0x2E, 0x16, 0xEE, 0xC4, 0x1C, 0x9E, 0x48, 0xAE, 0xBB, 0x4A, 0xD0, 0xBC, 0x3D, 0xAD, 0x5B,
+	0xB4, 0xD6, 0x77, 0x1B, 0x1B, 0x1C, 0xA9, 0x3D, 0x2B, 0xCA, 0x7A, 0xD6, 0xCF, 0x87, 0x9A, 0xF6,
+	0x19, 0x4B, 0x42, 0xEE, 0x8A, 0x7A, 0xE0, 0xD7, 0x0E, 0x27, 0x10, 0x92, 0x3E, 0x9B, 0x28, 0xC4,
+	0xCE, 0x72, 0x46, 0xD6, 0xBF, 0xA4, 0xA6, 0x9D, 0x78, 0x61, 0x49, 0x44, 0x83, 0xD4, 0x1A, 0xCE,
+	0xF2, 0xBD, 0xAB, 0x42, 0x45, 0x79, 0x1B, 0x73, 0xB1, 0x27, 0xD4, 0xD2, 0x08, 0xBD, 0xAB, 0xE5,
+	0xF1, 0xB8, 0xD4, 0x7E, 0xA9, 0x97, 0x54, 0xF7, 0x55, 0xCA, 0x22, 0x2F, 0x6A, 0x7A, 0xC3, 0xED,
+	0x57, 0x96, 0x1F, 0x6A, 0x95, 0x20, 0xF6, 0xAF, 0x9C, 0xAD, 0x88, 0xE6, 0x67, 0xD1, 0xD2, 0xAC,
+	0x92, 0x3C, 0xEA, 0xC2, 0xD5, 0x1E, 0xE6, 0x35, 0x7E, 0x14, 0xB0, 0x06, 0xBE, 0x89, 0xF0, 0x7E,
+	0x8B, 0xA4, 0x5A, 0xE9, 0x50, 0x35, 0xAC, 0x31, 0x31, 0x2A, 0x09, 0x6C, 0x73, 0x9A, 0xF0, 0x35,
+	0x87, 0x1D, 0x2B, 0x77, 0x49, 0xF1, 0x1E, 0xAF, 0xA6, 0xC5, 0xE5, 0xDB, 0xDC, 0x36, 0xC1, 0xD8,
+	0xD7, 0xEA, 0x19, 0xBD, 0x47, 0x25, 0xA1, 0xFC, 0x1F, 0x5A, 0x52, 0x9E, 0xC7, 0xB5, 0xF8, 0x96,
+	0x0B, 0x6F, 0xEC, 0xA9, 0x99, 0x82, 0xA9, 0x0A, 0x70, 0x6B, 0xC3, 0x9C, 0x83, 0x2C, 0x98, 0xFE,
+	0xF1, 0xAE, 0x9A, 0xE3, 0xC5, 0x73, 0x5F, 0x68, 0x72, 0x25, 0xCC, 0x87, 0xCD, 0x23, 0x18, 0xF5,
+	0xAE, 0x42, 0xDD, 0xC8, 0x63, 0x9E, 0xE6, 0xBE, 0x35, 0xC9, 0xC5, 0xEA, 0x7B, 0xD9, 0x24, 0x9D,
+	0x37, 0xA9, 0x69, 0x54, 0xB3, 0x05, 0x1D, 0x4D, 0x3C, 0x78, 0x52, 0xE2, 0x59, 0x3C, 0xC2, 0xC0,
+	0x2B, 0x73, 0x4D, 0xB6, 0x9D, 0x22, 0xB8, 0x56, 0x61, 0xB9, 0x41, 0xAE, 0x8E, 0x1D, 0x76, 0xD8,
+	0xED, 0x5D, 0xA4, 0x0A, 0xF2, 0x31, 0xB8, 0x99, 0xAD, 0x8F, 0x67, 0x30, 0xC6, 0xCE, 0xDE, 0xE9,
+	0x92, 0xBE, 0x0E, 0x03, 0xFE, 0x5B, 0x53, 0xD7, 0xC2, 0xBE, 0x51, 0x0E, 0xB2, 0xF2, 0xBC, 0xD6,
+	0xE8, 0xD5, 0x6D, 0x4F, 0x21, 0xAA, 0x68, 0x6F, 0x21, 0x97, 0xEE, 0x9C, 0xD7, 0x8F, 0x0A, 0xF5,
+	0x79, 0x8F, 0x1A, 0x8E, 0x36, 0xBF, 0x31, 0xA5, 0xA0, 0x6B, 0x77, 0x16, 0xB0, 0x25, 0xB4, 0xCB,
+	0xBC, 0x2F, 0x19, 0xAE, 0x86, 0x0D, 0x62, 0xDA, 0x56, 0x08, 0x41, 0x04, 0xD7, 0x16, 0xF7, 0x71,
+	0x21, 0xC0, 0x1C, 0xD3, 0xA1, 0xBE, 0x02, 0x45, 0x65, 0x53, 0xC1, 0xAF, 0xA3, 0xCB, 0xEA, 0x54,
+	0x6D, 0x1E, 0x8A, 0xC5, 0xD6, 0x91, 0xD5, 0xF8, 0x83, 0x45, 0xD2, 0x6E, 0x2D, 0xBE, 0xD1, 0x79,
+	0x02, 0xE3, 0xFB, 0xC0, 0x57, 0x09, 0xAB, 0x78, 0x7F, 0x40, 0xD8, 0xCF, 0x6F, 0x33, 0x02, 0x7B,
+	0x7A, 0x57, 0x73, 0xAF, 0xDF, 0xC7, 0x36, 0x81, 0x1A, 0xA9, 0x05, 0x9C, 0x72, 0x2B, 0xCB, 0x7C,
+	0x6B, 0x7E, 0x74, 0xDD, 0x34, 0x84, 0x38, 0x77, 0xE0, 0x57, 0xD8, 0x53, 0xAC, 0xE1, 0x0D, 0x4F,
+	0x4E, 0x84, 0x9B, 0x8D, 0xE4, 0x64, 0x6A, 0x69, 0xA5, 0xDA, 0x4F, 0xE5, 0x7D, 0xB3, 0x27, 0xBD,
+	0x4F, 0x6D, 0xA7, 0x41, 0x2A, 0x2C, 0x8B, 0x26, 0xE4, 0x35, 0xC0, 0xC4, 0xED, 0x3D, 0xDA, 0x99,
+	0x18, 0xB1, 0x66, 0xEE, 0x6B, 0xD3, 0x34, 0xF4, 0x58, 0xEC, 0xE3, 0x55, 0xE0, 0x6D, 0x15, 0xE3,
+	0xE3, 0x33, 0x37, 0x06, 0x65, 0xED, 0x57, 0x3D, 0x8B, 0x36, 0x9A, 0x45, 0xB0, 0x50, 0xD8, 0xDD,
+	0x5A, 0x11, 0xDB, 0x2A, 0x0C, 0x2A, 0x80, 0x29, 0x74, 0x90, 0x58, 0x30, 0xED, 0x5A, 0x1E, 0x4F,
+	0xB5, 0x78, 0xD5, 0xB3, 0x57, 0x25, 0xB9, 0xFA, 0x16, 0x43, 0x18, 0xB4, 0x99, 0x47, 0xC9, 0xF6,
+	0xA7, 0x2C, 0x1E, 0xD5, 0x7D, 0x61, 0xF6, 0xA9, 0x52, 0xDF, 0xDA, 0xBC, 0x2A, 0xF8, 0xB7, 0x36,
+	0x7E, 0x81, 0x87, 0xAC, 0xA2, 0x8A, 0x29, 0x07, 0xB5, 0x58, 0x8A, 0xDF, 0xDA, 0xAF, 0x47, 0x6F,
+	0xED, 0x5B, 0x1A, 0x56, 0x92, 0xB7, 0x3F, 0x7A, 0x45, 0x5F, 0xAD, 0x45, 0x34, 0xE6, 0x76, 0x4B,
+	0x1D, 0xC8, 0x8F, 0x1B, 0x10, 0xFB, 0x52, 0xF9, 0x3E, 0xD5, 0x7B, 0xCA, 0xF6, 0xA0, 0x43, 0xED,
+	0x5F, 0xA0, 0xE3, 0x33, 0x04, 0xD1, 0xFC, 0x5D, 0x4A, 0xAA, 0x65, 0x11, 0x17, 0x14, 0xE5, 0x87,
+	0xDA, 0xAF, 0xAC, 0x3E, 0xD5, 0x22, 0x41, 0xED, 0x5F, 0x37, 0x5A, 0xBB, 0x93, 0xD0, 0xF6, 0xB0,
+	0xD5, 0x79, 0x76, 0x28, 0xA4, 0x06, 0xAC, 0x45, 0x6F, 0xED, 0x57, 0xA2, 0xB7, 0xF6, 0xAB, 0x51,
+	0x5B, 0x7B, 0x56, 0x31, 0xA0, 0xEA, 0x3D, 0x4F, 0x45, 0x54, 0x53, 0xDC, 0xA3, 0x15, 0xB7, 0xB5,
+	0x69, 0x58, 0xC5, 0xE5, 0x83, 0xC7, 0x5A, 0xB1, 0x0D, 0xB7, 0x4E, 0x2A, 0xE4, 0x56, 0xDD, 0x38,
+	0xAE, 0xFA, 0x39, 0x74, 0x5E, 0xE8, 0xE9, 0xA3, 0x1A, 0x68, 0xA6, 0x20, 0xDC, 0xD9, 0xC5, 0x4F,
+	0x1D, 0xBF, 0xB5, 0x5F, 0x8E, 0xDF, 0xDA, 0xA7, 0x48, 0x3D, 0xAB, 0xDA, 0xA1, 0x87, 0x85, 0x24,
+	0x7A, 0x10, 0x8C, 0x19, 0x48, 0x46, 0xC5, 0x40, 0x24, 0x90, 0x2B, 0x80, 0xF8, 0xB5, 0x03, 0xAC,
+	0x70, 0x38, 0x53, 0xB7, 0xD6, 0xBD, 0x40, 0x43, 0xED, 0x59, 0x1E, 0x2D, 0xD0, 0xD3, 0x57, 0xD2,
+	0xDE, 0x1D, 0xBF, 0x38, 0x19, 0x5A, 0x9C, 0x4E, 0x25, 0x45, 0x58, 0xEB, 0xE5, 0x5C, 0xBA, 0x1E,
+	0x05, 0x13, 0xF9, 0x72, 0x2B, 0xFA, 0x1A, 0xF4, 0x9D, 0x06, 0xF1, 0x2E, 0xEC, 0xA3, 0x2A, 0xC3,
+	0x70, 0x18, 0x22, 0xB8, 0x8D, 0x53, 0x41, 0xD4, 0x6C, 0x2E, 0x9A, 0x09, 0x2D, 0x9C, 0x90, 0x78,
+	0xC0, 0xAE, 0xD7, 0xE1, 0xBF, 0x86, 0x2F, 0x8D, 0xC2, 0xDD, 0x5D, 0xAB, 0xC7, 0x0F, 0x50, 0xA7,
+	0xBD, 0x7C, 0xA6, 0x3E, 0xBA, 0x66, 0x14, 0xB0, 0x8E, 0x53, 0xB9, 0xD9, 0x68, 0xB6, 0x8C, 0xB0,
+	0xEF, 0x61, 0x82, 0x6B, 0x4D, 0x60, 0xF6, 0xAB, 0xB1, 0xDB, 0x85, 0x50, 0x00, 0xE0, 0x54, 0xC9,
+	0x07, 0xB5, 0x7C, 0xE4, 0xEB, 0xB6, 0xEC, 0x7D, 0xDE, 0x59, 0xFB, 0x98, 0xA2, 0x8A, 0x5B, 0xFB,
+	0x55, 0x88, 0xAD, 0x8F, 0xA5, 0x5E, 0x8E, 0x00, 0x3A, 0xD5, 0x88, 0x91, 0x4B, 0x00, 0x07, 0x26,
+	0xAE, 0x09, 0xDA, 0xEC, 0xF6, 0xD6, 0x60, 0xA0, 0x54, 0x8A, 0xDB, 0xA7, 0x02, 0xAE, 0xC1, 0x03,
+	0x2F, 0xDD, 0x38, 0xAD, 0x7B, 0x4D, 0x1A, 0xE6, 0x41, 0x91, 0x19, 0x02, 0xAF, 0x47, 0xA2, 0x5C,
+	0x8F, 0xE0, 0xAE, 0x8A, 0x78, 0x98, 0xC3, 0x41, 0x4B, 0x35, 0x83, 0xDD, 0x9E, 0x0A, 0x22, 0xA7,
+	0xAC, 0x3E, 0xD5, 0x79, 0x61, 0xF6, 0xA9, 0x04, 0x38, 0x5C, 0x91, 0x5E, 0xBA, 0xC4, 0x3A, 0xAE,
+	0xC7, 0xF2, 0x9E, 0x15, 0xCA, 0x6F, 0x42, 0x8A, 0x41, 0xED, 0x44, 0x92, 0xDA, 0xC1, 0xFE, 0xB6,
+	0x54, 0x5F, 0xC6, 0xB9, 0xEF, 0x12, 0xF8, 0x94, 0xC3, 0x23, 0xDA, 0xDA, 0x0F, 0x98, 0x70, 0x5A,
+	0xB9, 0x0B, 0x9B, 0xBB, 0x9B, 0x86, 0x2D, 0x24, 0x8E, 0x49, 0xAF, 0xA2, 0xC0, 0x65, 0xAA, 0xA6,
+	0xAC, 0xFA, 0xBC, 0x2E, 0x0E, 0x6D, 0x5E, 0xC7, 0xA4, 0x36, 0xBB, 0xA5, 0x44, 0xFB, 0x5A, 0x60,
+	0x4F, 0xB5, 0x59, 0xB4, 0xF1, 0x0E, 0x91, 0x24, 0x81, 0x04, 0xE0, 0x67, 0xD6, 0xBC, 0x9C, 0xE4,
+	0xF2, 0x73, 0x48, 0x09, 0x07, 0x20, 0x91, 0x5F, 0x4D, 0x43, 0x28, 0xA7, 0x63, 0xD1, 0x58, 0x59,
+	0x44, 0xF7, 0x7B, 0x0B, 0x8B, 0x2B, 0x9F, 0xF5, 0x33, 0xA3, 0x7E, 0x35, 0xA9, 0x15, 0xB8, 0xC0,
+	0xE2, 0xBE, 0x7E, 0xB3, 0xD4, 0x2E, 0xED, 0x24, 0x0F, 0x0C, 0xCE, 0xA4, 0x1F, 0x5A, 0xF4, 0x8F,
+	0x02, 0x78, 0xE0, 0xCF, 0x34, 0x76, 0x3A, 0x87, 0x2C, 0xDC, 0x07, 0xAD, 0x2B, 0x65, 0xCA, 0x9C,
+	0x6E, 0x89, 0x77, 0x89, 0xE8, 0x09, 0x07, 0xB5, 0x4A, 0x21, 0xF6, 0xAB, 0xB1, 0xC6, 0x19, 0x43,
+	0x0E, 0x41, 0x19, 0xA7, 0x88, 0xBD, 0xAB, 0xE6, 0xF1, 0x55, 0x9C, 0x1D, 0x8E, 0x9A, 0x15, 0x1B,
+	0x65, 0x0F, 0x2B, 0xDA, 0x97, 0xCA, 0xAB, 0x92, 0x85, 0x8E, 0x32, 0xEF, 0xC0, 0x15, 0x15, 0xB4,
+	0xF0, 0x4D, 0x11, 0x91, 0x1C, 0x15, 0x15, 0xF3, 0xB8, 0xAA, 0x93, 0x96, 0xC7, 0xD0, 0xE1, 0x29,
+	0x39, 0x94, 0xE4, 0xB0, 0xB7, 0x95, 0xB7, 0x49, 0x0A, 0x31, 0xF5, 0x22, 0xA7, 0x8A, 0xD9, 0x51,
+	0x42, 0xA2, 0x85, 0x03, 0xB0, 0x15, 0x0D, 0xC5, 0xF8, 0x56, 0xC4, 0x63, 0x38, 0xA6, 0xC5, 0xA9,
+	0x38, 0x61, 0xB9, 0x46, 0x2B, 0xC2, 0xAF, 0x4E, 0xA4, 0x8F, 0x7E, 0x86, 0x0D, 0x25, 0x72, 0xFA,
+	0x5B, 0xFB, 0x55, 0x88, 0xAD, 0xFD, 0xAA, 0x5D, 0x36, 0x48, 0xAE, 0x97, 0x28, 0x46, 0x7D, 0x2A,
+	0x5D, 0x66, 0xF6, 0xD3, 0x47, 0xD3, 0xA4, 0xBC, 0xBC, 0x90, 0x22, 0x20, 0xCF, 0x3D, 0xEB, 0x0C,
+	0x36, 0x06, 0x75, 0x27, 0x63, 0x79, 0x54, 0xF6, 0x7A, 0x19, 0xED, 0x2C, 0x6D, 0x2B, 0x46, 0x87,
+	0x94, 0xE0, 0xD3, 0xA1, 0x62, 0xB2, 0xAB, 0x7A, 0x1A, 0xF1, 0x3D, 0x53, 0xE2, 0x8D, 0xCC, 0x7A,
+	0xD4, 0xEF, 0x65, 0x12, 0xF9, 0x0C, 0xFD, 0xFD, 0x2B, 0xD2, 0x7C, 0x1B, 0xE2, 0x7B, 0x4D, 0x7A,
+	0xC5, 0x66, 0x8D, 0x80, 0x95, 0x46, 0x5D, 0x2B, 0xDE, 0xAB, 0x95, 0xCA, 0x14, 0xAF, 0x63, 0x86,
+	0xBE, 0x28, 0xF6, 0xDD, 0x2D, 0xB7, 0xD8, 0xC4, 0xE4, 0x00, 0x4A, 0xD6, 0x7F, 0x88, 0xBC, 0x49,
+	0xA6, 0x68, 0x48, 0x1E, 0xFA, 0x42, 0xB9, 0xF6, 0xAE, 0x67, 0x4C, 0xF8, 0x83, 0xA6, 0x5B, 0x42,
+	0x60, 0xBB, 0x86, 0x78, 0x84, 0x5C, 0x6E, 0x2A, 0x70, 0x6A, 0x0D, 0x4F, 0xC7, 0x3E, 0x07, 0xD5,
+	0x06, 0xCB, 0xCD, 0xB3, 0x63, 0xB1, 0x5C, 0xD7, 0xC8, 0x57, 0xA3, 0x51, 0x4C, 0xF3, 0x5D, 0x79,
+	0x49, 0xE8, 0xCE, 0x0A, 0x1B, 0x66, 0x76, 0x0A, 0xAB, 0x92, 0x6B, 0x7E, 0xD3, 0xC1, 0xD7, 0x77,
+	0xF6, 0x84, 0x33, 0x79, 0x21, 0x86, 0x33, 0x4F, 0xF0, 0xFC, 0x51, 0x26, 0xA1, 0x1B, 0x4C, 0x3E,
+	0x5C, 0xF7, 0xAF, 0x48, 0x85, 0x91, 0x90, 0x6C, 0xC6, 0x31, 0xDA, 0xBE, 0x97, 0x04, 0xF5, 0xB9,
+	0xF9, 0x67, 0x0F, 0x42, 0x95, 0x49, 0x2E, 0x63, 0xCC, 0xF4, 0xFF, 0x00, 0x83, 0xBA, 0x24, 0x72,
+	0x89, 0xAE, 0xDD, 0xA6, 0x7F, 0xE2, 0x07, 0xBD, 0x6B, 0x7F, 0xC2, 0xAD, 0xF0, 0xAF, 0xFC, 0xF9,
+	0xD7, 0x73, 0x45, 0x7D, 0x5D, 0x0C, 0x73, 0xA6, 0xB4, 0x3F, 0x57, 0xC2, 0x61, 0x68, 0xF2, 0xAB,
+	0x1E, 0x77, 0xA8, 0xFC, 0x24, 0xF0, 0xD5, 0xCC, 0x41, 0x22, 0x88, 0xC4, 0x7D, 0x45, 0x71, 0x9E,
+	0x24, 0xF8, 0x29, 0x22, 0x2B, 0x49, 0xA5, 0xDC, 0x64, 0x01, 0x90, 0xAD, 0x5E, 0xEF, 0x48, 0x70,
+	0x06, 0x49, 0xAF, 0x53, 0x0F, 0x9B, 0xB4, 0xF5, 0x63, 0xC4, 0xE1, 0xE9, 0x45, 0x1F, 0x17, 0xF8,
+	0x83, 0x44, 0xBF, 0xD1, 0x2E, 0xDA, 0xDE, 0xFA, 0x06, 0x8C, 0x83, 0x80, 0x48, 0xEB, 0x54, 0xEC,
+	0x1A, 0x45, 0xBC, 0x88, 0xC5, 0x9D, 0xFB, 0x86, 0x31, 0x5E, 0xE5, 0xFB, 0x42, 0x35, 0x85, 0xE4,
+	0x76, 0xF6, 0xD6, 0xB1, 0x89, 0x6F, 0x37, 0x7F, 0x00, 0xC9, 0xAE, 0x67, 0xE1, 0xBF, 0xC3, 0xAB,
+	0xDB, 0x8B, 0xA8, 0x75, 0x1D, 0x45, 0x3C, 0xB8, 0x94, 0xE4, 0x21, 0x1C, 0x9A, 0xF4, 0x71, 0x59,
+	0xC4, 0x3D, 0x96, 0xAC, 0xF9, 0x0C, 0x74, 0xE3, 0x17, 0xA1, 0xE9, 0x9E, 0x1E, 0x33, 0xFF, 0x00,
+	0xC2, 0x3B, 0x6F, 0x2C, 0xA8, 0x5A, 0x5F, 0x2C, 0x1C, 0x7E, 0x15, 0x83, 0x79, 0xE2, 0x5D, 0x5A,
+	0x1B, 0x87, 0x8D, 0x34, 0x89, 0x59, 0x54, 0xF0, 0x71, 0xD6, 0xBD, 0x06, 0x1B, 0x65, 0x8E, 0x35,
+	0x8D, 0x57, 0x0A, 0xA3, 0x00, 0x52, 0xFD, 0x99, 0x09, 0xE5, 0x17, 0xF2, 0xAF, 0xCE, 0x31, 0xF9,
+	0xCC, 0x3D, 0xA3, 0xD4, 0xE4, 0xC3, 0xD5, 0xF7, 0x8F, 0x16, 0xF1, 0x07, 0x8B, 0xF5, 0xC7, 0x0F,
+	0x09, 0xB1, 0x78, 0x90, 0x8F, 0x4A, 0xC8, 0xD3, 0xFC, 0x4B, 0xAC, 0xC5, 0x0B, 0x47, 0x14, 0x0E,
+	0xCA, 0x7A, 0xE0, 0x57, 0xBB, 0xDF, 0xE8, 0x96, 0x97, 0xB0, 0x3C, 0x6F, 0x02, 0x65, 0x87, 0x5C,
+	0x55, 0xFF, 0x00, 0x05, 0xFC, 0x3C, 0xB7, 0x10, 0x9D, 0xF0, 0x21, 0x46, 0x3C, 0xB1, 0x5A, 0xE2,
+	0xFE, 0xDA, 0xA3, 0x6D, 0x59, 0xF5, 0xF8, 0x0C, 0x4A, 0x48, 0xF9, 0xF3, 0xFE, 0x12, 0x8D, 0x64,
+	0x9C, 0x7D, 0x91, 0xB3, 0xFE, 0xED, 0x4F, 0x16, 0xBB, 0xE2, 0x09, 0x46, 0x53, 0x4F, 0x95, 0x87,
+	0xB2, 0x1A, 0xFA, 0xC2, 0xCB, 0xE1, 0xF7, 0x86, 0xED, 0xDC, 0x48, 0xD6, 0x31, 0xBB, 0x0E, 0xB9,
+	0x5A, 0xD3, 0x8F, 0x45, 0xD0, 0x2C, 0xD7, 0x62, 0xD9, 0x5A, 0x20, 0x3E, 0xAA, 0x2B, 0x9E, 0xA6,
+	0x6F, 0x49, 0xEC, 0x7D, 0x05, 0x3C, 0x43, 0x6B, 0x43, 0xE6, 0x1F, 0x0F, 0xEA, 0xFE, 0x24, 0x86,
+	0x45, 0x95, 0x74, 0x5B, 0x87, 0xE3, 0x91, 0xB4, 0xD6, 0x37, 0xC7, 0x5D, 0x7F, 0x53, 0xB8, 0xD0,
+	0xED, 0x6D, 0xEE, 0x2C, 0xE4, 0xB4, 0xF3, 0x0E, 0x58, 0x1E, 0x2B, 0xEB, 0x97, 0x97, 0x44, 0xB4,
+	0x00, 0x11, 0x6C, 0x80, 0xFA, 0x01, 0x5E, 0x29, 0xFB, 0x52, 0xE9, 0x16, 0x1A, 0xE7, 0x86, 0xA2,
+	0xB8, 0xD3, 0x16, 0x39, 0x2E, 0x62, 0x39, 0xC2, 0x7A, 0x57, 0x76, 0x59, 0x98, 0xD2, 0x75, 0x15,
+	0xCC, 0xEA, 0xC2, 0x73, 0x3E, 0x42, 0xAE, 0xD3, 0xE1, 0x36, 0xAB, 0x36, 0x9F, 0xE2, 0x15, 0x09,
+	0xCA, 0xB8, 0xE4, 0x1A, 0xE3, 0xE6, 0x86, 0x48, 0xA5, 0x31, 0xBA, 0x15, 0x60, 0x70, 0x41, 0x15,
+	0xDE, 0x7C, 0x31, 0xD0, 0x6E, 0x4D, 0xD7, 0xDB, 0xE5, 0x85, 0x82, 0x01, 0xF2, 0x92, 0x2B, 0xEB,
+	0x31, 0xB8, 0xDA, 0x32, 0xA5, 0x64, 0x78, 0xB8, 0xBA, 0x73, 0x8A, 0x3E, 0x95, 0xF0, 0x76, 0xB5,
+	0xA2, 0xEB, 0x29, 0xFD, 0x9B, 0xAB, 0x58, 0xDB, 0xEE, 0x6E, 0x03, 0x15, 0x1C, 0xD7, 0x47, 0x1F,
+	0xC3, 0x6F, 0x0B, 0xC6, 0xEF, 0x3C, 0x3A, 0x7C, 0x64, 0xBF, 0x38, 0x23, 0x8A, 0xF0, 0xC9, 0xAF,
+	0x9F, 0x4C, 0x74, 0x9D, 0x41, 0x0E, 0xA7, 0x22, 0xBD, 0xF3, 0xE1, 0x8F, 0x89, 0x57, 0xC4, 0x5A,
+	0x12, 0x4A, 0x46, 0xD9, 0x23, 0x1B, 0x58, 0x57, 0xCE, 0xD2, 0xC0, 0x2A, 0xCF, 0x9A, 0xC7, 0x8C,
+	0xAB, 0x4E, 0x0F, 0x53, 0xCE, 0x21, 0xB7, 0xC1, 0x1E, 0xB5, 0xB1, 0x61, 0x73, 0x73, 0x00, 0x0A,
+	0x18, 0x95, 0xF7, 0xA5, 0x8A, 0xDB, 0xDA, 0xAE, 0x45, 0x6F, 0xD3, 0x8A, 0xE3, 0xC2, 0xC6, 0xCC,
+	0xFC, 0x1B, 0x2F, 0xCE, 0xE7, 0x41, 0xE8, 0xCB, 0x50, 0xEA, 0x05, 0xB1, 0xBD, 0x2A, 0xBE, 0xA1,
+	0xAF, 0xDB, 0xD9, 0xB8, 0x59, 0x11, 0xB9, 0xA9, 0xE3, 0xB7, 0xF6, 0xAC, 0x3F, 0x19, 0x59, 0x9F,
+	0xB3, 0xAC, 0xC0, 0x74, 0xAF, 0x4D, 0xCA, 0xC8, 0xFD, 0x2F, 0x24, 0xE2, 0x79, 0xD4, 0xB2, 0x6C,
+	0xB2, 0xDE, 0x2A, 0x81, 0xD9, 0x52, 0x28, 0xC9, 0x62, 0x71, 0x5A, 0x72, 0xBC, 0x97, 0x11, 0x29,
+	0x0C, 0x50, 0x11, 0xC8, 0xAE, 0x1B, 0xC3, 0x96, 0xC6, 0xE7, 0x53, 0x8D, 0x40, 0xE0, 0x1C, 0xD7,
+	0xA2, 0xA4, 0x38, 0x50, 0x31, 0xD0, 0x56, 0x2B, 0x10, 0xD3, 0x3D, 0xFC, 0x4E, 0x6F, 0x2A, 0x8E,
+	0xC9, 0x9C, 0xA0, 0xD1, 0x74, 0x5B, 0x6D, 0x44, 0x34, 0xB1, 0xAC, 0x97, 0x0E, 0x72, 0x0B, 0xF2,
+	0x6B, 0x7A, 0x3B, 0x70, 0xAA, 0x15, 0x10, 0x01, 0xD8, 0x01, 0x5C, 0x87, 0x88, 0xEE, 0xD5, 0x7C,
+	0x57, 0x00, 0xC9, 0x01, 0x18, 0x03, 0x5E, 0x95, 0x66, 0xB1, 0xB5, 0xBC, 0x6E, 0xAA, 0x39, 0x50,
+	0x6B, 0xE7, 0xF3, 0xBC, 0xDA, 0x74, 0x60, 0xF5, 0x35, 0xA3, 0x82, 0x96, 0x22, 0x3C, 0xCC, 0xC8,
+	0x5B, 0x66, 0x27, 0x85, 0xA9, 0x16, 0xD1, 0xFF, 0x00, 0xBB, 0x5B, 0x41, 0x40, 0xE4, 0x00, 0x29,
+	0x71, 0xED, 0x5F, 0x98, 0x62, 0xB3, 0xB9, 0xCA, 0x4F, 0x53, 0xB2, 0x96, 0x53, 0x63, 0x26, 0x3B,
+	0x56, 0xC8, 0x25, 0x6B, 0xBB, 0xD0, 0xE5, 0x84, 0x58, 0x46, 0x8A, 0x42, 0x90, 0x39, 0x15, 0xCD,
+	0x71, 0x4E, 0x57, 0x65, 0xFB, 0xAC, 0x45, 0x71, 0x2C, 0xDA, 0x6D, 0xEE, 0x7A, 0xB4, 0x30, 0x9C,
+	0x87, 0x51, 0xAA, 0x09, 0xA5, 0xB0, 0x91, 0x6D, 0x1C, 0x09, 0x48, 0xF9, 0x4D, 0x79, 0x86, 0xAF,
+	0xA7, 0x78, 0x94, 0x48, 0x7C, 0xD3, 0x2B, 0x8C, 0xF1, 0x83, 0x5D, 0x5A, 0x5E, 0x4D, 0x10, 0xC8,
+	0x90, 0x80, 0x2A, 0xFE, 0x9D, 0xE2, 0x1B, 0x59, 0x9C, 0x41, 0x36, 0x37, 0x7A, 0xD7, 0xA9, 0x84,
+	0xC5, 0x4A, 0xAF, 0x53, 0xD4, 0xA7, 0x51, 0x52, 0x5A, 0x9E, 0x5B, 0x77, 0x65, 0xAB, 0x26, 0x3C,
+	0xF8, 0xE6, 0xF6, 0xCE, 0x6A, 0xAC, 0x96, 0x57, 0x52, 0x2E, 0xD7, 0x82, 0x46, 0x07, 0xB1, 0x15,
+	0xED, 0xD2, 0x5C, 0x58, 0x49, 0xF7, 0xD1, 0x1B, 0xF0, 0xAA, 0xF2, 0x4F, 0xA7, 0xAE, 0x42, 0xDB,
+	0xA1, 0xC7, 0xB5, 0x7B, 0xB4, 0x2B, 0x4E, 0x9E, 0xA9, 0x93, 0x53, 0x37, 0x84, 0x55, 0x8F, 0x9B,
+	0x75, 0x2F, 0x03, 0x68, 0x92, 0x5E, 0x9B, 0x9B, 0xAB, 0x30, 0x92, 0x13, 0x93, 0x91, 0x8A, 0xD6,
+	0xB5, 0x8F, 0x4F, 0xB3, 0x85, 0x60, 0x89, 0x63, 0x55, 0x51, 0x80, 0x05, 0x7A, 0x47, 0x8C, 0x61,
+	0xB2, 0xD4, 0xE6, 0x11, 0x18, 0x16, 0x3C, 0x75, 0x2B, 0xC5, 0x55, 0xD3, 0xFC, 0x05, 0xA3, 0xC9,
+	0xB2, 0x67, 0x95, 0xDB, 0xB9, 0x04, 0xD7, 0xBD, 0x84, 0xC7, 0xD4, 0xA9, 0x24, 0x9B, 0x3C, 0x7C,
+	0x46, 0x6D, 0x09, 0xBB, 0x1E, 0x35, 0xE3, 0xB5, 0x56, 0x58, 0xDE, 0x24, 0x21, 0x7B, 0x9C, 0x71,
+	0x5E, 0x81, 0xFB, 0x38, 0x79, 0x9E, 0x5D, 0xDE, 0x77, 0x6C, 0xED, 0xE9, 0x5D, 0x8F, 0x8B, 0xBC,
+	0x0B, 0x61, 0xAC, 0xE8, 0x83, 0x4F, 0xB1, 0x45, 0x8A, 0x45, 0xE5, 0x4E, 0x2B, 0x67, 0xE1, 0x9F,
+	0x83, 0x07, 0x86, 0x34, 0x9F, 0xB3, 0xBB, 0x06, 0x91, 0x8E, 0x58, 0xD7, 0xD8, 0x52, 0xCC, 0xE1,
+	0x87, 0xA7, 0xA9, 0xC6, 0xB9, 0x6B, 0x6C, 0x7F, 0xFF, 0xD9,
+};
+
+#endif /* __TEST_SW_JPEG_DATA_H */
@@ -0,0 +1,235 @@
+/*
+ * test_tlsf_heap.c
+ *
+ * tlsf_heap: alignment and placement, exhaustion and merging back to one
+ * block, realloc, the FreeRTOS heap API (the __wrap_ names the link uses)
+ * and a randomized run checking that no block overlaps another.
+ *
+ * Built with a small external arena and without the newlib entry points,
+ * malloc stays the one of the host.
+ */
+#include "tlsf_heap.h"
+#include "FreeRTOS.h"
+#include "test.h"
+#include <stdint.h>
+#include <string.h>
+
+#define STRESS_SLOTS                64U
+#define STRESS_LOOPS                200000U
+
+void *__wrap_pvPortMalloc(size_t xWantedSize);
+void __wrap_vPortFree(void *pv);
+void *__wrap_pvPortCalloc(size_t xNum, size_t xSize);
+size_t __wrap_xPortGetFreeHeapSize(void);
+size_t __wrap_xPortGetMinimumEverFreeHeapSize(void);
+void __wrap_vPortGetHeapStats(HeapStats_t *pxHeapStats);
+
+extern uint8_t ucHeap[configTOTAL_HEAP_SIZE];
+
+/* Every free byte in one block again, the free size counts its header */
+static void check_merged(tlsf_heap_tag_t tag)
+{
+	size_t largest;
+	size_t free_size = tlsf_heap_free_size(tag, &largest);
+
+	CHECK_EQ(tlsf_heap_stats.arena[tag].used, 0);
+	CHECK_EQ(free_size, tlsf_heap_stats.arena[tag].size);
+	CHECK(largest < free_size && largest + 32U >= free_size);
+}
+
+static void test_alloc_free(void)
+{
+	uint8_t *a, *b, *c;
+	uint32_t size;
+
+	a = tlsf_heap_alloc(TLSF_HEAP_INTERNAL, 1);
+	b = tlsf_heap_alloc(TLSF_HEAP_INTERNAL, 100);
+	c = tlsf_heap_alloc(TLSF_HEAP_PSRAM, 5000);
+	CHECK(a != NULL && b != NULL && c != NULL);
+	CHECK(((uintptr_t)a % 8U) == 0U && ((uintptr_t)b % 8U) == 0U && ((uintptr_t)c % 8U) == 0U);
+	CHECK(a >= ucHeap && b + 100 <= ucHeap + sizeof(ucHeap));
+	CHECK(c < ucHeap || c >= ucHeap + sizeof(ucHeap));
+	CHECK(b >= a + 8 || a >= b + 100);
+	memset(a, 0x11, 1);
+	memset(b, 0x22, 100);
+	memset(c, 0x33, 5000);
+
+	size = tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].size;
+	CHECK(size > 0 && size <= configTOTAL_HEAP_SIZE);
+	CHECK_EQ(tlsf_heap_stats.arena[TLSF_HEAP_PSRAM].size + 64U > TLSF_HEAP_PSRAM_SIZE, 1);
+	CHECK_EQ(tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].allocs, 2);
+	CHECK_EQ(tlsf_heap_stats.arena[TLSF_HEAP_PSRAM].allocs, 1);
+	CHECK(tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].used >= 108);
+
+	/* Middle first, then both sides: one block at the end */
+	tlsf_heap_free(b);
+	tlsf_heap_free(a);
+	tlsf_heap_free(c);
+	CHECK_EQ(tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].frees, 2);
+	check_merged(TLSF_HEAP_INTERNAL);
+	check_merged(TLSF_HEAP_PSRAM);
+
+	/* Ignored */
+	tlsf_heap_free(NULL);
+	tlsf_heap_free(&size);
+	CHECK(tlsf_heap_alloc(TLSF_HEAP_TAGS, 8) == NULL);
+	CHECK(tlsf_heap_alloc(TLSF_HEAP_INTERNAL, 0) == NULL);
+	check_merged(TLSF_HEAP_INTERNAL);
+}
+
+static void test_exhaustion(void)
+{
+	static void *blocks[configTOTAL_HEAP_SIZE / 32U];
+	const uint32_t failures = tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].failures;
+	uint32_t n = 0;
+	size_t largest;
+
+	CHECK(tlsf_heap_alloc(TLSF_HEAP_INTERNAL, configTOTAL_HEAP_SIZE) == NULL);
+	while (n < sizeof(blocks) / sizeof(blocks[0]) && (blocks[n] = tlsf_heap_alloc(TLSF_HEAP_INTERNAL, 48)) != NULL)
+		n++;
+	CHECK(n > configTOTAL_HEAP_SIZE / 96U);
+	CHECK(n < sizeof(blocks) / sizeof(blocks[0]));
+	CHECK_EQ(tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].failures, failures + 2U);
+	CHECK(tlsf_heap_free_size(TLSF_HEAP_INTERNAL, &largest) < 96U);
+
+	/* Every other block: free memory, all of it fragmented */
+	for (uint32_t i = 0; i < n; i += 2)
+		tlsf_heap_free(blocks[i]);
+	CHECK(tlsf_heap_free_size(TLSF_HEAP_INTERNAL, &largest) > configTOTAL_HEAP_SIZE / 4U);
+	CHECK(largest < 96U);
+	CHECK(tlsf_heap_alloc(TLSF_HEAP_INTERNAL, 200) == NULL);
+
+	for (uint32_t i = 1; i < n; i += 2)
+		tlsf_heap_free(blocks[i]);
+	check_merged(TLSF_HEAP_INTERNAL);
+	CHECK_EQ(tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].used_max + 96U > tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].size, 1);
+}
+
+static void test_realloc(void)
+{
+	uint8_t *p, *q, *big;
+
+	/* NULL allocates, with the malloc placement */
+	p = tlsf_heap_realloc(NULL, 16);
+	big = tlsf_heap_realloc(NULL, TLSF_HEAP_PSRAM_THRESHOLD);
+	CHECK(p >= ucHeap && p < ucHeap + sizeof(ucHeap));
+	CHECK(big != NULL && (big < ucHeap || big >= ucHeap + sizeof(ucHeap)));
+
+	for (uint32_t i = 0; i < 16; i++)
+		p[i] = (uint8_t)i;
+	CHECK(tlsf_heap_realloc(p, 8) == p);
+	q = tlsf_heap_realloc(p, 2000);
+	CHECK(q != NULL);
+	for (uint32_t i = 0; i < 16; i++)
+		CHECK_EQ(q[i], i);
+
+	/* Larger than the internal arena: moved to external RAM */
+	p = tlsf_heap_realloc(q, configTOTAL_HEAP_SIZE);
+	CHECK(p != NULL && (p < ucHeap || p >= ucHeap + sizeof(ucHeap)));
+	CHECK_EQ(p[15], 15);
+
+	CHECK(tlsf_heap_realloc(p, 0) == NULL);
+	CHECK(tlsf_heap_realloc(big, 0) == NULL);
+	check_merged(TLSF_HEAP_INTERNAL);
+	check_merged(TLSF_HEAP_PSRAM);
+}
+
+static void test_freertos(void)
+{
+	const size_t before = __wrap_xPortGetFreeHeapSize();
+	HeapStats_t stats;
+	uint8_t *p, *z;
+
+	p = __wrap_pvPortMalloc(1000);
+	z = __wrap_pvPortCalloc(10, 30);
+	CHECK(p >= ucHeap && p < ucHeap + sizeof(ucHeap));
+	CHECK(z != NULL);
+	for (uint32_t i = 0; i < 300; i++)
+		CHECK_EQ(z[i], 0);
+	CHECK(__wrap_pvPortCalloc(SIZE_MAX / 2U, 4) == NULL);
+	CHECK(__wrap_pvPortMalloc(configTOTAL_HEAP_SIZE) == NULL);
+
+	CHECK(__wrap_xPortGetFreeHeapSize() <= before - 1300U);
+	CHECK(__wrap_xPortGetMinimumEverFreeHeapSize() <= __wrap_xPortGetFreeHeapSize());
+
+	__wrap_vPortGetHeapStats(&stats);
+	CHECK_EQ(stats.xAvailableHeapSpaceInBytes, __wrap_xPortGetFreeHeapSize());
+	CHECK_EQ(stats.xNumberOfFreeBlocks, 1);
+	CHECK_EQ(stats.xSizeOfLargestFreeBlockInBytes, stats.xSizeOfSmallestFreeBlockInBytes);
+
+	__wrap_vPortFree(p);
+	__wrap_vPortGetHeapStats(&stats);
+	CHECK_EQ(stats.xNumberOfFreeBlocks, 2);
+	CHECK(stats.xSizeOfSmallestFreeBlockInBytes >= 1000U);
+	__wrap_vPortFree(z);
+	CHECK_EQ(__wrap_xPortGetFreeHeapSize(), before);
+	check_merged(TLSF_HEAP_INTERNAL);
+}
+
+/* Random sizes in both arenas, each block filled with its own byte */
+static void test_stress(void)
+{
+	static uint8_t *ptr[STRESS_SLOTS];
+	static uint32_t len[STRESS_SLOTS];
+	uint32_t seed = 7, failures = 0;
+
+	for (uint32_t n = 0; n < STRESS_LOOPS; n++)
+	{
+		uint32_t slot, size;
+		uint8_t *p;
+
+		seed = seed * 1103515245U + 12345U;
+		slot = (seed >> 8) % STRESS_SLOTS;
+		size = ((seed >> 16) & 3U) == 0U ? (seed >> 4) % 20000U : (seed >> 4) % 300U;
+
+		if (ptr[slot] != NULL)
+		{
+			for (uint32_t i = 0; i < len[slot]; i += 7)
+			{
+				if (ptr[slot][i] != (uint8_t)slot)
+				{
+					CHECK_EQ(ptr[slot][i], slot);
+					break;
+				}
+			}
+			if ((seed & 1U) != 0U)
+			{
+				tlsf_heap_free(ptr[slot]);
+				ptr[slot] = NULL;
+				continue;
+			}
+		}
+
+		/* A failed realloc keeps the block */
+		if (ptr[slot] != NULL)
+			p = tlsf_heap_realloc(ptr[slot], size + 1U);
+		else
+			p = tlsf_heap_alloc((size >= 4096U) ? TLSF_HEAP_PSRAM : TLSF_HEAP_INTERNAL, size + 1U);
+		if (p == NULL)
+		{
+			failures++;
+			continue;
+		}
+		ptr[slot] = p;
+		len[slot] = size + 1U;
+		memset(p, (int)slot, len[slot]);
+	}
+
+	for (uint32_t slot = 0; slot < STRESS_SLOTS; slot++)
+		tlsf_heap_free(ptr[slot]);
+	check_merged(TLSF_HEAP_INTERNAL);
+	check_merged(TLSF_HEAP_PSRAM);
+	printf("stress: %u operations, %u failed, alloc cycles max %u\n", STRESS_LOOPS, failures,
+			tlsf_heap_stats.arena[TLSF_HEAP_INTERNAL].alloc_cycles_max);
+	tlsf_heap_print();
+}
+
+int main(void)
+{
+	test_alloc_free();
+	test_exhaustion();
+	test_realloc();
+	test_freertos();
+	test_stress();
+	TEST_EXIT();
+}
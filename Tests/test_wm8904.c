@@ -0,0 +1,230 @@
+/*
+ * test_wm8904.c
+ *
+ * WM8904 register shadow over i2c_bus and the host bus: the codec ends up
+ * with the registers the driver believes it has, cached reads and skipped
+ * writes stay off the bus, WM8904_ApplyProfile sends one batch, volatile
+ * registers and failed flushes go back to the codec.
+ */
+#include "wm8904.h"
+#include "i2c_bus.h"
+#include "i2c_mock.h"
+#include "test.h"
+#include <string.h>
+
+#define CODEC_ADDR                  0x34U
+
+static I2C_HandleTypeDef hi2c;
+static WM8904_Object_t codec;
+static int32_t tick;
+
+static int32_t io_init(void)
+{
+	return 0;
+}
+
+/* Every call advances a millisecond, the delays of the driver end at once */
+static int32_t io_tick(void)
+{
+	return tick++;
+}
+
+static void attach(int batch)
+{
+	WM8904_IO_t io;
+
+	memset(&codec, 0, sizeof(codec));
+	memset(&io, 0, sizeof(io));
+	io.Init = io_init;
+	io.DeInit = io_init;
+	io.Address = CODEC_ADDR;
+	io.WriteReg = i2c_bus_codec_write;
+	io.ReadReg = i2c_bus_codec_read;
+	io.GetTick = io_tick;
+	io.WriteBatch = batch ? i2c_bus_codec_batch : NULL;
+	CHECK_EQ(WM8904_RegisterBusIO(&codec, &io), WM8904_OK);
+}
+
+static void init_headphone(void)
+{
+	WM8904_Init_t init = {
+		.InputDevice = WM8904_IN_NONE,
+		.OutputDevice = WM8904_OUT_HEADPHONE,
+		.Frequency = WM8904_FREQUENCY_44K,
+		.Resolution = WM8904_RESOLUTION_16B,
+		.Volume = 50,
+	};
+
+	/* DC servo start-up done at the first poll */
+	i2c_mock.regs[WM8904_DC_SERVO_READBACK0] = 0x0003U;
+	CHECK_EQ(WM8904_Init(&codec, &init), WM8904_OK);
+}
+
+/* Every register the shadow holds is what the codec holds */
+static void check_shadow(void)
+{
+	for (uint32_t reg = 0; reg < WM8904_REG_COUNT; reg++)
+	{
+		if ((codec.ShadowValid[reg / 32U] & (1UL << (reg % 32U))) != 0U)
+			CHECK_EQ(codec.Shadow[reg], i2c_mock.regs[reg]);
+	}
+}
+
+/* Same codec state with and without WriteBatch, fewer queue entries with it */
+static void test_init(void)
+{
+	uint16_t regs[WM8904_REG_COUNT];
+	uint32_t writes, entries;
+
+	i2c_mock_reset();
+	i2c_bus_reset();
+	attach(0);
+	init_headphone();
+	check_shadow();
+	memcpy(regs, i2c_mock.regs, sizeof(regs));
+	writes = i2c_mock.txns;
+	entries = i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].transfers;
+	CHECK_EQ(entries, writes);
+
+	i2c_mock_reset();
+	i2c_bus_reset();
+	attach(1);
+	init_headphone();
+	check_shadow();
+	CHECK(memcmp(regs, i2c_mock.regs, sizeof(regs)) == 0);
+	CHECK_EQ(i2c_mock.txns, writes);
+	CHECK_EQ(codec.Stats.BusWrites + codec.Stats.BusReads, writes);
+	CHECK_EQ(i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].transfers,
+			codec.Stats.Flushes + codec.Stats.BusReads + 1U);  /* + the reset */
+	CHECK(i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].transfers < entries / 3U);
+	printf("init: %lu writes, %lu queue entries -> %lu\n", (unsigned long)writes, (unsigned long)entries,
+			(unsigned long)i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].transfers);
+}
+
+static void test_cached_calls(void)
+{
+	uint8_t volume;
+	uint32_t txns, value;
+
+	/* Read-modify-write from the shadow, one write per change. Init leaves the DAC muted */
+	txns = i2c_mock.txns;
+	CHECK_EQ(WM8904_SetMute(&codec, WM8904_MUTE_ON), WM8904_OK);
+	CHECK_EQ(i2c_mock.txns, txns);
+	CHECK_EQ(WM8904_SetMute(&codec, WM8904_MUTE_OFF), WM8904_OK);
+	CHECK_EQ(i2c_mock.txns, txns + 1U);
+	CHECK_EQ(i2c_mock.log[txns].reg, WM8904_DAC_DIGITAL1);
+	CHECK((i2c_mock.regs[WM8904_DAC_DIGITAL1] & 0x0008U) == 0U);
+	CHECK_EQ(WM8904_SetMute(&codec, WM8904_MUTE_ON), WM8904_OK);
+	CHECK_EQ(i2c_mock.txns, txns + 2U);
+	CHECK((i2c_mock.regs[WM8904_DAC_DIGITAL1] & 0x0008U) != 0U);
+
+	/* Served by the shadow */
+	txns = i2c_mock.txns;
+	CHECK_EQ(WM8904_GetVolume(&codec, VOLUME_OUTPUT, &volume), WM8904_OK);
+	CHECK_EQ(WM8904_GetFrequency(&codec, &value), WM8904_OK);
+	CHECK_EQ(value, WM8904_FREQUENCY_44K);
+	CHECK_EQ(WM8904_GetProtocol(&codec, &value), WM8904_OK);
+	CHECK_EQ(value, WM8904_PROTOCOL_I2S);
+	CHECK_EQ(i2c_mock.txns, txns);
+
+	/* Both sides written when the volume changes, nothing when it does not */
+	CHECK_EQ(WM8904_SetVolume(&codec, VOLUME_OUTPUT, 80), WM8904_OK);
+	CHECK_EQ(i2c_mock.txns, txns + 2U);
+	CHECK_EQ(i2c_mock.log[txns].reg, WM8904_ANALOG_OUTPUT1_LEFT);
+	CHECK_EQ(i2c_mock.log[txns + 1U].reg, WM8904_ANALOG_OUTPUT1_RIGHT);
+	CHECK_EQ(WM8904_SetVolume(&codec, VOLUME_OUTPUT, 80), WM8904_OK);
+	CHECK_EQ(i2c_mock.txns, txns + 2U);
+	check_shadow();
+
+	/* The ID register is volatile */
+	i2c_mock.regs[WM8904_SW_RESET] = WM8904_ID;
+	CHECK_EQ(WM8904_ReadID(&codec, &value), WM8904_OK);
+	CHECK_EQ(value, WM8904_ID);
+	CHECK_EQ(WM8904_ReadID(&codec, &value), WM8904_OK);
+	CHECK_EQ(i2c_mock.txns, txns + 4U);
+}
+
+static void test_profile(void)
+{
+	static const WM8904_Reg_t profile[] = {
+		{ WM8904_DRC0, 0x81AFU },
+		{ WM8904_DRC1, 0x3248U },
+		{ WM8904_DRC2, 0x0000U },
+		{ WM8904_DRC0, 0x01AFU },           /* Written again, last value wins */
+	};
+	const uint32_t flushes = codec.Stats.Flushes;
+	const uint32_t entries = i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].transfers;
+	uint32_t txns = i2c_mock.txns;
+
+	CHECK_EQ(WM8904_ApplyProfile(&codec, profile, 4), WM8904_OK);
+	CHECK_EQ(codec.Stats.Flushes, flushes + 1U);
+	CHECK_EQ(i2c_bus_stats.client[I2C_BUS_CLIENT_CODEC].transfers, entries + 1U);
+	CHECK_EQ(i2c_mock.txns, txns + 4U);
+	CHECK_EQ(i2c_mock.log[txns].reg, WM8904_DRC0);
+	CHECK_EQ(i2c_mock.log[txns + 3U].reg, WM8904_DRC0);
+	CHECK_EQ(i2c_mock.regs[WM8904_DRC0], 0x01AFU);
+	CHECK_EQ(i2c_mock.regs[WM8904_DRC1], 0x3248U);
+	check_shadow();
+
+	/* The codec holds all of it, only the register that differs is sent */
+	txns = i2c_mock.txns;
+	CHECK_EQ(WM8904_ApplyProfile(&codec, &profile[1], 3), WM8904_OK);
+	CHECK_EQ(i2c_mock.txns, txns);
+	CHECK_EQ(WM8904_ApplyProfile(&codec, profile, 3), WM8904_OK);
+	CHECK_EQ(i2c_mock.txns, txns + 1U);
+	CHECK_EQ(i2c_mock.log[txns].reg, WM8904_DRC0);
+	CHECK_EQ(WM8904_ApplyProfile(&codec, profile, 0), WM8904_OK);
+	check_shadow();
+}
+
+static void test_invalidation(void)
+{
+	static const WM8904_Reg_t profile[] = {
+		{ WM8904_DRC1, 0x1111U },
+		{ WM8904_DRC2, 0x2222U },
+		{ WM8904_DRC3, 0x3333U },
+	};
+	uint32_t reads, txns;
+	uint8_t volume;
+
+	/* The second write fails: nothing of the batch is trusted afterwards */
+	txns = i2c_mock.txns;
+	i2c_mock_fail(txns + 1U, I2C_MOCK_NACK);
+	CHECK(WM8904_ApplyProfile(&codec, profile, 3) != WM8904_OK);
+	CHECK_EQ(i2c_mock.regs[WM8904_DRC1], 0x1111U);
+	CHECK(i2c_mock.regs[WM8904_DRC2] != 0x2222U);
+	for (uint32_t i = 0; i < 3; i++)
+		CHECK((codec.ShadowValid[profile[i].Reg / 32U] & (1UL << (profile[i].Reg % 32U))) == 0U);
+	i2c_mock_fail(0, I2C_MOCK_OK);
+
+	/* Rewritten in full, the codec may have any of them */
+	txns = i2c_mock.txns;
+	CHECK_EQ(WM8904_ApplyProfile(&codec, profile, 3), WM8904_OK);
+	CHECK_EQ(i2c_mock.txns, txns + 3U);
+	check_shadow();
+
+	/* External change: the next read goes to the codec */
+	i2c_mock.regs[WM8904_ANALOG_OUTPUT1_LEFT] = 0x0020U;
+	WM8904_InvalidateCache(&codec);
+	reads = codec.Stats.BusReads;
+	CHECK_EQ(WM8904_GetVolume(&codec, VOLUME_OUTPUT, &volume), WM8904_OK);
+	CHECK_EQ(codec.Stats.BusReads, reads + 1U);
+	CHECK_EQ(codec.Shadow[WM8904_ANALOG_OUTPUT1_LEFT], 0x0020U);
+	CHECK_EQ(WM8904_GetVolume(&codec, VOLUME_OUTPUT, &volume), WM8904_OK);
+	CHECK_EQ(codec.Stats.BusReads, reads + 1U);
+
+	/* A software reset forgets everything */
+	CHECK_EQ(WM8904_Reset(&codec), WM8904_OK);
+	for (uint32_t i = 0; i < WM8904_REG_COUNT / 32U; i++)
+		CHECK_EQ(codec.ShadowValid[i], 0);
+}
+
+int main(void)
+{
+	CHECK_EQ(i2c_bus_init(&hi2c), I2C_BUS_OK);
+	test_init();
+	test_cached_calls();
+	test_profile();
+	test_invalidation();
+	TEST_EXIT();
+}